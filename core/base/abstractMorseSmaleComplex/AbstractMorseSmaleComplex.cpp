@@ -10,7 +10,7 @@ AbstractMorseSmaleComplex::AbstractMorseSmaleComplex()
     ComputeAscendingSeparatrices1{true}, ComputeDescendingSeparatrices1{true},
     ComputeSaddleConnectors{false}, ComputeAscendingSeparatrices2{false},
     ComputeDescendingSeparatrices2{false}, ReturnSaddleConnectors{false},
-    PrioritizeSpeedOverMemory{false},
+    PrioritizeSpeedOverMemory{false}, PointerJumpingSegmentation{true},
 
     // other class members are value-initialized
     inputScalarField_{}, inputTriangulation_{}, inputOffsets_{},
@@ -46,6 +46,8 @@ AbstractMorseSmaleComplex::AbstractMorseSmaleComplex()
     outputSeparatrices2_cells_separatrixFunctionDiffs_{},
     outputSeparatrices2_cells_isOnBoundary_{},
 
+    separatrices2Sink_{}, separatrices2BatchSize_{65536},
+
     outputAscendingManifold_{}, outputDescendingManifold_{},
     outputMorseSmaleManifold_{} {
   discreteGradient_.setReverseSaddleMaximumConnection(true);
@@ -136,50 +138,102 @@ int AbstractMorseSmaleComplex::setAscendingSegmentation(
   const SimplexId numberOfSeeds = maxSeeds.size();
   numberOfMaxima = numberOfSeeds;
 
+  if(PointerJumpingSegmentation) {
+    // successor of each cell along the ascending V-paths: through its
+    // paired facet, into the other cofacet of that facet
+    vector<SimplexId> successors(numberOfCells);
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < numberOfSeeds; ++i) {
-    queue<SimplexId> bfs;
+    for(SimplexId i = 0; i < numberOfCells; ++i) {
+      const SimplexId facetId
+        = discreteGradient_.getPairedCell(Cell(cellDim, i), true);
+      // maxima are the roots
+      if(facetId == -1) {
+        successors[i] = i;
+        continue;
+      }
 
-    // push the seed
-    {
-      const SimplexId seedId = maxSeeds[i];
-      bfs.push(seedId);
+      // no successor through a boundary facet
+      successors[i] = -1;
+
+      SimplexId starNumber = 0;
+      if(cellDim == 2)
+        starNumber = inputTriangulation_->getEdgeStarNumber(facetId);
+      else if(cellDim == 3)
+        starNumber = inputTriangulation_->getTriangleStarNumber(facetId);
+      for(SimplexId k = 0; k < starNumber; ++k) {
+        SimplexId neighborId = -1;
+        if(cellDim == 2)
+          inputTriangulation_->getEdgeStar(facetId, k, neighborId);
+        else if(cellDim == 3)
+          inputTriangulation_->getTriangleStar(facetId, k, neighborId);
+        if(neighborId != i)
+          successors[i] = neighborId;
+      }
     }
 
-    // BFS traversal
-    while(!bfs.empty()) {
-      const SimplexId cofacetId = bfs.front();
-      bfs.pop();
-
-      if(morseSmaleManifoldOnCells[cofacetId] == -1) {
-        morseSmaleManifoldOnCells[cofacetId] = i;
-
-        for(int j = 0; j < (cellDim + 1); ++j) {
-          SimplexId facetId = -1;
-          if(cellDim == 2)
-            inputTriangulation_->getCellEdge(cofacetId, j, facetId);
-          else if(cellDim == 3)
-            inputTriangulation_->getCellTriangle(cofacetId, j, facetId);
-
-          SimplexId starNumber = 0;
-          if(cellDim == 2)
-            starNumber = inputTriangulation_->getEdgeStarNumber(facetId);
-          else if(cellDim == 3)
-            starNumber = inputTriangulation_->getTriangleStarNumber(facetId);
-          for(SimplexId k = 0; k < starNumber; ++k) {
-            SimplexId neighborId = -1;
+    jumpPointers(successors);
+
+    // maxima ids
+    for(SimplexId i = 0; i < numberOfSeeds; ++i)
+      morseSmaleManifoldOnCells[maxSeeds[i]] = i;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < numberOfCells; ++i) {
+      const SimplexId root = successors[i];
+      if(root != -1 and root != i)
+        morseSmaleManifoldOnCells[i] = morseSmaleManifoldOnCells[root];
+    }
+  } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < numberOfSeeds; ++i) {
+      queue<SimplexId> bfs;
+
+      // push the seed
+      {
+        const SimplexId seedId = maxSeeds[i];
+        bfs.push(seedId);
+      }
+
+      // BFS traversal
+      while(!bfs.empty()) {
+        const SimplexId cofacetId = bfs.front();
+        bfs.pop();
+
+        if(morseSmaleManifoldOnCells[cofacetId] == -1) {
+          morseSmaleManifoldOnCells[cofacetId] = i;
+
+          for(int j = 0; j < (cellDim + 1); ++j) {
+            SimplexId facetId = -1;
             if(cellDim == 2)
-              inputTriangulation_->getEdgeStar(facetId, k, neighborId);
+              inputTriangulation_->getCellEdge(cofacetId, j, facetId);
             else if(cellDim == 3)
-              inputTriangulation_->getTriangleStar(facetId, k, neighborId);
+              inputTriangulation_->getCellTriangle(cofacetId, j, facetId);
 
-            const SimplexId pairedCellId = discreteGradient_.getPairedCell(
-              Cell(cellDim, neighborId), true);
-
-            if(pairedCellId == facetId)
-              bfs.push(neighborId);
+            SimplexId starNumber = 0;
+            if(cellDim == 2)
+              starNumber = inputTriangulation_->getEdgeStarNumber(facetId);
+            else if(cellDim == 3)
+              starNumber
+                = inputTriangulation_->getTriangleStarNumber(facetId);
+            for(SimplexId k = 0; k < starNumber; ++k) {
+              SimplexId neighborId = -1;
+              if(cellDim == 2)
+                inputTriangulation_->getEdgeStar(facetId, k, neighborId);
+              else if(cellDim == 3)
+                inputTriangulation_->getTriangleStar(facetId, k, neighborId);
+
+              const SimplexId pairedCellId = discreteGradient_.getPairedCell(
+                Cell(cellDim, neighborId), true);
+
+              if(pairedCellId == facetId)
+                bfs.push(neighborId);
+            }
           }
         }
       }
@@ -199,6 +253,33 @@ int AbstractMorseSmaleComplex::setAscendingSegmentation(
   return 0;
 }
 
+int AbstractMorseSmaleComplex::jumpPointers(
+  vector<SimplexId> &successors) const {
+  const SimplexId numberOfCells = successors.size();
+  vector<SimplexId> nextSuccessors(numberOfCells);
+
+  // double the length of the jumps until every chain points to its root (or
+  // to -1), reading from one buffer and writing to the other
+  bool hasChanged = true;
+  while(hasChanged) {
+    hasChanged = false;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasChanged)
+#endif
+    for(SimplexId i = 0; i < numberOfCells; ++i) {
+      const SimplexId successor = successors[i];
+      nextSuccessors[i] = successor;
+      if(successor != -1 and successors[successor] != successor) {
+        nextSuccessors[i] = successors[successor];
+        hasChanged = true;
+      }
+    }
+    successors.swap(nextSuccessors);
+  }
+
+  return 0;
+}
+
 int AbstractMorseSmaleComplex::setDescendingSegmentation(
   const vector<Cell> &criticalPoints,
   SimplexId *const morseSmaleManifold,
@@ -218,41 +299,78 @@ int AbstractMorseSmaleComplex::setDescendingSegmentation(
   const SimplexId numberOfSeeds = seeds.size();
   numberOfMinima = numberOfSeeds;
 
+  if(PointerJumpingSegmentation) {
+    // successor of each vertex along the descending V-paths: the other
+    // vertex of its paired edge
+    vector<SimplexId> successors(numberOfVertices);
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < numberOfSeeds; ++i) {
-    queue<SimplexId> bfs;
+    for(SimplexId i = 0; i < numberOfVertices; ++i) {
+      const SimplexId edgeId = discreteGradient_.getPairedCell(Cell(0, i));
 
-    // push the seed
-    {
-      const SimplexId seedId = seeds[i];
-      bfs.push(seedId);
+      // minima are the roots
+      if(edgeId == -1) {
+        successors[i] = i;
+        continue;
+      }
+
+      inputTriangulation_->getEdgeVertex(edgeId, 0, successors[i]);
+      if(successors[i] == i)
+        inputTriangulation_->getEdgeVertex(edgeId, 1, successors[i]);
     }
 
-    // BFS traversal
-    while(!bfs.empty()) {
-      const SimplexId vertexId = bfs.front();
-      bfs.pop();
+    jumpPointers(successors);
+
+    // minima ids
+    for(SimplexId i = 0; i < numberOfSeeds; ++i)
+      morseSmaleManifold[seeds[i]] = i;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < numberOfVertices; ++i) {
+      const SimplexId root = successors[i];
+      if(root != i)
+        morseSmaleManifold[i] = morseSmaleManifold[root];
+    }
+  } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < numberOfSeeds; ++i) {
+      queue<SimplexId> bfs;
+
+      // push the seed
+      {
+        const SimplexId seedId = seeds[i];
+        bfs.push(seedId);
+      }
+
+      // BFS traversal
+      while(!bfs.empty()) {
+        const SimplexId vertexId = bfs.front();
+        bfs.pop();
 
-      if(morseSmaleManifold[vertexId] == -1) {
-        morseSmaleManifold[vertexId] = i;
+        if(morseSmaleManifold[vertexId] == -1) {
+          morseSmaleManifold[vertexId] = i;
 
-        const SimplexId edgeNumber
-          = inputTriangulation_->getVertexEdgeNumber(vertexId);
-        for(SimplexId j = 0; j < edgeNumber; ++j) {
-          SimplexId edgeId;
-          inputTriangulation_->getVertexEdge(vertexId, j, edgeId);
+          const SimplexId edgeNumber
+            = inputTriangulation_->getVertexEdgeNumber(vertexId);
+          for(SimplexId j = 0; j < edgeNumber; ++j) {
+            SimplexId edgeId;
+            inputTriangulation_->getVertexEdge(vertexId, j, edgeId);
 
-          for(int k = 0; k < 2; ++k) {
-            SimplexId neighborId;
-            inputTriangulation_->getEdgeVertex(edgeId, k, neighborId);
+            for(int k = 0; k < 2; ++k) {
+              SimplexId neighborId;
+              inputTriangulation_->getEdgeVertex(edgeId, k, neighborId);
 
-            const SimplexId pairedCellId
-              = discreteGradient_.getPairedCell(Cell(0, neighborId));
+              const SimplexId pairedCellId
+                = discreteGradient_.getPairedCell(Cell(0, neighborId));
 
-            if(pairedCellId == edgeId)
-              bfs.push(neighborId);
+              if(pairedCellId == edgeId)
+                bfs.push(neighborId);
+            }
           }
         }
       }
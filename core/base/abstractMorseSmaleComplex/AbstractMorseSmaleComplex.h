@@ -20,6 +20,7 @@
 #include <Triangulation.h>
 #include <Wrapper.h>
 
+#include <functional>
 #include <queue>
 
 namespace ttk {
@@ -107,6 +108,69 @@ namespace ttk {
     std::vector<SimplexId> geometry_;
   };
 
+  /**
+   * Batch of 2-separatrix geometry handed to a Separatrices2Sink. Each point
+   * is emitted once, in increasing identifier order starting from
+   * firstPointId_, and the polygons refer to the points by these global
+   * identifiers: the batches can be appended one after the other.
+   */
+  struct Separatrices2Batch {
+    /**
+     * Identifier of the first point of the batch.
+     */
+    SimplexId firstPointId_{};
+
+    /**
+     * Point coordinates (3 per point).
+     */
+    std::vector<float> points_;
+
+    /**
+     * Polygons: number of vertices followed by the point identifiers.
+     */
+    std::vector<SimplexId> cells_;
+
+    /**
+     * Cell data, see setOutputSeparatrices2() (function values are
+     * converted to double).
+     */
+    std::vector<SimplexId> cells_sourceIds_;
+    std::vector<SimplexId> cells_separatrixIds_;
+    std::vector<char> cells_separatrixTypes_;
+    std::vector<double> cells_separatrixFunctionMaxima_;
+    std::vector<double> cells_separatrixFunctionMinima_;
+    std::vector<double> cells_separatrixFunctionDiffs_;
+    std::vector<char> cells_isOnBoundary_;
+
+    inline SimplexId getNumberOfPoints() const {
+      return points_.size() / 3;
+    }
+
+    inline SimplexId getNumberOfCells() const {
+      return cells_sourceIds_.size();
+    }
+
+    /**
+     * Empty the batch (the capacities are kept for the next batch).
+     */
+    void clear() {
+      points_.clear();
+      cells_.clear();
+      cells_sourceIds_.clear();
+      cells_separatrixIds_.clear();
+      cells_separatrixTypes_.clear();
+      cells_separatrixFunctionMaxima_.clear();
+      cells_separatrixFunctionMinima_.clear();
+      cells_separatrixFunctionDiffs_.clear();
+      cells_isOnBoundary_.clear();
+    }
+  };
+
+  /**
+   * Consumer of the batches of 2-separatrix geometry, returning 0 on success.
+   */
+  using Separatrices2Sink = std::function<int(const Separatrices2Batch &)>;
+
   /**
    * Parent class containing convenience functions shared between
    * Morse-Smale Complex algorithms for 2D and 3D domains.
@@ -223,6 +287,35 @@ namespace ttk {
       return 0;
     }
 
+    /**
+     * Enable/Disable the computation of the ascending and descending
+     * segmentations by pointer jumping (enabled by default) instead of one
+     * BFS per extremum. Both give the same result, the former being
+     * insensitive to the imbalance of the manifold sizes.
+     */
+    int setPointerJumpingSegmentation(const bool state) {
+      PointerJumpingSegmentation = state;
+      return 0;
+    }
+
+    /**
+     * Enable/Disable the construction of the discrete gradient by lower
+     * stars (see dcg::DiscreteGradient::setLowerStarGradient()).
+     */
+    int setLowerStarGradient(const bool state) {
+      discreteGradient_.setLowerStarGradient(state);
+      return 0;
+    }
+
+    /**
+     * Enable/Disable the compact (one byte per cell) storage of the
+     * discrete gradient (requires the lower star gradient).
+     */
+    int setCompactGradient(const bool state) {
+      discreteGradient_.setCompactGradient(state);
+      return 0;
+    }
+
     /**
      * Set the input triangulation and preprocess the needed
      * mesh traversal queries.
@@ -370,6 +463,25 @@ namespace ttk {
       return 0;
     }
 
+    /**
+     * Stream the 2-separatrices (3D only) to \p sink in batches of
+     * \p batchSize polygons, wall after wall, instead of storing them all in
+     * the output 2-separatrices buffers. The peak memory then no longer
+     * depends on the size of the output. An empty sink restores the regular
+     * output. The sink is ignored (and never called) on 2D data-sets, which
+     * have no 2-separatrices.
+     */
+    inline int setSeparatrices2Sink(const Separatrices2Sink &sink,
+                                    const SimplexId batchSize = 65536) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(batchSize < 1)
+        return -1;
+#endif
+      separatrices2Sink_ = sink;
+      separatrices2BatchSize_ = batchSize;
+      return 0;
+    }
+
     /**
      * Set the data pointers to the output segmentation scalar fields.
      */
@@ -413,6 +525,13 @@ namespace ttk {
                                  SimplexId *const morseSmaleManifold,
                                  SimplexId &numberOfMaxima) const;
 
+    /**
+     * Replace in parallel each successor of \p successors (-1 if none, the
+     * cell itself for a root) by the root of its chain, by pointer jumping
+     * (path doubling): O(log(L)) parallel passes for chains of length L.
+     */
+    int jumpPointers(std::vector<SimplexId> &successors) const;
+
     /**
      * Compute the descending manifold of the minima.
      */
@@ -441,6 +560,7 @@ namespace ttk {
     bool ReturnSaddleConnectors;
     double SaddleConnectorsPersistenceThreshold;
     bool PrioritizeSpeedOverMemory;
+    bool PointerJumpingSegmentation;
 
     dcg::DiscreteGradient discreteGradient_;
 
@@ -485,6 +605,9 @@ namespace ttk {
     void *outputSeparatrices2_cells_separatrixFunctionDiffs_;
     std::vector<char> *outputSeparatrices2_cells_isOnBoundary_;
 
+    Separatrices2Sink separatrices2Sink_;
+    SimplexId separatrices2BatchSize_;
+
     void *outputAscendingManifold_;
     void *outputDescendingManifold_;
     void *outputMorseSmaleManifold_;
@@ -60,17 +60,11 @@ int AbstractTriangulation::clear() {
   return 0;
 }
 
-template <class itemType>
-size_t AbstractTriangulation::tableTableFootprint(
-  const vector<vector<itemType>> &table,
-  const string tableName,
-  stringstream *msg) const {
+size_t AbstractTriangulation::tableTableFootprint(const FlatJaggedArray &table,
+                                                  const string tableName,
+                                                  stringstream *msg) const {
 
-  size_t localByteNumber = 0;
-
-  for(size_t i = 0; i < table.size(); i++) {
-    localByteNumber += table[i].size() * sizeof(itemType);
-  }
+  const size_t localByteNumber = table.footprint();
 
   if((localByteNumber) && (tableName.length()) && (msg)) {
     (*msg) << "[AbstractTriangulation] " << tableName << ": " << localByteNumber
@@ -91,49 +85,38 @@ size_t AbstractTriangulation::footprint() const {
 
   size += tableFootprint<bool>(boundaryVertices_, "boundaryVertices_", &msg);
 
-  size += tableTableFootprint<SimplexId>(cellEdgeList_, "cellEdgeList_", &msg);
+  size += tableTableFootprint(cellEdgeList_, "cellEdgeList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    cellNeighborList_, "cellNeighborList_", &msg);
+  size += tableTableFootprint(cellNeighborList_, "cellNeighborList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    cellTriangleList_, "cellTriangleList_", &msg);
+  size += tableTableFootprint(cellTriangleList_, "cellTriangleList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(edgeLinkList_, "edgeLinkList_", &msg);
+  size += tableTableFootprint(edgeLinkList_, "edgeLinkList_", &msg);
 
   size
     += tableFootprint<pair<SimplexId, SimplexId>>(edgeList_, "edgeList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(edgeStarList_, "edgeStarList_", &msg);
+  size += tableTableFootprint(edgeStarList_, "edgeStarList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    edgeTriangleList_, "edgeTriangleList_", &msg);
+  size += tableTableFootprint(edgeTriangleList_, "edgeTriangleList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(triangleList_, "triangleList_", &msg);
+  size += tableTableFootprint(triangleList_, "triangleList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    triangleEdgeList_, "triangleEdgeList_", &msg);
+  size += tableTableFootprint(triangleEdgeList_, "triangleEdgeList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    triangleLinkList_, "triangleLinkList_", &msg);
+  size += tableTableFootprint(triangleLinkList_, "triangleLinkList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    triangleStarList_, "triangleStarList_", &msg);
+  size += tableTableFootprint(triangleStarList_, "triangleStarList_", &msg);
 
-  size
-    += tableTableFootprint<SimplexId>(vertexEdgeList_, "vertexEdgeList_", &msg);
+  size += tableTableFootprint(vertexEdgeList_, "vertexEdgeList_", &msg);
 
-  size
-    += tableTableFootprint<SimplexId>(vertexLinkList_, "vertexLinkList_", &msg);
+  size += tableTableFootprint(vertexLinkList_, "vertexLinkList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    vertexNeighborList_, "vertexNeighborList_", &msg);
+  size += tableTableFootprint(vertexNeighborList_, "vertexNeighborList_", &msg);
 
-  size
-    += tableTableFootprint<SimplexId>(vertexStarList_, "vertexStarList_", &msg);
+  size += tableTableFootprint(vertexStarList_, "vertexStarList_", &msg);
 
-  size += tableTableFootprint<SimplexId>(
-    vertexTriangleList_, "vertexTriangleList_", &msg);
+  size += tableTableFootprint(vertexTriangleList_, "vertexTriangleList_", &msg);
 
   msg << "[AbstractTriangulation] Total footprint: " << (size / 1024) / 1024
       << " MB." << endl;
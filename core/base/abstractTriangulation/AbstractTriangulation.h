@@ -13,6 +13,7 @@
 #define _ABSTRACTTRIANGULATION_H
 
 // base code includes
+#include <FlatJaggedArray.h>
 #include <Geometry.h>
 #include <Wrapper.h>
 
@@ -35,7 +36,7 @@ namespace ttk {
 
     virtual SimplexId getCellEdgeNumber(const SimplexId &cellId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getCellEdges() = 0;
+    virtual const FlatJaggedArray *getCellEdges() = 0;
 
     virtual int getCellNeighbor(const SimplexId &cellId,
                                 const int &localNeighborId,
@@ -43,7 +44,7 @@ namespace ttk {
 
     virtual SimplexId getCellNeighborNumber(const SimplexId &cellId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getCellNeighbors() = 0;
+    virtual const FlatJaggedArray *getCellNeighbors() = 0;
 
     virtual int getCellTriangle(const SimplexId &cellId,
                                 const int &localTriangleId,
@@ -51,7 +52,7 @@ namespace ttk {
 
     virtual SimplexId getCellTriangleNumber(const SimplexId &cellId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getCellTriangles() = 0;
+    virtual const FlatJaggedArray *getCellTriangles() = 0;
 
     virtual int getCellVertex(const SimplexId &cellId,
                               const int &localVertexId,
@@ -69,7 +70,7 @@ namespace ttk {
 
     virtual SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getEdgeLinks() = 0;
+    virtual const FlatJaggedArray *getEdgeLinks() = 0;
 
     virtual int getEdgeStar(const SimplexId &edgeId,
                             const int &localStarId,
@@ -77,7 +78,7 @@ namespace ttk {
 
     virtual SimplexId getEdgeStarNumber(const SimplexId &edgeId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getEdgeStars() = 0;
+    virtual const FlatJaggedArray *getEdgeStars() = 0;
 
     virtual int getEdgeTriangle(const SimplexId &edgeId,
                                 const int &localTriangleId,
@@ -85,7 +86,7 @@ namespace ttk {
 
     virtual SimplexId getEdgeTriangleNumber(const SimplexId &edgeId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getEdgeTriangles() = 0;
+    virtual const FlatJaggedArray *getEdgeTriangles() = 0;
 
     virtual int getEdgeVertex(const SimplexId &edgeId,
                               const int &localVertexId,
@@ -99,7 +100,7 @@ namespace ttk {
 
     virtual SimplexId getNumberOfVertices() const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangles() = 0;
+    virtual const FlatJaggedArray *getTriangles() = 0;
 
     virtual int getTriangleEdge(const SimplexId &triangleId,
                                 const int &localEdgeId,
@@ -108,7 +109,7 @@ namespace ttk {
     virtual SimplexId
       getTriangleEdgeNumber(const SimplexId &triangleId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangleEdges() = 0;
+    virtual const FlatJaggedArray *getTriangleEdges() = 0;
 
     virtual int getTriangleLink(const SimplexId &triangleId,
                                 const int &localLinkId,
@@ -117,7 +118,7 @@ namespace ttk {
     virtual SimplexId
       getTriangleLinkNumber(const SimplexId &triangleId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangleLinks() = 0;
+    virtual const FlatJaggedArray *getTriangleLinks() = 0;
 
     virtual int getTriangleStar(const SimplexId &triangleId,
                                 const int &localStarId,
@@ -126,7 +127,7 @@ namespace ttk {
     virtual SimplexId
       getTriangleStarNumber(const SimplexId &triangleId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangleStars() = 0;
+    virtual const FlatJaggedArray *getTriangleStars() = 0;
 
     virtual int getTriangleVertex(const SimplexId &triangleId,
                                   const int &localVertexId,
@@ -138,7 +139,7 @@ namespace ttk {
 
     virtual SimplexId getVertexEdgeNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexEdges() = 0;
+    virtual const FlatJaggedArray *getVertexEdges() = 0;
 
     virtual int getVertexLink(const SimplexId &vertexId,
                               const int &localLinkId,
@@ -146,7 +147,7 @@ namespace ttk {
 
     virtual SimplexId getVertexLinkNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexLinks() = 0;
+    virtual const FlatJaggedArray *getVertexLinks() = 0;
 
     virtual int getVertexNeighbor(const SimplexId &vertexId,
                                   const int &localNeighborId,
@@ -155,7 +156,7 @@ namespace ttk {
     virtual SimplexId
       getVertexNeighborNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexNeighbors() = 0;
+    virtual const FlatJaggedArray *getVertexNeighbors() = 0;
 
     virtual int getVertexPoint(const SimplexId &vertexId,
                                float &x,
@@ -168,7 +169,7 @@ namespace ttk {
 
     virtual SimplexId getVertexStarNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexStars() = 0;
+    virtual const FlatJaggedArray *getVertexStars() = 0;
 
     virtual int getVertexTriangle(const SimplexId &vertexId,
                                   const int &localTriangleId,
@@ -177,7 +178,7 @@ namespace ttk {
     virtual SimplexId
       getVertexTriangleNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexTriangles() = 0;
+    virtual const FlatJaggedArray *getVertexTriangles() = 0;
 
     virtual inline bool hasPreprocessedBoundaryEdges() const {
       return hasPreprocessedBoundaryEdges_;
@@ -496,8 +497,7 @@ namespace ttk {
       return table.size() * sizeof(itemType);
     }
 
-    template <class itemType>
-    size_t tableTableFootprint(const std::vector<std::vector<itemType>> &table,
+    size_t tableTableFootprint(const FlatJaggedArray &table,
                                const std::string tableName = "",
                                std::stringstream *msg = NULL) const;
 
@@ -517,22 +517,22 @@ namespace ttk {
       hasPreprocessedVertexTriangles_;
 
     std::vector<bool> boundaryEdges_, boundaryTriangles_, boundaryVertices_;
-    std::vector<std::vector<SimplexId>> cellEdgeList_;
-    std::vector<std::vector<SimplexId>> cellNeighborList_;
-    std::vector<std::vector<SimplexId>> cellTriangleList_;
-    std::vector<std::vector<SimplexId>> edgeLinkList_;
+    FlatJaggedArray cellEdgeList_;
+    FlatJaggedArray cellNeighborList_;
+    FlatJaggedArray cellTriangleList_;
+    FlatJaggedArray edgeLinkList_;
     std::vector<std::pair<SimplexId, SimplexId>> edgeList_;
-    std::vector<std::vector<SimplexId>> edgeStarList_;
-    std::vector<std::vector<SimplexId>> edgeTriangleList_;
-    std::vector<std::vector<SimplexId>> triangleList_;
-    std::vector<std::vector<SimplexId>> triangleEdgeList_;
-    std::vector<std::vector<SimplexId>> triangleLinkList_;
-    std::vector<std::vector<SimplexId>> triangleStarList_;
-    std::vector<std::vector<SimplexId>> vertexEdgeList_;
-    std::vector<std::vector<SimplexId>> vertexLinkList_;
-    std::vector<std::vector<SimplexId>> vertexNeighborList_;
-    std::vector<std::vector<SimplexId>> vertexStarList_;
-    std::vector<std::vector<SimplexId>> vertexTriangleList_;
+    FlatJaggedArray edgeStarList_;
+    FlatJaggedArray edgeTriangleList_;
+    FlatJaggedArray triangleList_;
+    FlatJaggedArray triangleEdgeList_;
+    FlatJaggedArray triangleLinkList_;
+    FlatJaggedArray triangleStarList_;
+    FlatJaggedArray vertexEdgeList_;
+    FlatJaggedArray vertexLinkList_;
+    FlatJaggedArray vertexNeighborList_;
+    FlatJaggedArray vertexStarList_;
+    FlatJaggedArray vertexTriangleList_;
   };
 } // namespace ttk
 
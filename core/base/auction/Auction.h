@@ -52,7 +52,6 @@ namespace ttk {
     }
 
     KDTree<dataType> *kdt_;
-    std::vector<KDTree<dataType> *> correspondance_kdt_map_;
 
     Auction(int wasserstein,
             double geometricalFactor,
@@ -81,7 +80,6 @@ namespace ttk {
             double lambda,
             double delta_lim,
             KDTree<dataType> *kdt,
-            std::vector<KDTree<dataType> *> &correspondance_kdt_map,
             dataType epsilon,
             dataType initial_diag_price,
             bool use_kdTree = true) {
@@ -127,7 +125,6 @@ namespace ttk {
       use_kdt_ = (use_kdTree && goods_->size() > 0);
       if(use_kdt_) {
         kdt_ = kdt;
-        correspondance_kdt_map_ = correspondance_kdt_map;
       }
     };
 
@@ -238,7 +235,7 @@ namespace ttk {
 
     void buildKDTree() {
       Timer t;
-      kdt_ = new KDTree<dataType>(true, wasserstein_);
+      kdt_ = new KDTree<dataType>(wasserstein_);
       const int dimension
         = geometricalFactor_ >= 1 ? (geometricalFactor_ <= 0 ? 3 : 2) : 5;
       std::vector<dataType> coordinates;
@@ -254,8 +251,7 @@ namespace ttk {
           coordinates.push_back((1 - geometricalFactor_) * g.coords_z_);
         }
       }
-      correspondance_kdt_map_
-        = kdt_->build(coordinates.data(), goods_->size(), dimension);
+      kdt_->build(coordinates.data(), goods_->size(), dimension);
     }
 
     void setEpsilon(dataType epsilon) {
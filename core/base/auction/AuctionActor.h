@@ -440,7 +440,7 @@ namespace ttk {
       int wasserstein,
       dataType epsilon,
       double geometricalFactor,
-      std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+      KDTree<dataType> *kdt,
       std::priority_queue<std::pair<int, dataType>,
                           std::vector<std::pair<int, dataType>>,
                           Compare<dataType>> &diagonal_queue,
@@ -651,7 +651,7 @@ namespace ttk {
     int wasserstein,
     dataType epsilon,
     double geometricalFactor,
-    std::vector<KDTree<dataType> *> &correspondance_kdt_map,
+    KDTree<dataType> *kdt,
     std::priority_queue<std::pair<int, dataType>,
                         std::vector<std::pair<int, dataType>>,
                         Compare<dataType>> &diagonal_queue,
@@ -762,8 +762,7 @@ namespace ttk {
     if(is_twin) {
       // std::cout << "got here 5" << std::endl;
       // Update weight in KDTree if the closest good is in it
-      correspondance_kdt_map[best_good->id_]->updateWeight(
-        new_price, kdt_index);
+      kdt->updateWeight(best_good->id_, new_price, kdt_index);
       if(non_empty_goods) {
         diagonal_queue.push(best_pair);
       }
@@ -787,7 +786,7 @@ namespace ttk {
                                       KDTree<dataType> *kdt,
                                       const int kdt_index) {
     /// Runs bidding of a non-diagonal bidder
-    std::vector<KDTree<dataType> *> neighbours;
+    std::vector<int> neighbours;
     std::vector<dataType> costs;
 
     std::vector<dataType> coordinates;
@@ -799,34 +798,15 @@ namespace ttk {
       coordinates.push_back((1 - geometricalFactor) * this->coords_z_);
     }
 
-    // std::cout<<"got to 1"<<std::endl;
+    // The neighbours are sorted by increasing cost
     kdt->getKClosest(2, coordinates, neighbours, costs, kdt_index);
-    // std::cout<<"got to 2"<<std::endl;
-    dataType best_val, second_val;
-    KDTree<dataType> *closest_kdt;
-    Good<dataType> *best_good;
-    if(costs.size() == 2) {
-      // std::cout<<"got to 735"<<std::endl;
-      std::vector<int> idx(2);
-      idx[0] = 0;
-      idx[1] = 1;
-      sort(idx.begin(), idx.end(),
-           [&costs](int &a, int &b) { return costs[a] < costs[b]; });
-
-      closest_kdt = neighbours[idx[0]];
-      best_good = &(goods->get(closest_kdt->id_));
-      // Value is defined as the opposite of cost (each bidder aims at
-      // maximizing it)
-      best_val = -costs[idx[0]];
-      second_val = -costs[idx[1]];
-    } else {
-      // std::cout<<"got to 748"<<std::endl;
-      // If the kdtree contains only one point
-      closest_kdt = neighbours[0];
-      best_good = &(goods->get(closest_kdt->id_));
-      best_val = -costs[0];
-      second_val = best_val;
-    }
+    const int closest = neighbours[0];
+    Good<dataType> *best_good = &(goods->get(closest));
+    // Value is defined as the opposite of cost (each bidder aims at
+    // maximizing it)
+    dataType best_val = -costs[0];
+    // If the kdtree contains only one point, second_val = best_val
+    dataType second_val = costs.size() == 2 ? -costs[1] : best_val;
     // std::cout<<"got to 755"<<std::endl;
     // And now check for the corresponding twin bidder
     bool twin_chosen = false;
@@ -864,7 +844,7 @@ namespace ttk {
     best_good->assign(this->position_in_auction_, new_price);
     // Update the price in the KDTree
     if(!twin_chosen) {
-      closest_kdt->updateWeight(new_price, kdt_index);
+      kdt->updateWeight(closest, new_price, kdt_index);
     }
     return idx_reassigned;
   }
@@ -30,7 +30,7 @@ void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
       if(use_kdt_) {
         idx_reassigned = b.runDiagonalKDTBidding(
           all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
-          correspondance_kdt_map_, diagonal_queue_, kdt_index);
+          kdt_, diagonal_queue_, kdt_index);
       } else {
         idx_reassigned
           = b.runDiagonalBidding(all_goods, twin_good, wasserstein_, epsilon,
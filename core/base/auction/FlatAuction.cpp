@@ -0,0 +1,412 @@
+#include <FlatAuction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+using namespace ttk;
+
+int FlatAuction::setInput(const vector<vector<double>> &bidderCoordinates,
+                          const vector<vector<double>> &goodCoordinates,
+                          const vector<double> &bidderDiagonal,
+                          const vector<double> &goodDiagonal) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(bidderCoordinates.size() != goodCoordinates.size())
+    return -1;
+  for(const auto &c : bidderCoordinates)
+    if(c.size() != bidderDiagonal.size())
+      return -2;
+  for(const auto &c : goodCoordinates)
+    if(c.size() != goodDiagonal.size())
+      return -3;
+#endif
+
+  bidderNumber_ = bidderDiagonal.size();
+  goodNumber_ = goodDiagonal.size();
+  dimension_ = bidderCoordinates.size();
+  bidderDiagonal_ = bidderDiagonal;
+  goodDiagonal_ = goodDiagonal;
+
+  bidderCoordinates_.resize((size_t)dimension_ * bidderNumber_);
+  goodCoordinates_.resize((size_t)dimension_ * goodNumber_);
+  for(int k = 0; k < dimension_; ++k) {
+    copy(bidderCoordinates[k].begin(), bidderCoordinates[k].end(),
+         bidderCoordinates_.begin() + (size_t)k * bidderNumber_);
+    copy(goodCoordinates[k].begin(), goodCoordinates[k].end(),
+         goodCoordinates_.begin() + (size_t)k * goodNumber_);
+  }
+
+  return 0;
+}
+
+double FlatAuction::cost(const int &bidder, const int &good) const {
+
+  if(bidder < bidderNumber_ and good < goodNumber_) {
+    // same operations (and order) as computeValues()
+    double sum = 0;
+    for(int k = 0; k < dimension_; ++k) {
+      const double d = goodCoordinates_[(size_t)k * goodNumber_ + good]
+                       - bidderCoordinates_[(size_t)k * bidderNumber_ + bidder];
+      if(wasserstein_ == 1)
+        sum += fabs(d);
+      else if(wasserstein_ == 2)
+        sum += d * d;
+      else
+        sum += pow(fabs(d), wasserstein_);
+    }
+    if(normCost_ and wasserstein_ != 1)
+      sum = wasserstein_ == 2 ? sqrt(sum) : pow(sum, 1 / wasserstein_);
+    return sum;
+  }
+  if(bidder < bidderNumber_)
+    return bidderDiagonal_[bidder];
+  if(good < goodNumber_)
+    return goodDiagonal_[good];
+
+  // diagonal bidder, diagonal good
+  return 0;
+}
+
+void FlatAuction::computeValues(const int &bidder,
+                                vector<double> &values) const {
+
+  const int goodNumber = goodNumber_;
+  const double w = wasserstein_;
+  double *v = values.data();
+  const double *prices = prices_.data();
+
+  fill(values.begin(), values.begin() + goodNumber, 0.0);
+
+  // one contiguous pass over the goods per coordinate, the exponent being
+  // tested outside of the loops
+  for(int k = 0; k < dimension_; ++k) {
+    const double x = bidderCoordinates_[(size_t)k * bidderNumber_ + bidder];
+    const double *g = goodCoordinates_.data() + (size_t)k * goodNumber;
+    if(w == 1) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+      for(int j = 0; j < goodNumber; ++j)
+        v[j] += fabs(g[j] - x);
+    } else if(w == 2) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+      for(int j = 0; j < goodNumber; ++j) {
+        const double d = g[j] - x;
+        v[j] += d * d;
+      }
+    } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+      for(int j = 0; j < goodNumber; ++j)
+        v[j] += pow(fabs(g[j] - x), w);
+    }
+  }
+
+  if(normCost_ and w == 2) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+    for(int j = 0; j < goodNumber; ++j)
+      v[j] = sqrt(v[j]);
+  } else if(normCost_ and w != 1) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+    for(int j = 0; j < goodNumber; ++j)
+      v[j] = pow(v[j], 1 / w);
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+  for(int j = 0; j < goodNumber; ++j)
+    v[j] += prices[j];
+}
+
+void FlatAuction::computeBid(const int &bidder,
+                             const double &epsilon,
+                             vector<double> &values,
+                             int &good,
+                             double &price) const {
+
+  computeValues(bidder, values);
+
+  // smallest and second smallest cost plus price
+  double best = numeric_limits<double>::max();
+  double second = best;
+  int bestGood = -1;
+  for(int j = 0; j < goodNumber_; ++j) {
+    if(values[j] < best) {
+      second = best;
+      best = values[j];
+      bestGood = j;
+    } else if(values[j] < second) {
+      second = values[j];
+    }
+  }
+
+  // the diagonal projection of the bidder
+  const int diagonalGood = goodNumber_ + bidder;
+  const double value = bidderDiagonal_[bidder] + prices_[diagonalGood];
+  if(value < best) {
+    second = best;
+    best = value;
+    bestGood = diagonalGood;
+  } else if(value < second) {
+    second = value;
+  }
+
+  if(second == numeric_limits<double>::max())
+    second = best;
+
+  good = bestGood;
+  price = prices_[bestGood] + second - best + epsilon;
+}
+
+int FlatAuction::assign(const int &bidder,
+                        const int &good,
+                        const double &price) {
+
+  const int previousOwner = owners_[good];
+  owners_[good] = bidder;
+  assignments_[bidder] = good;
+  prices_[good] = price;
+  if(good >= goodNumber_)
+    diagonalGoods_.update(good - goodNumber_, price);
+  if(previousOwner >= 0)
+    assignments_[previousOwner] = -1;
+
+  return previousOwner;
+}
+
+void FlatAuction::enqueue(const int &bidder) {
+  if(bidder < bidderNumber_)
+    realQueue_.push_back(bidder);
+  else
+    diagonalQueue_.push_back(bidder);
+}
+
+void FlatAuction::runDiagonalBidding(const int &bidder,
+                                     const double &epsilon) {
+
+  // the twin good (the pair projected to the diagonal)
+  const int twinGood = bidder - bidderNumber_;
+  double best = goodDiagonal_[twinGood] + prices_[twinGood];
+  double second = numeric_limits<double>::max();
+  int bestGood = twinGood;
+
+  // the diagonal goods all have a zero cost: only the two cheapest ones
+  // matter
+  if(!diagonalGoods_.empty()) {
+    const int cheapest = diagonalGoods_.top();
+    const double cheapestPrice = diagonalGoods_.topKey();
+    diagonalGoods_.pop();
+    const double secondPrice = diagonalGoods_.empty()
+                                 ? numeric_limits<double>::max()
+                                 : diagonalGoods_.topKey();
+    diagonalGoods_.push(cheapest, cheapestPrice);
+
+    if(cheapestPrice < best) {
+      second = min(best, secondPrice);
+      best = cheapestPrice;
+      bestGood = goodNumber_ + cheapest;
+    } else {
+      second = cheapestPrice;
+    }
+  }
+
+  if(second == numeric_limits<double>::max())
+    second = best;
+
+  const int evicted
+    = assign(bidder, bestGood, prices_[bestGood] + second - best + epsilon);
+  if(evicted >= 0)
+    enqueue(evicted);
+  bidNumber_++;
+}
+
+void FlatAuction::runGaussSeidelBidding(const double &epsilon) {
+
+  vector<double> values(goodNumber_);
+  while(!realQueue_.empty()) {
+    const int bidder = realQueue_.back();
+    realQueue_.pop_back();
+
+    int good;
+    double price;
+    computeBid(bidder, epsilon, values, good, price);
+    const int evicted = assign(bidder, good, price);
+    if(evicted >= 0)
+      enqueue(evicted);
+    bidNumber_++;
+  }
+}
+
+void FlatAuction::runJacobiBidding(const double &epsilon) {
+
+  const vector<int> bidders = move(realQueue_);
+  realQueue_.clear();
+  const int bidderNumber = bidders.size();
+
+  // all the bids are computed against the same prices
+  vector<int> goods(bidderNumber);
+  vector<double> bidPrices(bidderNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    vector<double> values(goodNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+    for(int i = 0; i < bidderNumber; ++i)
+      computeBid(bidders[i], epsilon, values, goods[i], bidPrices[i]);
+  }
+
+  // the highest bid wins each good, the other bidders stay unassigned
+  vector<int> wonGoods;
+  for(int i = 0; i < bidderNumber; ++i) {
+    const int good = goods[i];
+    const int winner = winners_[good];
+    if(winner < 0) {
+      winners_[good] = i;
+      wonGoods.push_back(good);
+    } else if(bidPrices[i] > bidPrices[winner]) {
+      winners_[good] = i;
+      realQueue_.push_back(bidders[winner]);
+    } else {
+      realQueue_.push_back(bidders[i]);
+    }
+  }
+
+  for(const auto &good : wonGoods) {
+    const int i = winners_[good];
+    winners_[good] = -1;
+    const int evicted = assign(bidders[i], good, bidPrices[i]);
+    if(evicted >= 0)
+      enqueue(evicted);
+  }
+
+  bidNumber_ += bidderNumber;
+}
+
+void FlatAuction::runAuctionRound(const double &epsilon) {
+
+  while(!realQueue_.empty() or !diagonalQueue_.empty()) {
+    if(useJacobiRounds_)
+      runJacobiBidding(epsilon);
+    else
+      runGaussSeidelBidding(epsilon);
+
+    while(!diagonalQueue_.empty()) {
+      const int bidder = diagonalQueue_.back();
+      diagonalQueue_.pop_back();
+      runDiagonalBidding(bidder, epsilon);
+    }
+  }
+}
+
+double FlatAuction::getMatchingCost() const {
+
+  double matchingCost = 0;
+  for(size_t i = 0; i < assignments_.size(); ++i)
+    matchingCost += cost(i, assignments_[i]);
+
+  return matchingCost;
+}
+
+int FlatAuction::run(vector<tuple<int, int, double>> &matchings) {
+
+  Timer t;
+
+  matchings.clear();
+  const int augmentedNumber = bidderNumber_ + goodNumber_;
+  if(!augmentedNumber)
+    return 0;
+
+  prices_.assign(augmentedNumber, 0);
+  owners_.resize(augmentedNumber);
+  assignments_.resize(augmentedNumber);
+  winners_.assign(augmentedNumber, -1);
+  diagonalGoods_.clear();
+  diagonalGoods_.reserve(bidderNumber_, bidderNumber_);
+  for(int i = 0; i < bidderNumber_; ++i)
+    diagonalGoods_.push(i, 0);
+
+  // epsilon-scaling, starting from the largest diagonal cost (as
+  // Auction::initializeEpsilon())
+  double epsilon = 0;
+  for(const auto &d : bidderDiagonal_)
+    epsilon = max(epsilon, d);
+  for(const auto &d : goodDiagonal_)
+    epsilon = max(epsilon, d);
+  if(!(epsilon > 0))
+    epsilon = 1;
+
+  bidNumber_ = 0;
+  int phaseNumber = 0;
+  double delta = 5;
+  while(delta > relativePrecision_) {
+    epsilon /= 5;
+
+    // risks of floating point limits reached, stop after this phase
+    const double maxPrice = *max_element(prices_.begin(), prices_.end());
+    const bool isLastPhase = epsilon < 1e-6 * maxPrice;
+    const double phaseEpsilon = isLastPhase ? 1e-6 * maxPrice : epsilon;
+
+    fill(owners_.begin(), owners_.end(), -1);
+    fill(assignments_.begin(), assignments_.end(), -1);
+    realQueue_.resize(bidderNumber_);
+    for(int i = 0; i < bidderNumber_; ++i)
+      realQueue_[i] = i;
+    diagonalQueue_.resize(goodNumber_);
+    for(int i = 0; i < goodNumber_; ++i)
+      diagonalQueue_[i] = bidderNumber_ + i;
+
+    runAuctionRound(phaseEpsilon);
+    phaseNumber++;
+
+    // relative precision (as Auction::getRelativePrecision())
+    const double d = getMatchingCost();
+    const double denominator = d - augmentedNumber * phaseEpsilon;
+    if(d < 1e-12)
+      delta = 0;
+    else if(denominator <= 0)
+      delta = 1;
+    else if(normCost_)
+      delta = d / denominator - 1;
+    else
+      delta = pow(d / denominator, 1 / wasserstein_) - 1;
+
+    if(isLastPhase)
+      break;
+  }
+
+  for(int i = 0; i < bidderNumber_; ++i) {
+    const int good = assignments_[i];
+    if(good < goodNumber_)
+      matchings.emplace_back(i, good, cost(i, good));
+    else
+      matchings.emplace_back(i, -1, bidderDiagonal_[i]);
+  }
+  for(int j = 0; j < goodNumber_; ++j) {
+    if(assignments_[bidderNumber_ + j] == j)
+      matchings.emplace_back(-1, j, goodDiagonal_[j]);
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[FlatAuction] " << bidNumber_ << " bid(s) in " << phaseNumber
+        << " phase(s), relative precision " << delta << ", "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
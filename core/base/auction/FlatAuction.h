@@ -0,0 +1,162 @@
+/// \ingroup base
+/// \class ttk::FlatAuction
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Structure-of-arrays auction for the matching of two persistence
+/// diagrams.
+///
+/// %FlatAuction solves the same assignment problem as ttk::Auction (each pair
+/// of a diagram is either matched to a pair of the other diagram or sent to
+/// the diagonal) with the same epsilon-scaling strategy, but without the
+/// ttk::Good and ttk::Bidder objects: the coordinates of the pairs, the
+/// prices and the assignments are stored in flat arrays (one array per
+/// coordinate), so that the bid of a bidder over all the goods is a
+/// contiguous, vectorizable loop. The diagonal goods are kept in a
+/// ttk::IndexedHeap sorted by price.
+///
+/// The points are given by an arbitrary number of (pre-weighted)
+/// coordinates. The cost between two points is the sum of the w-th powers of
+/// their coordinate differences (or its w-th root, see setNormCost()), while
+/// the cost of sending a point to the diagonal is given by the caller.
+///
+/// Optionally, the bids of the unassigned bidders are computed in parallel
+/// against fixed prices and then resolved at once (Jacobi rounds), instead
+/// of one bidder after the other (Gauss-Seidel rounds, as in ttk::Auction).
+///
+/// \sa ttk::Auction
+/// \sa ttk::BottleneckDistance
+
+#ifndef _FLATAUCTION_H
+#define _FLATAUCTION_H
+
+#include <Debug.h>
+#include <IndexedHeap.h>
+
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace ttk {
+
+  class FlatAuction : public Debug {
+
+  public:
+    FlatAuction() {
+    }
+
+    ~FlatAuction() {
+    }
+
+    /// Set the points to match.
+    /// \param bidderCoordinates Coordinates of the pairs of the first diagram
+    /// (one vector per coordinate).
+    /// \param goodCoordinates Coordinates of the pairs of the second diagram
+    /// (one vector per coordinate).
+    /// \param bidderDiagonal Costs of sending the pairs of the first diagram
+    /// to the diagonal.
+    /// \param goodDiagonal Costs of sending the pairs of the second diagram
+    /// to the diagonal.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setInput(const std::vector<std::vector<double>> &bidderCoordinates,
+                 const std::vector<std::vector<double>> &goodCoordinates,
+                 const std::vector<double> &bidderDiagonal,
+                 const std::vector<double> &goodDiagonal);
+
+    /// Set the exponent of the coordinate differences (2 by default).
+    inline int setWasserstein(const double &wasserstein) {
+      wasserstein_ = wasserstein;
+      return 0;
+    }
+
+    /// Use the w-th root of the sum of the coordinate differences raised to
+    /// the power w (L-w norm) as cost, instead of the sum itself.
+    inline int setNormCost(const bool normCost) {
+      normCost_ = normCost;
+      return 0;
+    }
+
+    /// Set the relative precision at which the epsilon-scaling stops (0.01
+    /// by default).
+    inline int setRelativePrecision(const double &relativePrecision) {
+      relativePrecision_ = relativePrecision;
+      return 0;
+    }
+
+    /// Compute the bids of all the unassigned bidders in parallel before
+    /// resolving them (Jacobi rounds), instead of one after the other.
+    inline int setUseJacobiRounds(const bool useJacobiRounds) {
+      useJacobiRounds_ = useJacobiRounds;
+      return 0;
+    }
+
+    /// Run the auction.
+    /// The pairs sent to the diagonal are reported with a -1 index on the
+    /// other side.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int run(std::vector<std::tuple<int, int, double>> &matchings);
+
+  protected:
+    /// Cost between the bidder \p bidder and the good \p good (augmented
+    /// indices).
+    double cost(const int &bidder, const int &good) const;
+
+    /// Compute the cost plus the price of each real good for the real
+    /// bidder \p bidder.
+    void computeValues(const int &bidder, std::vector<double> &values) const;
+
+    /// Compute the bid of the real bidder \p bidder against the current
+    /// prices.
+    void computeBid(const int &bidder,
+                    const double &epsilon,
+                    std::vector<double> &values,
+                    int &good,
+                    double &price) const;
+
+    /// Give the good \p good to the bidder \p bidder at the price \p price.
+    /// \return Returns the bidder previously owning the good (-1 if none).
+    int assign(const int &bidder, const int &good, const double &price);
+
+    void enqueue(const int &bidder);
+
+    void runDiagonalBidding(const int &bidder, const double &epsilon);
+    void runGaussSeidelBidding(const double &epsilon);
+    void runJacobiBidding(const double &epsilon);
+    void runAuctionRound(const double &epsilon);
+
+    double getMatchingCost() const;
+
+    int bidderNumber_{};
+    int goodNumber_{};
+    int dimension_{};
+
+    double wasserstein_{2};
+    bool normCost_{false};
+    double relativePrecision_{0.01};
+    bool useJacobiRounds_{false};
+
+    // coordinates (the coordinate k of the point i being stored at
+    // k * pointNumber + i) and diagonal costs
+    std::vector<double> bidderCoordinates_;
+    std::vector<double> goodCoordinates_;
+    std::vector<double> bidderDiagonal_;
+    std::vector<double> goodDiagonal_;
+
+    // The augmented bidders are the pairs of the first diagram followed by
+    // the diagonal projections of the pairs of the second diagram, the
+    // augmented goods are the pairs of the second diagram followed by the
+    // diagonal projections of the pairs of the first diagram.
+    std::vector<double> prices_;
+    std::vector<int> owners_;
+    std::vector<int> assignments_;
+    IndexedHeap<double, std::less<double>> diagonalGoods_;
+
+    // unassigned bidders and, in Jacobi rounds, best bid per good
+    std::vector<int> realQueue_;
+    std::vector<int> diagonalQueue_;
+    std::vector<int> winners_;
+    long long bidNumber_{};
+  };
+} // namespace ttk
+
+#endif // _FLATAUCTION_H
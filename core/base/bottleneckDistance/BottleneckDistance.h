@@ -1,6 +1,22 @@
 /// \ingroup base
 /// \class ttk::BottleneckDistance
 /// \author Maxime Soler <soler.maxime@total.com>
+///
+/// \brief Bottleneck and Wasserstein distances between persistence diagrams.
+///
+/// The distance between two pairs combines the differences of their birth
+/// and death values (weighted by setPE() and setPS()) and, optionally, the
+/// distances between the positions of their critical points (weighted by
+/// setPX(), setPY() and setPZ()). The extrema pairs are located at their
+/// extremum, the saddle-saddle pairs at the midpoint of their two critical
+/// points.
+///
+/// \note Since October 2026, the geometric term of the saddle-saddle pairs
+/// is the absolute difference of the midpoints, |(a + a') / 2 - (b + b') / 2|.
+/// It was previously computed as |a + a'| / 2 - |b + b'| / 2, which could be
+/// negative. With non-zero geometric weights, the distances (and matchings)
+/// between diagrams with saddle-saddle pairs therefore differ from those of
+/// earlier versions.
 #ifndef _BOTTLENECKDISTANCE_H
 #define _BOTTLENECKDISTANCE_H
 
@@ -29,12 +45,15 @@
 #endif
 
 // base code includes
+#include <DenseAssignment.h>
+#include <FlatAuction.h>
 #include <GabowTarjan.h>
-#include <Munkres.h>
 #include <PersistenceDiagram.h>
+#include <SparseMatching.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
+#include <array>
 #include <functional>
 #include <string>
 #include <tuple>
@@ -46,7 +65,9 @@ namespace ttk {
   public:
     BottleneckDistance()
       : distance_(-1), wasserstein_("inf"), pvAlgorithm_(-1), zeroThreshold_(0),
-        px_(0), py_(0), pz_(0), pe_(0), ps_(0){};
+        px_(0), py_(0), pz_(0), pe_(0), ps_(0), useSparseMatching_(true),
+        auctionPrecision_(0.01), useJacobiAuction_(false),
+        denseAssignments_(nullptr){};
 
     ~BottleneckDistance(){};
 
@@ -58,6 +79,38 @@ namespace ttk {
       return 0;
     }
 
+    /// Match the diagrams with the sparse, geometry-pruned solvers of
+    /// ttk::SparseMatching (default) instead of the dense cost matrices of
+    /// ttk::DenseAssignment and ttk::GabowTarjan. The small Wasserstein
+    /// problems are solved on dense cost matrices anyway.
+    inline int setUseSparseMatching(const bool useSparseMatching) {
+      useSparseMatching_ = useSparseMatching;
+      return 0;
+    }
+
+    /// Solve the dense Wasserstein problems (minima, maxima and saddles)
+    /// with the given solvers, whose buffers are reused from one call to
+    /// the next (for instance to match many consecutive diagrams).
+    inline int setDenseAssignments(
+      std::array<DenseAssignment, 3> *denseAssignments) {
+      denseAssignments_ = denseAssignments;
+      return 0;
+    }
+
+    /// Set the relative precision of the auction algorithm (algorithm
+    /// "auction"), 0.01 by default.
+    inline int setAuctionPrecision(const double auctionPrecision) {
+      auctionPrecision_ = auctionPrecision;
+      return 0;
+    }
+
+    /// Compute the bids of the auction algorithm (algorithm "auction") in
+    /// parallel Jacobi rounds.
+    inline int setUseJacobiAuction(const bool useJacobiAuction) {
+      useJacobiAuction_ = useJacobiAuction;
+      return 0;
+    }
+
     inline int setPX(double px) {
       px_ = px;
       return 0;
@@ -144,13 +197,18 @@ namespace ttk {
     double pz_;
     double pe_;
     double ps_;
+    bool useSparseMatching_;
+    double auctionPrecision_;
+    bool useJacobiAuction_;
+    std::array<DenseAssignment, 3> *denseAssignments_;
 
   private:
     template <typename dataType>
     int computeBottleneck(const std::vector<diagramTuple> &d1,
                           const std::vector<diagramTuple> &d2,
                           std::vector<matchingTuple> &matchings,
-                          bool usePersistenceMetric);
+                          bool usePersistenceMetric,
+                          bool useAuction = false);
 
     template <typename dataType>
     double computeGeometricalRange(const std::vector<diagramTuple> &CTDiagram1,
@@ -196,11 +254,16 @@ namespace ttk {
       int wasserstein);
 
     template <typename dataType>
-    void solvePWasserstein(int nbRow,
-                           int nbCol,
-                           std::vector<std::vector<dataType>> &matrix,
-                           std::vector<matchingTuple> &matchings,
-                           Munkres &solver);
+    void solveDense(
+      const std::vector<diagramTuple> &CTDiagram1,
+      const std::vector<diagramTuple> &CTDiagram2,
+      const std::vector<int> &map1,
+      const std::vector<int> &map2,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+      DenseAssignment &solver,
+      std::vector<matchingTuple> &matchings);
 
     template <typename dataType>
     void solveInfinityWasserstein(int nbRow,
@@ -211,6 +274,29 @@ namespace ttk {
                                   std::vector<matchingTuple> &matchings,
                                   GabowTarjan &solver);
 
+    template <typename dataType>
+    void solveSparse(
+      const std::vector<diagramTuple> &CTDiagram1,
+      const std::vector<diagramTuple> &CTDiagram2,
+      const std::vector<int> &map1,
+      const std::vector<int> &map2,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+      double lowerBoundFactor,
+      int wasserstein,
+      std::vector<matchingTuple> &matchings);
+
+    template <typename dataType>
+    void solveAuction(
+      const std::vector<diagramTuple> &CTDiagram1,
+      const std::vector<diagramTuple> &CTDiagram2,
+      const std::vector<int> &map1,
+      const std::vector<int> &map2,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+      int wasserstein,
+      std::vector<matchingTuple> &matchings);
+
     template <typename dataType>
     dataType buildMappings(const std::vector<matchingTuple> &inputMatchings,
                            bool transposeGlobal,
@@ -53,6 +53,18 @@ int BottleneckDistance::execute(const bool usePersistenceMetric) {
             << "[BottleneckDistance|PV] Not supported." << std::endl;
         dMsg(std::cout, msg.str(), timeMsg);
       } break;
+      case 5: {
+        std::stringstream msg;
+        msg << "[BottleneckDistance|PV] Solving with the auction approach."
+            << std::endl;
+        dMsg(std::cout, msg.str(), timeMsg);
+      }
+        this->computeBottleneck<dataType>(
+          *static_cast<const std::vector<diagramTuple> *>(outputCT1_),
+          *static_cast<const std::vector<diagramTuple> *>(outputCT2_),
+          *static_cast<std::vector<matchingTuple> *>(matchings_),
+          usePersistenceMetric, true);
+        break;
       default: {
         std::stringstream msg;
         msg << "[BottleneckDistance|PV] You must specify a valid assignment "
@@ -109,6 +121,19 @@ int BottleneckDistance::execute(const bool usePersistenceMetric) {
             << "[BottleneckDistance|PV] Not supported." << std::endl;
         dMsg(std::cout, msg.str(), timeMsg);
       } break;
+      case str2int("5"):
+      case str2int("auction"): {
+        std::stringstream msg;
+        msg << "[BottleneckDistance] Solving with the auction approach."
+            << std::endl;
+        dMsg(std::cout, msg.str(), timeMsg);
+      }
+        this->computeBottleneck<dataType>(
+          *static_cast<const std::vector<diagramTuple> *>(outputCT1_),
+          *static_cast<const std::vector<diagramTuple> *>(outputCT2_),
+          *static_cast<std::vector<matchingTuple> *>(matchings_),
+          usePersistenceMetric, true);
+        break;
       default: {
         std::stringstream msg;
         msg << "[BottleneckDistance] You must specify a valid assignment "
@@ -432,15 +457,47 @@ void BottleneckDistance::buildCostMatrices(
 }
 
 template <typename dataType>
-void BottleneckDistance::solvePWasserstein(
-  const int nbRow,
-  const int nbCol,
-  std::vector<std::vector<dataType>> &matrix,
-  std::vector<matchingTuple> &matchings,
-  Munkres &solver) {
-  solver.setInput(nbRow, nbCol, (void *)&matrix);
-  solver.run<dataType>(matchings);
-  solver.clearMatrix<dataType>();
+void BottleneckDistance::solveDense(
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const std::vector<int> &map1,
+  const std::vector<int> &map2,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+  DenseAssignment &solver,
+  std::vector<matchingTuple> &matchings) {
+  const auto nbRow = (int)map1.size();
+  const auto nbCol = (int)map2.size();
+
+  // The cost matrix is filled in place, two pairs farther than their
+  // cumulated distances to the diagonal being never matched.
+  solver.setDebugLevel(debugLevel_);
+  solver.setSize(nbRow, nbCol);
+  std::vector<double> diagonal2(nbCol);
+  for(int j = 0; j < nbCol; ++j) {
+    diagonal2[j] = diagonalDistanceFunction(CTDiagram2[map2[j]]);
+    solver.setColumnDiagonal(j, diagonal2[j]);
+  }
+  for(int i = 0; i < nbRow; ++i) {
+    const diagramTuple &t1 = CTDiagram1[map1[i]];
+    const double diag1 = diagonalDistanceFunction(t1);
+    solver.setRowDiagonal(i, diag1);
+    double *costs = solver.getCostRow(i);
+    for(int j = 0; j < nbCol; ++j) {
+      const double distance = distanceFunction(t1, CTDiagram2[map2[j]]);
+      costs[j] = distance > diag1 + diagonal2[j]
+                   ? std::numeric_limits<double>::infinity()
+                   : distance;
+    }
+  }
+
+  std::vector<std::tuple<int, int, double>> denseMatchings;
+  solver.run(denseMatchings);
+
+  matchings.clear();
+  for(const auto &m : denseMatchings)
+    matchings.emplace_back(std::get<0>(m), std::get<1>(m), std::get<2>(m));
 }
 
 template <typename dataType>
@@ -466,6 +523,131 @@ void BottleneckDistance::solveInfinityWasserstein(
   solver.clear<dataType>();
 }
 
+template <typename dataType>
+void BottleneckDistance::solveSparse(
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const std::vector<int> &map1,
+  const std::vector<int> &map2,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+  const double lowerBoundFactor,
+  const int wasserstein,
+  std::vector<matchingTuple> &matchings) {
+  const auto nbRow = (int)map1.size();
+  const auto nbCol = (int)map2.size();
+
+  // (birth, death) coordinates and distances to the diagonal
+  std::vector<std::array<double, 2>> points1(nbRow), points2(nbCol);
+  std::vector<double> diagonal1(nbRow), diagonal2(nbCol);
+  for(int i = 0; i < nbRow; ++i) {
+    const diagramTuple &t = CTDiagram1[map1[i]];
+    points1[i] = {(double)std::get<6>(t), (double)std::get<10>(t)};
+    diagonal1[i] = diagonalDistanceFunction(t);
+  }
+  for(int j = 0; j < nbCol; ++j) {
+    const diagramTuple &t = CTDiagram2[map2[j]];
+    points2[j] = {(double)std::get<6>(t), (double)std::get<10>(t)};
+    diagonal2[j] = diagonalDistanceFunction(t);
+  }
+
+  SparseMatching solver;
+  solver.setDebugLevel(debugLevel_);
+  solver.setThreadNumber(threadNumber_);
+  solver.setInput(points1, points2, diagonal1, diagonal2, lowerBoundFactor,
+                  [&](const int i, const int j) -> double {
+                    return distanceFunction(
+                      CTDiagram1[map1[i]], CTDiagram2[map2[j]]);
+                  });
+
+  {
+    std::stringstream msg;
+    msg << "[BottleneckDistance] " << solver.getNumberOfEdges()
+        << " candidate edge(s) (instead of "
+        << (size_t)(nbRow + 1) * (size_t)(nbCol + 1) << " matrix entries)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  std::vector<std::tuple<int, int, double>> sparseMatchings;
+  if(wasserstein > 0)
+    solver.runWasserstein(sparseMatchings);
+  else
+    solver.runBottleneck(sparseMatchings);
+
+  matchings.clear();
+  for(const auto &m : sparseMatchings)
+    matchings.emplace_back(std::get<0>(m), std::get<1>(m), std::get<2>(m));
+}
+
+template <typename dataType>
+void BottleneckDistance::solveAuction(
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const std::vector<int> &map1,
+  const std::vector<int> &map2,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+  const int wasserstein,
+  std::vector<matchingTuple> &matchings) {
+  const double w = wasserstein > 1 ? wasserstein : 1;
+
+  // (birth, death, x, y, z) coordinates, weighted so that the L-w norm of
+  // their differences is the distance between the pairs (as in
+  // distanceFunction), and distances to the diagonal
+  const auto fillCoordinates
+    = [&](const std::vector<diagramTuple> &CTDiagram,
+          const std::vector<int> &map,
+          std::vector<std::vector<double>> &coordinates,
+          std::vector<double> &diagonal) {
+        const auto nb = (int)map.size();
+        coordinates.assign(5, std::vector<double>(nb));
+        diagonal.resize(nb);
+        for(int i = 0; i < nb; ++i) {
+          const diagramTuple &t = CTDiagram[map[i]];
+          const bool isMin = std::get<1>(t) == BLocalMin;
+          const bool isMax = std::get<3>(t) == BLocalMax;
+          coordinates[0][i]
+            = pow((isMin && !isMax) ? pe_ : ps_, 1 / w) * std::get<6>(t);
+          coordinates[1][i] = pow(isMax ? pe_ : ps_, 1 / w) * std::get<10>(t);
+          std::array<double, 3> p;
+          if(isMax)
+            p = {std::get<11>(t), std::get<12>(t), std::get<13>(t)};
+          else if(isMin)
+            p = {std::get<7>(t), std::get<8>(t), std::get<9>(t)};
+          else
+            p = {(std::get<7>(t) + std::get<11>(t)) / 2,
+                 (std::get<8>(t) + std::get<12>(t)) / 2,
+                 (std::get<9>(t) + std::get<13>(t)) / 2};
+          coordinates[2][i] = pow(px_, 1 / w) * p[0];
+          coordinates[3][i] = pow(py_, 1 / w) * p[1];
+          coordinates[4][i] = pow(pz_, 1 / w) * p[2];
+          diagonal[i] = diagonalDistanceFunction(t);
+        }
+      };
+
+  std::vector<std::vector<double>> coordinates1, coordinates2;
+  std::vector<double> diagonal1, diagonal2;
+  fillCoordinates(CTDiagram1, map1, coordinates1, diagonal1);
+  fillCoordinates(CTDiagram2, map2, coordinates2, diagonal2);
+
+  FlatAuction solver;
+  solver.setDebugLevel(debugLevel_);
+  solver.setThreadNumber(threadNumber_);
+  solver.setInput(coordinates1, coordinates2, diagonal1, diagonal2);
+  solver.setWasserstein(w);
+  solver.setNormCost(true);
+  solver.setRelativePrecision(auctionPrecision_);
+  solver.setUseJacobiRounds(useJacobiAuction_);
+
+  std::vector<std::tuple<int, int, double>> auctionMatchings;
+  solver.run(auctionMatchings);
+
+  matchings.clear();
+  for(const auto &m : auctionMatchings)
+    matchings.emplace_back(std::get<0>(m), std::get<1>(m), std::get<2>(m));
+}
+
 template <typename dataType>
 dataType BottleneckDistance::buildMappings(
   const std::vector<matchingTuple> &inputMatchings,
@@ -15,7 +15,8 @@ template <typename dataType>
 int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
                                           const std::vector<diagramTuple> &d2,
                                           std::vector<matchingTuple> &matchings,
-                                          const bool usePersistenceMetric) {
+                                          const bool usePersistenceMetric,
+                                          const bool useAuction) {
   auto d1Size = (int)d1.size();
   auto d2Size = (int)d2.size();
 
@@ -83,13 +84,6 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
   minRowColMax = std::min(nbRowMax + 1, nbColMax + 1);
   minRowColSad = std::min(nbRowSad + 1, nbColSad + 1);
 
-  std::vector<std::vector<dataType>> minMatrix(
-    (unsigned long)minRowColMin, std::vector<dataType>(maxRowColMin));
-  std::vector<std::vector<dataType>> maxMatrix(
-    (unsigned long)minRowColMax, std::vector<dataType>(maxRowColMax));
-  std::vector<std::vector<dataType>> sadMatrix(
-    (unsigned long)minRowColSad, std::vector<dataType>(maxRowColSad));
-
   double px = px_;
   double py = py_;
   double pz = pz_;
@@ -128,16 +122,16 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
                       + py * pow(abs(std::get<8>(a) - std::get<8>(b)), w)
                       + pz * pow(abs(std::get<9>(a) - std::get<9>(b)), w))
                    : (px
-                        * pow(abs(std::get<7>(a) + std::get<11>(a)) / 2
-                                - abs(std::get<7>(b) + std::get<11>(b)) / 2,
+                        * pow(abs((std::get<7>(a) + std::get<11>(a)) / 2
+                                  - (std::get<7>(b) + std::get<11>(b)) / 2),
                               w)
                       + py
-                          * pow(abs(std::get<8>(a) + std::get<12>(a)) / 2
-                                  - abs(std::get<8>(b) + std::get<12>(b)) / 2,
+                          * pow(abs((std::get<8>(a) + std::get<12>(a)) / 2
+                                    - (std::get<8>(b) + std::get<12>(b)) / 2),
                                 w)
                       + pz
-                          * pow(abs(std::get<9>(a) + std::get<13>(a)) / 2
-                                  - abs(std::get<9>(b) + std::get<13>(b)) / 2,
+                          * pow(abs((std::get<9>(a) + std::get<13>(a)) / 2
+                                    - (std::get<9>(b) + std::get<13>(b)) / 2),
                                 w));
 
     double persDistance = x + y;
@@ -171,42 +165,112 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     return pow(val, 1 / w);
   };
 
-  const bool transposeMin = nbRowMin > nbColMin;
-  const bool transposeMax = nbRowMax > nbColMax;
-  const bool transposeSad = nbRowSad > nbColSad;
+  // The auction only addresses the Wasserstein distances.
+  const bool auction = useAuction && wasserstein > 0;
+  if(useAuction && !auction) {
+    std::stringstream msg;
+    msg << "[BottleneckDistance] The auction does not compute bottleneck "
+           "distances, solving with the default matching."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  // Only the dense bottleneck solver transposes the problems.
+  const bool transpose = !useSparseMatching_ && wasserstein <= 0;
+  const bool transposeMin = transpose && nbRowMin > nbColMin;
+  const bool transposeMax = transpose && nbRowMax > nbColMax;
+  const bool transposeSad = transpose && nbRowSad > nbColSad;
 
   Timer t;
 
-  this->buildCostMatrices(
-    CTDiagram1, CTDiagram2, d1Size, d2Size, distanceFunction,
-    diagonalDistanceFunction, zeroThresh, minMatrix, maxMatrix, sadMatrix,
-    transposeMin, transposeMax, transposeSad, wasserstein);
-
-  if(wasserstein > 0) {
+  if(auction) {
 
     if(nbRowMin > 0 && nbColMin > 0) {
-      Munkres solverMin;
       dMsg(std::cout, "[BottleneckDistance] Affecting minima...\n", timeMsg);
-      this->solvePWasserstein(
-        minRowColMin, maxRowColMin, minMatrix, minMatchings, solverMin);
+      this->solveAuction(CTDiagram1, CTDiagram2, minMap1, minMap2,
+                         diagonalDistanceFunction, wasserstein, minMatchings);
     }
 
     if(nbRowMax > 0 && nbColMax > 0) {
-      Munkres solverMax;
       dMsg(std::cout, "[BottleneckDistance] Affecting maxima...\n", timeMsg);
-      this->solvePWasserstein(
-        minRowColMax, maxRowColMax, maxMatrix, maxMatchings, solverMax);
+      this->solveAuction(CTDiagram1, CTDiagram2, maxMap1, maxMap2,
+                         diagonalDistanceFunction, wasserstein, maxMatchings);
     }
 
     if(nbRowSad > 0 && nbColSad > 0) {
-      Munkres solverSad;
       dMsg(std::cout, "[BottleneckDistance] Affecting saddles...\n", timeMsg);
-      this->solvePWasserstein(
-        minRowColSad, maxRowColSad, sadMatrix, sadMatchings, solverSad);
+      this->solveAuction(CTDiagram1, CTDiagram2, sadMap1, sadMap2,
+                         diagonalDistanceFunction, wasserstein, sadMatchings);
+    }
+
+  } else if(useSparseMatching_ || wasserstein > 0) {
+
+    // The distance between two pairs is larger than the L-infinity distance
+    // of their (birth, death) coordinates, weighted by the smallest
+    // persistence factor.
+    const double w = wasserstein > 1 ? wasserstein : 1;
+    const double lowerBoundFactor = pow(std::max(0.0, std::min(pe, ps)), 1 / w);
+
+    const std::array<std::string, 3> names{"minima", "maxima", "saddles"};
+    const std::array<const std::vector<int> *, 3> maps1{
+      &minMap1, &maxMap1, &sadMap1};
+    const std::array<const std::vector<int> *, 3> maps2{
+      &minMap2, &maxMap2, &sadMap2};
+    const std::array<std::vector<matchingTuple> *, 3> typeMatchings{
+      &minMatchings, &maxMatchings, &sadMatchings};
+
+    // The Wasserstein problems are solved on dense cost matrices when they
+    // are small enough to fit in cache (or without the sparse solvers).
+    std::array<bool, 3> isDense;
+    for(int k = 0; k < 3; ++k) {
+      const size_t matrixSize
+        = (maps1[k]->size() + 1) * (maps2[k]->size() + 1);
+      isDense[k] = wasserstein > 0
+                   && (!useSparseMatching_ || matrixSize <= (1 << 14));
+    }
+
+    // sparse problems, one after the other (the solver is parallel)
+    for(int k = 0; k < 3; ++k) {
+      if(isDense[k] || maps1[k]->empty() || maps2[k]->empty())
+        continue;
+      dMsg(std::cout, "[BottleneckDistance] Affecting " + names[k] + "...\n",
+           timeMsg);
+      this->solveSparse(CTDiagram1, CTDiagram2, *maps1[k], *maps2[k],
+                        distanceFunction, diagonalDistanceFunction,
+                        lowerBoundFactor, wasserstein, *typeMatchings[k]);
+    }
+
+    // dense problems, in parallel
+    std::array<DenseAssignment, 3> localAssignments;
+    std::array<DenseAssignment, 3> &denseAssignments
+      = denseAssignments_ ? *denseAssignments_ : localAssignments;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(int k = 0; k < 3; ++k) {
+      if(!isDense[k] || maps1[k]->empty() || maps2[k]->empty())
+        continue;
+      dMsg(std::cout, "[BottleneckDistance] Affecting " + names[k] + "...\n",
+           timeMsg);
+      this->solveDense(CTDiagram1, CTDiagram2, *maps1[k], *maps2[k],
+                       distanceFunction, diagonalDistanceFunction,
+                       denseAssignments[k], *typeMatchings[k]);
     }
 
   } else {
 
+    std::vector<std::vector<dataType>> minMatrix(
+      (unsigned long)minRowColMin, std::vector<dataType>(maxRowColMin));
+    std::vector<std::vector<dataType>> maxMatrix(
+      (unsigned long)minRowColMax, std::vector<dataType>(maxRowColMax));
+    std::vector<std::vector<dataType>> sadMatrix(
+      (unsigned long)minRowColSad, std::vector<dataType>(maxRowColSad));
+
+    this->buildCostMatrices(
+      CTDiagram1, CTDiagram2, d1Size, d2Size, distanceFunction,
+      diagonalDistanceFunction, zeroThresh, minMatrix, maxMatrix, sadMatrix,
+      transposeMin, transposeMax, transposeSad, wasserstein);
+
     // Launch solving for minima.
     if(nbRowMin > 0 && nbColMin > 0) {
       GabowTarjan solverMin;
@@ -0,0 +1,349 @@
+#include <DenseAssignment.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+using namespace ttk;
+
+int DenseAssignment::setSize(const int &rowNumber, const int &columnNumber) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(rowNumber < 0 || columnNumber < 0)
+    return -1;
+#endif
+
+  rowNumber_ = rowNumber;
+  columnNumber_ = columnNumber;
+  costs_.resize((size_t)rowNumber * columnNumber);
+  rowDiagonal_.resize(rowNumber);
+  columnDiagonal_.resize(columnNumber);
+
+  return 0;
+}
+
+double DenseAssignment::getReducedCost(const int &row,
+                                       const int &column) const {
+  if(isSquare_)
+    return squareCosts_[(size_t)row * problemColumns_ + column]
+           - duals_[column];
+
+  // rectangular problem: costs relative to the diagonal
+  if(column < columnNumber_)
+    return costs_[(size_t)row * columnNumber_ + column] - rowDiagonal_[row]
+           - columnDiagonal_[column] - duals_[column];
+  if(column == columnNumber_ + row)
+    return -duals_[column];
+  return numeric_limits<double>::infinity();
+}
+
+void DenseAssignment::relaxRow(const int &row, const double &offset) {
+
+  if(isSquare_) {
+    const double *costs = &squareCosts_[(size_t)row * problemColumns_];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+    for(int j = 0; j < problemColumns_; ++j) {
+      const double d = costs[j] - duals_[j] - offset;
+      const bool isCloser = !isReady_[j] && d < distances_[j];
+      distances_[j] = isCloser ? d : distances_[j];
+      predecessors_[j] = isCloser ? row : predecessors_[j];
+    }
+    return;
+  }
+
+  // the real columns, then the dummy column of the row
+  const double *costs = &costs_[(size_t)row * columnNumber_];
+  const double rowOffset = rowDiagonal_[row] + offset;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+  for(int j = 0; j < columnNumber_; ++j) {
+    const double d = costs[j] - columnDiagonal_[j] - duals_[j] - rowOffset;
+    const bool isCloser = !isReady_[j] && d < distances_[j];
+    distances_[j] = isCloser ? d : distances_[j];
+    predecessors_[j] = isCloser ? row : predecessors_[j];
+  }
+
+  const int dummy = columnNumber_ + row;
+  const double d = -duals_[dummy] - offset;
+  if(!isReady_[dummy] && d < distances_[dummy]) {
+    distances_[dummy] = d;
+    predecessors_[dummy] = row;
+  }
+}
+
+void DenseAssignment::initializeRectangular() {
+
+  // Each row is assigned to its closest column (a real column or its dummy
+  // column) if it is still free, the column duals being zero.
+  for(int i = 0; i < rowNumber_; ++i) {
+    const double *costs = &costs_[(size_t)i * columnNumber_];
+    double minCost = numeric_limits<double>::infinity();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(min : minCost)
+#endif
+    for(int j = 0; j < columnNumber_; ++j)
+      minCost = min(minCost, costs[j] - columnDiagonal_[j]);
+
+    int column = columnNumber_ + i;
+    if(minCost - rowDiagonal_[i] < 0) {
+      for(int j = 0; j < columnNumber_; ++j) {
+        if(costs[j] - columnDiagonal_[j] == minCost) {
+          column = j;
+          break;
+        }
+      }
+    }
+
+    if(columnRows_[column] == -1) {
+      rowColumns_[i] = column;
+      columnRows_[column] = i;
+    } else {
+      freeRows_.push_back(i);
+    }
+  }
+}
+
+void DenseAssignment::initializeSquare() {
+
+  const int n = rowNumber_;
+  const int m = columnNumber_;
+  const int size = problemColumns_;
+  const double infinity = numeric_limits<double>::infinity();
+
+  // The rows are the pairs of the first diagram followed by the diagonal
+  // projections of the pairs of the second one, the columns are the pairs of
+  // the second diagram followed by the diagonal projections of the pairs of
+  // the first one. The projections are matched together at no cost.
+  squareCosts_.assign((size_t)size * size, infinity);
+  for(int i = 0; i < n; ++i) {
+    copy(&costs_[(size_t)i * m], &costs_[(size_t)(i + 1) * m],
+         &squareCosts_[(size_t)i * size]);
+    squareCosts_[(size_t)i * size + m + i] = rowDiagonal_[i];
+  }
+  for(int k = 0; k < m; ++k) {
+    double *costs = &squareCosts_[(size_t)(n + k) * size];
+    costs[k] = columnDiagonal_[k];
+    fill(costs + m, costs + size, 0);
+  }
+
+  // column reduction: the column minima are computed row by row (contiguous
+  // loops), their rows being stored in predecessors_ and the number of
+  // columns reduced on each row in isReady_ (up to 2)
+  fill(duals_.begin(), duals_.end(), infinity);
+  for(int i = 0; i < size; ++i) {
+    const double *costs = &squareCosts_[(size_t)i * size];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd
+#endif
+    for(int j = 0; j < size; ++j) {
+      const bool isSmaller = costs[j] < duals_[j];
+      duals_[j] = isSmaller ? costs[j] : duals_[j];
+      predecessors_[j] = isSmaller ? i : predecessors_[j];
+    }
+  }
+  for(int j = size - 1; j >= 0; --j) {
+    const int i = predecessors_[j];
+    if(!isReady_[i]) {
+      isReady_[i] = 1;
+      rowColumns_[i] = j;
+      columnRows_[j] = i;
+    } else {
+      isReady_[i] = 2;
+      if(duals_[j] < duals_[rowColumns_[i]]) {
+        columnRows_[rowColumns_[i]] = -1;
+        rowColumns_[i] = j;
+        columnRows_[j] = i;
+      }
+    }
+  }
+
+  // reduction transfer from the rows reduced once
+  for(int i = 0; i < size; ++i) {
+    if(!isReady_[i]) {
+      freeRows_.push_back(i);
+    } else if(isReady_[i] == 1) {
+      const double *costs = &squareCosts_[(size_t)i * size];
+      const int column = rowColumns_[i];
+      double minCost = infinity;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp simd reduction(min : minCost)
+#endif
+      for(int j = 0; j < size; ++j)
+        minCost = min(minCost, j == column ? infinity : costs[j] - duals_[j]);
+      if(minCost < infinity)
+        duals_[column] -= minCost;
+    }
+  }
+  fill(isReady_.begin(), isReady_.end(), false);
+
+  // augmenting row reduction (two passes): each free row takes its closest
+  // column, whose dual is decreased so that the row just prefers it
+  for(int pass = 0; pass < 2; ++pass) {
+    const int previousFreeNumber = freeRows_.size();
+    int freeNumber = 0;
+    int k = 0;
+    while(k < previousFreeNumber) {
+      const int i = freeRows_[k++];
+      const double *costs = &squareCosts_[(size_t)i * size];
+      double firstMin = infinity, secondMin = infinity;
+      int firstColumn = -1, secondColumn = -1;
+      for(int j = 0; j < size; ++j) {
+        const double h = costs[j] - duals_[j];
+        if(h < secondMin) {
+          if(h >= firstMin) {
+            secondMin = h;
+            secondColumn = j;
+          } else {
+            secondMin = firstMin;
+            secondColumn = firstColumn;
+            firstMin = h;
+            firstColumn = j;
+          }
+        }
+      }
+
+      // if the row has a single admissible column, the displaced row is
+      // postponed to the next pass instead of decreasing the dual
+      const bool isStrict = firstMin < secondMin && secondMin < infinity;
+      int column = firstColumn;
+      int displacedRow = columnRows_[column];
+      if(isStrict)
+        duals_[column] -= secondMin - firstMin;
+      else if(displacedRow != -1 && secondColumn != -1) {
+        column = secondColumn;
+        displacedRow = columnRows_[column];
+      }
+
+      rowColumns_[i] = column;
+      columnRows_[column] = i;
+      if(displacedRow != -1) {
+        rowColumns_[displacedRow] = -1;
+        if(isStrict)
+          freeRows_[--k] = displacedRow;
+        else
+          freeRows_[freeNumber++] = displacedRow;
+      }
+    }
+    freeRows_.resize(freeNumber);
+  }
+}
+
+int DenseAssignment::augment(const int &row) {
+
+  relaxRow(row, 0);
+
+  // Dijkstra on the columns, with non negative reduced costs
+  int sink = -1;
+  double sinkDistance = 0;
+  while(sink == -1) {
+
+    // closest column, the free columns being preferred on ties
+    int closest = -1;
+    sinkDistance = numeric_limits<double>::infinity();
+    for(int j = 0; j < problemColumns_; ++j) {
+      if(isReady_[j])
+        continue;
+      if(distances_[j] < sinkDistance
+         || (distances_[j] == sinkDistance && closest != -1
+             && columnRows_[closest] != -1 && columnRows_[j] == -1)) {
+        sinkDistance = distances_[j];
+        closest = j;
+      }
+    }
+    if(closest == -1)
+      return -1;
+
+    isReady_[closest] = true;
+    readyColumns_.push_back(closest);
+    const int i = columnRows_[closest];
+    if(i == -1)
+      sink = closest;
+    else
+      relaxRow(i, getReducedCost(i, closest) - sinkDistance);
+  }
+
+  // update the duals of the scanned columns
+  for(const auto j : readyColumns_)
+    duals_[j] += distances_[j] - sinkDistance;
+
+  // augment along the shortest path
+  for(int j = sink;;) {
+    const int i = predecessors_[j];
+    const int previous = rowColumns_[i];
+    rowColumns_[i] = j;
+    columnRows_[j] = i;
+    if(i == row)
+      break;
+    j = previous;
+  }
+
+  for(const auto j : readyColumns_)
+    isReady_[j] = false;
+  readyColumns_.clear();
+  fill(distances_.begin(), distances_.end(),
+       numeric_limits<double>::infinity());
+
+  return 0;
+}
+
+int DenseAssignment::run(vector<tuple<int, int, double>> &matchings) {
+
+  Timer t;
+
+  const int n = rowNumber_;
+  const int m = columnNumber_;
+
+  isSquare_ = (n + m <= lapjvThreshold_);
+  problemRows_ = isSquare_ ? n + m : n;
+  problemColumns_ = n + m;
+
+  rowColumns_.assign(problemRows_, -1);
+  columnRows_.assign(problemColumns_, -1);
+  duals_.assign(problemColumns_, 0);
+  freeRows_.clear();
+  distances_.assign(problemColumns_, numeric_limits<double>::infinity());
+  predecessors_.resize(problemColumns_);
+  isReady_.assign(problemColumns_, false);
+  readyColumns_.clear();
+
+  if(isSquare_)
+    initializeSquare();
+  else
+    initializeRectangular();
+
+  const int freeNumber = freeRows_.size();
+  for(const auto i : freeRows_) {
+    if(augment(i)) {
+      stringstream msg;
+      msg << "[DenseAssignment] No feasible assignment for row " << i << "."
+          << endl;
+      dMsg(cerr, msg.str(), infoMsg);
+      return -1;
+    }
+  }
+
+  matchings.clear();
+  for(int i = 0; i < n; ++i) {
+    const int j = rowColumns_[i];
+    if(j < m)
+      matchings.emplace_back(i, j, costs_[(size_t)i * m + j]);
+    else
+      matchings.emplace_back(i, -1, rowDiagonal_[i]);
+  }
+  for(int j = 0; j < m; ++j)
+    if(columnRows_[j] == -1 || columnRows_[j] >= n)
+      matchings.emplace_back(-1, j, columnDiagonal_[j]);
+
+  {
+    stringstream msg;
+    msg << "[DenseAssignment] Assignment found in " << t.getElapsedTime()
+        << " s. (" << (isSquare_ ? "LAPJV, " : "") << freeNumber
+        << " augmenting path(s))." << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+/// \ingroup base
+/// \class ttk::DenseAssignment
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Jonker-Volgenant solver for the dense Wasserstein matching of two
+/// persistence diagrams.
+///
+/// %DenseAssignment solves the assignment problem of ttk::Munkres (each pair
+/// of a diagram is either matched to a pair of the other diagram or sent to
+/// the diagonal) on a contiguous, row-major cost matrix, filled in place by
+/// the caller. All the buffers are kept from one run to the next (they are
+/// only reallocated when they grow), so that a single instance can be used
+/// as a workspace for many consecutive problems.
+///
+/// The pair \p i of the first diagram is either matched to a pair of the
+/// second diagram or to its own diagonal projection (dummy column), which
+/// makes a rectangular n x (m + n) assignment problem, the unmatched pairs
+/// of the second diagram being sent to the diagonal. It is solved by
+/// shortest augmenting paths (Jonker-Volgenant augmentation), from a greedy
+/// assignment of each row to its minimum. The row scans and the reductions
+/// are contiguous loops over the cost matrix.
+///
+/// Small problems (see setLapjvThreshold()) are instead expanded in cache to
+/// the square (n + m) x (n + m) problem and solved by the complete LAPJV
+/// algorithm (column reduction, reduction transfer and augmenting row
+/// reduction before the augmentation).
+///
+/// \sa ttk::Munkres
+/// \sa ttk::BottleneckDistance
+
+#ifndef _DENSEASSIGNMENT_H
+#define _DENSEASSIGNMENT_H
+
+#include <Debug.h>
+
+#include <tuple>
+#include <vector>
+
+namespace ttk {
+
+  class DenseAssignment : public Debug {
+
+  public:
+    DenseAssignment() {
+    }
+
+    ~DenseAssignment() {
+    }
+
+    /// Set the size of the problem. The costs of the previous problem are
+    /// not reset.
+    /// \param rowNumber Number of pairs of the first diagram.
+    /// \param columnNumber Number of pairs of the second diagram.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setSize(const int &rowNumber, const int &columnNumber);
+
+    /// Get the costs between the pair \p row of the first diagram and the
+    /// pairs of the second diagram (contiguous). An infinite cost forbids
+    /// the matching.
+    inline double *getCostRow(const int &row) {
+      return &costs_[(size_t)row * columnNumber_];
+    }
+
+    /// Set the cost of sending the pair \p row of the first diagram to the
+    /// diagonal.
+    inline void setRowDiagonal(const int &row, const double &cost) {
+      rowDiagonal_[row] = cost;
+    }
+
+    /// Set the cost of sending the pair \p column of the second diagram to
+    /// the diagonal.
+    inline void setColumnDiagonal(const int &column, const double &cost) {
+      columnDiagonal_[column] = cost;
+    }
+
+    /// Set the size (n + m) up to which the square problem is solved by
+    /// LAPJV (512 by default).
+    inline int setLapjvThreshold(const int &lapjvThreshold) {
+      lapjvThreshold_ = lapjvThreshold;
+      return 0;
+    }
+
+    /// Solve the assignment problem.
+    /// The pairs sent to the diagonal are reported with a -1 index on the
+    /// other side.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int run(std::vector<std::tuple<int, int, double>> &matchings);
+
+  protected:
+    /// Set the initial (square problem) or greedy (rectangular problem)
+    /// assignment and dual variables, and list the free rows.
+    void initializeRectangular();
+    void initializeSquare();
+
+    /// Reduced cost of the edge (\p row, \p column).
+    double getReducedCost(const int &row, const int &column) const;
+
+    /// Update the distances of the columns through the row \p row, whose
+    /// assigned column is at the reduced distance \p offset.
+    void relaxRow(const int &row, const double &offset);
+
+    /// Assign the free row \p row along a shortest augmenting path.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int augment(const int &row);
+
+    int rowNumber_{};
+    int columnNumber_{};
+    int lapjvThreshold_{512};
+
+    // costs between the pairs (row-major) and to the diagonal
+    std::vector<double> costs_;
+    std::vector<double> rowDiagonal_;
+    std::vector<double> columnDiagonal_;
+
+    // Problem actually solved: rows and columns of the rectangular problem
+    // (the real columns followed by the dummy columns) or of the square one
+    // (the real rows or columns followed by the diagonal projections of the
+    // other diagram), the square costs being expanded in squareCosts_.
+    bool isSquare_{};
+    int problemRows_{};
+    int problemColumns_{};
+    std::vector<double> squareCosts_;
+
+    // assignment, column duals and free rows
+    std::vector<int> rowColumns_;
+    std::vector<int> columnRows_;
+    std::vector<double> duals_;
+    std::vector<int> freeRows_;
+
+    // shortest augmenting path state
+    std::vector<double> distances_;
+    std::vector<int> predecessors_;
+    std::vector<char> isReady_;
+    std::vector<int> readyColumns_;
+  };
+} // namespace ttk
+
+#endif // _DENSEASSIGNMENT_H
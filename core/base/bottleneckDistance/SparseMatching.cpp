@@ -0,0 +1,611 @@
+#include <IndexedHeap.h>
+#include <SparseMatching.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+using namespace ttk;
+
+void SparseMatching::PointGrid::build(const vector<array<double, 2>> &points,
+                                      const double &cellSize) {
+
+  points_ = &points;
+  const int pointNumber = points.size();
+  cellKeys_.clear();
+  cellPoints_.clear();
+  if(!pointNumber)
+    return;
+
+  array<double, 2> upper = points[0];
+  origin_ = points[0];
+  for(const auto &p : points) {
+    for(int k = 0; k < 2; ++k) {
+      origin_[k] = min(origin_[k], p[k]);
+      upper[k] = max(upper[k], p[k]);
+    }
+  }
+
+  // bound the resolution so that the cell keys fit in 64 bits
+  const double extent = max(upper[0] - origin_[0], upper[1] - origin_[1]);
+  cellSize_ = max(cellSize, extent / (1 << 20));
+  if(!(cellSize_ > 0))
+    cellSize_ = 1;
+  for(int k = 0; k < 2; ++k)
+    resolution_[k] = (long long)((upper[k] - origin_[k]) / cellSize_) + 1;
+
+  // the points are sorted by cell (row-major), only the non-empty cells are
+  // stored
+  vector<pair<long long, int>> keys(pointNumber);
+  for(int i = 0; i < pointNumber; ++i) {
+    long long cell[2];
+    for(int k = 0; k < 2; ++k)
+      cell[k] = min(resolution_[k] - 1,
+                    (long long)((points[i][k] - origin_[k]) / cellSize_));
+    keys[i] = make_pair(cell[1] * resolution_[0] + cell[0], i);
+  }
+  sort(keys.begin(), keys.end());
+
+  cellKeys_.resize(pointNumber);
+  cellPoints_.resize(pointNumber);
+  for(int i = 0; i < pointNumber; ++i) {
+    cellKeys_[i] = keys[i].first;
+    cellPoints_[i] = keys[i].second;
+  }
+}
+
+void SparseMatching::PointGrid::query(const array<double, 2> &center,
+                                      const double &radius,
+                                      vector<int> &neighbors) const {
+
+  neighbors.clear();
+  if(cellPoints_.empty())
+    return;
+
+  const auto &points = *points_;
+  const auto addPoint = [&](const int i) {
+    if(fabs(points[i][0] - center[0]) <= radius
+       and fabs(points[i][1] - center[1]) <= radius)
+      neighbors.push_back(i);
+  };
+
+  long long lower[2], upper[2];
+  for(int k = 0; k < 2; ++k) {
+    // clamp in floating point first (the radius may be huge)
+    const double l = (center[k] - radius - origin_[k]) / cellSize_;
+    const double u = (center[k] + radius - origin_[k]) / cellSize_;
+    if(u < 0 or l >= resolution_[k])
+      return;
+    lower[k] = max(0.0, floor(l));
+    upper[k] = min(resolution_[k] - 1.0, floor(u));
+  }
+
+  // large queries: a linear scan is cheaper than a search per cell row
+  if(upper[1] - lower[1] + 1 >= (long long)cellPoints_.size()) {
+    for(const auto i : cellPoints_)
+      addPoint(i);
+    return;
+  }
+
+  for(long long y = lower[1]; y <= upper[1]; ++y) {
+    const auto begin = lower_bound(
+      cellKeys_.begin(), cellKeys_.end(), y * resolution_[0] + lower[0]);
+    const auto end
+      = upper_bound(begin, cellKeys_.end(), y * resolution_[0] + upper[0]);
+    for(auto p = begin; p != end; ++p)
+      addPoint(cellPoints_[p - cellKeys_.begin()]);
+  }
+}
+
+int SparseMatching::setInput(const vector<array<double, 2>> &points1,
+                             const vector<array<double, 2>> &points2,
+                             const vector<double> &diagonal1,
+                             const vector<double> &diagonal2,
+                             const double &lowerBoundFactor,
+                             const function<double(int, int)> &distance) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(points1.size() != diagonal1.size() or points2.size() != diagonal2.size())
+    return -1;
+  if(lowerBoundFactor < 0)
+    return -2;
+#endif
+
+  Timer t;
+
+  rowNumber_ = points1.size();
+  columnNumber_ = points2.size();
+  rowDiagonal_ = diagonal1;
+  columnDiagonal_ = diagonal2;
+
+  // distance(i, j) <= diag1[i] + diag2[j] <= 2 * max(diag1[i], diag2[j]),
+  // the pair with the largest distance to the diagonal queries the other
+  // diagram (the slack avoids missing edges due to round-off errors)
+  const double scale
+    = lowerBoundFactor > 0 ? 2 * (1 + 1e-9) / lowerBoundFactor : 0;
+
+  // the cells of each grid are about as large as the queries it receives
+  const auto medianRadius = [scale](vector<double> radii) {
+    if(radii.empty())
+      return 0.0;
+    nth_element(radii.begin(), radii.begin() + radii.size() / 2, radii.end());
+    return scale * radii[radii.size() / 2];
+  };
+
+  PointGrid grid1, grid2;
+  if(lowerBoundFactor > 0) {
+    grid1.build(points1, medianRadius(diagonal2));
+    grid2.build(points2, medianRadius(diagonal1));
+  }
+
+  // a pair is never matched to a pair farther than their cumulated distances
+  // to the diagonal
+  vector<vector<pair<int, int>>> threadEdges(threadNumber_);
+  vector<vector<double>> threadWeights(threadNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+#endif
+    auto &edges = threadEdges[threadId];
+    auto &weights = threadWeights[threadId];
+    vector<int> neighbors;
+
+    const auto testEdge = [&](const int i, const int j) {
+      // cheap rejection with the lower bound first
+      const double bound = diagonal1[i] + diagonal2[j];
+      if(lowerBoundFactor
+           * max(fabs(points1[i][0] - points2[j][0]),
+                 fabs(points1[i][1] - points2[j][1]))
+         > bound)
+        return;
+      const double w = distance(i, j);
+      if(w <= bound) {
+        edges.emplace_back(i, j);
+        weights.push_back(w);
+      }
+    };
+
+    if(lowerBoundFactor > 0) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for(int i = 0; i < rowNumber_; ++i) {
+        grid2.query(points1[i], scale * diagonal1[i], neighbors);
+        for(const auto j : neighbors)
+          if(diagonal2[j] <= diagonal1[i])
+            testEdge(i, j);
+      }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for(int j = 0; j < columnNumber_; ++j) {
+        grid1.query(points2[j], scale * diagonal2[j], neighbors);
+        for(const auto i : neighbors)
+          if(diagonal1[i] < diagonal2[j])
+            testEdge(i, j);
+      }
+    } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for(int i = 0; i < rowNumber_; ++i)
+        for(int j = 0; j < columnNumber_; ++j)
+          testEdge(i, j);
+    }
+  }
+
+  // sort the edges by row (counting sort), then by weight within each row
+  rowOffsets_.assign(rowNumber_ + 1, 0);
+  for(const auto &edges : threadEdges)
+    for(const auto &e : edges)
+      ++rowOffsets_[e.first + 1];
+  for(int i = 0; i < rowNumber_; ++i)
+    rowOffsets_[i + 1] += rowOffsets_[i];
+
+  const LongSimplexId edgeNumber = rowOffsets_[rowNumber_];
+  vector<LongSimplexId> fill(rowOffsets_.begin(), rowOffsets_.end() - 1);
+  edgeRows_.resize(edgeNumber);
+  edgeColumns_.resize(edgeNumber);
+  edgeWeights_.resize(edgeNumber);
+  for(size_t k = 0; k < threadEdges.size(); ++k) {
+    for(size_t e = 0; e < threadEdges[k].size(); ++e) {
+      const int i = threadEdges[k][e].first;
+      const LongSimplexId id = fill[i]++;
+      edgeRows_[id] = i;
+      edgeColumns_[id] = threadEdges[k][e].second;
+      edgeWeights_[id] = threadWeights[k][e];
+    }
+    threadEdges[k] = {};
+    threadWeights[k] = {};
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    vector<pair<double, int>> rowEdges;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+    for(int i = 0; i < rowNumber_; ++i) {
+      rowEdges.clear();
+      for(LongSimplexId e = rowOffsets_[i]; e < rowOffsets_[i + 1]; ++e)
+        rowEdges.emplace_back(edgeWeights_[e], edgeColumns_[e]);
+      sort(rowEdges.begin(), rowEdges.end());
+      for(size_t k = 0; k < rowEdges.size(); ++k) {
+        edgeWeights_[rowOffsets_[i] + k] = rowEdges[k].first;
+        edgeColumns_[rowOffsets_[i] + k] = rowEdges[k].second;
+      }
+    }
+  }
+
+  columnOffsets_.assign(columnNumber_ + 1, 0);
+  for(const auto c : edgeColumns_)
+    ++columnOffsets_[c + 1];
+  for(int j = 0; j < columnNumber_; ++j)
+    columnOffsets_[j + 1] += columnOffsets_[j];
+
+  fill.assign(columnOffsets_.begin(), columnOffsets_.end() - 1);
+  columnEdges_.resize(edgeNumber);
+  for(LongSimplexId e = 0; e < edgeNumber; ++e)
+    columnEdges_[fill[edgeColumns_[e]]++] = e;
+
+  {
+    stringstream msg;
+    msg << "[SparseMatching] " << edgeNumber << " candidate edge(s) for "
+        << rowNumber_ << "x" << columnNumber_ << " pairs, built in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
+
+void SparseMatching::buildThresholdGraph() {
+
+  const int vertexNumber = rowNumber_ + columnNumber_;
+  const LongSimplexId edgeNumber = edgeColumns_.size();
+
+  // The neighbors of each left vertex are sorted by weight: the graph of a
+  // given threshold only keeps a prefix of each list.
+  leftOffsets_.resize(vertexNumber + 1);
+  leftNeighbors_.resize(2 * edgeNumber + vertexNumber);
+  leftWeights_.resize(leftNeighbors_.size());
+  leftOffsets_[0] = 0;
+  LongSimplexId n = 0;
+  for(int i = 0; i < rowNumber_; ++i) {
+    bool isDiagonalAdded = false;
+    for(LongSimplexId e = rowOffsets_[i]; e < rowOffsets_[i + 1]; ++e) {
+      if(!isDiagonalAdded and rowDiagonal_[i] < edgeWeights_[e]) {
+        leftNeighbors_[n] = columnNumber_ + i;
+        leftWeights_[n++] = rowDiagonal_[i];
+        isDiagonalAdded = true;
+      }
+      leftNeighbors_[n] = edgeColumns_[e];
+      leftWeights_[n++] = edgeWeights_[e];
+    }
+    if(!isDiagonalAdded) {
+      leftNeighbors_[n] = columnNumber_ + i;
+      leftWeights_[n++] = rowDiagonal_[i];
+    }
+    leftOffsets_[i + 1] = n;
+  }
+  for(int j = 0; j < columnNumber_; ++j) {
+    // two diagonal projections are at distance 0, but they only need to be
+    // connected if their pairs may be matched together
+    for(LongSimplexId e = columnOffsets_[j]; e < columnOffsets_[j + 1]; ++e) {
+      leftNeighbors_[n] = columnNumber_ + edgeRows_[columnEdges_[e]];
+      leftWeights_[n++] = 0;
+    }
+    leftNeighbors_[n] = j;
+    leftWeights_[n++] = columnDiagonal_[j];
+    leftOffsets_[rowNumber_ + j + 1] = n;
+  }
+
+  leftEnds_.resize(vertexNumber);
+  leftMatch_.assign(vertexNumber, -1);
+  rightMatch_.assign(vertexNumber, -1);
+  layers_.resize(vertexNumber);
+  nextNeighbor_.resize(vertexNumber);
+}
+
+bool SparseMatching::isThresholdFeasible(const double &threshold) {
+
+  const int vertexNumber = rowNumber_ + columnNumber_;
+
+  // threshold graph
+  for(int l = 0; l < vertexNumber; ++l)
+    leftEnds_[l] = upper_bound(leftWeights_.begin() + leftOffsets_[l],
+                               leftWeights_.begin() + leftOffsets_[l + 1],
+                               threshold)
+                   - leftWeights_.begin();
+
+  // keep the edges of the current matching which are still in the graph
+  int matchingSize = 0;
+  for(int l = 0; l < vertexNumber; ++l) {
+    const LongSimplexId n = leftMatch_[l];
+    if(n == -1)
+      continue;
+    if(n >= leftEnds_[l]) {
+      rightMatch_[leftNeighbors_[n]] = -1;
+      leftMatch_[l] = -1;
+    } else
+      ++matchingSize;
+  }
+
+  // Hopcroft-Karp
+  const int infinity = numeric_limits<int>::max();
+  vector<int> queue, stack;
+  queue.reserve(vertexNumber);
+  while(true) {
+    // breadth-first search from the free left vertices
+    queue.clear();
+    for(int l = 0; l < vertexNumber; ++l) {
+      if(leftMatch_[l] == -1) {
+        layers_[l] = 0;
+        queue.push_back(l);
+      } else
+        layers_[l] = infinity;
+    }
+    bool isAugmentable = false;
+    for(size_t q = 0; q < queue.size(); ++q) {
+      const int l = queue[q];
+      for(LongSimplexId n = leftOffsets_[l]; n < leftEnds_[l]; ++n) {
+        const int l2 = rightMatch_[leftNeighbors_[n]];
+        if(l2 == -1)
+          isAugmentable = true;
+        else if(layers_[l2] == infinity) {
+          layers_[l2] = layers_[l] + 1;
+          queue.push_back(l2);
+        }
+      }
+    }
+    if(!isAugmentable)
+      break;
+
+    // vertex-disjoint augmenting paths along the layers (iterative
+    // depth-first search)
+    for(int l = 0; l < vertexNumber; ++l)
+      nextNeighbor_[l] = leftOffsets_[l];
+    for(int root = 0; root < vertexNumber; ++root) {
+      if(leftMatch_[root] != -1)
+        continue;
+      stack.assign(1, root);
+      while(!stack.empty()) {
+        const int l = stack.back();
+        if(nextNeighbor_[l] == leftEnds_[l]) {
+          layers_[l] = infinity;
+          stack.pop_back();
+          continue;
+        }
+        const int l2 = rightMatch_[leftNeighbors_[nextNeighbor_[l]]];
+        if(l2 == -1) {
+          for(const auto v : stack) {
+            leftMatch_[v] = nextNeighbor_[v];
+            rightMatch_[leftNeighbors_[nextNeighbor_[v]]] = v;
+          }
+          ++matchingSize;
+          break;
+        }
+        if(layers_[l2] != infinity and layers_[l2] == layers_[l] + 1)
+          stack.push_back(l2);
+        else
+          ++nextNeighbor_[l];
+      }
+    }
+  }
+
+  return matchingSize == vertexNumber;
+}
+
+int SparseMatching::runBottleneck(vector<tuple<int, int, double>> &matchings) {
+
+  Timer t;
+
+  buildThresholdGraph();
+
+  // each pair is at least matched with its closest candidate (the first
+  // neighbor of each row)
+  double lowerBound = 0;
+  for(int i = 0; i < rowNumber_; ++i)
+    lowerBound = max(lowerBound, leftWeights_[leftOffsets_[i]]);
+  for(int j = 0; j < columnNumber_; ++j) {
+    double closest = columnDiagonal_[j];
+    for(LongSimplexId e = columnOffsets_[j]; e < columnOffsets_[j + 1]; ++e)
+      closest = min(closest, edgeWeights_[columnEdges_[e]]);
+    lowerBound = max(lowerBound, closest);
+  }
+
+  vector<double> thresholds;
+  thresholds.reserve(leftWeights_.size() + 1);
+  thresholds.push_back(lowerBound);
+  for(const auto w : leftWeights_)
+    if(w > lowerBound)
+      thresholds.push_back(w);
+  sort(thresholds.begin(), thresholds.end());
+  thresholds.erase(
+    unique(thresholds.begin(), thresholds.end()), thresholds.end());
+
+  // galloping search from the lower bound (the bottleneck is usually close
+  // to it, and the matching is then only grown), followed by a binary search
+  // (the largest threshold is feasible: every pair can be sent to the
+  // diagonal)
+  int lower = 0, upper = (int)thresholds.size() - 1;
+  int testedThreshold = -1;
+  for(int step = 1; lower < upper; step *= 2) {
+    const int next = min(lower + step - 1, upper);
+    testedThreshold = next;
+    if(isThresholdFeasible(thresholds[next])) {
+      upper = next;
+      break;
+    }
+    lower = next + 1;
+  }
+  while(lower < upper) {
+    const int middle = (lower + upper) / 2;
+    testedThreshold = middle;
+    if(isThresholdFeasible(thresholds[middle]))
+      upper = middle;
+    else
+      lower = middle + 1;
+  }
+  if(testedThreshold != lower)
+    isThresholdFeasible(thresholds[lower]);
+
+  matchings.clear();
+  for(int i = 0; i < rowNumber_; ++i) {
+    const LongSimplexId n = leftMatch_[i];
+    const int j = leftNeighbors_[n];
+    if(j >= columnNumber_)
+      matchings.emplace_back(i, -1, rowDiagonal_[i]);
+    else
+      matchings.emplace_back(i, j, leftWeights_[n]);
+  }
+  for(int j = 0; j < columnNumber_; ++j)
+    if(rightMatch_[j] >= rowNumber_)
+      matchings.emplace_back(-1, j, columnDiagonal_[j]);
+
+  {
+    stringstream msg;
+    msg << "[SparseMatching] Bottleneck " << thresholds[lower] << " found in "
+        << t.getElapsedTime() << " s." << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
+
+int SparseMatching::runWasserstein(
+  vector<tuple<int, int, double>> &matchings) {
+
+  Timer t;
+
+  // Each row is either matched along a candidate edge or sent to the diagonal
+  // (through a private dummy column), the unmatched columns being sent to the
+  // diagonal. With the costs relative to the diagonal (non positive on the
+  // candidate edges), this is a rectangular assignment problem; shifting the
+  // costs of each row by a constant makes them non negative without changing
+  // the optimal assignment.
+  const LongSimplexId edgeNumber = edgeColumns_.size();
+  vector<double> rowShifts(rowNumber_, 0);
+  vector<double> costs(edgeNumber);
+  for(int i = 0; i < rowNumber_; ++i) {
+    for(LongSimplexId e = rowOffsets_[i]; e < rowOffsets_[i + 1]; ++e) {
+      costs[e] = edgeWeights_[e] - rowDiagonal_[i]
+                 - columnDiagonal_[edgeColumns_[e]];
+      rowShifts[i] = min(rowShifts[i], costs[e]);
+    }
+    for(LongSimplexId e = rowOffsets_[i]; e < rowOffsets_[i + 1]; ++e)
+      costs[e] -= rowShifts[i];
+  }
+
+  // columns: the pairs of the second diagram, then the dummy columns
+  const int columnNumber = columnNumber_ + rowNumber_;
+  const double infinity = numeric_limits<double>::max();
+  vector<double> potentials(columnNumber, 0);
+  vector<double> distances(columnNumber, infinity);
+  vector<int> columnRows(columnNumber, -1);
+  vector<int> rowColumns(rowNumber_, -1);
+  vector<LongSimplexId> rowEdges(rowNumber_, -1);
+  vector<double> rowCosts(rowNumber_, 0);
+  vector<int> predecessors(columnNumber);
+  vector<LongSimplexId> predecessorEdges(columnNumber);
+  vector<char> isScanned(columnNumber, false);
+  vector<int> touched, scanned;
+  IndexedHeap<double, less<double>> heap;
+  heap.reserve(columnNumber, columnNumber);
+
+  // shortest augmenting path from each row (Dijkstra on the columns, with
+  // non negative reduced costs thanks to the column potentials)
+  for(int s = 0; s < rowNumber_; ++s) {
+
+    // relax the edges of the row i, reached with the distance base
+    const auto relaxRow = [&](const int i, const double base) {
+      for(LongSimplexId e = rowOffsets_[i]; e <= rowOffsets_[i + 1]; ++e) {
+        const bool isDummy = (e == rowOffsets_[i + 1]);
+        const int c = isDummy ? columnNumber_ + i : edgeColumns_[e];
+        if(isScanned[c])
+          continue;
+        const double d
+          = base + (isDummy ? -rowShifts[i] : costs[e]) - potentials[c];
+        if(d < distances[c]) {
+          if(distances[c] == infinity)
+            touched.push_back(c);
+          distances[c] = d;
+          predecessors[c] = i;
+          predecessorEdges[c] = isDummy ? -1 : e;
+          heap.push(c, d);
+        }
+      }
+    };
+
+    relaxRow(s, 0);
+    int sink = -1;
+    while(!heap.empty()) {
+      const int c = heap.pop();
+      isScanned[c] = true;
+      scanned.push_back(c);
+      const int i = columnRows[c];
+      if(i == -1) {
+        sink = c;
+        break;
+      }
+      relaxRow(i, distances[c] - (rowCosts[i] - potentials[c]));
+    }
+
+    // update the potentials of the scanned columns
+    const double sinkDistance = distances[sink];
+    for(const auto c : scanned)
+      potentials[c] += distances[c] - sinkDistance;
+
+    // augment along the shortest path
+    for(int c = sink;;) {
+      const int i = predecessors[c];
+      const LongSimplexId e = predecessorEdges[c];
+      const int previous = rowColumns[i];
+      rowColumns[i] = c;
+      rowEdges[i] = e;
+      rowCosts[i] = (e == -1 ? -rowShifts[i] : costs[e]);
+      columnRows[c] = i;
+      if(i == s)
+        break;
+      c = previous;
+    }
+
+    for(const auto c : touched) {
+      distances[c] = infinity;
+      isScanned[c] = false;
+    }
+    touched.clear();
+    scanned.clear();
+    heap.clear();
+  }
+
+  matchings.clear();
+  for(int i = 0; i < rowNumber_; ++i) {
+    const LongSimplexId e = rowEdges[i];
+    if(e == -1)
+      matchings.emplace_back(i, -1, rowDiagonal_[i]);
+    else
+      matchings.emplace_back(i, edgeColumns_[e], edgeWeights_[e]);
+  }
+  for(int j = 0; j < columnNumber_; ++j)
+    if(columnRows[j] == -1)
+      matchings.emplace_back(-1, j, columnDiagonal_[j]);
+
+  {
+    stringstream msg;
+    msg << "[SparseMatching] Assignment found in " << t.getElapsedTime()
+        << " s." << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
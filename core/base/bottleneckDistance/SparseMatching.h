@@ -0,0 +1,162 @@
+/// \ingroup base
+/// \class ttk::SparseMatching
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Sparse, geometry-pruned matching of two persistence diagrams.
+///
+/// %SparseMatching solves the assignment problems of ttk::BottleneckDistance
+/// without building the dense (n + 1) x (m + 1) cost matrices of ttk::Munkres
+/// and ttk::GabowTarjan, whose quadratic memory footprint alone prevents the
+/// comparison of large diagrams.
+///
+/// A pair of the first diagram is never matched to a pair of the second
+/// diagram which is farther than their cumulated distances to the diagonal
+/// (sending both pairs to the diagonal is cheaper). Provided that the
+/// distance is bounded from below by the L-infinity distance of the
+/// (birth, death) coordinates (up to a factor), the candidate edges are
+/// enumerated with a grid over the diagram points: the pair \p i of
+/// the first diagram is only tested against the pairs \p j of the second one
+/// within a radius of 2 * max(diag1[i], diag2[j]) (queried from the side of
+/// the pair with the largest distance to the diagonal).
+///
+/// Then:
+///   - the Wasserstein problem is solved by successive shortest augmenting
+///   paths (Hungarian algorithm, with Dijkstra on the sparse edges and dual
+///   potentials), each pair being either matched along a candidate edge or
+///   sent to the diagonal;
+///   - the bottleneck problem is solved by a (galloping) binary search over
+///   the candidate weights, the feasibility of each threshold being tested by
+///   Hopcroft-Karp on the sparse graph augmented with the diagonal
+///   projections of the pairs (two projections being connected only if their
+///   pairs share a candidate edge).
+///
+/// Both solvers are exact: they return the same distance as the dense solvers.
+///
+/// \sa ttk::BottleneckDistance
+
+#ifndef _SPARSEMATCHING_H
+#define _SPARSEMATCHING_H
+
+#include <DataTypes.h>
+#include <Debug.h>
+
+#include <array>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace ttk {
+
+  class SparseMatching : public Debug {
+
+  public:
+    SparseMatching() {
+    }
+
+    ~SparseMatching() {
+    }
+
+    /// Enumerate the candidate edges between the pairs of the two diagrams.
+    /// \param points1 (birth, death) coordinates of the pairs of the first
+    /// diagram.
+    /// \param points2 (birth, death) coordinates of the pairs of the second
+    /// diagram.
+    /// \param diagonal1 Distances to the diagonal of the pairs of the first
+    /// diagram.
+    /// \param diagonal2 Distances to the diagonal of the pairs of the second
+    /// diagram.
+    /// \param lowerBoundFactor Factor c such that distance(i, j) is larger
+    /// than c times the L-infinity distance between points1[i] and
+    /// points2[j] (if c is zero, all the couples of pairs are tested).
+    /// \param distance Distance between the pair i of the first diagram and
+    /// the pair j of the second diagram.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setInput(const std::vector<std::array<double, 2>> &points1,
+                 const std::vector<std::array<double, 2>> &points2,
+                 const std::vector<double> &diagonal1,
+                 const std::vector<double> &diagonal2,
+                 const double &lowerBoundFactor,
+                 const std::function<double(int, int)> &distance);
+
+    /// Get the number of candidate edges (without the diagonal edges).
+    inline size_t getNumberOfEdges() const {
+      return edgeColumns_.size();
+    }
+
+    /// Solve the bottleneck assignment problem.
+    /// The pairs sent to the diagonal are reported with a -1 index on the
+    /// other side.
+    int runBottleneck(std::vector<std::tuple<int, int, double>> &matchings);
+
+    /// Solve the Wasserstein assignment problem (the distances being already
+    /// raised to the desired power).
+    /// The pairs sent to the diagonal are reported with a -1 index on the
+    /// other side.
+    int runWasserstein(std::vector<std::tuple<int, int, double>> &matchings);
+
+  protected:
+    /// Uniform grid over a set of points. Only the non-empty cells are
+    /// stored (sorted keys), so that the cells can be as small as the
+    /// queries.
+    class PointGrid {
+    public:
+      void build(const std::vector<std::array<double, 2>> &points,
+                 const double &cellSize);
+
+      /// Collect the points within a L-infinity distance \p radius of
+      /// \p center.
+      void query(const std::array<double, 2> &center,
+                 const double &radius,
+                 std::vector<int> &neighbors) const;
+
+    protected:
+      const std::vector<std::array<double, 2>> *points_{};
+      std::array<double, 2> origin_{};
+      double cellSize_{1};
+      std::array<long long, 2> resolution_{};
+      std::vector<long long> cellKeys_;
+      std::vector<int> cellPoints_;
+    };
+
+    /// Build the bipartite graph used by Hopcroft-Karp, with the neighbors
+    /// of each left vertex sorted by weight.
+    void buildThresholdGraph();
+
+    /// Test if a perfect matching of the threshold graph exists, starting
+    /// from the current matching (the edges above the threshold are removed
+    /// from it first).
+    bool isThresholdFeasible(const double &threshold);
+
+    int rowNumber_{};
+    int columnNumber_{};
+    std::vector<double> rowDiagonal_;
+    std::vector<double> columnDiagonal_;
+
+    // candidate edges, sorted by row (CSR); the edge identifiers and the
+    // offsets may exceed the range of int for large diagrams
+    std::vector<LongSimplexId> rowOffsets_;
+    std::vector<int> edgeRows_;
+    std::vector<int> edgeColumns_;
+    std::vector<double> edgeWeights_;
+
+    // candidate edges, sorted by column (edge identifiers)
+    std::vector<LongSimplexId> columnOffsets_;
+    std::vector<LongSimplexId> columnEdges_;
+
+    // Hopcroft-Karp state: the left vertices are the rows followed by the
+    // diagonal projections of the columns, the right vertices are the
+    // columns followed by the diagonal projections of the rows. The matching
+    // of a left vertex is stored as a position in its neighbor list.
+    std::vector<LongSimplexId> leftOffsets_;
+    std::vector<int> leftNeighbors_;
+    std::vector<double> leftWeights_;
+    std::vector<LongSimplexId> leftEnds_;
+    std::vector<LongSimplexId> leftMatch_;
+    std::vector<int> rightMatch_;
+    std::vector<int> layers_;
+    std::vector<LongSimplexId> nextNeighbor_;
+  };
+} // namespace ttk
+
+#endif // _SPARSEMATCHING_H
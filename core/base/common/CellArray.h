@@ -0,0 +1,131 @@
+/// \ingroup base
+/// \class ttk::CellArray
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Read-only, non-owning view on the cells of a (homogeneous)
+/// triangulation.
+///
+/// %CellArray gives uniform access to the vertices of the cells of a mesh
+/// stored in any of the following layouts, without copying them:
+///   - the legacy VTK layout: for each cell, its number of vertices followed
+///   by its vertex identifiers (count-prefixed);
+///   - the VTK 9 layout: a connectivity array (vertex identifiers, cell after
+///   cell) and an offsets array (position of the first vertex of each cell
+///   in the connectivity array, with one additional trailing entry);
+///   - a connectivity array only, for homogeneous meshes (tetrahedra,
+///   triangles, edges) where the number of vertices per cell is known.
+///
+/// Identifiers may be stored on 32 bits (int) or 64 bits (LongSimplexId).
+/// In all cases, TTK expects all the cells to have the same number of
+/// vertices, so the vertices are accessed with a constant stride (the
+/// offsets, if any, are only checked, see isHomogeneous()).
+///
+/// \sa ttk::ExplicitTriangulation
+
+#ifndef _CELLARRAY_H
+#define _CELLARRAY_H
+
+#include <DataTypes.h>
+
+#include <cstddef>
+
+namespace ttk {
+
+  class CellArray {
+
+  public:
+    CellArray()
+      : connectivity32_(NULL), connectivity64_(NULL), stride_(0),
+        vertexNumber_(0) {
+    }
+
+    /// Legacy (count-prefixed) layout, 64-bit identifiers.
+    /// \param cellArray Pointer to a contiguous array of cells. Each entry
+    /// starts by the number of vertices in the cell, followed by the vertex
+    /// identifiers of the cell.
+    CellArray(const LongSimplexId *cellArray)
+      : connectivity32_(NULL), connectivity64_(NULL), stride_(0),
+        vertexNumber_(0) {
+      if(cellArray) {
+        connectivity64_ = cellArray + 1;
+        vertexNumber_ = cellArray[0];
+        stride_ = vertexNumber_ + 1;
+      }
+    }
+
+    /// Legacy (count-prefixed) layout, 32-bit identifiers.
+    /// \param cellArray Pointer to a contiguous array of cells. Each entry
+    /// starts by the number of vertices in the cell, followed by the vertex
+    /// identifiers of the cell.
+    CellArray(const int *cellArray)
+      : connectivity32_(NULL), connectivity64_(NULL), stride_(0),
+        vertexNumber_(0) {
+      if(cellArray) {
+        connectivity32_ = cellArray + 1;
+        vertexNumber_ = cellArray[0];
+        stride_ = vertexNumber_ + 1;
+      }
+    }
+
+    /// Connectivity-only layout (homogeneous meshes), 64-bit identifiers.
+    /// \param connectivity Pointer to the vertex identifiers of the cells,
+    /// cell after cell.
+    /// \param vertexNumber Number of vertices per cell.
+    CellArray(const LongSimplexId *connectivity, const int &vertexNumber)
+      : connectivity32_(NULL), connectivity64_(connectivity),
+        stride_(vertexNumber), vertexNumber_(vertexNumber) {
+    }
+
+    /// Connectivity-only layout (homogeneous meshes), 32-bit identifiers.
+    /// \param connectivity Pointer to the vertex identifiers of the cells,
+    /// cell after cell.
+    /// \param vertexNumber Number of vertices per cell.
+    CellArray(const int *connectivity, const int &vertexNumber)
+      : connectivity32_(connectivity), connectivity64_(NULL),
+        stride_(vertexNumber), vertexNumber_(vertexNumber) {
+    }
+
+    inline bool empty() const {
+      return (!connectivity32_) && (!connectivity64_);
+    }
+
+    /// Get the \p localVertexId-th vertex of the \p cellId-th cell (no
+    /// sanity check).
+    inline LongSimplexId getCellVertex(const LongSimplexId &cellId,
+                                       const int &localVertexId) const {
+      if(connectivity64_)
+        return connectivity64_[stride_ * cellId + localVertexId];
+      return connectivity32_[stride_ * cellId + localVertexId];
+    }
+
+    /// Get the number of vertices of the cells.
+    inline int getCellVertexNumber() const {
+      return vertexNumber_;
+    }
+
+    /// Check that a VTK 9 offsets array describes cells of
+    /// getCellVertexNumber() vertices each.
+    /// \param cellNumber Number of cells.
+    /// \param offsets Offsets array (cellNumber + 1 entries).
+    /// \return Returns true if all the cells have the same number of
+    /// vertices.
+    template <typename idType>
+    inline bool isHomogeneous(const SimplexId &cellNumber,
+                              const idType *offsets) const {
+      for(SimplexId i = 0; i <= cellNumber; i++) {
+        if(offsets[i] != (LongSimplexId)i * vertexNumber_)
+          return false;
+      }
+      return true;
+    }
+
+  protected:
+    const int *connectivity32_;
+    const LongSimplexId *connectivity64_;
+    LongSimplexId stride_;
+    int vertexNumber_;
+  };
+} // namespace ttk
+
+#endif // _CELLARRAY_H
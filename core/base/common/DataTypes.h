@@ -34,6 +34,10 @@ namespace ttk {
   /// default name for offset scalar field
   const char OffsetScalarFieldName[] = "ttkOffsetScalarField";
 
+  /// default name for order scalar field (rank of each vertex in the order
+  /// of a scalar field, see ttk::VertexOrder)
+  const char OrderScalarFieldName[] = "ttkOrderScalarField";
+
   /// default name for bivariate offset fields
   const char OffsetFieldUName[] = "ttkOffsetFieldU";
   const char OffsetFieldVName[] = "ttkOffsetFieldV";
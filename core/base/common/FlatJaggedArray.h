@@ -0,0 +1,199 @@
+/// \ingroup base
+/// \class ttk::FlatJaggedArray
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Compressed (offsets + data) storage for jagged tables of simplex
+/// identifiers.
+///
+/// %FlatJaggedArray replaces std::vector<std::vector<SimplexId>> tables (one
+/// heap allocation and one std::vector header per row) by two contiguous
+/// arrays, in the spirit of the CSR sparse matrix format:
+///   - offsets_ stores, for each row, the position of its first entry in
+///   data_ (with one additional trailing entry holding the total size);
+///   - data_ stores all the entries, row after row.
+///
+/// The offsets are stored as size_t, so that the total number of entries
+/// may exceed the range of SimplexId (for instance the vertex stars of a
+/// mesh with more than 2^31 / 4 tetrahedra).
+///
+/// \sa ttk::AbstractTriangulation
+
+#ifndef _FLATJAGGEDARRAY_H
+#define _FLATJAGGEDARRAY_H
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  class FlatJaggedArray {
+
+  public:
+    /// Read-only view on one row of a FlatJaggedArray.
+    class Slice {
+    public:
+      Slice(const SimplexId *begin, const SimplexId *end)
+        : begin_(begin), end_(end) {
+      }
+
+      inline const SimplexId *begin() const {
+        return begin_;
+      }
+
+      inline const SimplexId *end() const {
+        return end_;
+      }
+
+      inline bool empty() const {
+        return begin_ == end_;
+      }
+
+      inline size_t size() const {
+        return end_ - begin_;
+      }
+
+      inline const SimplexId &operator[](const size_t &i) const {
+        return begin_[i];
+      }
+
+    private:
+      const SimplexId *begin_, *end_;
+    };
+
+    /// Release the memory of the table.
+    inline void clear() {
+      std::vector<size_t>().swap(offsets_);
+      std::vector<SimplexId>().swap(data_);
+    }
+
+    /// Total number of entries in the table (all rows together).
+    inline size_t dataSize() const {
+      return data_.size();
+    }
+
+    inline bool empty() const {
+      return offsets_.empty();
+    }
+
+    /// Fill the table from the row sizes and the (already flattened) entries.
+    /// \param rowSizes Number of entries of each row.
+    /// \param data Entries of all the rows, stored contiguously (the content
+    /// is moved into the table).
+    inline void fillFrom(const std::vector<SimplexId> &rowSizes,
+                         std::vector<SimplexId> &&data) {
+      setOffsets(rowSizes);
+      data_ = std::move(data);
+    }
+
+    /// Fill the table row by row.
+    /// \param rowNumber Number of rows.
+    /// \param rowSize Functor returning the number of entries of a row.
+    /// \param getEntry Functor writing the \p j-th entry of the \p i-th row
+    /// into its last argument, for instance a triangulation traversal method
+    /// such as getVertexStar().
+    template <typename rowSizeType, typename entryType>
+    inline void fillRows(const SimplexId &rowNumber,
+                         const rowSizeType &rowSize,
+                         const entryType &getEntry) {
+      std::vector<SimplexId> rowSizes(rowNumber);
+      for(SimplexId i = 0; i < rowNumber; i++) {
+        rowSizes[i] = rowSize(i);
+      }
+      setRowSizes(rowSizes);
+      for(SimplexId i = 0; i < rowNumber; i++) {
+        for(SimplexId j = 0; j < rowSizes[i]; j++) {
+          getEntry(i, j, data_[offsets_[i] + j]);
+        }
+      }
+    }
+
+    /// Memory footprint of the table, in bytes.
+    inline size_t footprint() const {
+      return offsets_.size() * sizeof(size_t)
+             + data_.size() * sizeof(SimplexId);
+    }
+
+    /// Memory footprint the same table would have if it were stored as a
+    /// std::vector of std::vector, in bytes.
+    inline size_t jaggedFootprint() const {
+      if(empty())
+        return 0;
+      return subvectorsNumber() * sizeof(std::vector<SimplexId>)
+             + data_.size() * sizeof(SimplexId);
+    }
+
+    /// Get the \p localId-th entry of the \p id-th row.
+    inline SimplexId get(const SimplexId &id, const SimplexId &localId) const {
+      return data_[offsets_[id] + localId];
+    }
+
+    /// Initialize the offsets from the row sizes and allocate (without
+    /// filling) the entries. The entries can then be written with set().
+    inline void setRowSizes(const std::vector<SimplexId> &rowSizes) {
+      setOffsets(rowSizes);
+      data_.resize(offsets_.back());
+    }
+
+    /// Set the \p localId-th entry of the \p id-th row.
+    inline void
+      set(const SimplexId &id, const SimplexId &localId, const SimplexId &v) {
+      data_[offsets_[id] + localId] = v;
+    }
+
+    /// Shrink each row to its first entries, for the tables whose rows are
+    /// allocated with an upper bound of their size (see setRowSizes()) and
+    /// filled in parallel.
+    /// \param rowSizes New number of entries of each row (lower than or
+    /// equal to the current one).
+    inline void shrinkRows(const std::vector<SimplexId> &rowSizes) {
+      size_t position = 0;
+      for(size_t i = 0; i < rowSizes.size(); i++) {
+        const size_t begin = offsets_[i];
+        if(position != begin) {
+          std::copy(data_.begin() + begin,
+                    data_.begin() + begin + rowSizes[i],
+                    data_.begin() + position);
+        }
+        offsets_[i] = position;
+        position += rowSizes[i];
+      }
+      offsets_.back() = position;
+      data_.resize(position);
+      data_.shrink_to_fit();
+    }
+
+    /// Number of entries in the \p id-th row.
+    inline SimplexId size(const SimplexId &id) const {
+      return offsets_[id + 1] - offsets_[id];
+    }
+
+    /// Number of rows in the table.
+    inline SimplexId subvectorsNumber() const {
+      return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    inline Slice operator[](const SimplexId &id) const {
+      return Slice(
+        data_.data() + offsets_[id], data_.data() + offsets_[id + 1]);
+    }
+
+  protected:
+    inline void setOffsets(const std::vector<SimplexId> &rowSizes) {
+      offsets_.resize(rowSizes.size() + 1);
+      offsets_[0] = 0;
+      for(size_t i = 0; i < rowSizes.size(); i++) {
+        offsets_[i + 1] = offsets_[i] + rowSizes[i];
+      }
+    }
+
+    std::vector<size_t> offsets_;
+    std::vector<SimplexId> data_;
+  };
+} // namespace ttk
+
+#endif // _FLATJAGGEDARRAY_H
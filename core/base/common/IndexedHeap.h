@@ -0,0 +1,188 @@
+/// \ingroup base
+/// \class ttk::IndexedHeap
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Addressable d-ary min-heap of elements identified by integers.
+///
+/// %IndexedHeap replaces the std::set instances used as priority queues in
+/// the sweeps of the topological simplification algorithms (one node
+/// allocation per insertion, pointer chasing on every pop) by an implicit
+/// d-ary heap stored in a contiguous array. Each element is identified by an
+/// integer handle (typically a vertex or a v-path identifier) in [0, n), and
+/// the position of each element in the heap is recorded, which allows to
+/// change the key of an element (decrease-key or increase-key) or to erase it
+/// in logarithmic time.
+///
+/// The top of the heap is the smallest key according to \p Compare (a strict
+/// weak ordering, as for std::set). If the keys are all distinct (for
+/// instance if they include the element identifier, as in the sweeps of
+/// TTK), the elements are popped in the same order as they would be
+/// iterated in a std::set<keyType, Compare>.
+///
+/// \sa ttk::DiscreteGradient
+/// \sa ttk::TopologicalSimplification
+
+#ifndef _INDEXEDHEAP_H
+#define _INDEXEDHEAP_H
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  template <typename keyType, typename Compare, int arity = 4>
+  class IndexedHeap {
+
+  public:
+    IndexedHeap(const Compare &cmp = Compare()) : cmp_(cmp) {
+    }
+
+    /// Remove all the elements (the memory is kept for later use).
+    inline void clear() {
+      for(const auto &e : heap_)
+        positions_[e.second] = -1;
+      heap_.clear();
+    }
+
+    inline bool empty() const {
+      return heap_.empty();
+    }
+
+    inline size_t size() const {
+      return heap_.size();
+    }
+
+    /// Prepare the heap for the handles [0, \p handleNumber) and for
+    /// \p elementNumber simultaneous elements.
+    inline void reserve(const SimplexId &handleNumber,
+                        const size_t &elementNumber) {
+      if((SimplexId)positions_.size() < handleNumber)
+        positions_.resize(handleNumber, -1);
+      heap_.reserve(elementNumber);
+    }
+
+    /// Check if the element \p id is in the heap.
+    inline bool contains(const SimplexId &id) const {
+      return id < (SimplexId)positions_.size() and positions_[id] != -1;
+    }
+
+    /// Get the key of the element \p id (no sanity check).
+    inline const keyType &getKey(const SimplexId &id) const {
+      return heap_[positions_[id]].first;
+    }
+
+    /// Get the identifier of the top element (no sanity check).
+    inline SimplexId top() const {
+      return heap_[0].second;
+    }
+
+    /// Get the key of the top element (no sanity check).
+    inline const keyType &topKey() const {
+      return heap_[0].first;
+    }
+
+    /// Remove the top element and return its identifier (no sanity check).
+    inline SimplexId pop() {
+      const SimplexId id = heap_[0].second;
+      removeAt(0);
+      return id;
+    }
+
+    /// Insert the element \p id with the key \p key. If \p id is already in
+    /// the heap, its key is replaced (either increased or decreased).
+    inline void push(const SimplexId &id, const keyType &key) {
+      if(contains(id)) {
+        update(id, key);
+        return;
+      }
+      if(id >= (SimplexId)positions_.size())
+        positions_.resize(id + 1, -1);
+      heap_.emplace_back(key, id);
+      positions_[id] = heap_.size() - 1;
+      siftUp(heap_.size() - 1);
+    }
+
+    /// Replace the key of the element \p id (which must be in the heap).
+    inline void update(const SimplexId &id, const keyType &key) {
+      const size_t i = positions_[id];
+      const bool isDecreased = cmp_(key, heap_[i].first);
+      heap_[i].first = key;
+      if(isDecreased)
+        siftUp(i);
+      else
+        siftDown(i);
+    }
+
+    /// Remove the element \p id if it is in the heap.
+    /// \return Returns true if the element was removed.
+    inline bool erase(const SimplexId &id) {
+      if(!contains(id))
+        return false;
+      removeAt(positions_[id]);
+      return true;
+    }
+
+  protected:
+    inline void removeAt(const size_t &i) {
+      positions_[heap_[i].second] = -1;
+      if(i + 1 == heap_.size()) {
+        heap_.pop_back();
+        return;
+      }
+      heap_[i] = std::move(heap_.back());
+      heap_.pop_back();
+      positions_[heap_[i].second] = i;
+      if(i and cmp_(heap_[i].first, heap_[(i - 1) / arity].first))
+        siftUp(i);
+      else
+        siftDown(i);
+    }
+
+    inline void siftUp(size_t i) {
+      std::pair<keyType, SimplexId> e = std::move(heap_[i]);
+      while(i) {
+        const size_t parent = (i - 1) / arity;
+        if(!cmp_(e.first, heap_[parent].first))
+          break;
+        heap_[i] = std::move(heap_[parent]);
+        positions_[heap_[i].second] = i;
+        i = parent;
+      }
+      positions_[e.second] = i;
+      heap_[i] = std::move(e);
+    }
+
+    inline void siftDown(size_t i) {
+      const size_t n = heap_.size();
+      std::pair<keyType, SimplexId> e = std::move(heap_[i]);
+      while(true) {
+        const size_t firstChild = arity * i + 1;
+        if(firstChild >= n)
+          break;
+        const size_t lastChild = std::min(firstChild + arity, n);
+        size_t minChild = firstChild;
+        for(size_t c = firstChild + 1; c < lastChild; ++c) {
+          if(cmp_(heap_[c].first, heap_[minChild].first))
+            minChild = c;
+        }
+        if(!cmp_(heap_[minChild].first, e.first))
+          break;
+        heap_[i] = std::move(heap_[minChild]);
+        positions_[heap_[i].second] = i;
+        i = minChild;
+      }
+      positions_[e.second] = i;
+      heap_[i] = std::move(e);
+    }
+
+    Compare cmp_;
+    std::vector<std::pair<keyType, SimplexId>> heap_;
+    std::vector<SimplexId> positions_;
+  };
+} // namespace ttk
+
+#endif // _INDEXEDHEAP_H
@@ -0,0 +1,127 @@
+/// \ingroup base
+/// \class ttk::MPIUtils
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Helpers for the distributed (MPI) mode of the modules whose inputs
+/// are replicated on every process and whose work is partitioned.
+///
+/// In this mode, each process handles a contiguous block of the inputs (see
+/// getBlock()) and the per-input results of all processes are gathered on
+/// every process (see allGather()), in rank order, that is in input order.
+/// The reductions are then replayed by every process in input order, so that
+/// their results do not depend on the number of processes.
+///
+/// Without TTK_ENABLE_MPI (or if MPI is not initialized), the run is
+/// considered as a single process one and all the helpers are no-ops.
+///
+/// \sa ttk::PDClustering
+
+#ifndef _MPIUTILS_H
+#define _MPIUTILS_H
+
+#ifdef TTK_ENABLE_MPI
+#include <mpi.h>
+#endif
+
+#include <vector>
+
+namespace ttk {
+
+  namespace MPIUtils {
+
+    /// Get the rank of the process and the number of processes (0 and 1 if
+    /// MPI is not used).
+    inline void getPartition(int &rank, int &size) {
+      rank = 0;
+      size = 1;
+#ifdef TTK_ENABLE_MPI
+      int isInitialized = 0, isFinalized = 0;
+      MPI_Initialized(&isInitialized);
+      MPI_Finalized(&isFinalized);
+      if(isInitialized && !isFinalized) {
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &size);
+      }
+#endif
+    }
+
+    /// Get the contiguous block [\p begin, \p end) of the \p n inputs handled
+    /// by the process \p rank among \p size processes.
+    inline void getBlock(const int &n,
+                         const int &rank,
+                         const int &size,
+                         int &begin,
+                         int &end) {
+      const int quotient = n / size;
+      const int remainder = n % size;
+      begin = rank * quotient + (rank < remainder ? rank : remainder);
+      end = begin + quotient + (rank < remainder ? 1 : 0);
+    }
+
+    /// Gather on every process the buffers of all the processes,
+    /// concatenated in rank order.
+    /// \param localBuffer Buffer of the current process.
+    /// \param buffer Concatenated buffers.
+    /// \param offsets Optional position of the buffer of each process in
+    /// \p buffer (plus a trailing entry holding the total size).
+    /// \return Returns 0 upon success, negative values otherwise.
+    inline int allGather(const std::vector<double> &localBuffer,
+                         std::vector<double> &buffer,
+                         std::vector<int> *offsets = nullptr) {
+      int rank, size;
+      getPartition(rank, size);
+      std::vector<int> counts(size, localBuffer.size());
+      std::vector<int> displacements(size + 1, 0);
+
+#ifdef TTK_ENABLE_MPI
+      if(size > 1) {
+        int count = localBuffer.size();
+        if(MPI_Allgather(
+             &count, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD)
+           != MPI_SUCCESS)
+          return -1;
+      }
+#endif
+
+      for(int r = 0; r < size; r++)
+        displacements[r + 1] = displacements[r] + counts[r];
+      buffer.resize(displacements[size]);
+
+#ifdef TTK_ENABLE_MPI
+      if(size > 1) {
+        if(MPI_Allgatherv(localBuffer.data(), localBuffer.size(), MPI_DOUBLE,
+                          buffer.data(), counts.data(), displacements.data(),
+                          MPI_DOUBLE, MPI_COMM_WORLD)
+           != MPI_SUCCESS)
+          return -2;
+      } else
+#endif
+        buffer = localBuffer;
+
+      if(offsets)
+        *offsets = displacements;
+
+      return 0;
+    }
+
+    /// Broadcast the value of the process 0 (for instance a random draw or
+    /// a timing driving the control flow) to all the processes.
+    template <typename type>
+    inline int broadcast(type &value) {
+#ifdef TTK_ENABLE_MPI
+      int rank, size;
+      getPartition(rank, size);
+      if(size > 1
+         && MPI_Bcast(&value, sizeof(type), MPI_BYTE, 0, MPI_COMM_WORLD)
+              != MPI_SUCCESS)
+        return -1;
+#else
+      (void)value;
+#endif
+      return 0;
+    }
+  } // namespace MPIUtils
+} // namespace ttk
+
+#endif // _MPIUTILS_H
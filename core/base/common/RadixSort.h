@@ -0,0 +1,181 @@
+/// \ingroup base
+/// \class ttk::RadixSort
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Stable, parallel (OpenMP) LSD radix sort.
+///
+/// The items are sorted by an unsigned integer key, extracted by a functor,
+/// 8 bits per pass. Only the \p keyBits least significant bits of the key
+/// are considered, so the number of passes adapts to the range of the keys
+/// (for instance, 3 passes for keys bounded by the number of vertices of a
+/// 10M-vertex mesh).
+///
+/// The sort is stable and its output does not depend on the number of
+/// threads: lexicographic orders can be obtained by sorting successively
+/// with respect to the least significant components first.
+///
+/// \sa ttk::OneSkeleton
+/// \sa ttk::TwoSkeleton
+
+#ifndef _RADIXSORT_H
+#define _RADIXSORT_H
+
+#include <BaseClass.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  namespace RadixSort {
+
+    /// Number of significant bits needed to represent values in [0, n).
+    inline int bitNumber(unsigned long long n) {
+      int bits = 0;
+      if(n)
+        n--;
+      while(n) {
+        bits++;
+        n >>= 1;
+      }
+      return bits;
+    }
+
+    /// Stable sort of \p items with respect to the key returned by
+    /// \p getKey (unsigned integer type, of which only the \p keyBits least
+    /// significant bits are considered).
+    /// \param items Items to sort.
+    /// \param getKey Functor returning the key of an item.
+    /// \param keyBits Number of significant bits of the keys.
+    /// \param threadNumber Number of threads.
+    template <typename itemType, typename keyFunctor>
+    void sort(std::vector<itemType> &items,
+              const keyFunctor &getKey,
+              const int &keyBits,
+              const ThreadId &threadNumber = 1) {
+
+      const int digitBits = 8;
+      const size_t bucketNumber = 1 << digitBits;
+      const size_t itemNumber = items.size();
+
+      if((itemNumber < 2) || (keyBits <= 0))
+        return;
+
+      // one chunk per thread, at most one chunk per 4096 items
+      size_t chunkNumber = std::max(threadNumber, 1);
+      chunkNumber = std::min(chunkNumber, 1 + itemNumber / 4096);
+
+      std::vector<itemType> buffer(itemNumber);
+      std::vector<size_t> histograms(chunkNumber * bucketNumber);
+
+      for(int shift = 0; shift < keyBits; shift += digitBits) {
+
+        std::fill(histograms.begin(), histograms.end(), 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(size_t i = 0; i < chunkNumber; i++) {
+          const size_t begin = itemNumber * i / chunkNumber;
+          const size_t end = itemNumber * (i + 1) / chunkNumber;
+          size_t *histogram = &histograms[i * bucketNumber];
+          for(size_t j = begin; j < end; j++) {
+            histogram[(getKey(items[j]) >> shift) & (bucketNumber - 1)]++;
+          }
+        }
+
+        // exclusive prefix sum, digit-major then chunk-major (stability)
+        size_t offset = 0;
+        for(size_t i = 0; i < bucketNumber; i++) {
+          for(size_t j = 0; j < chunkNumber; j++) {
+            const size_t count = histograms[j * bucketNumber + i];
+            histograms[j * bucketNumber + i] = offset;
+            offset += count;
+          }
+        }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(size_t i = 0; i < chunkNumber; i++) {
+          const size_t begin = itemNumber * i / chunkNumber;
+          const size_t end = itemNumber * (i + 1) / chunkNumber;
+          size_t *histogram = &histograms[i * bucketNumber];
+          for(size_t j = begin; j < end; j++) {
+            buffer[histogram[(getKey(items[j]) >> shift)
+                             & (bucketNumber - 1)]++]
+              = items[j];
+          }
+        }
+
+        items.swap(buffer);
+      }
+    }
+
+    /// Compute the ranges of consecutive equal items of a (sorted) vector.
+    /// \param items Input items.
+    /// \param isEqual Functor returning true if two items are equal.
+    /// \param ranges Output ranges ([begin, end) positions in \p items), in
+    /// the order of \p items.
+    /// \param threadNumber Number of threads.
+    template <typename itemType, typename equalFunctor>
+    void equalRanges(const std::vector<itemType> &items,
+                     const equalFunctor &isEqual,
+                     std::vector<std::pair<size_t, size_t>> &ranges,
+                     const ThreadId &threadNumber = 1) {
+
+      const size_t itemNumber = items.size();
+
+      ranges.clear();
+      if(!itemNumber)
+        return;
+
+      size_t chunkNumber = std::max(threadNumber, 1);
+      chunkNumber = std::min(chunkNumber, 1 + itemNumber / 4096);
+
+      // number of ranges starting in each chunk
+      std::vector<size_t> rangeOffsets(chunkNumber + 1, 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+      for(size_t i = 0; i < chunkNumber; i++) {
+        const size_t begin = itemNumber * i / chunkNumber;
+        const size_t end = itemNumber * (i + 1) / chunkNumber;
+        for(size_t j = begin; j < end; j++) {
+          if((!j) || (!isEqual(items[j - 1], items[j])))
+            rangeOffsets[i + 1]++;
+        }
+      }
+
+      for(size_t i = 0; i < chunkNumber; i++)
+        rangeOffsets[i + 1] += rangeOffsets[i];
+
+      ranges.resize(rangeOffsets.back());
+
+      // the end of each range is written by the chunk holding the beginning
+      // of the next one
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+      for(size_t i = 0; i < chunkNumber; i++) {
+        const size_t begin = itemNumber * i / chunkNumber;
+        const size_t end = itemNumber * (i + 1) / chunkNumber;
+        size_t rangeId = rangeOffsets[i];
+        for(size_t j = begin; j < end; j++) {
+          if((!j) || (!isEqual(items[j - 1], items[j]))) {
+            ranges[rangeId].first = j;
+            if(rangeId)
+              ranges[rangeId - 1].second = j;
+            rangeId++;
+          }
+        }
+      }
+      ranges.back().second = itemNumber;
+    }
+  } // namespace RadixSort
+} // namespace ttk
+
+#endif // _RADIXSORT_H
@@ -0,0 +1,321 @@
+/// \ingroup base
+/// \class ttk::VertexOrder
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Sorted order of the vertices of a scalar field.
+///
+/// The vertices are sorted by increasing scalar values, ties being broken by
+/// increasing offsets (Simulation of Simplicity), with a parallel LSD radix
+/// sort (see ttk::RadixSort) on order-preserving integer transforms of the
+/// scalar values and of the offsets. Only the bits which actually vary over
+/// the field are sorted, and the output does not depend on the number of
+/// threads.
+///
+/// The position of each vertex in this order (its rank) defines the \em order
+/// \em field of the scalar field (see ttk::OrderScalarFieldName). Comparing
+/// two vertices then boils down to a single integer comparison on their
+/// ranks, and the sorted vertices are recovered from an order field in linear
+/// time (see sortVerticesFromOrder()), which allows filters to share a single
+/// sort of the same scalar field.
+///
+/// \sa ttk::RadixSort
+/// \sa ttk::ftm::FTMTree_MT
+/// \sa ttk::ftr::Scalars
+/// \sa ttk::TopologicalSimplification
+
+#ifndef _VERTEXORDER_H
+#define _VERTEXORDER_H
+
+#include <RadixSort.h>
+
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+
+namespace ttk {
+
+  namespace VertexOrder {
+
+    /// Order-preserving transform of a value into an unsigned integer key
+    /// (integral types: the sign bit is flipped).
+    template <typename valueType,
+              bool isFloatingPoint = std::is_floating_point<valueType>::value>
+    struct Key {
+      typedef typename std::make_unsigned<valueType>::type type;
+
+      static inline type get(const valueType &value) {
+        type key = static_cast<type>(value);
+        if(std::is_signed<valueType>::value)
+          key ^= (type)1 << (8 * sizeof(valueType) - 1);
+        return key;
+      }
+    };
+
+    /// Order-preserving transform of a value into an unsigned integer key
+    /// (IEEE 754 types: the sign bit is flipped for positive values, all the
+    /// bits are flipped for negative values, -0 and +0 are equal).
+    template <typename valueType>
+    struct Key<valueType, true> {
+      typedef typename std::conditional<sizeof(valueType) == 4,
+                                        uint32_t,
+                                        uint64_t>::type type;
+
+      static inline type get(const valueType &value) {
+        const valueType v = (value == 0) ? valueType(0) : value;
+        type key;
+        memcpy(&key, &v, sizeof(type));
+        const type signBit = (type)1 << (8 * sizeof(type) - 1);
+        return (key & signBit) ? ~key : (key | signBit);
+      }
+    };
+
+    /// Stable sort of (key, vertex) pairs, restricted to the bits of the keys
+    /// which vary.
+    template <typename keyType>
+    void sortKeys(std::vector<std::pair<keyType, SimplexId>> &items,
+                  const ThreadId &threadNumber) {
+
+      const size_t itemNumber = items.size();
+      if(!itemNumber)
+        return;
+
+      size_t chunkNumber = std::max(threadNumber, 1);
+      chunkNumber = std::min(chunkNumber, 1 + itemNumber / 4096);
+
+      std::vector<keyType> minKeys(chunkNumber), maxKeys(chunkNumber);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+      for(size_t i = 0; i < chunkNumber; i++) {
+        const size_t begin = itemNumber * i / chunkNumber;
+        const size_t end = itemNumber * (i + 1) / chunkNumber;
+        minKeys[i] = maxKeys[i] = items[begin].first;
+        for(size_t j = begin + 1; j < end; j++) {
+          minKeys[i] = std::min(minKeys[i], items[j].first);
+          maxKeys[i] = std::max(maxKeys[i], items[j].first);
+        }
+      }
+
+      const keyType minKey = *std::min_element(minKeys.begin(), minKeys.end());
+      const keyType maxKey = *std::max_element(maxKeys.begin(), maxKeys.end());
+
+      if(minKey == maxKey)
+        return;
+
+      // bits of (maxKey - minKey)
+      int keyBits = 0;
+      for(keyType range = maxKey - minKey; range; range >>= 1)
+        keyBits++;
+
+      RadixSort::sort(
+        items,
+        [minKey](const std::pair<keyType, SimplexId> &item) {
+          return (uint64_t)(item.first - minKey);
+        },
+        keyBits, threadNumber);
+    }
+
+    /// Sort the vertices of a scalar field.
+    /// \param vertexNumber Number of vertices.
+    /// \param scalars Scalar values of the vertices.
+    /// \param offsets Offsets of the vertices, used to break ties (NULL:
+    /// vertex identifiers).
+    /// \param sortedVertices Output vertices, by increasing order.
+    /// \param vertexOrder Optional output position of each vertex in
+    /// \p sortedVertices (NULL: not computed).
+    /// \param threadNumber Number of threads.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename scalarType, typename idType>
+    int sortVertices(const SimplexId &vertexNumber,
+                     const scalarType *scalars,
+                     const idType *offsets,
+                     std::vector<SimplexId> &sortedVertices,
+                     std::vector<SimplexId> *vertexOrder = nullptr,
+                     const ThreadId &threadNumber = 1) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((vertexNumber < 0) || (!scalars))
+        return -1;
+#endif
+
+      sortedVertices.resize(vertexNumber);
+      std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
+
+      // tie break: sort first by offsets (unless they are increasing)
+      bool increasingOffsets = true;
+      if(offsets) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) \
+  reduction(&& : increasingOffsets)
+#endif
+        for(SimplexId i = 1; i < vertexNumber; i++) {
+          if(offsets[i] < offsets[i - 1])
+            increasingOffsets = false;
+        }
+      }
+
+      if(!increasingOffsets) {
+        std::vector<std::pair<typename Key<idType>::type, SimplexId>> items(
+          vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++) {
+          items[i].first = Key<idType>::get(offsets[i]);
+          items[i].second = i;
+        }
+        sortKeys(items, threadNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          sortedVertices[i] = items[i].second;
+      }
+
+      // stable sort by scalar values
+      {
+        std::vector<std::pair<typename Key<scalarType>::type, SimplexId>>
+          items(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++) {
+          items[i].first = Key<scalarType>::get(scalars[sortedVertices[i]]);
+          items[i].second = sortedVertices[i];
+        }
+        sortKeys(items, threadNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          sortedVertices[i] = items[i].second;
+      }
+
+      if(vertexOrder) {
+        vertexOrder->resize(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          (*vertexOrder)[sortedVertices[i]] = i;
+      }
+
+      return 0;
+    }
+
+    /// Compute the order field of a scalar field (rank of each vertex in the
+    /// order of sortVertices()).
+    /// \param vertexNumber Number of vertices.
+    /// \param scalars Scalar values of the vertices.
+    /// \param offsets Offsets of the vertices, used to break ties (NULL:
+    /// vertex identifiers).
+    /// \param order Output rank of each vertex (\p vertexNumber entries,
+    /// allocated by the caller).
+    /// \param threadNumber Number of threads.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename scalarType, typename idType>
+    int computeOrder(const SimplexId &vertexNumber,
+                     const scalarType *scalars,
+                     const idType *offsets,
+                     SimplexId *order,
+                     const ThreadId &threadNumber = 1) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!order)
+        return -1;
+#endif
+
+      std::vector<SimplexId> sortedVertices;
+      const int ret = sortVertices(
+        vertexNumber, scalars, offsets, sortedVertices, nullptr, threadNumber);
+      if(ret)
+        return ret;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+      for(SimplexId i = 0; i < vertexNumber; i++)
+        order[sortedVertices[i]] = i;
+
+      return 0;
+    }
+
+    /// Sort the vertices of a scalar field given its order field.
+    ///
+    /// If \p order is a permutation of [0, \p vertexNumber) (for instance an
+    /// order field computed with computeOrder()), the sorted vertices are
+    /// obtained by inverting it, in linear time. Otherwise (for instance if
+    /// \p order is the restriction of an order field to a subset of the
+    /// vertices), the vertices are sorted by increasing \p order values.
+    /// \param vertexNumber Number of vertices.
+    /// \param order Order field (pairwise distinct values).
+    /// \param sortedVertices Output vertices, by increasing order.
+    /// \param vertexOrder Optional output position of each vertex in
+    /// \p sortedVertices (NULL: not computed).
+    /// \param threadNumber Number of threads.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename orderType>
+    int sortVerticesFromOrder(const SimplexId &vertexNumber,
+                              const orderType *order,
+                              std::vector<SimplexId> &sortedVertices,
+                              std::vector<SimplexId> *vertexOrder = nullptr,
+                              const ThreadId &threadNumber = 1) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((vertexNumber < 0) || (!order))
+        return -1;
+#endif
+
+      bool isPermutation = true;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) \
+  reduction(&& : isPermutation)
+#endif
+      for(SimplexId i = 0; i < vertexNumber; i++) {
+        if((order[i] < 0) || (order[i] >= (orderType)vertexNumber))
+          isPermutation = false;
+      }
+
+      if(isPermutation) {
+        sortedVertices.assign(vertexNumber, -1);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          sortedVertices[order[i]] = i;
+
+        // duplicated ranks leave some positions unassigned
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) \
+  reduction(&& : isPermutation)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++) {
+          if((sortedVertices[i] == -1)
+             || (order[sortedVertices[i]] != (orderType)i))
+            isPermutation = false;
+        }
+      }
+
+      if(!isPermutation) {
+        return sortVertices(vertexNumber, order, (const SimplexId *)nullptr,
+                            sortedVertices, vertexOrder, threadNumber);
+      }
+
+      if(vertexOrder) {
+        vertexOrder->resize(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          (*vertexOrder)[i] = order[i];
+      }
+
+      return 0;
+    }
+  } // namespace VertexOrder
+} // namespace ttk
+
+#endif // _VERTEXORDER_H
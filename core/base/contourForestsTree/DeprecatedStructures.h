@@ -36,6 +36,8 @@ namespace ttk {
       SimplexId size;
       void *values;
       std::vector<SimplexId> sosOffsets;
+      // optional order field (rank of each vertex), see ttk::VertexOrder
+      const SimplexId *order;
       std::vector<SimplexId> sortedVertices, mirrorVertices;
 
       // Need vertices to be sorted : use mirrorVertices.
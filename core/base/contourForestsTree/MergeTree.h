@@ -41,6 +41,7 @@
 
 #include <Geometry.h>
 #include <Triangulation.h>
+#include <VertexOrder.h>
 #include <Wrapper.h>
 
 #include "DeprecatedDataTypes.h"
@@ -193,6 +194,13 @@ namespace ttk {
         scalars_->sosOffsets = offsets;
       }
 
+      /// Set an order field (rank of each vertex in the order given by the
+      /// scalars and the offsets, see ttk::VertexOrder) to skip the sort of
+      /// the vertices (NULL: the vertices are sorted).
+      inline void setVertexOrder(const SimplexId *order) {
+        scalars_->order = order;
+      }
+
       // }
       // arcs
       // .....................{
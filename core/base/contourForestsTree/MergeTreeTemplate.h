@@ -33,6 +33,14 @@ namespace ttk {
       const auto &nbVertices = scalars_->size;
       auto &sortedVect = scalars_->sortedVertices;
 
+      if(!sortedVect.size() && scalars_->order) {
+        // order field given: no sort needed
+        VertexOrder::sortVerticesFromOrder(nbVertices, scalars_->order,
+                                           sortedVect,
+                                           &scalars_->mirrorVertices,
+                                           threadNumber_);
+      }
+
       if(!sortedVect.size()) {
         auto indirect_sort = [&](const size_t &a, const size_t &b) {
           return isLower<scalarType>(a, b);
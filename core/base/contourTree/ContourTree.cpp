@@ -167,6 +167,7 @@ SubLevelSetTree::SubLevelSetTree() {
   minimumList_ = NULL;
   maximumList_ = NULL;
   vertexSoSoffsets_ = NULL;
+  vertexOrder_ = NULL;
   vertexScalars_ = NULL;
   maintainRegularVertices_ = true;
   vertexPositions_ = NULL;
@@ -259,9 +260,7 @@ int SubLevelSetTree::build() {
     // add each minimum to the filtration front
     pair<bool, pair<double, pair<int, int>>> v;
     v.first = isMergeTree;
-    v.second.first = (*vertexScalars_)[(*extremumList)[i]];
-    v.second.second.first = (*vertexSoSoffsets_)[(*extremumList)[i]];
-    v.second.second.second = (*extremumList)[i];
+    getFiltrationKey((*extremumList)[i], v.second);
 
     filtrationFront.insert(v);
   }
@@ -299,9 +298,7 @@ int SubLevelSetTree::build() {
 
         pair<bool, pair<double, pair<int, int>>> v;
         v.first = isMergeTree;
-        v.second.first = (*vertexScalars_)[nId];
-        v.second.second.first = (*vertexSoSoffsets_)[nId];
-        v.second.second.second = nId;
+        getFiltrationKey(nId, v.second);
 
         filtrationFront.insert(v);
         visitedVertices[nId] = true;
@@ -1240,9 +1237,7 @@ int SubLevelSetTree::buildExtremumList(vector<int> &extremumList,
     if(isExtremum) {
       pair<bool, pair<double, pair<int, int>>> entry;
       entry.first = isSubLevelSet;
-      entry.second.first = (*vertexScalars_)[i];
-      entry.second.second.first = (*vertexSoSoffsets_)[i];
-      entry.second.second.second = i;
+      getFiltrationKey(i, entry.second);
       tmpList.push_back(entry);
     }
   }
@@ -1773,6 +1768,9 @@ int SubLevelSetTree::openSuperArc(const int &nodeId) {
 bool SubLevelSetTree::isSosHigherThan(const int &vertexId0,
                                       const int &vertexId1) const {
 
+  if(vertexOrder_)
+    return vertexOrder_[vertexId0] > vertexOrder_[vertexId1];
+
   return (((*vertexScalars_)[vertexId0] > (*vertexScalars_)[vertexId1])
           || (((*vertexScalars_)[vertexId0] == (*vertexScalars_)[vertexId1])
               && ((*vertexSoSoffsets_)[vertexId0]
@@ -1782,6 +1780,9 @@ bool SubLevelSetTree::isSosHigherThan(const int &vertexId0,
 bool SubLevelSetTree::isSosLowerThan(const int &vertexId0,
                                      const int &vertexId1) const {
 
+  if(vertexOrder_)
+    return vertexOrder_[vertexId0] < vertexOrder_[vertexId1];
+
   return (((*vertexScalars_)[vertexId0] < (*vertexScalars_)[vertexId1])
           || (((*vertexScalars_)[vertexId0] == (*vertexScalars_)[vertexId1])
               && ((*vertexSoSoffsets_)[vertexId0]
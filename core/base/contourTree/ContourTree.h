@@ -518,6 +518,13 @@ namespace ttk {
       vertexSoSoffsets_ = vertexSoSoffsets;
     };
 
+    /// Set an order field (rank of each vertex in the order given by the
+    /// scalars and the offsets, see ttk::VertexOrder): the vertices are then
+    /// compared by their ranks only (NULL: by their scalars and offsets).
+    inline void setVertexOrder(const SimplexId *vertexOrder) {
+      vertexOrder_ = vertexOrder;
+    };
+
     virtual int simplify(const double &simplificationThreshold,
                          ContourTreeSimplificationMetric *metric = NULL);
 
@@ -552,6 +559,21 @@ namespace ttk {
                           const std::vector<float> *voxelSize,
                           std::ofstream &o);
 
+    // filtration key of a vertex: its scalar value and its offset, or its
+    // rank and 0 given an order field (see setVertexOrder())
+    inline void getFiltrationKey(const int &vertexId,
+                                 std::pair<double, std::pair<int, int>> &key)
+      const {
+      if(vertexOrder_) {
+        key.first = vertexOrder_[vertexId];
+        key.second.first = 0;
+      } else {
+        key.first = (*vertexScalars_)[vertexId];
+        key.second.first = (*vertexSoSoffsets_)[vertexId];
+      }
+      key.second.second = vertexId;
+    }
+
     int makeArc(const int &nodeId0, const int &nodeId1);
 
     int makeNode(const int &vertexId);
@@ -563,6 +585,7 @@ namespace ttk {
     double minScalar_, maxScalar_;
     const std::vector<real> *vertexScalars_;
     std::vector<int> *vertexSoSoffsets_;
+    const SimplexId *vertexOrder_;
     Triangulation *triangulation_;
     std::vector<int> *minimumList_, *maximumList_;
     std::vector<Node> nodeList_, originalNodeList_;
@@ -5,7 +5,8 @@ using namespace ttk;
 using namespace dcg;
 
 DiscreteGradient::DiscreteGradient()
-  : IterationThreshold{-1}, ReverseSaddleMaximumConnection{false},
+  : IterationThreshold{-1}, LowerStarGradient{false}, CompactGradient{false},
+    ReverseSaddleMaximumConnection{false},
     ReverseSaddleSaddleConnection{false}, CollectPersistencePairs{false},
     ReturnSaddleConnectors{false}, SaddleConnectorsPersistenceThreshold{0},
 
@@ -83,6 +84,9 @@ SimplexId DiscreteGradient::getNumberOfCells(const int dimension) const {
 }
 
 bool DiscreteGradient::isMinimum(const Cell &cell) const {
+  if(isGradientCompact())
+    return (cell.dim_ == 0 and compactGradient_[0][cell.id_] == 0);
+
   if(cell.dim_ == 0)
     return (gradient_[0][0][cell.id_] == -1);
 
@@ -90,6 +94,9 @@ bool DiscreteGradient::isMinimum(const Cell &cell) const {
 }
 
 bool DiscreteGradient::isSaddle1(const Cell &cell) const {
+  if(isGradientCompact())
+    return (cell.dim_ == 1 and compactGradient_[1][cell.id_] == 0);
+
   if(cell.dim_ == 1)
     return (gradient_[0][1][cell.id_] == -1
             and gradient_[1][1][cell.id_] == -1);
@@ -98,6 +105,10 @@ bool DiscreteGradient::isSaddle1(const Cell &cell) const {
 }
 
 bool DiscreteGradient::isSaddle2(const Cell &cell) const {
+  if(isGradientCompact())
+    return (dimensionality_ == 3 and cell.dim_ == 2
+            and compactGradient_[2][cell.id_] == 0);
+
   if(dimensionality_ == 3 and cell.dim_ == 2)
     return (gradient_[1][2][cell.id_] == -1
             and gradient_[2][2][cell.id_] == -1);
@@ -106,6 +117,10 @@ bool DiscreteGradient::isSaddle2(const Cell &cell) const {
 }
 
 bool DiscreteGradient::isMaximum(const Cell &cell) const {
+  if(isGradientCompact())
+    return (cell.dim_ == dimensionality_
+            and compactGradient_[cell.dim_][cell.id_] == 0);
+
   if(dimensionality_ == 2 and cell.dim_ == 2)
     return (gradient_[1][2][cell.id_] == -1);
 
@@ -117,6 +132,10 @@ bool DiscreteGradient::isMaximum(const Cell &cell) const {
 
 bool DiscreteGradient::isCellCritical(const int cellDim,
                                       const SimplexId cellId) const {
+  if(isGradientCompact())
+    return (cellDim <= dimensionality_
+            and compactGradient_[cellDim][cellId] == 0);
+
   if(dimensionality_ == 2) {
     switch(cellDim) {
       case 0:
@@ -207,6 +226,9 @@ bool DiscreteGradient::isBoundary(const Cell &cell) const {
 
 SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
                                           bool isReverse) const {
+  if(isGradientCompact())
+    return getCompactPairedCell(cell, isReverse);
+
   SimplexId id{-1};
   if(dimensionality_ == 2) {
     switch(cell.dim_) {
@@ -316,6 +338,82 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
   return id;
 }
 
+int DiscreteGradient::setCompactPair(const int alphaDim,
+                                     const SimplexId alphaId,
+                                     const SimplexId betaId) {
+  SimplexId alphaLocalId, betaLocalId;
+  getPairLocalIds(alphaDim, alphaId, betaId, alphaLocalId, betaLocalId,
+                  inputTriangulation_);
+  setCompactPair(alphaDim, alphaId, betaId, alphaLocalId, betaLocalId);
+  return 0;
+}
+
+SimplexId DiscreteGradient::getCompactPairedCell(const Cell &cell,
+                                                 const bool isReverse) const {
+  const int dim = cell.dim_;
+  const unsigned char code = compactGradient_[dim][cell.id_];
+
+  // k-th facet (resp. cofacet) of the cell of dimension d
+  const auto getFacet = [this](const int d, const SimplexId id, const int k) {
+    SimplexId facet{-1};
+    if(d == 1)
+      inputTriangulation_->getEdgeVertex(id, k, facet);
+    else if(d == 2 and dimensionality_ == 2)
+      inputTriangulation_->getCellEdge(id, k, facet);
+    else if(d == 2)
+      inputTriangulation_->getTriangleEdge(id, k, facet);
+    else if(d == 3)
+      inputTriangulation_->getCellTriangle(id, k, facet);
+    return facet;
+  };
+  const auto getCofacet = [this](const int d, const SimplexId id,
+                                 const SimplexId k) {
+    SimplexId cofacet{-1};
+    if(d == 0)
+      inputTriangulation_->getVertexEdge(id, k, cofacet);
+    else if(d == 1 and dimensionality_ == 2)
+      inputTriangulation_->getEdgeStar(id, k, cofacet);
+    else if(d == 1)
+      inputTriangulation_->getEdgeTriangle(id, k, cofacet);
+    else if(d == 2)
+      inputTriangulation_->getTriangleStar(id, k, cofacet);
+    return cofacet;
+  };
+
+  // as in the regular layout, a vertex has no reverse pairing
+  if(isReverse and dim > 0) {
+    if(code == 0 or code >= compactCofacet_)
+      return -1;
+    return getFacet(dim, cell.id_, code - compactFacet_);
+  }
+
+  if(code < compactCofacet_)
+    return -1;
+  if(code < compactCofacet_ + maxCompactCofacet_)
+    return getCofacet(dim, cell.id_, code - compactCofacet_);
+
+  // high valence: find the cofacet whose facet code points back to the cell
+  SimplexId cofacetNumber{};
+  if(dim == 0)
+    cofacetNumber = inputTriangulation_->getVertexEdgeNumber(cell.id_);
+  else if(dim == 1 and dimensionality_ == 2)
+    cofacetNumber = inputTriangulation_->getEdgeStarNumber(cell.id_);
+  else if(dim == 1)
+    cofacetNumber = inputTriangulation_->getEdgeTriangleNumber(cell.id_);
+  else if(dim == 2)
+    cofacetNumber = inputTriangulation_->getTriangleStarNumber(cell.id_);
+  for(SimplexId k = maxCompactCofacet_; k < cofacetNumber; ++k) {
+    const SimplexId cofacet = getCofacet(dim, cell.id_, k);
+    const unsigned char cofacetCode = compactGradient_[dim + 1][cofacet];
+    if(cofacetCode != 0 and cofacetCode < compactCofacet_
+       and getFacet(dim + 1, cofacet, cofacetCode - compactFacet_)
+             == cell.id_)
+      return cofacet;
+  }
+
+  return -1;
+}
+
 int DiscreteGradient::getCriticalPoints(vector<Cell> &criticalPoints) const {
   // foreach dimension
   const int numberOfDimensions = getNumberOfDimensions();
@@ -818,6 +916,11 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
       const SimplexId edgeId = vpath[i].id_;
       const SimplexId triangleId = vpath[i + 1].id_;
 
+      if(isGradientCompact()) {
+        setCompactPair(1, edgeId, triangleId);
+        continue;
+      }
+
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 3; ++k) {
         SimplexId tmp;
@@ -847,6 +950,11 @@ int DiscreteGradient::reverseAscendingPath(const vector<Cell> &vpath) {
       const SimplexId triangleId = vpath[i].id_;
       const SimplexId tetraId = vpath[i + 1].id_;
 
+      if(isGradientCompact()) {
+        setCompactPair(2, triangleId, tetraId);
+        continue;
+      }
+
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 4; ++k) {
         SimplexId tmp;
@@ -883,6 +991,11 @@ int DiscreteGradient::reverseAscendingPathOnWall(const vector<Cell> &vpath) {
       const SimplexId edgeId = vpath[i].id_;
       const SimplexId triangleId = vpath[i + 1].id_;
 
+      if(isGradientCompact()) {
+        setCompactPair(1, edgeId, triangleId);
+        continue;
+      }
+
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 3; ++k) {
         SimplexId tmp;
@@ -919,6 +1032,11 @@ int DiscreteGradient::reverseDescendingPathOnWall(const vector<Cell> &vpath) {
       const SimplexId triangleId = vpath[i].id_;
       const SimplexId edgeId = vpath[i + 1].id_;
 
+      if(isGradientCompact()) {
+        setCompactPair(1, edgeId, triangleId);
+        continue;
+      }
+
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
       for(int k = 0; k < 3; ++k) {
         SimplexId tmp;
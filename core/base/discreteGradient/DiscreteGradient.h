@@ -17,11 +17,16 @@
 // base code includes
 #include <FTMTree.h>
 #include <Geometry.h>
+#include <IndexedHeap.h>
 #include <ScalarFieldCriticalPoints.h>
 #include <Triangulation.h>
+#include <VertexOrder.h>
 #include <Wrapper.h>
 
 #include <algorithm>
+#include <array>
+#include <functional>
+#include <queue>
 #include <set>
 
 namespace ttk {
@@ -57,6 +62,47 @@ namespace ttk {
       SimplexId id_;
     };
 
+    /**
+     * Cell of the lower star of a vertex, extended with the data required by
+     * DiscreteGradient::processLowerStars(): the orders of its vertices except
+     * the star vertex (in decreasing order, -1 if unused), the indices of its
+     * faces in the lower star, the number of those faces still unpaired and
+     * its status.
+     */
+    struct CellExt {
+      explicit CellExt(const int dim, const SimplexId id)
+        : dim_{dim}, id_{id}, lowVerts_{{-1, -1, -1}}, faces_{{0, 0, 0}},
+          unpairedFaces_{dim == 1 ? 0 : dim}, paired_{false} {
+      }
+
+      /**
+       * Compare two cells of the same lower star: lexicographic order on the
+       * orders of their vertices (a face is lower than its cofaces).
+       */
+      bool operator<(const CellExt &other) const {
+        return lowVerts_ < other.lowVerts_;
+      }
+
+      bool operator>(const CellExt &other) const {
+        return lowVerts_ > other.lowVerts_;
+      }
+
+      int dim_;
+      SimplexId id_;
+      std::array<SimplexId, 3> lowVerts_;
+      std::array<SimplexId, 3> faces_;
+      // the star vertex, face of the edges, is always paired first
+      int unpairedFaces_;
+      // paired or critical
+      bool paired_;
+    };
+
+    /**
+     * Lower star of a vertex, cells sorted by dimension (the vertex itself is
+     * implicit).
+     */
+    using LowerStar = std::array<std::vector<CellExt>, 4>;
+
     /**
      * Low-level structure storing a succession of cells. The orientation tells
      * whether the segment has been reversed or not.
@@ -324,6 +370,23 @@ namespace ttk {
       };
     };
 
+    /**
+     * Priority queue of the (saddle,...,maximum) vpaths, addressed by vpath
+     * identifier.
+     */
+    template <typename dataType>
+    using SaddleMaximumVPathQueue
+      = IndexedHeap<std::pair<dataType, SimplexId>,
+                    SaddleMaximumVPathComparator<dataType>>;
+
+    /**
+     * Priority queue of the saddle-connectors, addressed by vpath identifier.
+     */
+    template <typename dataType>
+    using SaddleSaddleVPathQueue
+      = IndexedHeap<std::tuple<dataType, SimplexId, SimplexId>,
+                    SaddleSaddleVPathComparator<dataType>>;
+
     /**
      * Compute and manage a discrete gradient of a function on a triangulation.
      * TTK assumes that the input dataset is made of only one connected
@@ -344,6 +407,35 @@ namespace ttk {
         return 0;
       }
 
+      /**
+       * Enable/Disable the construction of the gradient by lower stars (see
+       * processLowerStars(), disabled by default). If disabled, the gradient
+       * is built with assignGradient() and its post-processing passes
+       * (buildGradient2() and buildGradient3()).
+       *
+       * The lower star gradient has no unpaired cell to be fixed, hence
+       * buildGradient2() and buildGradient3() are no-ops when it is
+       * enabled. Both gradients have the same critical cells in the
+       * interior of the domain but may pair the regular cells differently,
+       * so the separatrices and saddle connectors extracted from them may
+       * differ.
+       */
+      int setLowerStarGradient(const bool state) {
+        LowerStarGradient = state;
+        return 0;
+      }
+
+      /**
+       * Enable/Disable the compact storage of the gradient (disabled by
+       * default): one byte per cell encoding the local index of its paired
+       * cell, decoded on the fly, instead of two identifier arrays per pair
+       * of dimensions. Requires the lower star gradient.
+       */
+      int setCompactGradient(const bool state) {
+        CompactGradient = state;
+        return 0;
+      }
+
       /**
        * Enable/Disable gradient reversal of saddle to maximum VPaths.
        */
@@ -424,9 +516,12 @@ Morse-Smale Complexes",
        * N. Shivashankar and V. Natarajan.
        * Compute the initial gradient field of the input scalar function for a
 given dimension.
+       * The kernel is instantiated for the concrete triangulation type (see
+       * ttkTemplateMacro).
        */
-      template <typename dataType, typename idType>
-      int assignGradient(const int alphaDim,
+      template <typename dataType, typename idType, class triangulationType>
+      int assignGradient(const triangulationType *triangulation,
+                         const int alphaDim,
                          const dataType *const scalars,
                          const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
@@ -468,6 +563,83 @@ triangulation only).
                           std::vector<std::vector<SimplexId>> &gradient) const;
 #endif
 
+      /**
+       * Gather the lower star of vertex \p a (cells whose highest vertex is
+       * \p a) with their faces.
+       */
+      template <class triangulationType>
+      int lowerStar(LowerStar &ls,
+                    const SimplexId a,
+                    const SimplexId *const vertsOrder,
+                    const triangulationType *triangulation) const;
+
+      /**
+       * Get the local identifier of the cell \p betaId in the cofacets of the
+       * \p alphaDim-cell \p alphaId, and the local identifier of \p alphaId
+       * in the facets of \p betaId.
+       */
+      template <class triangulationType>
+      int getPairLocalIds(const int alphaDim,
+                          const SimplexId alphaId,
+                          const SimplexId betaId,
+                          SimplexId &alphaLocalId,
+                          SimplexId &betaLocalId,
+                          const triangulationType *triangulation) const;
+
+      /**
+       * Store the gradient pair (\p alphaId, \p betaId), \p alphaId being a
+       * facet of \p betaId of local identifier \p alphaLocalId, and
+       * \p betaId a cofacet of \p alphaId of local identifier
+       * \p betaLocalId, in compactGradient_.
+       */
+      inline void setCompactPair(const int alphaDim,
+                                 const SimplexId alphaId,
+                                 const SimplexId betaId,
+                                 const SimplexId alphaLocalId,
+                                 const SimplexId betaLocalId) {
+        compactGradient_[alphaDim][alphaId]
+          = (betaLocalId < maxCompactCofacet_)
+              ? compactCofacet_ + betaLocalId
+              : compactCofacet_ + maxCompactCofacet_;
+        compactGradient_[alphaDim + 1][betaId] = compactFacet_ + alphaLocalId;
+      }
+
+      /**
+       * Store the gradient pair (\p alphaId, \p betaId) in compactGradient_,
+       * the local identifiers being computed on inputTriangulation_.
+       */
+      int setCompactPair(const int alphaDim,
+                         const SimplexId alphaId,
+                         const SimplexId betaId);
+
+      /**
+       * Decode the cell paired to \p cell in compactGradient_ (see
+       * getPairedCell()).
+       */
+      SimplexId getCompactPairedCell(const Cell &cell,
+                                     const bool isReverse) const;
+
+      /**
+       * Store the gradient pair (\p alpha, \p beta), \p alpha being a facet of
+       * \p beta, in gradient_ (or compactGradient_).
+       */
+      template <class triangulationType>
+      int pairCells(const CellExt &alpha,
+                    const CellExt &beta,
+                    const triangulationType *triangulation);
+
+      /**
+       * Body of ProcessLowerStars algorithm from "Theory and Algorithms for
+       * Constructing Discrete Morse Complexes from Grayscale Digital Images",
+       * V. Robins, P. J. Wood and A. P. Sheppard.
+       * Compute the gradient field of the input scalar function in a single
+       * pass over the lower star of each vertex (in parallel over the
+       * vertices), written straight into gradient_.
+       */
+      template <class triangulationType>
+      int processLowerStars(const triangulationType *triangulation,
+                            const SimplexId *const vertsOrder);
+
       /**
        * Compute the initial gradient field of the input scalar function on the
 triangulation.
@@ -540,8 +712,7 @@ triangulation only).
       template <typename dataType>
       int orderSaddleMaximumConnections(
         const std::vector<VPath> &vpaths,
-        std::set<std::pair<dataType, SimplexId>,
-                 SaddleMaximumVPathComparator<dataType>> &S);
+        SaddleMaximumVPathQueue<dataType> &S);
 
       /**
        * Compute simple algebra on the vpaths to minimize the number of gradient
@@ -567,8 +738,7 @@ to be reversed.
         const std::vector<char> &isPL,
         const bool allowBoundary,
         const bool allowBruteForce,
-        std::set<std::pair<dataType, SimplexId>,
-                 SaddleMaximumVPathComparator<dataType>> &S,
+        SaddleMaximumVPathQueue<dataType> &S,
         std::vector<SimplexId> &pl2dmt_saddle,
         std::vector<SimplexId> &pl2dmt_maximum,
         std::vector<Segment> &segments,
@@ -617,8 +787,7 @@ the discrete gradient.
       int orderSaddleSaddleConnections1(
         const std::vector<VPath> &vpaths,
         std::vector<CriticalPoint> &criticalPoints,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S);
+        SaddleSaddleVPathQueue<dataType> &S);
 
       /**
        * Core of the simplification process, modify the gradient and
@@ -631,8 +800,7 @@ the discrete gradient.
         const bool allowBoundary,
         const bool allowBruteForce,
         const bool returnSaddleConnectors,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S,
+        SaddleSaddleVPathQueue<dataType> &S,
         std::vector<SimplexId> &pl2dmt_saddle1,
         std::vector<SimplexId> &pl2dmt_saddle2,
         std::vector<char> &isRemovableSaddle1,
@@ -677,8 +845,7 @@ the discrete gradient.
       int orderSaddleSaddleConnections2(
         const std::vector<VPath> &vpaths,
         std::vector<CriticalPoint> &criticalPoints,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S);
+        SaddleSaddleVPathQueue<dataType> &S);
 
       /**
        * Core of the simplification process, modify the gradient and
@@ -691,8 +858,7 @@ the discrete gradient.
         const bool allowBoundary,
         const bool allowBruteForce,
         const bool returnSaddleConnectors,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S,
+        SaddleSaddleVPathQueue<dataType> &S,
         std::vector<SimplexId> &pl2dmt_saddle1,
         std::vector<SimplexId> &pl2dmt_saddle2,
         std::vector<char> &isRemovableSaddle1,
@@ -905,6 +1071,14 @@ in the gradient.
        */
       SimplexId getPairedCell(const Cell &cell, bool isReverse = false) const;
 
+      /**
+       * Return true if the gradient is stored in the compact layout (see
+       * setCompactGradient()).
+       */
+      inline bool isGradientCompact() const {
+        return !compactGradient_.empty();
+      }
+
       /**
        * Get the output critical points as a STL vector of cells.
        */
@@ -1040,6 +1214,8 @@ tetra identifier.
 
     protected:
       int IterationThreshold;
+      bool LowerStarGradient;
+      bool CompactGradient;
       bool ReverseSaddleMaximumConnection;
       bool ReverseSaddleSaddleConnection;
       bool CollectPersistencePairs;
@@ -1053,6 +1229,15 @@ tetra identifier.
 #else
       std::vector<std::vector<std::vector<SimplexId>>> gradient_;
 #endif
+      // compact gradient: for each dimension, one code per cell, 0 if the
+      // cell is unpaired, compactFacet_ + k if it is paired with its k-th
+      // facet, compactCofacet_ + k if it is paired with its k-th cofacet
+      // (compactCofacet_ + maxCompactCofacet_ if k >= maxCompactCofacet_, the
+      // cofacet being then found by a scan of the cofacets)
+      static const unsigned char compactFacet_{1};
+      static const unsigned char compactCofacet_{5};
+      static const unsigned char maxCompactCofacet_{250};
+      std::vector<std::vector<unsigned char>> compactGradient_;
       std::vector<SimplexId> dmtMax2PL_;
       std::vector<SimplexId> dmt1Saddle2PL_;
       std::vector<SimplexId> dmt2Saddle2PL_;
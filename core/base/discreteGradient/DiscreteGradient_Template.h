@@ -177,8 +177,9 @@ dataType DiscreteGradient::getPersistence(const Cell &up,
   return scalarMax<dataType>(up, scalars) - scalarMin<dataType>(down, scalars);
 }
 
-template <typename dataType, typename idType>
+template <typename dataType, typename idType, class triangulationType>
 int DiscreteGradient::assignGradient(
+  const triangulationType *triangulation,
   const int alphaDim,
   const dataType *const scalars,
   const idType *const offsets,
@@ -209,16 +210,15 @@ int DiscreteGradient::assignGradient(
         char minEdgeLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
-        const SimplexId edgeNumber
-          = inputTriangulation_->getVertexEdgeNumber(alpha);
+        const SimplexId edgeNumber = triangulation->getVertexEdgeNumber(alpha);
         for(SimplexId k = 0; k < edgeNumber; ++k) {
           SimplexId edgeId;
-          inputTriangulation_->getVertexEdge(alpha, k, edgeId);
+          triangulation->getVertexEdge(alpha, k, edgeId);
 
           SimplexId vertexId;
-          inputTriangulation_->getEdgeVertex(edgeId, 0, vertexId);
+          triangulation->getEdgeVertex(edgeId, 0, vertexId);
           if(vertexId == alpha)
-            inputTriangulation_->getEdgeVertex(edgeId, 1, vertexId);
+            triangulation->getEdgeVertex(edgeId, 1, vertexId);
 
           if(sosLowerThan(vertexId, alpha)) {
             if(minVertexId == -1) {
@@ -243,7 +243,7 @@ int DiscreteGradient::assignGradient(
           char minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 2; ++k) {
             SimplexId tmp;
-            inputTriangulation_->getEdgeVertex(minEdgeId, k, tmp);
+            triangulation->getEdgeVertex(minEdgeId, k, tmp);
             if(tmp == alpha) {
               minAlphaLocalId = k;
               break;
@@ -259,26 +259,25 @@ int DiscreteGradient::assignGradient(
       } else if(alphaDim == 1) {
         SimplexId v0;
         SimplexId v1;
-        inputTriangulation_->getEdgeVertex(alpha, 0, v0);
-        inputTriangulation_->getEdgeVertex(alpha, 1, v1);
+        triangulation->getEdgeVertex(alpha, 0, v0);
+        triangulation->getEdgeVertex(alpha, 1, v1);
 
         SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
         char minStarLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
-        const SimplexId starNumber
-          = inputTriangulation_->getEdgeStarNumber(alpha);
+        const SimplexId starNumber = triangulation->getEdgeStarNumber(alpha);
         for(SimplexId k = 0; k < starNumber; ++k) {
           SimplexId starId;
-          inputTriangulation_->getEdgeStar(alpha, k, starId);
+          triangulation->getEdgeStar(alpha, k, starId);
 
           SimplexId vertexId;
-          inputTriangulation_->getCellVertex(starId, 0, vertexId);
+          triangulation->getCellVertex(starId, 0, vertexId);
           if(vertexId == v0 or vertexId == v1)
-            inputTriangulation_->getCellVertex(starId, 1, vertexId);
+            triangulation->getCellVertex(starId, 1, vertexId);
           if(vertexId == v0 or vertexId == v1)
-            inputTriangulation_->getCellVertex(starId, 2, vertexId);
+            triangulation->getCellVertex(starId, 2, vertexId);
 
           if(sosLowerThan(vertexId, v0) and sosLowerThan(vertexId, v1)) {
             if(minVertexId == -1) {
@@ -303,7 +302,7 @@ int DiscreteGradient::assignGradient(
           char minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
-            inputTriangulation_->getCellEdge(minStarId, k, tmp);
+            triangulation->getCellEdge(minStarId, k, tmp);
             if(tmp == alpha) {
               minAlphaLocalId = k;
               break;
@@ -329,16 +328,15 @@ int DiscreteGradient::assignGradient(
         char minEdgeLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
-        const SimplexId edgeNumber
-          = inputTriangulation_->getVertexEdgeNumber(alpha);
+        const SimplexId edgeNumber = triangulation->getVertexEdgeNumber(alpha);
         for(SimplexId k = 0; k < edgeNumber; ++k) {
           SimplexId edgeId;
-          inputTriangulation_->getVertexEdge(alpha, k, edgeId);
+          triangulation->getVertexEdge(alpha, k, edgeId);
 
           SimplexId vertexId;
-          inputTriangulation_->getEdgeVertex(edgeId, 0, vertexId);
+          triangulation->getEdgeVertex(edgeId, 0, vertexId);
           if(vertexId == alpha)
-            inputTriangulation_->getEdgeVertex(edgeId, 1, vertexId);
+            triangulation->getEdgeVertex(edgeId, 1, vertexId);
 
           if(sosLowerThan(vertexId, alpha)) {
             if(minVertexId == -1) {
@@ -363,7 +361,7 @@ int DiscreteGradient::assignGradient(
           char minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 2; ++k) {
             SimplexId tmp;
-            inputTriangulation_->getEdgeVertex(minEdgeId, k, tmp);
+            triangulation->getEdgeVertex(minEdgeId, k, tmp);
             if(tmp == alpha) {
               minAlphaLocalId = k;
               break;
@@ -379,8 +377,8 @@ int DiscreteGradient::assignGradient(
       } else if(alphaDim == 1) {
         SimplexId v0;
         SimplexId v1;
-        inputTriangulation_->getEdgeVertex(alpha, 0, v0);
-        inputTriangulation_->getEdgeVertex(alpha, 1, v1);
+        triangulation->getEdgeVertex(alpha, 0, v0);
+        triangulation->getEdgeVertex(alpha, 1, v1);
 
         SimplexId minTriangleId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
@@ -388,17 +386,17 @@ int DiscreteGradient::assignGradient(
 #endif
         SimplexId minVertexId{-1};
         const SimplexId triangleNumber
-          = inputTriangulation_->getEdgeTriangleNumber(alpha);
+          = triangulation->getEdgeTriangleNumber(alpha);
         for(SimplexId k = 0; k < triangleNumber; ++k) {
           SimplexId starId;
-          inputTriangulation_->getEdgeTriangle(alpha, k, starId);
+          triangulation->getEdgeTriangle(alpha, k, starId);
 
           SimplexId vertexId;
-          inputTriangulation_->getTriangleVertex(starId, 0, vertexId);
+          triangulation->getTriangleVertex(starId, 0, vertexId);
           if(vertexId == v0 or vertexId == v1)
-            inputTriangulation_->getTriangleVertex(starId, 1, vertexId);
+            triangulation->getTriangleVertex(starId, 1, vertexId);
           if(vertexId == v0 or vertexId == v1)
-            inputTriangulation_->getTriangleVertex(starId, 2, vertexId);
+            triangulation->getTriangleVertex(starId, 2, vertexId);
 
           if(sosLowerThan(vertexId, v0) and sosLowerThan(vertexId, v1)) {
             if(minVertexId == -1) {
@@ -423,7 +421,7 @@ int DiscreteGradient::assignGradient(
           char minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
-            inputTriangulation_->getTriangleEdge(minTriangleId, k, tmp);
+            triangulation->getTriangleEdge(minTriangleId, k, tmp);
             if(tmp == alpha) {
               minAlphaLocalId = k;
               break;
@@ -440,9 +438,9 @@ int DiscreteGradient::assignGradient(
         SimplexId v0;
         SimplexId v1;
         SimplexId v2;
-        inputTriangulation_->getTriangleVertex(alpha, 0, v0);
-        inputTriangulation_->getTriangleVertex(alpha, 1, v1);
-        inputTriangulation_->getTriangleVertex(alpha, 2, v2);
+        triangulation->getTriangleVertex(alpha, 0, v0);
+        triangulation->getTriangleVertex(alpha, 1, v1);
+        triangulation->getTriangleVertex(alpha, 2, v2);
 
         SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
@@ -450,19 +448,19 @@ int DiscreteGradient::assignGradient(
 #endif
         SimplexId minVertexId{-1};
         const SimplexId starNumber
-          = inputTriangulation_->getTriangleStarNumber(alpha);
+          = triangulation->getTriangleStarNumber(alpha);
         for(SimplexId k = 0; k < starNumber; ++k) {
           SimplexId starId;
-          inputTriangulation_->getTriangleStar(alpha, k, starId);
+          triangulation->getTriangleStar(alpha, k, starId);
 
           SimplexId vertexId;
-          inputTriangulation_->getCellVertex(starId, 0, vertexId);
+          triangulation->getCellVertex(starId, 0, vertexId);
           if(vertexId == v0 or vertexId == v1 or vertexId == v2)
-            inputTriangulation_->getCellVertex(starId, 1, vertexId);
+            triangulation->getCellVertex(starId, 1, vertexId);
           if(vertexId == v0 or vertexId == v1 or vertexId == v2)
-            inputTriangulation_->getCellVertex(starId, 2, vertexId);
+            triangulation->getCellVertex(starId, 2, vertexId);
           if(vertexId == v0 or vertexId == v1 or vertexId == v2)
-            inputTriangulation_->getCellVertex(starId, 3, vertexId);
+            triangulation->getCellVertex(starId, 3, vertexId);
 
           if(sosLowerThan(vertexId, v0) and sosLowerThan(vertexId, v1)
              and sosLowerThan(vertexId, v2)) {
@@ -488,7 +486,7 @@ int DiscreteGradient::assignGradient(
           char minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 4; ++k) {
             SimplexId tmp;
-            inputTriangulation_->getCellTriangle(minStarId, k, tmp);
+            triangulation->getCellTriangle(minStarId, k, tmp);
             if(tmp == alpha) {
               minAlphaLocalId = k;
               break;
@@ -868,6 +866,371 @@ int DiscreteGradient::assignGradient3(
   return 0;
 }
 
+template <class triangulationType>
+int DiscreteGradient::lowerStar(LowerStar &ls,
+                                const SimplexId a,
+                                const SimplexId *const vertsOrder,
+                                const triangulationType *triangulation) const {
+
+  for(auto &cells : ls)
+    cells.clear();
+
+  // edges
+  const SimplexId edgeNumber = triangulation->getVertexEdgeNumber(a);
+  for(SimplexId i = 0; i < edgeNumber; ++i) {
+    SimplexId edgeId;
+    triangulation->getVertexEdge(a, i, edgeId);
+    SimplexId vertexId;
+    triangulation->getEdgeVertex(edgeId, 0, vertexId);
+    if(vertexId == a)
+      triangulation->getEdgeVertex(edgeId, 1, vertexId);
+    if(vertsOrder[vertexId] < vertsOrder[a]) {
+      ls[1].emplace_back(1, edgeId);
+      ls[1].back().lowVerts_[0] = vertsOrder[vertexId];
+    }
+  }
+
+  // index of the edge (a, v) in the lower star
+  const auto edgeIndex = [&ls](const SimplexId order) {
+    SimplexId i = 0;
+    while(ls[1][i].lowVerts_[0] != order)
+      ++i;
+    return i;
+  };
+
+  // triangles (a, u, v), u > v, gathered from the edges (a, u)
+  const SimplexId lowerEdgeNumber = ls[1].size();
+  for(SimplexId i = 0; i < lowerEdgeNumber; ++i) {
+    const SimplexId edgeId = ls[1][i].id_;
+    const SimplexId orderU = ls[1][i].lowVerts_[0];
+    const SimplexId triangleNumber
+      = (dimensionality_ == 2) ? triangulation->getEdgeStarNumber(edgeId)
+                               : triangulation->getEdgeTriangleNumber(edgeId);
+    for(SimplexId j = 0; j < triangleNumber; ++j) {
+      SimplexId triangleId;
+      if(dimensionality_ == 2)
+        triangulation->getEdgeStar(edgeId, j, triangleId);
+      else
+        triangulation->getEdgeTriangle(edgeId, j, triangleId);
+
+      // highest vertex of the triangle, other than a
+      SimplexId orderV = -1;
+      for(int k = 0; k < 3; ++k) {
+        SimplexId vertexId;
+        if(dimensionality_ == 2)
+          triangulation->getCellVertex(triangleId, k, vertexId);
+        else
+          triangulation->getTriangleVertex(triangleId, k, vertexId);
+        if(vertexId != a and vertsOrder[vertexId] != orderU)
+          orderV = vertsOrder[vertexId];
+      }
+
+      if(orderV < orderU) {
+        ls[2].emplace_back(2, triangleId);
+        CellExt &triangle = ls[2].back();
+        triangle.lowVerts_[0] = orderU;
+        triangle.lowVerts_[1] = orderV;
+        triangle.faces_[0] = i;
+        triangle.faces_[1] = edgeIndex(orderV);
+      }
+    }
+  }
+
+  if(dimensionality_ < 3)
+    return 0;
+
+  // index of the triangle (a, u, v) in the lower star
+  const auto triangleIndex = [&ls](const SimplexId orderU,
+                                   const SimplexId orderV) {
+    SimplexId i = 0;
+    while(ls[2][i].lowVerts_[0] != orderU or ls[2][i].lowVerts_[1] != orderV)
+      ++i;
+    return i;
+  };
+
+  // tetrahedra (a, u, v, w), u > v > w, gathered from the triangles (a, u, v)
+  const SimplexId lowerTriangleNumber = ls[2].size();
+  for(SimplexId i = 0; i < lowerTriangleNumber; ++i) {
+    const SimplexId triangleId = ls[2][i].id_;
+    const SimplexId orderU = ls[2][i].lowVerts_[0];
+    const SimplexId orderV = ls[2][i].lowVerts_[1];
+    const SimplexId tetraNumber
+      = triangulation->getTriangleStarNumber(triangleId);
+    for(SimplexId j = 0; j < tetraNumber; ++j) {
+      SimplexId tetraId;
+      triangulation->getTriangleStar(triangleId, j, tetraId);
+
+      // vertex of the tetrahedron not in the triangle
+      SimplexId orderW = -1;
+      for(int k = 0; k < 4; ++k) {
+        SimplexId vertexId;
+        triangulation->getCellVertex(tetraId, k, vertexId);
+        if(vertexId != a and vertsOrder[vertexId] != orderU
+           and vertsOrder[vertexId] != orderV)
+          orderW = vertsOrder[vertexId];
+      }
+
+      if(orderW < orderV) {
+        ls[3].emplace_back(3, tetraId);
+        CellExt &tetra = ls[3].back();
+        tetra.lowVerts_[0] = orderU;
+        tetra.lowVerts_[1] = orderV;
+        tetra.lowVerts_[2] = orderW;
+        tetra.faces_[0] = i;
+        tetra.faces_[1] = triangleIndex(orderU, orderW);
+        tetra.faces_[2] = triangleIndex(orderV, orderW);
+      }
+    }
+  }
+
+  return 0;
+}
+
+template <class triangulationType>
+int DiscreteGradient::getPairLocalIds(
+  const int alphaDim,
+  const SimplexId alphaId,
+  const SimplexId betaId,
+  SimplexId &alphaLocalId,
+  SimplexId &betaLocalId,
+  const triangulationType *triangulation) const {
+  alphaLocalId = -1;
+  betaLocalId = -1;
+
+  if(alphaDim == 0) {
+    const SimplexId edgeNumber = triangulation->getVertexEdgeNumber(alphaId);
+    for(SimplexId k = 0; k < edgeNumber; ++k) {
+      SimplexId tmp;
+      triangulation->getVertexEdge(alphaId, k, tmp);
+      if(tmp == betaId) {
+        betaLocalId = k;
+        break;
+      }
+    }
+    for(SimplexId k = 0; k < 2; ++k) {
+      SimplexId tmp;
+      triangulation->getEdgeVertex(betaId, k, tmp);
+      if(tmp == alphaId) {
+        alphaLocalId = k;
+        break;
+      }
+    }
+  } else if(alphaDim == 1) {
+    const SimplexId starNumber
+      = (dimensionality_ == 2)
+          ? triangulation->getEdgeStarNumber(alphaId)
+          : triangulation->getEdgeTriangleNumber(alphaId);
+    for(SimplexId k = 0; k < starNumber; ++k) {
+      SimplexId tmp;
+      if(dimensionality_ == 2)
+        triangulation->getEdgeStar(alphaId, k, tmp);
+      else
+        triangulation->getEdgeTriangle(alphaId, k, tmp);
+      if(tmp == betaId) {
+        betaLocalId = k;
+        break;
+      }
+    }
+    for(SimplexId k = 0; k < 3; ++k) {
+      SimplexId tmp;
+      if(dimensionality_ == 2)
+        triangulation->getCellEdge(betaId, k, tmp);
+      else
+        triangulation->getTriangleEdge(betaId, k, tmp);
+      if(tmp == alphaId) {
+        alphaLocalId = k;
+        break;
+      }
+    }
+  } else if(alphaDim == 2) {
+    const SimplexId starNumber
+      = triangulation->getTriangleStarNumber(alphaId);
+    for(SimplexId k = 0; k < starNumber; ++k) {
+      SimplexId tmp;
+      triangulation->getTriangleStar(alphaId, k, tmp);
+      if(tmp == betaId) {
+        betaLocalId = k;
+        break;
+      }
+    }
+    for(SimplexId k = 0; k < 4; ++k) {
+      SimplexId tmp;
+      triangulation->getCellTriangle(betaId, k, tmp);
+      if(tmp == alphaId) {
+        alphaLocalId = k;
+        break;
+      }
+    }
+  }
+
+  return 0;
+}
+
+template <class triangulationType>
+int DiscreteGradient::pairCells(const CellExt &alpha,
+                                const CellExt &beta,
+                                const triangulationType *triangulation) {
+  const int dim = alpha.dim_;
+
+  if(isGradientCompact()) {
+    SimplexId alphaLocalId, betaLocalId;
+    getPairLocalIds(dim, alpha.id_, beta.id_, alphaLocalId, betaLocalId,
+                    triangulation);
+    setCompactPair(dim, alpha.id_, beta.id_, alphaLocalId, betaLocalId);
+    return 0;
+  }
+
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  SimplexId alphaLocalId, betaLocalId;
+  getPairLocalIds(dim, alpha.id_, beta.id_, alphaLocalId, betaLocalId,
+                  triangulation);
+  gradient_[dim][dim][alpha.id_] = betaLocalId;
+  gradient_[dim][dim + 1][beta.id_] = alphaLocalId;
+#else
+  gradient_[dim][dim][alpha.id_] = beta.id_;
+  gradient_[dim][dim + 1][beta.id_] = alpha.id_;
+#endif
+
+  return 0;
+}
+
+template <class triangulationType>
+int DiscreteGradient::processLowerStars(const triangulationType *triangulation,
+                                        const SimplexId *const vertsOrder) {
+
+  // min-heap of cells of the lower star
+  using PriorityQueue
+    = std::priority_queue<std::reference_wrapper<CellExt>,
+                          std::vector<std::reference_wrapper<CellExt>>,
+                          std::greater<CellExt>>;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    // per-thread containers, reused from one vertex to the next
+    LowerStar ls;
+    PriorityQueue pqZero, pqOne;
+    // cofaces (indices in ls[dim + 1]) of the cells of ls[dim], dim = 1, 2,
+    // in compressed rows
+    std::array<std::vector<SimplexId>, 3> cofaceOffsets, cofaces;
+
+    // compressed rows of the cofaces of the cells of ls[dim]
+    const auto buildCofaces = [&ls, &cofaceOffsets, &cofaces](const int dim) {
+      auto &offsets = cofaceOffsets[dim];
+      auto &rows = cofaces[dim];
+      offsets.assign(ls[dim].size() + 1, 0);
+      for(const auto &coface : ls[dim + 1]) {
+        for(int i = 0; i < coface.dim_; ++i)
+          ++offsets[coface.faces_[i] + 1];
+      }
+      for(size_t i = 1; i < offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+      rows.resize(offsets.back());
+      for(size_t j = 0; j < ls[dim + 1].size(); ++j) {
+        const auto &coface = ls[dim + 1][j];
+        for(int i = 0; i < coface.dim_; ++i)
+          rows[offsets[coface.faces_[i]]++] = j;
+      }
+      // shift the offsets back
+      for(size_t i = offsets.size() - 1; i > 0; --i)
+        offsets[i] = offsets[i - 1];
+      offsets[0] = 0;
+    };
+
+    // c (of index `index` in ls[c.dim_]) got paired or critical: push its
+    // cofaces left with a single unpaired face into pqOne
+    const auto pushCofaces = [this, &ls, &pqOne, &cofaceOffsets, &cofaces](
+                               const CellExt &c, const SimplexId index) {
+      if(c.dim_ >= dimensionality_)
+        return;
+      const auto &offsets = cofaceOffsets[c.dim_];
+      for(SimplexId k = offsets[index]; k < offsets[index + 1]; ++k) {
+        CellExt &coface = ls[c.dim_ + 1][cofaces[c.dim_][k]];
+        --coface.unpairedFaces_;
+        if(coface.unpairedFaces_ == 1 and !coface.paired_)
+          pqOne.push(coface);
+      }
+    };
+
+    // index of the only unpaired face of c in ls[c.dim_ - 1]
+    const auto unpairedFace = [&ls](const CellExt &c) {
+      for(int i = 0; i < c.dim_; ++i) {
+        if(!ls[c.dim_ - 1][c.faces_[i]].paired_)
+          return c.faces_[i];
+      }
+      return SimplexId{-1};
+    };
+
+    // index of a cell in its lower star container
+    const auto indexOf = [&ls](const CellExt &c) {
+      return static_cast<SimplexId>(&c - ls[c.dim_].data());
+    };
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+    for(SimplexId a = 0; a < numberOfVertices_; ++a) {
+      lowerStar(ls, a, vertsOrder, triangulation);
+
+      // a is a minimum
+      if(ls[1].empty())
+        continue;
+
+      buildCofaces(1);
+      if(dimensionality_ == 3)
+        buildCofaces(2);
+
+      // pair a with its steepest descending edge
+      CellExt &delta = *std::min_element(ls[1].begin(), ls[1].end());
+      pairCells(CellExt{0, a}, delta, triangulation);
+      delta.paired_ = true;
+
+      for(auto &edge : ls[1]) {
+        if(!edge.paired_)
+          pqZero.push(edge);
+      }
+      pushCofaces(delta, indexOf(delta));
+
+      while(!pqOne.empty() or !pqZero.empty()) {
+        while(!pqOne.empty()) {
+          CellExt &alpha = pqOne.top();
+          pqOne.pop();
+          if(alpha.paired_)
+            continue;
+
+          if(alpha.unpairedFaces_ == 0) {
+            pqZero.push(alpha);
+            continue;
+          }
+
+          // pair alpha with its only unpaired face
+          const SimplexId face = unpairedFace(alpha);
+          CellExt &faceAlpha = ls[alpha.dim_ - 1][face];
+          pairCells(faceAlpha, alpha, triangulation);
+          faceAlpha.paired_ = true;
+          alpha.paired_ = true;
+
+          pushCofaces(alpha, indexOf(alpha));
+          pushCofaces(faceAlpha, face);
+        }
+
+        // lowest remaining cell: critical
+        while(!pqZero.empty() and pqZero.top().get().paired_)
+          pqZero.pop();
+        if(!pqZero.empty()) {
+          CellExt &gamma = pqZero.top();
+          pqZero.pop();
+          gamma.paired_ = true;
+          pushCofaces(gamma, indexOf(gamma));
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
 template <typename dataType, typename idType>
 int DiscreteGradient::buildGradient() {
   Timer t;
@@ -887,15 +1250,46 @@ int DiscreteGradient::buildGradient() {
   dmt1Saddle2PL_.clear();
   dmt2Saddle2PL_.clear();
   gradient_.clear();
-  gradient_.resize(dimensionality_);
-  for(int i = 0; i < dimensionality_; ++i) {
-    // init gradient memory
-    gradient_[i].resize(numberOfDimensions);
-    gradient_[i][i].resize(numberOfCells[i], -1);
-    gradient_[i][i + 1].resize(numberOfCells[i + 1], -1);
+  compactGradient_.clear();
+  if(CompactGradient and !LowerStarGradient) {
+    std::stringstream msg;
+    msg << "[DiscreteGradient] Compact gradient requires the lower star "
+        << "gradient, using the regular layout." << std::endl;
+    dMsg(std::cout, msg.str(), infoMsg);
+  }
+  if(CompactGradient and LowerStarGradient) {
+    // init compact gradient memory: one code per cell, all unpaired
+    compactGradient_.resize(numberOfDimensions);
+    for(int i = 0; i < numberOfDimensions; ++i)
+      compactGradient_[i].resize(numberOfCells[i], 0);
+  } else {
+    gradient_.resize(dimensionality_);
+    for(int i = 0; i < dimensionality_; ++i) {
+      // init gradient memory
+      gradient_[i].resize(numberOfDimensions);
+      gradient_[i][i].resize(numberOfCells[i], -1);
+      gradient_[i][i + 1].resize(numberOfCells[i + 1], -1);
+    }
+  }
+
+  if(LowerStarGradient) {
+    // single pass over the lower stars, on the ranks of the vertices
+    std::vector<SimplexId> vertsOrder(numberOfVertices_);
+    VertexOrder::computeOrder(
+      numberOfVertices_, scalars, offsets, vertsOrder.data(), threadNumber_);
 
-    // compute gradient pairs
-    assignGradient<dataType, idType>(i, scalars, offsets, gradient_[i]);
+    ttkTemplateMacro(
+      inputTriangulation_->getDispatchType(),
+      (processLowerStars(
+        inputTriangulation_->getData<TTK_TT>(), vertsOrder.data())));
+  } else {
+    for(int i = 0; i < dimensionality_; ++i) {
+      // compute gradient pairs
+      ttkTemplateMacro(inputTriangulation_->getDispatchType(),
+                       (assignGradient<dataType, idType>(
+                         inputTriangulation_->getData<TTK_TT>(), i, scalars,
+                         offsets, gradient_[i])));
+    }
   }
 
   {
@@ -920,6 +1314,10 @@ int DiscreteGradient::buildGradient() {
 
 template <typename dataType, typename idType>
 int DiscreteGradient::buildGradient2() {
+  // the lower star gradient has no unpaired cell to be fixed
+  if(LowerStarGradient)
+    return 0;
+
   Timer t;
 
   const idType *const offsets = static_cast<const idType *>(inputOffsets_);
@@ -942,6 +1340,10 @@ int DiscreteGradient::buildGradient2() {
 
 template <typename dataType, typename idType>
 int DiscreteGradient::buildGradient3() {
+  // the lower star gradient has no unpaired cell to be fixed
+  if(LowerStarGradient)
+    return 0;
+
   Timer t;
 
   const idType *const offsets = static_cast<const idType *>(inputOffsets_);
@@ -1434,16 +1836,16 @@ int DiscreteGradient::getRemovableSaddles2(
 template <typename dataType>
 int DiscreteGradient::orderSaddleMaximumConnections(
   const std::vector<VPath> &vpaths,
-  std::set<std::pair<dataType, SimplexId>,
-           SaddleMaximumVPathComparator<dataType>> &S) {
+  SaddleMaximumVPathQueue<dataType> &S) {
   Timer t;
 
   const SimplexId numberOfVPaths = vpaths.size();
+  S.reserve(numberOfVPaths, numberOfVPaths);
   for(SimplexId i = 0; i < numberOfVPaths; ++i) {
     const VPath &vpath = vpaths[i];
 
     if(vpath.isValid_)
-      S.insert(std::make_pair(vpath.persistence_, i));
+      S.push(i, std::make_pair(vpath.persistence_, i));
   }
 
   {
@@ -1774,8 +2176,7 @@ int DiscreteGradient::processSaddleMaximumConnections(
   const std::vector<char> &isPL,
   const bool allowBoundary,
   const bool allowBruteForce,
-  std::set<std::pair<dataType, SimplexId>,
-           SaddleMaximumVPathComparator<dataType>> &S,
+  SaddleMaximumVPathQueue<dataType> &S,
   std::vector<SimplexId> &pl2dmt_saddle,
   std::vector<SimplexId> &pl2dmt_maximum,
   std::vector<Segment> &segments,
@@ -1806,9 +2207,7 @@ int DiscreteGradient::processSaddleMaximumConnections(
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold)
       break;
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = ptr->second;
-    S.erase(ptr);
+    const SimplexId vpathId = S.pop();
     VPath &vpath = vpaths[vpathId];
 
     // filter by saddle condition
@@ -2055,15 +2454,13 @@ int DiscreteGradient::processSaddleMaximumConnections(
         CriticalPoint &newDestination = criticalPoints[newDestinationId];
         newDestination.vpaths_.push_back(newVPathId);
 
-        // erase newVPath
-        S.erase(std::make_pair(newVPath.persistence_, newVPathId));
-
         // update persistence
         newVPath.persistence_ = getPersistence<dataType>(
           newDestination.cell_, newSource.cell_, scalars);
 
-        // repush newVPath to confirm update
-        S.insert(std::make_pair(newVPath.persistence_, newVPathId));
+        // repush newVPath to confirm update (its key is updated in place if
+        // it is still queued)
+        S.push(newVPathId, std::make_pair(newVPath.persistence_, newVPathId));
       }
 
       // invalid source.vpaths
@@ -2131,9 +2528,7 @@ int DiscreteGradient::simplifySaddleMaximumConnections(
   // Part 2 : push the vpaths into a set to order them by persistence
   // value - lower to higher (gradient is not modified).
   SaddleMaximumVPathComparator<dataType> cmp_f;
-  std::set<std::pair<dataType, SimplexId>,
-           SaddleMaximumVPathComparator<dataType>>
-    S(cmp_f);
+  SaddleMaximumVPathQueue<dataType> S(cmp_f);
   orderSaddleMaximumConnections<dataType>(vpaths, S);
 
   // Part 3 : iteratively process the vpaths, virtually reverse the
@@ -2295,17 +2690,17 @@ template <typename dataType>
 int DiscreteGradient::orderSaddleSaddleConnections1(
   const std::vector<VPath> &vpaths,
   std::vector<CriticalPoint> &criticalPoints,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S) {
+  SaddleSaddleVPathQueue<dataType> &S) {
   Timer t;
 
   const SimplexId numberOfVPaths = vpaths.size();
+  S.reserve(numberOfVPaths, numberOfVPaths);
   for(SimplexId i = 0; i < numberOfVPaths; ++i) {
     const VPath &vpath = vpaths[i];
 
     if(vpath.isValid_) {
       const SimplexId saddleId = criticalPoints[vpath.destination_].cell_.id_;
-      S.insert(std::make_tuple(vpath.persistence_, i, saddleId));
+      S.push(i, std::make_tuple(vpath.persistence_, i, saddleId));
     }
   }
 
@@ -2326,8 +2721,7 @@ int DiscreteGradient::processSaddleSaddleConnections1(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S,
+  SaddleSaddleVPathQueue<dataType> &S,
   std::vector<SimplexId> &pl2dmt_saddle1,
   std::vector<SimplexId> &pl2dmt_saddle2,
   std::vector<char> &isRemovableSaddle1,
@@ -2353,9 +2747,7 @@ int DiscreteGradient::processSaddleSaddleConnections1(
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold)
       break;
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = std::get<1>(*ptr);
-    S.erase(ptr);
+    const SimplexId vpathId = S.pop();
     VPath &vpath = vpaths[vpathId];
 
     if(vpath.isValid_) {
@@ -2620,9 +3012,9 @@ int DiscreteGradient::processSaddleSaddleConnections1(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newDestination.cell_.id_));
+          // update queue
+          S.push(newVPathId, std::make_tuple(persistence, newVPathId,
+                                             newDestination.cell_.id_));
         }
       }
 
@@ -2680,9 +3072,9 @@ int DiscreteGradient::processSaddleSaddleConnections1(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newDestination.cell_.id_));
+          // update queue
+          S.push(newVPathId, std::make_tuple(persistence, newVPathId,
+                                             newDestination.cell_.id_));
         }
       }
     }
@@ -2731,9 +3123,7 @@ int DiscreteGradient::simplifySaddleSaddleConnections1(
 
   // Part 2 : push the vpaths and order by persistence
   SaddleSaddleVPathComparator<dataType> cmp_f;
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>>
-    S(cmp_f);
+  SaddleSaddleVPathQueue<dataType> S(cmp_f);
   orderSaddleSaddleConnections1<dataType>(vpaths, dmt_criticalPoints, S);
 
   // Part 3 : process the vpaths
@@ -2889,17 +3279,17 @@ template <typename dataType>
 int DiscreteGradient::orderSaddleSaddleConnections2(
   const std::vector<VPath> &vpaths,
   std::vector<CriticalPoint> &criticalPoints,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S) {
+  SaddleSaddleVPathQueue<dataType> &S) {
   Timer t;
 
   const SimplexId numberOfVPaths = vpaths.size();
+  S.reserve(numberOfVPaths, numberOfVPaths);
   for(SimplexId i = 0; i < numberOfVPaths; ++i) {
     const VPath &vpath = vpaths[i];
 
     if(vpath.isValid_) {
       const SimplexId saddleId = criticalPoints[vpath.source_].cell_.id_;
-      S.insert(std::make_tuple(vpath.persistence_, i, saddleId));
+      S.push(i, std::make_tuple(vpath.persistence_, i, saddleId));
     }
   }
 
@@ -2920,8 +3310,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S,
+  SaddleSaddleVPathQueue<dataType> &S,
   std::vector<SimplexId> &pl2dmt_saddle1,
   std::vector<SimplexId> &pl2dmt_saddle2,
   std::vector<char> &isRemovableSaddle1,
@@ -2954,9 +3343,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold)
       break;
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = std::get<1>(*ptr);
-    S.erase(ptr);
+    const SimplexId vpathId = S.pop();
     VPath &vpath = vpaths[vpathId];
 
     if(vpath.isValid_) {
@@ -3219,9 +3606,9 @@ int DiscreteGradient::processSaddleSaddleConnections2(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
+          // update queue
+          S.push(newVPathId,
+                 std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
         }
       }
 
@@ -3278,9 +3665,9 @@ int DiscreteGradient::processSaddleSaddleConnections2(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
+          // update queue
+          S.push(newVPathId,
+                 std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
         }
       }
     }
@@ -3330,9 +3717,7 @@ int DiscreteGradient::simplifySaddleSaddleConnections2(
 
   // Part 2 : push the vpaths and order by persistence
   SaddleSaddleVPathComparator<dataType> cmp_f;
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>>
-    S(cmp_f);
+  SaddleSaddleVPathQueue<dataType> S(cmp_f);
   orderSaddleSaddleConnections2<dataType>(vpaths, dmt_criticalPoints, S);
 
   // Part 3 : process the vpaths
@@ -25,3 +25,34 @@ int ExplicitTriangulation::clear() {
 
   return AbstractTriangulation::clear();
 }
+
+size_t ExplicitTriangulation::footprint() const {
+
+  // the tables are accounted for by AbstractTriangulation::footprint(),
+  // only report here what their compression saves.
+  size_t size = AbstractTriangulation::footprint();
+  size_t flatSize = 0, jaggedSize = 0;
+
+  const FlatJaggedArray *tables[]
+    = {&cellEdgeList_,       &cellNeighborList_, &cellTriangleList_,
+       &edgeLinkList_,       &edgeStarList_,     &edgeTriangleList_,
+       &triangleList_,       &triangleEdgeList_, &triangleLinkList_,
+       &triangleStarList_,   &vertexEdgeList_,   &vertexLinkList_,
+       &vertexNeighborList_, &vertexStarList_,   &vertexTriangleList_};
+
+  for(const FlatJaggedArray *table : tables) {
+    flatSize += table->footprint();
+    jaggedSize += table->jaggedFootprint();
+  }
+
+  stringstream msg;
+  msg << "[ExplicitTriangulation] Compressed tables: "
+      << (flatSize / 1024) / 1024 << " MB (jagged storage: "
+      << (jaggedSize / 1024) / 1024 << " MB, saved: "
+      << ((jaggedSize > flatSize ? jaggedSize - flatSize : 0) / 1024) / 1024
+      << " MB)." << endl;
+
+  dMsg(cout, msg.str(), memoryMsg);
+
+  return size;
+}
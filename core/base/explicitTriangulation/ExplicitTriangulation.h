@@ -5,13 +5,18 @@
 ///
 /// \brief ExplicitTriangulation is a class that provides time efficient
 /// traversal methods on triangulations of piecewise linear manifolds.
+///
+/// All the adjacency relations are stored in compressed (offsets + data)
+/// tables, see ttk::FlatJaggedArray.
 /// \sa Triangulation
+/// \sa FlatJaggedArray
 
 #ifndef _EXPLICITTRIANGULATION_H
 #define _EXPLICITTRIANGULATION_H
 
 // base code includes
 #include <AbstractTriangulation.h>
+#include <FlatJaggedArray.h>
 #include <OneSkeleton.h>
 #include <ThreeSkeleton.h>
 #include <TwoSkeleton.h>
@@ -31,25 +36,24 @@ namespace ttk {
                            SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= cellEdgeList_.subvectorsNumber()))
         return -1;
-      if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)cellEdgeList_[cellId].size()))
+      if((localEdgeId < 0) || (localEdgeId >= cellEdgeList_.size(cellId)))
         return -2;
 #endif
-      edgeId = cellEdgeList_[cellId][localEdgeId];
+      edgeId = cellEdgeList_.get(cellId, localEdgeId);
       return 0;
     }
 
     inline SimplexId getCellEdgeNumber(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= cellEdgeList_.subvectorsNumber()))
         return -1;
 #endif
-      return cellEdgeList_[cellId].size();
+      return cellEdgeList_.size(cellId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *getCellEdges() override {
+    inline const FlatJaggedArray *getCellEdges() override {
 
       return &cellEdgeList_;
     }
@@ -58,27 +62,26 @@ namespace ttk {
                                const int &localNeighborId,
                                SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= cellNeighborList_.subvectorsNumber()))
         return -1;
       if((localNeighborId < 0)
-         || (localNeighborId >= (SimplexId)cellNeighborList_[cellId].size()))
+         || (localNeighborId >= cellNeighborList_.size(cellId)))
         return -2;
 #endif
-      neighborId = cellNeighborList_[cellId][localNeighborId];
+      neighborId = cellNeighborList_.get(cellId, localNeighborId);
       return 0;
     }
 
     inline SimplexId
       getCellNeighborNumber(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= cellNeighborList_.subvectorsNumber()))
         return -1;
 #endif
-      return cellNeighborList_[cellId].size();
+      return cellNeighborList_.size(cellId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getCellNeighbors() override {
+    inline const FlatJaggedArray *getCellNeighbors() override {
       return &cellNeighborList_;
     }
 
@@ -87,13 +90,13 @@ namespace ttk {
                                SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= cellTriangleList_.subvectorsNumber()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)cellTriangleList_[cellId].size()))
+         || (localTriangleId >= cellTriangleList_.size(cellId)))
         return -2;
 #endif
-      triangleId = cellTriangleList_[cellId][localTriangleId];
+      triangleId = cellTriangleList_.get(cellId, localTriangleId);
 
       return 0;
     }
@@ -102,15 +105,14 @@ namespace ttk {
       getCellTriangleNumber(const SimplexId &cellId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= cellTriangleList_.subvectorsNumber()))
         return -1;
 #endif
 
-      return cellTriangleList_[cellId].size();
+      return cellTriangleList_.size(cellId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getCellTriangles() override {
+    inline const FlatJaggedArray *getCellTriangles() override {
 
       return &cellTriangleList_;
     }
@@ -121,10 +123,11 @@ namespace ttk {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((cellId < 0) || (cellId >= cellNumber_))
         return -1;
-      if((localVertexId < 0) || (localVertexId >= cellArray_[0]))
+      if((localVertexId < 0)
+         || (localVertexId >= cellArray_.getCellVertexNumber()))
         return -2;
 #endif
-      vertexId = cellArray_[(cellArray_[0] + 1) * cellId + localVertexId + 1];
+      vertexId = cellArray_.getCellVertex(cellId, localVertexId);
       return 0;
     }
 
@@ -133,16 +136,16 @@ namespace ttk {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((cellId < 0) || (cellId >= cellNumber_))
         return -1;
-      if((!cellArray_) || (!cellNumber_))
+      if((cellArray_.empty()) || (!cellNumber_))
         return -2;
 #endif
-      return cellArray_[0];
+      return cellArray_.getCellVertexNumber();
     }
 
     int getDimensionality() const override {
 
-      if((cellArray_) && (cellNumber_)) {
-        return cellArray_[0] - 1;
+      if((!cellArray_.empty()) && (cellNumber_)) {
+        return cellArray_.getCellVertexNumber() - 1;
       }
 
       return -1;
@@ -157,25 +160,24 @@ namespace ttk {
                            const int &localLinkId,
                            SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeLinkList_.subvectorsNumber()))
         return -1;
-      if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)edgeLinkList_[edgeId].size()))
+      if((localLinkId < 0) || (localLinkId >= edgeLinkList_.size(edgeId)))
         return -2;
 #endif
-      linkId = edgeLinkList_[edgeId][localLinkId];
+      linkId = edgeLinkList_.get(edgeId, localLinkId);
       return 0;
     }
 
     inline SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeLinkList_.subvectorsNumber()))
         return -1;
 #endif
-      return edgeLinkList_[edgeId].size();
+      return edgeLinkList_.size(edgeId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *getEdgeLinks() override {
+    inline const FlatJaggedArray *getEdgeLinks() override {
 
       return &edgeLinkList_;
     }
@@ -184,25 +186,24 @@ namespace ttk {
                            const int &localStarId,
                            SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeStarList_.subvectorsNumber()))
         return -1;
-      if((localStarId < 0)
-         || (localStarId >= (SimplexId)edgeStarList_[edgeId].size()))
+      if((localStarId < 0) || (localStarId >= edgeStarList_.size(edgeId)))
         return -2;
 #endif
-      starId = edgeStarList_[edgeId][localStarId];
+      starId = edgeStarList_.get(edgeId, localStarId);
       return 0;
     }
 
     inline SimplexId getEdgeStarNumber(const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeStarList_.subvectorsNumber()))
         return -1;
 #endif
-      return edgeStarList_[edgeId].size();
+      return edgeStarList_.size(edgeId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *getEdgeStars() override {
+    inline const FlatJaggedArray *getEdgeStars() override {
       return &edgeStarList_;
     }
 
@@ -211,14 +212,14 @@ namespace ttk {
                                SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeTriangleList_.subvectorsNumber()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)edgeTriangleList_[edgeId].size()))
+         || (localTriangleId >= edgeTriangleList_.size(edgeId)))
         return -2;
 #endif
 
-      triangleId = edgeTriangleList_[edgeId][localTriangleId];
+      triangleId = edgeTriangleList_.get(edgeId, localTriangleId);
 
       return 0;
     }
@@ -227,15 +228,14 @@ namespace ttk {
       getEdgeTriangleNumber(const SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= edgeTriangleList_.subvectorsNumber()))
         return -1;
 #endif
 
-      return edgeTriangleList_[edgeId].size();
+      return edgeTriangleList_.size(edgeId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getEdgeTriangles() override {
+    inline const FlatJaggedArray *getEdgeTriangles() override {
 
       return &edgeTriangleList_;
     }
@@ -265,14 +265,14 @@ namespace ttk {
     }
 
     inline SimplexId getNumberOfTriangles() const override {
-      return triangleList_.size();
+      return triangleList_.subvectorsNumber();
     }
 
     inline SimplexId getNumberOfVertices() const override {
       return vertexNumber_;
     }
 
-    inline const std::vector<std::vector<SimplexId>> *getTriangles() override {
+    inline const FlatJaggedArray *getTriangles() override {
       return &triangleList_;
     }
 
@@ -282,13 +282,13 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= triangleEdgeList_.subvectorsNumber()))
         return -1;
       if((localEdgeId < 0) || (localEdgeId > 2))
         return -2;
 #endif
 
-      edgeId = triangleEdgeList_[triangleId][localEdgeId];
+      edgeId = triangleEdgeList_.get(triangleId, localEdgeId);
 
       return 0;
     }
@@ -298,15 +298,14 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= triangleEdgeList_.subvectorsNumber()))
         return -1;
 #endif
 
-      return triangleEdgeList_[triangleId].size();
+      return triangleEdgeList_.size(triangleId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleEdges() override {
+    inline const FlatJaggedArray *getTriangleEdges() override {
 
       return &triangleEdgeList_;
     }
@@ -316,13 +315,13 @@ namespace ttk {
                                SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+         || (triangleId >= triangleLinkList_.subvectorsNumber()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)triangleLinkList_[triangleId].size()))
+         || (localLinkId >= triangleLinkList_.size(triangleId)))
         return -2;
 #endif
-      linkId = triangleLinkList_[triangleId][localLinkId];
+      linkId = triangleLinkList_.get(triangleId, localLinkId);
       return 0;
     }
 
@@ -330,14 +329,13 @@ namespace ttk {
       getTriangleLinkNumber(const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+         || (triangleId >= triangleLinkList_.subvectorsNumber()))
         return -1;
 #endif
-      return triangleLinkList_[triangleId].size();
+      return triangleLinkList_.size(triangleId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleLinks() override {
+    inline const FlatJaggedArray *getTriangleLinks() override {
       return &triangleLinkList_;
     }
 
@@ -346,13 +344,13 @@ namespace ttk {
                                SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= triangleStarList_.subvectorsNumber()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)triangleStarList_[triangleId].size()))
+         || (localStarId >= triangleStarList_.size(triangleId)))
         return -2;
 #endif
-      starId = triangleStarList_[triangleId][localStarId];
+      starId = triangleStarList_.get(triangleId, localStarId);
       return 0;
     }
 
@@ -360,14 +358,13 @@ namespace ttk {
       getTriangleStarNumber(const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= triangleStarList_.subvectorsNumber()))
         return -1;
 #endif
-      return triangleStarList_[triangleId].size();
+      return triangleStarList_.size(triangleId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleStars() override {
+    inline const FlatJaggedArray *getTriangleStars() override {
       return &triangleStarList_;
     }
 
@@ -375,13 +372,13 @@ namespace ttk {
                                  const int &localVertexId,
                                  SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((triangleId < 0) || (triangleId >= (SimplexId)triangleList_.size()))
+      if((triangleId < 0) || (triangleId >= triangleList_.subvectorsNumber()))
         return -1;
       if((localVertexId < 0)
-         || (localVertexId >= (SimplexId)triangleList_[triangleId].size()))
+         || (localVertexId >= triangleList_.size(triangleId)))
         return -2;
 #endif
-      vertexId = triangleList_[triangleId][localVertexId];
+      vertexId = triangleList_.get(triangleId, localVertexId);
       return 0;
     }
 
@@ -389,13 +386,12 @@ namespace ttk {
                              const int &localEdgeId,
                              SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexEdgeList_.subvectorsNumber()))
         return -1;
-      if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)vertexEdgeList_[vertexId].size()))
+      if((localEdgeId < 0) || (localEdgeId >= vertexEdgeList_.size(vertexId)))
         return -2;
 #endif
-      edgeId = vertexEdgeList_[vertexId][localEdgeId];
+      edgeId = vertexEdgeList_.get(vertexId, localEdgeId);
       return 0;
     }
 
@@ -403,14 +399,13 @@ namespace ttk {
       getVertexEdgeNumber(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexEdgeList_.subvectorsNumber()))
         return -1;
 #endif
-      return vertexEdgeList_[vertexId].size();
+      return vertexEdgeList_.size(vertexId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexEdges() override {
+    inline const FlatJaggedArray *getVertexEdges() override {
       return &vertexEdgeList_;
     }
 
@@ -419,13 +414,12 @@ namespace ttk {
                              SimplexId &linkId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexLinkList_.subvectorsNumber()))
         return -1;
-      if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)vertexLinkList_[vertexId].size()))
+      if((localLinkId < 0) || (localLinkId >= vertexLinkList_.size(vertexId)))
         return -2;
 #endif
-      linkId = vertexLinkList_[vertexId][localLinkId];
+      linkId = vertexLinkList_.get(vertexId, localLinkId);
 
       return 0;
     }
@@ -433,14 +427,13 @@ namespace ttk {
     inline SimplexId
       getVertexLinkNumber(const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexLinkList_.subvectorsNumber()))
         return -1;
 #endif
-      return vertexLinkList_[vertexId].size();
+      return vertexLinkList_.size(vertexId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexLinks() override {
+    inline const FlatJaggedArray *getVertexLinks() override {
       return &vertexLinkList_;
     }
 
@@ -448,14 +441,13 @@ namespace ttk {
                                  const int &localNeighborId,
                                  SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexNeighborList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexNeighborList_.subvectorsNumber()))
         return -1;
       if((localNeighborId < 0)
-         || (localNeighborId
-             >= (SimplexId)vertexNeighborList_[vertexId].size()))
+         || (localNeighborId >= vertexNeighborList_.size(vertexId)))
         return -2;
 #endif
-      neighborId = vertexNeighborList_[vertexId][localNeighborId];
+      neighborId = vertexNeighborList_.get(vertexId, localNeighborId);
       return 0;
     }
 
@@ -465,11 +457,10 @@ namespace ttk {
       if((vertexId < 0) || (vertexId >= vertexNumber_))
         return -1;
 #endif
-      return vertexNeighborList_[vertexId].size();
+      return vertexNeighborList_.size(vertexId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexNeighbors() override {
+    inline const FlatJaggedArray *getVertexNeighbors() override {
       return &vertexNeighborList_;
     }
 
@@ -500,27 +491,25 @@ namespace ttk {
                              const int &localStarId,
                              SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexStarList_.subvectorsNumber()))
         return -1;
-      if((localStarId < 0)
-         || (localStarId >= (SimplexId)vertexStarList_[vertexId].size()))
+      if((localStarId < 0) || (localStarId >= vertexStarList_.size(vertexId)))
         return -2;
 #endif
-      starId = vertexStarList_[vertexId][localStarId];
+      starId = vertexStarList_.get(vertexId, localStarId);
       return 0;
     }
 
     inline SimplexId
       getVertexStarNumber(const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexStarList_.subvectorsNumber()))
         return -1;
 #endif
-      return vertexStarList_[vertexId].size();
+      return vertexStarList_.size(vertexId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexStars() override {
+    inline const FlatJaggedArray *getVertexStars() override {
       return &vertexStarList_;
     }
 
@@ -529,14 +518,13 @@ namespace ttk {
                                  SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexTriangleList_.subvectorsNumber()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId
-             >= (SimplexId)vertexTriangleList_[vertexId].size()))
+         || (localTriangleId >= vertexTriangleList_.size(vertexId)))
         return -2;
 #endif
-      triangleId = vertexTriangleList_[vertexId][localTriangleId];
+      triangleId = vertexTriangleList_.get(vertexId, localTriangleId);
       return 0;
     }
 
@@ -544,14 +532,13 @@ namespace ttk {
       getVertexTriangleNumber(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= vertexTriangleList_.subvectorsNumber()))
         return -1;
 #endif
-      return vertexTriangleList_[vertexId].size();
+      return vertexTriangleList_.size(vertexId);
     }
 
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexTriangles() override {
+    inline const FlatJaggedArray *getVertexTriangles() override {
 
       return &vertexTriangleList_;
     }
@@ -573,15 +560,15 @@ namespace ttk {
     }
 
     inline bool hasPreprocessedCellEdges() const override {
-      return (cellEdgeList_.size() != 0);
+      return !cellEdgeList_.empty();
     }
 
     inline bool hasPreprocessedCellNeighbors() const override {
-      return (cellNeighborList_.size() != 0);
+      return !cellNeighborList_.empty();
     }
 
     inline bool hasPreprocessedCellTriangles() const override {
-      return (cellTriangleList_.size() != 0);
+      return !cellTriangleList_.empty();
     }
 
     inline bool hasPreprocessedEdges() const override {
@@ -589,51 +576,51 @@ namespace ttk {
     }
 
     inline bool hasPreprocessedEdgeLinks() const override {
-      return (edgeLinkList_.size() != 0);
+      return !edgeLinkList_.empty();
     }
 
     inline bool hasPreprocessedEdgeStars() const override {
-      return (edgeStarList_.size() != 0);
+      return !edgeStarList_.empty();
     }
 
     inline bool hasPreprocessedEdgeTriangles() const override {
-      return (edgeTriangleList_.size() != 0);
+      return !edgeTriangleList_.empty();
     }
 
     inline bool hasPreprocessedTriangles() const override {
-      return (triangleList_.size() != 0);
+      return !triangleList_.empty();
     }
 
     inline bool hasPreprocessedTriangleEdges() const override {
-      return (triangleEdgeList_.size() != 0);
+      return !triangleEdgeList_.empty();
     }
 
     inline bool hasPreprocessedTriangleLinks() const override {
-      return (triangleLinkList_.size() != 0);
+      return !triangleLinkList_.empty();
     }
 
     inline bool hasPreprocessedTriangleStars() const override {
-      return (triangleStarList_.size() != 0);
+      return !triangleStarList_.empty();
     }
 
     inline bool hasPreprocessedVertexEdges() const override {
-      return (vertexEdgeList_.size() != 0);
+      return !vertexEdgeList_.empty();
     }
 
     inline bool hasPreprocessedVertexLinks() const override {
-      return (vertexLinkList_.size() != 0);
+      return !vertexLinkList_.empty();
     }
 
     inline bool hasPreprocessedVertexNeighbors() const override {
-      return (vertexNeighborList_.size() != 0);
+      return !vertexNeighborList_.empty();
     }
 
     inline bool hasPreprocessedVertexStars() const override {
-      return (vertexStarList_.size() != 0);
+      return !vertexStarList_.empty();
     }
 
     inline bool hasPreprocessedVertexTriangles() const override {
-      return (vertexTriangleList_.size() != 0);
+      return !vertexTriangleList_.empty();
     }
 
     inline bool isEdgeOnBoundary(const SimplexId &edgeId) const override {
@@ -678,8 +665,8 @@ namespace ttk {
 
       if(getDimensionality() == 2) {
         preprocessEdgeStars();
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < edgeStarList_.subvectorsNumber(); i++) {
+          if(edgeStarList_.size(i) == 1) {
             boundaryEdges_[i] = true;
           }
         }
@@ -687,10 +674,10 @@ namespace ttk {
         preprocessTriangleStars();
         preprocessTriangleEdges();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < triangleStarList_.subvectorsNumber(); i++) {
+          if(triangleStarList_.size(i) == 1) {
             for(int j = 0; j < 3; j++) {
-              boundaryEdges_[triangleEdgeList_[i][j]] = true;
+              boundaryEdges_[triangleEdgeList_.get(i, j)] = true;
             }
           }
         }
@@ -712,18 +699,19 @@ namespace ttk {
         return 0;
 
       if((!boundaryTriangles_.empty())
-         && (boundaryTriangles_.size() == triangleList_.size())) {
+         && ((SimplexId)boundaryTriangles_.size()
+             == triangleList_.subvectorsNumber())) {
         return 0;
       }
 
       preprocessTriangles();
-      boundaryTriangles_.resize(triangleList_.size(), false);
+      boundaryTriangles_.resize(triangleList_.subvectorsNumber(), false);
 
       if(getDimensionality() == 3) {
         preprocessTriangleStars();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < triangleStarList_.subvectorsNumber(); i++) {
+          if(triangleStarList_.size(i) == 1) {
             boundaryTriangles_[i] = true;
           }
         }
@@ -752,8 +740,8 @@ namespace ttk {
       // look for singletons
       if(getDimensionality() == 1) {
         preprocessVertexStars();
-        for(SimplexId i = 0; i < (SimplexId)vertexStarList_.size(); i++) {
-          if(vertexStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < vertexStarList_.subvectorsNumber(); i++) {
+          if(vertexStarList_.size(i) == 1) {
             boundaryVertices_[i] = true;
           }
         }
@@ -761,8 +749,8 @@ namespace ttk {
         preprocessEdges();
         preprocessEdgeStars();
 
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < edgeStarList_.subvectorsNumber(); i++) {
+          if(edgeStarList_.size(i) == 1) {
             boundaryVertices_[edgeList_[i].first] = true;
             boundaryVertices_[edgeList_[i].second] = true;
           }
@@ -771,11 +759,11 @@ namespace ttk {
         preprocessTriangles();
         preprocessTriangleStars();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
-            boundaryVertices_[triangleList_[i][0]] = true;
-            boundaryVertices_[triangleList_[i][1]] = true;
-            boundaryVertices_[triangleList_[i][2]] = true;
+        for(SimplexId i = 0; i < triangleStarList_.subvectorsNumber(); i++) {
+          if(triangleStarList_.size(i) == 1) {
+            boundaryVertices_[triangleList_.get(i, 0)] = true;
+            boundaryVertices_[triangleList_.get(i, 1)] = true;
+            boundaryVertices_[triangleList_.get(i, 2)] = true;
           }
         }
       } else {
@@ -792,14 +780,23 @@ namespace ttk {
 
     inline int preprocessCellEdges() override {
 
-      if(!cellEdgeList_.size()) {
+      if(cellEdgeList_.empty()) {
+
+        if(!edgeList_.size()) {
+          // edges, cell edges and vertex edges in a single pass
+          OneSkeleton oneSkeleton;
+          oneSkeleton.setWrapper(this);
+          return oneSkeleton.buildEdgeList(
+            vertexNumber_, cellNumber_, cellArray_, edgeList_, &cellEdgeList_,
+            vertexEdgeList_.empty() ? &vertexEdgeList_ : NULL);
+        }
 
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
-        threeSkeleton.buildCellEdges(vertexNumber_, cellNumber_, cellArray_,
-                                     cellEdgeList_, &edgeList_,
-                                     &vertexEdgeList_);
+        return threeSkeleton.buildCellEdges(vertexNumber_, cellNumber_,
+                                            cellArray_, cellEdgeList_,
+                                            &edgeList_, &vertexEdgeList_);
       }
 
       return 0;
@@ -807,12 +804,12 @@ namespace ttk {
 
     inline int preprocessCellNeighbors() override {
 
-      if(!cellNeighborList_.size()) {
+      if(cellNeighborList_.empty()) {
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         // choice here (for the more likely)
-        threeSkeleton.buildCellNeighborsFromVertices(
+        return threeSkeleton.buildCellNeighborsFromVertices(
           vertexNumber_, cellNumber_, cellArray_, cellNeighborList_,
           &vertexStarList_);
       }
@@ -822,38 +819,19 @@ namespace ttk {
 
     inline int preprocessCellTriangles() override {
 
-      if(!cellTriangleList_.size()) {
+      if(cellTriangleList_.empty()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        if(triangleList_.size()) {
-          // we already computed this guy, let's just get the cell triangles
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                                 cellArray_, NULL, NULL,
-                                                 &cellTriangleList_);
-          } else {
-            // let's compute the triangle star while we're at it...
-            // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
-              vertexNumber_, cellNumber_, cellArray_, NULL, &triangleStarList_,
-              &cellTriangleList_);
-          }
-        } else {
-          // we have not computed this guy, let's do it while we're at it
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                                 cellArray_, &triangleList_,
-                                                 NULL, &cellTriangleList_);
-          } else {
-            // let's compute the triangle star while we're at it...
-            // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
-              vertexNumber_, cellNumber_, cellArray_, &triangleList_,
-              &triangleStarList_, &cellTriangleList_);
-          }
-        }
+        // if the triangles (or their stars) have already been computed,
+        // only the cell triangles are requested. otherwise, let's compute
+        // them while we're at it, it's just a tiny overhead.
+        return twoSkeleton.buildTriangleList(
+          vertexNumber_, cellNumber_, cellArray_,
+          triangleList_.empty() ? &triangleList_ : NULL,
+          triangleStarList_.empty() ? &triangleStarList_ : NULL,
+          &cellTriangleList_);
       }
 
       return 0;
@@ -873,7 +851,7 @@ namespace ttk {
 
     inline int preprocessEdgeLinks() override {
 
-      if(!edgeLinkList_.size()) {
+      if(edgeLinkList_.empty()) {
 
         if(getDimensionality() == 2) {
           preprocessEdges();
@@ -907,7 +885,7 @@ namespace ttk {
 
     inline int preprocessEdgeStars() override {
 
-      if(!edgeStarList_.size()) {
+      if(edgeStarList_.empty()) {
         OneSkeleton oneSkeleton;
         oneSkeleton.setWrapper(this);
         return oneSkeleton.buildEdgeStars(vertexNumber_, cellNumber_,
@@ -919,7 +897,7 @@ namespace ttk {
 
     inline int preprocessEdgeTriangles() override {
 
-      if(!edgeTriangleList_.size()) {
+      if(edgeTriangleList_.empty()) {
 
         // WARNING
         // here vertexStarList and triangleStarList will be computed (for
@@ -939,14 +917,15 @@ namespace ttk {
 
     inline int preprocessTriangles() override {
 
-      if(!triangleList_.size()) {
+      if(triangleList_.empty()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_, cellArray_,
-                                      &triangleList_, &triangleStarList_,
-                                      &cellTriangleList_);
+        twoSkeleton.buildTriangleList(
+          vertexNumber_, cellNumber_, cellArray_, &triangleList_,
+          triangleStarList_.empty() ? &triangleStarList_ : NULL,
+          cellTriangleList_.empty() ? &cellTriangleList_ : NULL);
       }
 
       return 0;
@@ -954,7 +933,7 @@ namespace ttk {
 
     inline int preprocessTriangleEdges() override {
 
-      if(!triangleEdgeList_.size()) {
+      if(triangleEdgeList_.empty()) {
 
         // WARNING
         // here triangleStarList and cellTriangleList will be computed (for
@@ -975,7 +954,7 @@ namespace ttk {
 
     inline int preprocessTriangleLinks() override {
 
-      if(!triangleLinkList_.size()) {
+      if(triangleLinkList_.empty()) {
 
         preprocessTriangleStars();
 
@@ -990,13 +969,13 @@ namespace ttk {
 
     inline int preprocessTriangleStars() override {
 
-      if(!triangleStarList_.size()) {
+      if(triangleStarList_.empty()) {
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                             cellArray_, &triangleList_,
-                                             &triangleStarList_);
+        return twoSkeleton.buildTriangleList(
+          vertexNumber_, cellNumber_, cellArray_,
+          triangleList_.empty() ? &triangleList_ : NULL, &triangleStarList_);
       }
 
       return 0;
@@ -1004,16 +983,16 @@ namespace ttk {
 
     inline int preprocessVertexEdges() override {
 
-      if((SimplexId)vertexEdgeList_.size() != vertexNumber_) {
-        ZeroSkeleton zeroSkeleton;
-
+      if(vertexEdgeList_.subvectorsNumber() != vertexNumber_) {
         if(!edgeList_.size()) {
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          oneSkeleton.buildEdgeList(
-            vertexNumber_, cellNumber_, cellArray_, edgeList_);
+          return oneSkeleton.buildEdgeList(vertexNumber_, cellNumber_,
+                                           cellArray_, edgeList_, NULL,
+                                           &vertexEdgeList_);
         }
 
+        ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
         return zeroSkeleton.buildVertexEdges(
           vertexNumber_, edgeList_, vertexEdgeList_);
@@ -1023,7 +1002,7 @@ namespace ttk {
 
     inline int preprocessVertexLinks() override {
 
-      if((SimplexId)vertexLinkList_.size() != vertexNumber_) {
+      if(vertexLinkList_.subvectorsNumber() != vertexNumber_) {
 
         if(getDimensionality() == 2) {
           preprocessVertexStars();
@@ -1055,7 +1034,7 @@ namespace ttk {
 
     inline int preprocessVertexNeighbors() override {
 
-      if((SimplexId)vertexNeighborList_.size() != vertexNumber_) {
+      if(vertexNeighborList_.subvectorsNumber() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
         return zeroSkeleton.buildVertexNeighbors(
@@ -1067,7 +1046,7 @@ namespace ttk {
 
     inline int preprocessVertexStars() override {
 
-      if((SimplexId)vertexStarList_.size() != vertexNumber_) {
+      if(vertexStarList_.subvectorsNumber() != vertexNumber_) {
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
 
@@ -1079,7 +1058,7 @@ namespace ttk {
 
     inline int preprocessVertexTriangles() override {
 
-      if((SimplexId)vertexTriangleList_.size() != vertexNumber_) {
+      if(vertexTriangleList_.subvectorsNumber() != vertexNumber_) {
 
         preprocessTriangles();
 
@@ -1093,8 +1072,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the input cells (no copy, see ttk::CellArray).
+    /// \param cellNumber Number of input cells.
+    /// \param cellArray Input cells, for instance a pointer to an array
+    /// where each cell starts by its number of vertices, followed by the
+    /// identifiers of its vertices (legacy VTK layout).
+    /// \return Returns 0 upon success, negative values otherwise.
     inline int setInputCells(const SimplexId &cellNumber,
-                             const LongSimplexId *cellArray) {
+                             const CellArray &cellArray) {
 
       if(cellNumber_)
         clear();
@@ -1105,6 +1090,42 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the input cells from a connectivity array and an offsets array
+    /// (VTK 9 layout), without copying them.
+    /// \param cellNumber Number of input cells.
+    /// \param connectivity Vertex identifiers of the cells, cell after cell.
+    /// \param offsets Position of the first vertex of each cell in
+    /// \p connectivity (\p cellNumber + 1 entries). All the cells must have
+    /// the same number of vertices.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename idType>
+    inline int setInputCells(const SimplexId &cellNumber,
+                             const idType *connectivity,
+                             const idType *offsets) {
+
+      if(!cellNumber)
+        return setInputCells(cellNumber, CellArray());
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((!connectivity) || (!offsets))
+        return -1;
+#endif
+
+      const CellArray cellArray(connectivity, offsets[1] - offsets[0]);
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!cellArray.isHomogeneous(cellNumber, offsets)) {
+        std::stringstream msg;
+        msg << "[ExplicitTriangulation] Mixed cell types are not supported!"
+            << std::endl;
+        dMsg(std::cerr, msg.str(), fatalMsg);
+        return -2;
+      }
+#endif
+
+      return setInputCells(cellNumber, cellArray);
+    }
+
     inline int setInputPoints(const SimplexId &pointNumber,
                               const void *pointSet,
                               const bool &doublePrecision = false) {
@@ -1118,13 +1139,15 @@ namespace ttk {
       return 0;
     }
 
+    size_t footprint() const override;
+
   protected:
     int clear();
 
     bool doublePrecision_;
     SimplexId cellNumber_, vertexNumber_;
     const void *pointSet_;
-    const LongSimplexId *cellArray_;
+    CellArray cellArray_;
   };
 } // namespace ttk
 
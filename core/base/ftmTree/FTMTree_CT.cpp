@@ -442,7 +442,8 @@ void FTMTree_CT::insertNodes(void) {
   }
 }
 
-int FTMTree_CT::leafSearch() {
+template <class triangulationType>
+void FTMTree_CT::leafSearch(const triangulationType *mesh) {
   const auto nbScalars = scalars_->size;
   const auto chunkSize = getChunkSize();
   const auto chunkNb = getChunkCount();
@@ -456,13 +457,13 @@ int FTMTree_CT::leafSearch() {
       const SimplexId lowerBound = chunkId * chunkSize;
       const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
       for(SimplexId v = lowerBound; v < upperBound; ++v) {
-        const auto &neighNumb = mesh_->getVertexNeighborNumber(v);
+        const auto &neighNumb = mesh->getVertexNeighborNumber(v);
         valence upval = 0;
         valence downval = 0;
 
         for(valence n = 0; n < neighNumb; ++n) {
-          SimplexId neigh;
-          mesh_->getVertexNeighbor(v, n, neigh);
+          SimplexId neigh{-1};
+          mesh->getVertexNeighbor(v, n, neigh);
           if(scalars_->isLower(neigh, v)) {
             ++downval;
           } else {
@@ -487,5 +488,10 @@ int FTMTree_CT::leafSearch() {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp taskwait
 #endif
+}
+
+int FTMTree_CT::leafSearch() {
+  ttkTemplateMacro(
+    mesh_->getDispatchType(), leafSearch(mesh_->getData<TTK_TT>()));
   return 0;
 }
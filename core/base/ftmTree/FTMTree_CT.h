@@ -100,6 +100,9 @@ namespace ttk {
 
       int leafSearch();
 
+      template <class triangulationType>
+      void leafSearch(const triangulationType *mesh);
+
       void build(TreeType tt);
 
       void insertNodes();
@@ -146,7 +146,10 @@ FTMTree_MT::~FTMTree_MT() {
 #endif
 }
 
-void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
+template <class triangulationType>
+void FTMTree_MT::arcGrowth(const triangulationType *mesh,
+                           const SimplexId startVert,
+                           const SimplexId orig) {
   // current task id / propag
 
   // local order (ignore non regular verts)
@@ -203,7 +206,7 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
 
     // Saddle & Last detection + propagation
     bool isSaddle, isLast;
-    tie(isSaddle, isLast) = propage(*currentState, startUF);
+    tie(isSaddle, isLast) = propage(mesh, *currentState, startUF);
 
     // regular propagation
 #ifdef TTK_ENABLE_OPENMP
@@ -227,7 +230,7 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
       // If last close all and merge
       if(isLast) {
         // finish works here
-        closeAndMergeOnSaddle(currentVert);
+        closeAndMergeOnSaddle(mesh, currentVert);
 
         // last task detection
         idNode remainingTasks;
@@ -250,7 +253,7 @@ void FTMTree_MT::arcGrowth(const SimplexId startVert, const SimplexId orig) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp taskyield
 #endif
-        arcGrowth(currentVert, orig);
+        arcGrowth(mesh, currentVert, orig);
       } else {
         // Active tasks / threads
 #ifdef TTK_ENABLE_OPENMP
@@ -494,14 +497,16 @@ FTMTree_MT *FTMTree_MT::clone() const {
   return newMT;
 }
 
-void FTMTree_MT::closeAndMergeOnSaddle(SimplexId saddleVert) {
+template <class triangulationType>
+void FTMTree_MT::closeAndMergeOnSaddle(const triangulationType *mesh,
+                                       SimplexId saddleVert) {
   idNode closeNode = makeNode(saddleVert);
 
   // Union of the UF coming here (merge propagation and closing arcs)
-  const auto &nbNeigh = mesh_->getVertexNeighborNumber(saddleVert);
+  const auto &nbNeigh = mesh->getVertexNeighborNumber(saddleVert);
   for(valence n = 0; n < nbNeigh; ++n) {
     SimplexId neigh;
-    mesh_->getVertexNeighbor(saddleVert, n, neigh);
+    mesh->getVertexNeighbor(saddleVert, n, neigh);
 
     if(comp_.vertLower(neigh, saddleVert)) {
       if((*mt_data_.ufs)[neigh]->find()
@@ -526,14 +531,16 @@ void FTMTree_MT::closeArcsUF(idNode closeNode, UF uf) {
   uf->find()->clearOpenedArcs();
 }
 
-void FTMTree_MT::closeOnBackBone(SimplexId saddleVert) {
+template <class triangulationType>
+void FTMTree_MT::closeOnBackBone(const triangulationType *mesh,
+                                 SimplexId saddleVert) {
   idNode closeNode = makeNode(saddleVert);
 
   // Union of the UF coming here (merge propagation and closing arcs)
-  const auto &nbNeigh = mesh_->getVertexNeighborNumber(saddleVert);
+  const auto &nbNeigh = mesh->getVertexNeighborNumber(saddleVert);
   for(valence n = 0; n < nbNeigh; ++n) {
     SimplexId neigh;
-    mesh_->getVertexNeighbor(saddleVert, n, neigh);
+    mesh->getVertexNeighbor(saddleVert, n, neigh);
 
     if(comp_.vertLower(neigh, saddleVert)) {
       if((*mt_data_.ufs)[neigh]
@@ -789,7 +796,8 @@ void FTMTree_MT::leafGrowth() {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp task untied OPTIONAL_PRIORITY(isPrior())
 #endif
-    arcGrowth(v, n);
+    ttkTemplateMacro(
+      mesh_->getDispatchType(), arcGrowth(mesh_->getData<TTK_TT>(), v, n));
   }
 
 #ifdef TTK_ENABLE_OPENMP
@@ -797,44 +805,50 @@ void FTMTree_MT::leafGrowth() {
 #endif
 }
 
-int FTMTree_MT::leafSearch() {
-  int ret = 0;
-  // if not already computed by CT
-  if(getNumberOfNodes() == 0) {
-    const auto nbScalars = scalars_->size;
-    const auto chunkSize = getChunkSize();
-    const auto chunkNb = getChunkCount();
+template <class triangulationType>
+void FTMTree_MT::leafSearch(const triangulationType *mesh) {
+  const auto nbScalars = scalars_->size;
+  const auto chunkSize = getChunkSize();
+  const auto chunkNb = getChunkCount();
 
-    // Extrema extract and launch tasks
-    for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
+  // Extrema extract and launch tasks
+  for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp task firstprivate(chunkId) OPTIONAL_PRIORITY(isPrior())
 #endif
-      {
-        const SimplexId lowerBound = chunkId * chunkSize;
-        const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
-        for(SimplexId v = lowerBound; v < upperBound; ++v) {
-          const auto &neighNumb = mesh_->getVertexNeighborNumber(v);
-          valence val = 0;
-
-          for(valence n = 0; n < neighNumb; ++n) {
-            SimplexId neigh;
-            mesh_->getVertexNeighbor(v, n, neigh);
-            comp_.vertLower(neigh, v) && ++val;
-          }
+    {
+      const SimplexId lowerBound = chunkId * chunkSize;
+      const SimplexId upperBound = min(nbScalars, (chunkId + 1) * chunkSize);
+      for(SimplexId v = lowerBound; v < upperBound; ++v) {
+        const auto &neighNumb = mesh->getVertexNeighborNumber(v);
+        valence val = 0;
 
-          (*mt_data_.valences)[v] = val;
+        for(valence n = 0; n < neighNumb; ++n) {
+          SimplexId neigh{-1};
+          mesh->getVertexNeighbor(v, n, neigh);
+          comp_.vertLower(neigh, v) && ++val;
+        }
 
-          if(!val) {
-            makeNode(v);
-          }
+        (*mt_data_.valences)[v] = val;
+
+        if(!val) {
+          makeNode(v);
         }
       }
     }
+  }
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp taskwait
 #endif
+}
+
+int FTMTree_MT::leafSearch() {
+  int ret = 0;
+  // if not already computed by CT
+  if(getNumberOfNodes() == 0) {
+    ttkTemplateMacro(
+      mesh_->getDispatchType(), leafSearch(mesh_->getData<TTK_TT>()));
   } else {
     ret = 1;
   }
@@ -1173,9 +1187,12 @@ void FTMTree_MT::printTree2() {
   }
 }
 
-tuple<bool, bool> FTMTree_MT::propage(CurrentState &currentState, UF curUF) {
+template <class triangulationType>
+tuple<bool, bool> FTMTree_MT::propage(const triangulationType *mesh,
+                                      CurrentState &currentState,
+                                      UF curUF) {
   bool becameSaddle = false, isLast = false;
-  const auto nbNeigh = mesh_->getVertexNeighborNumber(currentState.vertex);
+  const auto nbNeigh = mesh->getVertexNeighborNumber(currentState.vertex);
   valence decr = 0;
 
   // once for all
@@ -1184,7 +1201,7 @@ tuple<bool, bool> FTMTree_MT::propage(CurrentState &currentState, UF curUF) {
   // propagation / is saddle
   for(valence n = 0; n < nbNeigh; ++n) {
     SimplexId neigh;
-    mesh_->getVertexNeighbor(currentState.vertex, n, neigh);
+    mesh->getVertexNeighbor(currentState.vertex, n, neigh);
 
     if(comp_.vertLower(neigh, currentState.vertex)) {
       UF neighUF = (*mt_data_.ufs)[neigh];
@@ -1294,9 +1311,12 @@ SimplexId FTMTree_MT::trunk(const bool ct) {
     }
   }
   sort(trunkVerts.begin(), trunkVerts.end(), comp_.vertLower);
-  for(const SimplexId v : trunkVerts) {
-    closeOnBackBone(v);
-  }
+  ttkTemplateMacro(mesh_->getDispatchType(), {
+    const TTK_TT *mesh = mesh_->getData<TTK_TT>();
+    for(const SimplexId v : trunkVerts) {
+      closeOnBackBone(mesh, v);
+    }
+  });
 
   // Arcs
   const auto &nbNodes = trunkVerts.size();
@@ -244,17 +244,32 @@ namespace ttk {
 
       virtual int leafSearch();
 
+      /// Extrema extraction, instantiated for the concrete triangulation
+      /// type (see ttkTemplateMacro).
+      template <class triangulationType>
+      void leafSearch(const triangulationType *mesh);
+
       // skeleton
 
       void leafGrowth();
 
-      void arcGrowth(const SimplexId startVert, const SimplexId orig);
+      template <class triangulationType>
+      void arcGrowth(const triangulationType *mesh,
+                     const SimplexId startVert,
+                     const SimplexId orig);
 
-      std::tuple<bool, bool> propage(CurrentState &currentState, UF curUF);
+      template <class triangulationType>
+      std::tuple<bool, bool> propage(const triangulationType *mesh,
+                                     CurrentState &currentState,
+                                     UF curUF);
 
-      void closeAndMergeOnSaddle(SimplexId saddleVert);
+      template <class triangulationType>
+      void closeAndMergeOnSaddle(const triangulationType *mesh,
+                                 SimplexId saddleVert);
 
-      void closeOnBackBone(SimplexId saddleVert);
+      template <class triangulationType>
+      void closeOnBackBone(const triangulationType *mesh,
+                           SimplexId saddleVert);
 
       void closeArcsUF(idNode closeNode, UF uf);
 
@@ -320,8 +335,8 @@ namespace ttk {
         }
       }
 
-      inline void setScalars(void *local_scalars) {
-        scalars_->values = local_scalars;
+      inline void setScalars(const void *local_scalars) {
+        scalars_->values = (void *)local_scalars;
       }
 
       inline void setTreeType(const int local_treeType) {
@@ -364,6 +379,17 @@ namespace ttk {
         scalars_->offsets = (void *)sos;
       }
 
+      /// Set an order field (rank of each vertex in the order given by the
+      /// scalars and the offsets, see ttk::VertexOrder) to skip the sort of
+      /// the vertices (NULL: the vertices are sorted).
+      inline void setVertexOrder(const SimplexId *order) {
+        scalars_->order = order;
+      }
+
+      inline const std::vector<SimplexId> *getMirrorVertices(void) const {
+        return scalars_->mirrorVertices.get();
+      }
+
       // arcs
 
       inline idSuperArc getNumberOfSuperArcs(void) const {
@@ -17,12 +17,11 @@
 #define FTMTREE_MT_TPL_H
 
 #include <functional>
-#if(defined(__GNUC__) && !defined(__clang__))
-#include <parallel/algorithm>
-#endif
 
 #include "FTMTree_MT.h"
 
+#include <VertexOrder.h>
+
 // ----
 // Init
 // ----
@@ -42,31 +41,6 @@ namespace ttk {
         sortedVect->clear();
       }
 
-      auto indirect_sort = [&](const size_t &a, const size_t &b) {
-        return isLower<scalarType, idType>(a, b);
-      };
-
-      sortedVect->resize(nbVertices, 0);
-      std::iota(
-        sortedVect->begin(), sortedVect->end(), static_cast<SimplexId>(0));
-
-      // #pragma omp parallel
-      // #pragma omp single
-      //    scalars_->qsort<SimplexId>(sortedVect->data(), 0, scalars_->size -1,
-      //    indirect_sort);
-
-#ifdef TTK_ENABLE_OPENMP
-#ifdef __clang__
-      std::cout << "Caution, outside GCC, sequential sort" << std::endl;
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#else
-      __gnu_parallel::sort(
-        sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-#else
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-
       auto *mirrorVert = scalars_->mirrorVertices.get();
       if(mirrorVert == nullptr) {
         mirrorVert = new std::vector<SimplexId>(0);
@@ -75,14 +49,18 @@ namespace ttk {
         mirrorVert->clear();
       }
 
-      scalars_->mirrorVertices->resize(nbVertices);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for
-#endif
-      for(SimplexId i = 0; i < nbVertices; i++) {
-        (*scalars_->mirrorVertices)[(*sortedVect)[i]] = i;
+      if(scalars_->order) {
+        // order field given: no sort needed
+        VertexOrder::sortVerticesFromOrder(nbVertices, scalars_->order,
+                                           *sortedVect, mirrorVert,
+                                           threadNumber_);
+        return;
       }
+
+      // same order as isLower(), computed with a parallel radix sort
+      VertexOrder::sortVertices(nbVertices, (scalarType *)scalars_->values,
+                                (idType *)scalars_->offsets, *sortedVect,
+                                mirrorVert, threadNumber_);
     }
 
   } // namespace ftm
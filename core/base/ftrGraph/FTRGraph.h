@@ -192,6 +192,13 @@ namespace ttk {
         scalars_->setOffsets(sos);
       }
 
+      /// Set an order field (rank of each vertex in the order given by the
+      /// scalars and the offsets, see ttk::VertexOrder) to skip the sort of
+      /// the vertices (NULL: the vertices are sorted).
+      void setVertexOrder(const SimplexId *order) {
+        scalars_->setOrder(order);
+      }
+
       DynamicGraph<idVertex> &dynGraph(const Propagation *const lp) {
         if(lp->goUp()) {
           return dynGraphs_.up;
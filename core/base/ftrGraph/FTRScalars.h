@@ -8,20 +8,10 @@
 #include <vector>
 
 #include <Debug.h>
+#include <VertexOrder.h>
 
 namespace ttk {
   namespace ftr {
-    template <typename ScalarType>
-    struct Vert {
-      idVertex id;
-      ScalarType value;
-      idVertex offset;
-
-      inline bool operator<(const Vert<ScalarType> &v) const {
-        return std::tie(value, offset) < std::tie(v.value, v.offset);
-      }
-    };
-
     template <typename ScalarType>
     class Scalars : virtual public Debug {
     private:
@@ -30,16 +20,19 @@ namespace ttk {
       ScalarType *values_;
       std::vector<SimplexId> *vOffsets_;
       SimplexId *offsets_;
+      // optional order field (rank of each vertex), see ttk::VertexOrder
+      const SimplexId *order_;
 
       bool externalOffsets_;
 
-      std::vector<Vert<ScalarType>> vertices_;
+      std::vector<idVertex> vertices_;
       std::vector<idVertex> mirror_;
 
     public:
       Scalars()
         : size_(nullVertex), values_(nullptr), vOffsets_(nullptr),
-          offsets_(nullptr), externalOffsets_(false), vertices_(), mirror_() {
+          offsets_(nullptr), order_(nullptr), externalOffsets_(false),
+          vertices_(), mirror_() {
       }
 
       // Heavy, prevent using it
@@ -72,7 +65,7 @@ namespace ttk {
       }
 
       idVertex getSortedVert(const idVertex i) const {
-        return vertices_[i].id;
+        return vertices_[i];
       }
 
       idVertex getMirror(const idVertex i) const {
@@ -95,6 +88,10 @@ namespace ttk {
         }
       }
 
+      void setOrder(const SimplexId *order) {
+        order_ = order;
+      }
+
       void alloc() {
         if(!externalOffsets_) {
           offsets_ = new SimplexId[size_];
@@ -113,32 +110,19 @@ namespace ttk {
             offsets_[i] = i;
           }
         }
-
-        // Copy everything in the main array
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for schedule(static, size_ / threadNumber_)
-#endif
-        for(idVertex i = 0; i < size_; i++) {
-          vertices_[i].id = i;
-          vertices_[i].value = values_[i];
-          vertices_[i].offset = offsets_[i];
-        }
       }
 
       void sort() {
-        // Sort the vertices array
-        ::ttk::ftr::parallel_sort<decltype(vertices_.begin())>(
-          vertices_.begin(), vertices_.end());
-
-        // Fill the mirror array, used for later comparisons
-        DebugTimer tt;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_) \
-  schedule(static, size_ / threadNumber_)
-#endif
-        for(idVertex i = 0; i < size_; i++) {
-          mirror_[vertices_[i].id] = i;
+        // Sort the vertices array and fill the mirror array, used for later
+        // comparisons
+        if(order_) {
+          // order field given: no sort needed
+          VertexOrder::sortVerticesFromOrder(
+            size_, order_, vertices_, &mirror_, threadNumber_);
+          return;
         }
+        VertexOrder::sortVertices(
+          size_, values_, offsets_, vertices_, &mirror_, threadNumber_);
       }
 
       void removeNaN(void) {
@@ -148,15 +132,21 @@ namespace ttk {
         // of Simplicity in the FTM tree computation Note: Can we detect NaN
         // using vtk ?
         if(std::numeric_limits<ScalarType>::has_quiet_NaN) {
+          bool hasNaN = false;
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_) \
-  schedule(static, size_ / threadNumber_)
+  schedule(static, size_ / threadNumber_) reduction(|| : hasNaN)
 #endif
           for(idVertex i = 0; i < size_; i++) {
             if(::std::isnan((double)values_[i])) {
               values_[i] = 0;
+              hasNaN = true;
             }
           }
+          // the order field (if any) does not account for the new values
+          if(hasNaN) {
+            order_ = nullptr;
+          }
         }
       }
 
@@ -1,11 +1,14 @@
 #include <ImplicitTriangulation.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace ttk;
 
 ImplicitTriangulation::ImplicitTriangulation()
   : dimensionality_{-1}, cellNumber_{}, vertexNumber_{}, edgeNumber_{},
-    triangleNumber_{}, tetrahedronNumber_{}, isAccelerated_{} {
+    triangleNumber_{}, tetrahedronNumber_{}, vertexNeighborStencilSize_{},
+    vertexBrickSize_{}, isAccelerated_{} {
 }
 
 ImplicitTriangulation::~ImplicitTriangulation() {
@@ -106,6 +109,39 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
     // TetrahedronShift
     tetshift_[0] = (xDim - 1) * 6;
     tetshift_[1] = (xDim - 1) * (yDim - 1) * 6;
+    // Interior vertex stencils
+    // V(abcdefgh)=V(g)+V(d)::{g,h}+V(h)::{g}+V(b)::{c,d,g,h}
+    vertexNeighborStencilSize_ = 14;
+    vertexNeighborStencil_[0] = -vshift_[0] - vshift_[1]; // a
+    vertexNeighborStencil_[1] = 1 - vshift_[0] - vshift_[1]; // b
+    vertexNeighborStencil_[2] = -vshift_[1]; // c
+    vertexNeighborStencil_[3] = 1 - vshift_[1]; // d
+    vertexNeighborStencil_[4] = -vshift_[0]; // e
+    vertexNeighborStencil_[5] = 1 - vshift_[0]; // f
+    vertexNeighborStencil_[6] = 1; // h
+    vertexNeighborStencil_[7] = -1 + vshift_[1]; // V(d)::{g}
+    vertexNeighborStencil_[8] = vshift_[1]; // V(d)::{h}
+    vertexNeighborStencil_[9] = -1; // V(h)::{g}
+    vertexNeighborStencil_[10] = -1 + vshift_[0]; // V(b)::{c}
+    vertexNeighborStencil_[11] = vshift_[0]; // V(b)::{d}
+    vertexNeighborStencil_[12] = -1 + vshift_[0] + vshift_[1]; // V(b)::{g}
+    vertexNeighborStencil_[13] = vshift_[0] + vshift_[1]; // V(b)::{h}
+    for(int k = 0; k < 6; ++k) {
+      vertexStarStencil_[k] = -6 + k; // tet(b)
+      vertexStarStencil_[6 + k] = -tetshift_[0] - tetshift_[1] + k; // tet(g)
+    }
+    vertexStarStencil_[12] = 0; // tet(a)::abcg
+    vertexStarStencil_[13] = 2; // tet(a)::abeg
+    vertexStarStencil_[14] = -tetshift_[0]; // tet(c)::abcg
+    vertexStarStencil_[15] = -tetshift_[0] + 1; // tet(c)::bcdg
+    vertexStarStencil_[16] = -6 - tetshift_[0] + 1; // tet(d)::bcdg
+    vertexStarStencil_[17] = -6 - tetshift_[0] + 5; // tet(d)::bdgh
+    vertexStarStencil_[18] = -tetshift_[1] + 2; // tet(e)::abeg
+    vertexStarStencil_[19] = -tetshift_[1] + 3; // tet(e)::befg
+    vertexStarStencil_[20] = -6 - tetshift_[1] + 3; // tet(f)::befg
+    vertexStarStencil_[21] = -6 - tetshift_[1] + 4; // tet(f)::bfgh
+    vertexStarStencil_[22] = -6 - tetshift_[0] - tetshift_[1] + 4; // tet(h)
+    vertexStarStencil_[23] = -6 - tetshift_[0] - tetshift_[1] + 5; // tet(h)
 
     // Numbers
     vertexNumber_ = xDim * yDim * zDim;
@@ -147,6 +183,21 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
     eshift_[4] = dimensions_[Di_] - 1;
     // TriangleShift
     tshift_[0] = (dimensions_[Di_] - 1) * 2;
+    // Interior vertex stencils
+    // V(abcd)=V(d)::{b,c}+V(c)::{b,d}+V(a)::{b}+V(b)::{c}
+    vertexNeighborStencilSize_ = 6;
+    vertexNeighborStencil_[0] = -1;
+    vertexNeighborStencil_[1] = -vshift_[0];
+    vertexNeighborStencil_[2] = -vshift_[0] + 1;
+    vertexNeighborStencil_[3] = 1;
+    vertexNeighborStencil_[4] = vshift_[0];
+    vertexNeighborStencil_[5] = vshift_[0] - 1;
+    vertexStarStencil_[0] = -2;
+    vertexStarStencil_[1] = -1;
+    vertexStarStencil_[2] = 0;
+    vertexStarStencil_[3] = -tshift_[0];
+    vertexStarStencil_[4] = -tshift_[0] + 1;
+    vertexStarStencil_[5] = -tshift_[0] - 1;
 
     // Numbers
     vertexNumber_ = dimensions_[Di_] * dimensions_[Dj_];
@@ -166,12 +217,103 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
       }
     }
 
+    // Interior vertex stencils
+    vertexNeighborStencilSize_ = 2;
+    vertexNeighborStencil_[0] = 1;
+    vertexNeighborStencil_[1] = -1;
+
     // Numbers
     vertexNumber_ = dimensions_[Di_];
     edgeNumber_ = vertexNumber_ - 1;
     cellNumber_ = edgeNumber_;
   }
 
+  // the brick decomposition of the previous grid, if any, is obsolete
+  vertexBrickSize_ = 0;
+  vertexBrickOrder_.clear();
+
+  return 0;
+}
+
+int ImplicitTriangulation::preprocessVertexBricks(const SimplexId &brickSize) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(brickSize < 1)
+    return -1;
+  if(dimensionality_ < 1)
+    return -2;
+#endif
+
+  if(brickSize == vertexBrickSize_)
+    return 0;
+
+  Timer t;
+
+  vertexBrickSize_ = brickSize;
+  for(int k = 0; k < 3; ++k)
+    vertexBrickDimensions_[k] = (dimensions_[k] + brickSize - 1) / brickSize;
+
+  const SimplexId brickNumber = vertexBrickDimensions_[0]
+                                * vertexBrickDimensions_[1]
+                                * vertexBrickDimensions_[2];
+
+  // Morton code of each brick (interleaved bits of its coordinates)
+  vector<pair<unsigned long long int, SimplexId>> codes(brickNumber);
+  for(SimplexId b = 0; b < brickNumber; ++b) {
+    unsigned long long int p[3];
+    p[0] = b % vertexBrickDimensions_[0];
+    p[1] = (b / vertexBrickDimensions_[0]) % vertexBrickDimensions_[1];
+    p[2] = b / (vertexBrickDimensions_[0] * vertexBrickDimensions_[1]);
+
+    unsigned long long int code = 0;
+    for(int i = 0; i < 21; ++i) {
+      for(int k = 0; k < 3; ++k)
+        code |= ((p[k] >> i) & 1ULL) << (3 * i + k);
+    }
+    codes[b] = make_pair(code, b);
+  }
+  sort(codes.begin(), codes.end());
+
+  vertexBrickOrder_.resize(brickNumber);
+  for(SimplexId b = 0; b < brickNumber; ++b)
+    vertexBrickOrder_[b] = codes[b].second;
+
+  {
+    stringstream msg;
+    msg << "[ImplicitTriangulation] " << brickNumber << " vertex bricks ("
+        << brickSize << "^" << dimensionality_ << " vertices) built in "
+        << t.getElapsedTime() << " s." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ImplicitTriangulation::getVertexBrick(const SimplexId &brickId,
+                                          SimplexId lower[3],
+                                          SimplexId upper[3],
+                                          bool &isInterior) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(brickId < 0 or brickId >= (SimplexId)vertexBrickOrder_.size())
+    return -1;
+#endif
+
+  const SimplexId b = vertexBrickOrder_[brickId];
+  SimplexId p[3];
+  p[0] = b % vertexBrickDimensions_[0];
+  p[1] = (b / vertexBrickDimensions_[0]) % vertexBrickDimensions_[1];
+  p[2] = b / (vertexBrickDimensions_[0] * vertexBrickDimensions_[1]);
+
+  isInterior = true;
+  for(int k = 0; k < 3; ++k) {
+    lower[k] = p[k] * vertexBrickSize_;
+    upper[k] = min(lower[k] + vertexBrickSize_, dimensions_[k]);
+    // flat dimensions (of lower dimensional grids) have no boundary
+    if(dimensions_[k] > 1 and (!lower[k] or upper[k] == dimensions_[k]))
+      isInterior = false;
+  }
+
   return 0;
 }
 
@@ -311,254 +453,15 @@ bool ImplicitTriangulation::isTriangleOnBoundary(
   return false;
 }
 
-inline SimplexId ImplicitTriangulation::getVertexNeighborNumber(
-  const SimplexId &vertexId) const {
-#ifndef TTK_ENABLE_KAMIKAZE
-  if(vertexId < 0 or vertexId >= vertexNumber_)
-    return -1;
-#endif
-
-  if(dimensionality_ == 3) {
-    SimplexId p[3];
-    vertexToPosition(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 14; // abcdefgh
-        else
-          return 10; // abdc ou efhg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // aefb
-        else if(p[2] == 0)
-          return 8; // ab
-        else
-          return 6; // ef
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // ghdc
-        else if(p[2] == 0)
-          return 6; // cd
-        else
-          return 8; // gh
-      }
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // aegc
-        else if(p[2] == 0)
-          return 6; // ac
-        else
-          return 8; // eg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 6; // ae
-        else
-          return 4; // a ou e
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 8; // cg
-        else if(p[2] == 0)
-          return 4; // c
-        else
-          return 7; // g
-      }
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // bfhd
-        else if(p[2] == 0)
-          return 8; // bd
-        else
-          return 6; // fh
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 8; // bf
-        else if(p[2] == 0)
-          return 7; // b
-        else
-          return 4; // f
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 6; // dh
-        else
-          return 4; // d ou h
-      }
-    }
-  } else if(dimensionality_ == 2) {
-    SimplexId p[2];
-    vertexToPosition2d(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 6; // abcd
-      else if(p[1] == 0)
-        return 4; // ab
-      else
-        return 4; // cd
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 4; // ac
-      else if(p[1] == 0)
-        return 2; // a
-      else
-        return 3; // c
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 4; // bd
-      else if(p[1] == 0)
-        return 3; // b
-      else
-        return 2; // d
-    }
-  } else if(dimensionality_ == 1) {
-    if(vertexId > 0 and vertexId < nbvoxels_[Di_])
-      return 2; // ab
-    else
-      return 1; // a ou b
-  }
-
-  return -1;
-}
-
-int ImplicitTriangulation::getVertexNeighbor(const SimplexId &vertexId,
-                                             const int &localNeighborId,
-                                             SimplexId &neighborId) const {
-#ifndef TTK_ENABLE_KAMIKAZE
-  if(localNeighborId < 0
-     or localNeighborId >= getVertexNeighborNumber(vertexId))
-    return -1;
-#endif
-
-  neighborId = -1;
-
-  if(dimensionality_ == 3) {
-    SimplexId p[3];
-    vertexToPosition(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId
-            = getVertexNeighborABCDEFGH(vertexId, localNeighborId); // abcdefgh
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborABDC(vertexId, localNeighborId); // abdc
-        else
-          neighborId = getVertexNeighborEFHG(vertexId, localNeighborId); // efhg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborAEFB(vertexId, localNeighborId); // aefb
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborAB(vertexId, localNeighborId); // ab
-        else
-          neighborId = getVertexNeighborEF(vertexId, localNeighborId); // ef
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborGHDC(vertexId, localNeighborId); // ghdc
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborCD(vertexId, localNeighborId); // cd
-        else
-          neighborId = getVertexNeighborGH(vertexId, localNeighborId); // gh
-      }
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborAEGC(vertexId, localNeighborId); // aegc
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborAC(vertexId, localNeighborId); // ac
-        else
-          neighborId = getVertexNeighborEG(vertexId, localNeighborId); // eg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborAE(vertexId, localNeighborId); // ae
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborA(vertexId, localNeighborId); // a
-        else
-          neighborId = getVertexNeighborE(vertexId, localNeighborId); // e
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborCG(vertexId, localNeighborId); // cg
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborC(vertexId, localNeighborId); // c
-        else
-          neighborId = getVertexNeighborG(vertexId, localNeighborId); // g
-      }
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborBFHD(vertexId, localNeighborId); // bfhd
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborBD(vertexId, localNeighborId); // bd
-        else
-          neighborId = getVertexNeighborFH(vertexId, localNeighborId); // fh
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborBF(vertexId, localNeighborId); // bf
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborB(vertexId, localNeighborId); // b
-        else
-          neighborId = getVertexNeighborF(vertexId, localNeighborId); // f
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborDH(vertexId, localNeighborId); // dh
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborD(vertexId, localNeighborId); // d
-        else
-          neighborId = getVertexNeighborH(vertexId, localNeighborId); // h
-      }
-    }
-  } else if(dimensionality_ == 2) {
-    SimplexId p[2];
-    vertexToPosition2d(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        neighborId = getVertexNeighbor2dABCD(vertexId, localNeighborId); // abcd
-      else if(p[1] == 0)
-        neighborId = getVertexNeighbor2dAB(vertexId, localNeighborId); // ab
-      else
-        neighborId = getVertexNeighbor2dCD(vertexId, localNeighborId); // cd
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        neighborId = getVertexNeighbor2dAC(vertexId, localNeighborId); // ac
-      else if(p[1] == 0)
-        neighborId = getVertexNeighbor2dA(vertexId, localNeighborId); // a
-      else
-        neighborId = getVertexNeighbor2dC(vertexId, localNeighborId); // c
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        neighborId = getVertexNeighbor2dBD(vertexId, localNeighborId); // bd
-      else if(p[1] == 0)
-        neighborId = getVertexNeighbor2dB(vertexId, localNeighborId); // b
-      else
-        neighborId = getVertexNeighbor2dD(vertexId, localNeighborId); // d
-    }
-  } else if(dimensionality_ == 1) {
-    // ab
-    if(vertexId > 0 and vertexId < nbvoxels_[Di_]) {
-      if(localNeighborId == 0)
-        neighborId = vertexId + 1;
-      else
-        neighborId = vertexId - 1;
-    } else if(vertexId == 0)
-      neighborId = vertexId + 1; // a
-    else
-      neighborId = vertexId - 1; // b
-  }
-
-  return 0;
-}
-
-const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexNeighbors() {
-  if(!vertexNeighborList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getVertexNeighbors() {
+  if(vertexNeighborList_.empty()) {
     Timer t;
-    vertexNeighborList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexNeighborList_[i].resize(getVertexNeighborNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexNeighborList_[i].size(); ++j)
-        getVertexNeighbor(i, j, vertexNeighborList_[i][j]);
-    }
+    vertexNeighborList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexNeighborNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexNeighbor(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -718,16 +621,16 @@ int ImplicitTriangulation::getVertexEdge(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexEdges() {
-  if(!vertexEdgeList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getVertexEdges() {
+  if(vertexEdgeList_.empty()) {
     Timer t;
 
-    vertexEdgeList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexEdgeList_[i].resize(getVertexEdgeNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexEdgeList_[i].size(); ++j)
-        getVertexEdge(i, j, vertexEdgeList_[i][j]);
-    }
+    vertexEdgeList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexEdgeNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexEdge(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -910,16 +813,16 @@ int ImplicitTriangulation::getVertexTriangle(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexTriangles() {
-  if(!vertexTriangleList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getVertexTriangles() {
+  if(vertexTriangleList_.empty()) {
     Timer t;
 
-    vertexTriangleList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexTriangleList_[i].resize(getVertexTriangleNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexTriangleList_[i].size(); ++j)
-        getVertexTriangle(i, j, vertexTriangleList_[i][j]);
-    }
+    vertexTriangleList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexTriangleNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexTriangle(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1052,16 +955,16 @@ int ImplicitTriangulation::getVertexLink(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexLinks() {
-  if(!vertexLinkList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getVertexLinks() {
+  if(vertexLinkList_.empty()) {
     Timer t;
 
-    vertexLinkList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexLinkList_[i].resize(getVertexLinkNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexLinkList_[i].size(); ++j)
-        getVertexLink(i, j, vertexLinkList_[i][j]);
-    }
+    vertexLinkList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexLinkNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexLink(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1295,15 +1198,15 @@ int ImplicitTriangulation::getVertexStar(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexStars() {
-  if(!vertexStarList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getVertexStars() {
+  if(vertexStarList_.empty()) {
     Timer t;
-    vertexStarList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexStarList_[i].resize(getVertexStarNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexStarList_[i].size(); ++j)
-        getVertexStar(i, j, vertexStarList_[i][j]);
-    }
+    vertexStarList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexStarNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexStar(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1908,16 +1811,16 @@ int ImplicitTriangulation::getEdgeTriangle(const SimplexId &edgeId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeTriangles() {
-  if(!edgeTriangleList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getEdgeTriangles() {
+  if(edgeTriangleList_.empty()) {
     Timer t;
 
-    edgeTriangleList_.resize(edgeNumber_);
-    for(SimplexId i = 0; i < edgeNumber_; ++i) {
-      edgeTriangleList_[i].resize(getEdgeTriangleNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)edgeTriangleList_[i].size(); ++j)
-        getEdgeTriangle(i, j, edgeTriangleList_[i][j]);
-    }
+    edgeTriangleList_.fillRows(
+      edgeNumber_,
+      [this](const SimplexId &i) { return getEdgeTriangleNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getEdgeTriangle(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1993,16 +1896,16 @@ int ImplicitTriangulation::getEdgeLink(const SimplexId &edgeId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeLinks() {
-  if(!edgeLinkList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getEdgeLinks() {
+  if(edgeLinkList_.empty()) {
     Timer t;
 
-    edgeLinkList_.resize(edgeNumber_);
-    for(SimplexId i = 0; i < edgeNumber_; ++i) {
-      edgeLinkList_[i].resize(getEdgeLinkNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)edgeLinkList_[i].size(); ++j)
-        getEdgeLink(i, j, edgeLinkList_[i][j]);
-    }
+    edgeLinkList_.fillRows(
+      edgeNumber_,
+      [this](const SimplexId &i) { return getEdgeLinkNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getEdgeLink(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -2222,16 +2125,16 @@ int ImplicitTriangulation::getEdgeStar(const SimplexId &edgeId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeStars() {
-  if(!edgeStarList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getEdgeStars() {
+  if(edgeStarList_.empty()) {
     Timer t;
 
-    edgeStarList_.resize(edgeNumber_);
-    for(SimplexId i = 0; i < edgeNumber_; ++i) {
-      edgeStarList_[i].resize(getEdgeStarNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)edgeStarList_[i].size(); ++j)
-        getEdgeStar(i, j, edgeStarList_[i][j]);
-    }
+    edgeStarList_.fillRows(
+      edgeNumber_,
+      [this](const SimplexId &i) { return getEdgeStarNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getEdgeStar(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -2445,19 +2348,18 @@ int ImplicitTriangulation::getTriangleEdge(const SimplexId &triangleId,
   return 0;
 }
 
-int ImplicitTriangulation::getTriangleEdges(
-  vector<vector<SimplexId>> &edges) const {
-  edges.resize(triangleNumber_);
-  for(SimplexId i = 0; i < triangleNumber_; ++i) {
-    edges[i].resize(3);
-    for(int j = 0; j < 3; ++j)
-      getTriangleEdge(i, j, edges[i][j]);
-  }
+int ImplicitTriangulation::getTriangleEdges(FlatJaggedArray &edges) const {
+  edges.fillRows(
+    triangleNumber_,
+    [](const SimplexId &) { return 3; },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTriangleEdge(i, j, v);
+    });
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleEdges() {
-  if(!triangleEdgeList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getTriangleEdges() {
+  if(triangleEdgeList_.empty()) {
     Timer t;
 
     getTriangleEdges(triangleEdgeList_);
@@ -2474,16 +2376,16 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleEdges() {
   return &triangleEdgeList_;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangles() {
-  if(!triangleList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getTriangles() {
+  if(triangleList_.empty()) {
     Timer t;
 
-    triangleList_.resize(triangleNumber_);
-    for(SimplexId i = 0; i < triangleNumber_; ++i) {
-      triangleList_[i].resize(3);
-      for(int j = 0; j < 3; ++j)
-        getTriangleVertex(i, j, triangleList_[i][j]);
-    }
+    triangleList_.fillRows(
+      triangleNumber_,
+      [](const SimplexId &) { return 3; },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getTriangleVertex(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -2550,16 +2452,16 @@ inline SimplexId ImplicitTriangulation::getTriangleLinkNumber(
   return getTriangleStarNumber(triangleId);
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleLinks() {
-  if(!triangleLinkList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getTriangleLinks() {
+  if(triangleLinkList_.empty()) {
     Timer t;
 
-    triangleLinkList_.resize(triangleNumber_);
-    for(SimplexId i = 0; i < triangleNumber_; ++i) {
-      triangleLinkList_[i].resize(getTriangleLinkNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)triangleLinkList_[i].size(); ++j)
-        getTriangleLink(i, j, triangleLinkList_[i][j]);
-    }
+    triangleLinkList_.fillRows(
+      triangleNumber_,
+      [this](const SimplexId &i) { return getTriangleLinkNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getTriangleLink(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -2669,16 +2571,16 @@ int ImplicitTriangulation::getTriangleStar(const SimplexId &triangleId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleStars() {
-  if(!triangleStarList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getTriangleStars() {
+  if(triangleStarList_.empty()) {
     Timer t;
 
-    triangleStarList_.resize(triangleNumber_);
-    for(SimplexId i = 0; i < triangleNumber_; ++i) {
-      triangleStarList_[i].resize(getTriangleStarNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)triangleStarList_[i].size(); ++j)
-        getTriangleStar(i, j, triangleStarList_[i][j]);
-    }
+    triangleStarList_.fillRows(
+      triangleNumber_,
+      [this](const SimplexId &i) { return getTriangleStarNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getTriangleStar(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -2812,14 +2714,13 @@ int ImplicitTriangulation::getTriangleNeighbor(const SimplexId &triangleId,
   return 0;
 }
 
-int ImplicitTriangulation::getTriangleNeighbors(
-  vector<vector<SimplexId>> &neighbors) {
-  neighbors.resize(triangleNumber_);
-  for(SimplexId i = 0; i < triangleNumber_; ++i) {
-    neighbors[i].resize(getTriangleNeighborNumber(i));
-    for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
-      getTriangleNeighbor(i, j, neighbors[i][j]);
-  }
+int ImplicitTriangulation::getTriangleNeighbors(FlatJaggedArray &neighbors) {
+  neighbors.fillRows(
+    triangleNumber_,
+    [this](const SimplexId &i) { return getTriangleNeighborNumber(i); },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTriangleNeighbor(i, j, v);
+    });
   return 0;
 }
 
@@ -2906,14 +2807,13 @@ int ImplicitTriangulation::getTetrahedronEdge(const SimplexId &tetId,
   return 0;
 }
 
-int ImplicitTriangulation::getTetrahedronEdges(
-  vector<vector<SimplexId>> &edges) const {
-  edges.resize(tetrahedronNumber_);
-  for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
-    edges[i].resize(6);
-    for(int j = 0; j < 6; ++j)
-      getTetrahedronEdge(i, j, edges[i][j]);
-  }
+int ImplicitTriangulation::getTetrahedronEdges(FlatJaggedArray &edges) const {
+  edges.fillRows(
+    tetrahedronNumber_,
+    [](const SimplexId &) { return 6; },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTetrahedronEdge(i, j, v);
+    });
 
   return 0;
 }
@@ -2961,13 +2861,13 @@ int ImplicitTriangulation::getTetrahedronTriangle(const SimplexId &tetId,
 }
 
 int ImplicitTriangulation::getTetrahedronTriangles(
-  vector<vector<SimplexId>> &triangles) const {
-  triangles.resize(tetrahedronNumber_);
-  for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
-    triangles[i].resize(4);
-    for(int j = 0; j < 4; ++j)
-      getTetrahedronTriangle(i, j, triangles[i][j]);
-  }
+  FlatJaggedArray &triangles) const {
+  triangles.fillRows(
+    tetrahedronNumber_,
+    [](const SimplexId &) { return 4; },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTetrahedronTriangle(i, j, v);
+    });
 
   return 0;
 }
@@ -3080,14 +2980,13 @@ int ImplicitTriangulation::getTetrahedronNeighbor(const SimplexId &tetId,
   return 0;
 }
 
-int ImplicitTriangulation::getTetrahedronNeighbors(
-  vector<vector<SimplexId>> &neighbors) {
-  neighbors.resize(tetrahedronNumber_);
-  for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
-    neighbors[i].resize(getTetrahedronNeighborNumber(i));
-    for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
-      getTetrahedronNeighbor(i, j, neighbors[i][j]);
-  }
+int ImplicitTriangulation::getTetrahedronNeighbors(FlatJaggedArray &neighbors) {
+  neighbors.fillRows(
+    tetrahedronNumber_,
+    [this](const SimplexId &i) { return getTetrahedronNeighborNumber(i); },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTetrahedronNeighbor(i, j, v);
+    });
 
   return 0;
 }
@@ -3131,8 +3030,8 @@ int ImplicitTriangulation::getCellEdge(const SimplexId &cellId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getCellEdges() {
-  if(!cellEdgeList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getCellEdges() {
+  if(cellEdgeList_.empty()) {
     Timer t;
 
     if(dimensionality_ == 3)
@@ -3161,8 +3060,8 @@ int ImplicitTriangulation::getCellTriangle(const SimplexId &cellId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getCellTriangles() {
-  if(!cellTriangleList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getCellTriangles() {
+  if(cellTriangleList_.empty()) {
     Timer t;
 
     if(dimensionality_ == 3)
@@ -3215,8 +3114,8 @@ int ImplicitTriangulation::getCellNeighbor(const SimplexId &cellId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *ImplicitTriangulation::getCellNeighbors() {
-  if(!cellNeighborList_.size()) {
+const FlatJaggedArray *ImplicitTriangulation::getCellNeighbors() {
+  if(cellNeighborList_.empty()) {
     Timer t;
 
     if(dimensionality_ == 3)
@@ -32,7 +32,7 @@ namespace ttk {
 
     SimplexId getCellEdgeNumber(const SimplexId &cellId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getCellEdges() override;
+    const FlatJaggedArray *getCellEdges() override;
 
     int getCellNeighbor(const SimplexId &cellId,
                         const int &localNeighborId,
@@ -40,7 +40,7 @@ namespace ttk {
 
     SimplexId getCellNeighborNumber(const SimplexId &cellId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getCellNeighbors() override;
+    const FlatJaggedArray *getCellNeighbors() override;
 
     int getCellTriangle(const SimplexId &cellId,
                         const int &id,
@@ -52,7 +52,7 @@ namespace ttk {
       return 4;
     };
 
-    const std::vector<std::vector<SimplexId>> *getCellTriangles() override;
+    const FlatJaggedArray *getCellTriangles() override;
 
     int getCellVertex(const SimplexId &cellId,
                       const int &localVertexId,
@@ -70,7 +70,7 @@ namespace ttk {
 
     SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getEdgeLinks() override;
+    const FlatJaggedArray *getEdgeLinks() override;
 
     int getEdgeStar(const SimplexId &edgeId,
                     const int &localStarId,
@@ -78,7 +78,7 @@ namespace ttk {
 
     SimplexId getEdgeStarNumber(const SimplexId &edgeId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getEdgeStars() override;
+    const FlatJaggedArray *getEdgeStars() override;
 
     int getEdgeTriangle(const SimplexId &edgeId,
                         const int &id,
@@ -86,7 +86,7 @@ namespace ttk {
 
     SimplexId getEdgeTriangleNumber(const SimplexId &edgeId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getEdgeTriangles() override;
+    const FlatJaggedArray *getEdgeTriangles() override;
 
     int getEdgeVertex(const SimplexId &edgeId,
                       const int &localVertexId,
@@ -114,14 +114,13 @@ namespace ttk {
                            const int &id,
                            SimplexId &edgeId) const;
 
-    int getTetrahedronEdges(std::vector<std::vector<SimplexId>> &edges) const;
+    int getTetrahedronEdges(FlatJaggedArray &edges) const;
 
     int getTetrahedronTriangle(const SimplexId &tetId,
                                const int &id,
                                SimplexId &triangleId) const;
 
-    int getTetrahedronTriangles(
-      std::vector<std::vector<SimplexId>> &triangles) const;
+    int getTetrahedronTriangles(FlatJaggedArray &triangles) const;
 
     int getTetrahedronNeighbor(const SimplexId &tetId,
                                const int &localNeighborId,
@@ -129,7 +128,7 @@ namespace ttk {
 
     SimplexId getTetrahedronNeighborNumber(const SimplexId &tetId) const;
 
-    int getTetrahedronNeighbors(std::vector<std::vector<SimplexId>> &neighbors);
+    int getTetrahedronNeighbors(FlatJaggedArray &neighbors);
 
     int getTetrahedronVertex(const SimplexId &tetId,
                              const int &localVertexId,
@@ -146,9 +145,9 @@ namespace ttk {
       return 3;
     }
 
-    const std::vector<std::vector<SimplexId>> *getTriangleEdges() override;
+    const FlatJaggedArray *getTriangleEdges() override;
 
-    int getTriangleEdges(std::vector<std::vector<SimplexId>> &edges) const;
+    int getTriangleEdges(FlatJaggedArray &edges) const;
 
     int getTriangleLink(const SimplexId &triangleId,
                         const int &localLinkId,
@@ -156,7 +155,7 @@ namespace ttk {
 
     SimplexId getTriangleLinkNumber(const SimplexId &triangleId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getTriangleLinks() override;
+    const FlatJaggedArray *getTriangleLinks() override;
 
     int getTriangleNeighbor(const SimplexId &triangleId,
                             const int &localNeighborId,
@@ -164,7 +163,7 @@ namespace ttk {
 
     SimplexId getTriangleNeighborNumber(const SimplexId &triangleId) const;
 
-    int getTriangleNeighbors(std::vector<std::vector<SimplexId>> &neighbors);
+    int getTriangleNeighbors(FlatJaggedArray &neighbors);
 
     int getTriangleStar(const SimplexId &triangleId,
                         const int &localStarId,
@@ -172,13 +171,13 @@ namespace ttk {
 
     SimplexId getTriangleStarNumber(const SimplexId &triangleId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getTriangleStars() override;
+    const FlatJaggedArray *getTriangleStars() override;
 
     int getTriangleVertex(const SimplexId &triangleId,
                           const int &localVertexId,
                           SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getTriangles() override;
+    const FlatJaggedArray *getTriangles() override;
 
     int getVertexEdge(const SimplexId &vertexId,
                       const int &id,
@@ -186,7 +185,7 @@ namespace ttk {
 
     SimplexId getVertexEdgeNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexEdges() override;
+    const FlatJaggedArray *getVertexEdges() override;
 
     int getVertexLink(const SimplexId &vertexId,
                       const int &localLinkId,
@@ -194,7 +193,7 @@ namespace ttk {
 
     SimplexId getVertexLinkNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexLinks() override;
+    const FlatJaggedArray *getVertexLinks() override;
 
     int getVertexNeighbor(const SimplexId &vertexId,
                           const int &localNeighborId,
@@ -202,7 +201,66 @@ namespace ttk {
 
     SimplexId getVertexNeighborNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexNeighbors() override;
+    const FlatJaggedArray *getVertexNeighbors() override;
+
+    /// Get the \p localNeighborId-th neighbor of an interior vertex (i.e.
+    /// not on the boundary of the grid, for instance any vertex of an interior
+    /// brick, see getVertexBrick()).
+    ///
+    /// This stencil look-up skips the position decoding and the boundary case
+    /// analysis of getVertexNeighbor(), with which it is consistent.
+    /// \param vertexId Input interior vertex identifier.
+    /// \param localNeighborId Input local neighbor identifier,
+    /// in [0, getInteriorVertexNeighborNumber()[.
+    /// \return Returns the global neighbor identifier.
+    inline SimplexId
+      getInteriorVertexNeighbor(const SimplexId &vertexId,
+                                const int &localNeighborId) const {
+      return vertexId + vertexNeighborStencil_[localNeighborId];
+    }
+
+    /// Get the number of neighbors of an interior vertex.
+    /// \return Returns the number of neighbors of any interior vertex.
+    inline SimplexId getInteriorVertexNeighborNumber() const {
+      return vertexNeighborStencilSize_;
+    }
+
+    /// Get the number of vertex bricks.
+    ///
+    /// preprocessVertexBricks() needs to be called before this function.
+    /// \return Returns the number of vertex bricks.
+    inline SimplexId getVertexBrickNumber() const {
+      return vertexBrickOrder_.size();
+    }
+
+    /// Get the extent of the \p brickId-th vertex brick.
+    ///
+    /// The bricks are ordered along a Morton (Z-order) curve. Visiting the
+    /// vertices brick by brick (and in row-major order inside each brick)
+    /// keeps the neighbors of the visited vertices in cache, including the
+    /// z-neighbors of large grids, which a row-major scan evicts.
+    ///
+    /// preprocessVertexBricks() needs to be called before this function.
+    /// \param brickId Input brick identifier, in [0, getVertexBrickNumber()[.
+    /// \param lower Output lower grid coordinates of the brick (inclusive).
+    /// \param upper Output upper grid coordinates of the brick (exclusive).
+    /// The identifier of the vertex at (i, j, k) is
+    /// i + dimX * (j + dimY * k).
+    /// \param isInterior Output flag, true if no vertex of the brick is on
+    /// the boundary of the grid (see getInteriorVertexNeighbor()).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int getVertexBrick(const SimplexId &brickId,
+                       SimplexId lower[3],
+                       SimplexId upper[3],
+                       bool &isInterior) const;
+
+    /// Pre-process the decomposition of the grid into bricks of
+    /// \p brickSize vertices along each dimension, for cache-blocked vertex
+    /// traversals (see getVertexBrick()). The vertex identifiers are left
+    /// unchanged.
+    /// \param brickSize Number of vertices of a brick along each dimension.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int preprocessVertexBricks(const SimplexId &brickSize = 16);
 
     int getVertexPoint(const SimplexId &vertexId,
                        float &x,
@@ -215,7 +273,7 @@ namespace ttk {
 
     SimplexId getVertexStarNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexStars() override;
+    const FlatJaggedArray *getVertexStars() override;
 
     int getVertexTriangle(const SimplexId &vertexId,
                           const int &id,
@@ -223,7 +281,7 @@ namespace ttk {
 
     SimplexId getVertexTriangleNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexTriangles() override;
+    const FlatJaggedArray *getVertexTriangles() override;
 
     bool isEdgeOnBoundary(const SimplexId &edgeId) const override;
 
@@ -278,6 +336,17 @@ namespace ttk {
     SimplexId Di_;
     SimplexId Dj_;
 
+    // interior vertex stencils (offsets to the vertex identifier)
+    int vertexNeighborStencilSize_;
+    SimplexId vertexNeighborStencil_[14];
+    // (offsets to the star of the voxel of the vertex)
+    SimplexId vertexStarStencil_[24];
+
+    // vertex bricks
+    SimplexId vertexBrickSize_;
+    SimplexId vertexBrickDimensions_[3];
+    std::vector<SimplexId> vertexBrickOrder_;
+
     // acceleration variables
     bool isAccelerated_;
     SimplexId mod_[2];
@@ -803,21 +872,8 @@ inline ttk::SimplexId
   ttk::ImplicitTriangulation::getVertexNeighbor2dABCD(const SimplexId v,
                                                       const int id) const {
   // V(abcd)=V(d)::{b,c}+V(c)::{b,d}+V(a)::{b}+V(b)::{c}
-  switch(id) {
-    case 0:
-      return v - 1;
-    case 1:
-      return v - vshift_[0];
-    case 2:
-      return v - vshift_[0] + 1;
-    case 3:
-      return v + 1;
-    case 4:
-      return v + vshift_[0];
-    case 5:
-      return v + vshift_[0] - 1;
-  }
-  return -1;
+  // (see setInputGrid())
+  return v + vertexNeighborStencil_[id];
 }
 
 inline ttk::SimplexId
@@ -1060,21 +1116,8 @@ inline ttk::SimplexId
 inline ttk::SimplexId
   ttk::ImplicitTriangulation::getVertexStar2dABCD(const SimplexId p[2],
                                                   const int id) const {
-  switch(id) {
-    case 0:
-      return (p[0] - 1) * 2 + p[1] * tshift_[0];
-    case 1:
-      return (p[0] - 1) * 2 + p[1] * tshift_[0] + 1;
-    case 2:
-      return p[0] * 2 + p[1] * tshift_[0];
-    case 3:
-      return p[0] * 2 + (p[1] - 1) * tshift_[0];
-    case 4:
-      return p[0] * 2 + (p[1] - 1) * tshift_[0] + 1;
-    case 5:
-      return (p[0] - 1) * 2 + (p[1] - 1) * tshift_[0] + 1;
-  }
-  return -1;
+  // (see setInputGrid())
+  return p[0] * 2 + p[1] * tshift_[0] + vertexStarStencil_[id];
 }
 
 inline ttk::SimplexId
@@ -1983,37 +2026,8 @@ inline ttk::SimplexId
   ttk::ImplicitTriangulation::getVertexNeighborABCDEFGH(const SimplexId v,
                                                         const int id) const {
   // V(abcdefgh)=V(g)+V(d)::{g,h}+V(h)::{g}+V(b)::{c,d,g,h}
-  switch(id) {
-    case 0:
-      return v - vshift_[0] - vshift_[1]; // a
-    case 1:
-      return v + 1 - vshift_[0] - vshift_[1]; // b
-    case 2:
-      return v - vshift_[1]; // c
-    case 3:
-      return v + 1 - vshift_[1]; // d
-    case 4:
-      return v - vshift_[0]; // e
-    case 5:
-      return v + 1 - vshift_[0]; // f
-    case 6:
-      return v + 1; // h
-    case 7:
-      return v - 1 + vshift_[1]; // V(d)::{g}
-    case 8:
-      return v + vshift_[1]; // V(d)::{h}
-    case 9:
-      return v - 1; // V(h)::{g}
-    case 10:
-      return v - 1 + vshift_[0]; // V(b)::{c}
-    case 11:
-      return v + vshift_[0]; // V(b)::{d}
-    case 12:
-      return v - 1 + vshift_[0] + vshift_[1]; // V(b)::{g}
-    case 13:
-      return v + vshift_[0] + vshift_[1]; // V(b)::{h}
-  }
-  return -1;
+  // (see setInputGrid())
+  return v + vertexNeighborStencil_[id];
 }
 
 inline ttk::SimplexId
@@ -5162,51 +5176,9 @@ inline ttk::SimplexId
 inline ttk::SimplexId
   ttk::ImplicitTriangulation::getVertexStarABCDEFGH(const SimplexId p[3],
                                                     const int id) const {
-  if(id >= 0 && id <= 5)
-    return (p[0] - 1) * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
-           + id; // tet(b)
-  if(id >= 6 && id <= 11)
-    return p[0] * 6 + (p[1] - 1) * tetshift_[0] + (p[2] - 1) * tetshift_[1] + id
-           - 6; // tet(g)
-  switch(id) {
-    case 12:
-      return p[0] * 6 + p[1] * tetshift_[0]
-             + p[2] * tetshift_[1]; // tet(a)::abcg
-    case 13:
-      return p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
-             + 2; // tet(a)::abeg
-    case 14:
-      return p[0] * 6 + (p[1] - 1) * tetshift_[0]
-             + p[2] * tetshift_[1]; // tet(c)::abcg
-    case 15:
-      return p[0] * 6 + (p[1] - 1) * tetshift_[0] + p[2] * tetshift_[1]
-             + 1; // tet(c)::bcdg
-    case 16:
-      return (p[0] - 1) * 6 + (p[1] - 1) * tetshift_[0] + p[2] * tetshift_[1]
-             + 1; // tet(d)::bcdg
-    case 17:
-      return (p[0] - 1) * 6 + (p[1] - 1) * tetshift_[0] + p[2] * tetshift_[1]
-             + 5; // tet(d)::bdgh
-    case 18:
-      return p[0] * 6 + p[1] * tetshift_[0] + (p[2] - 1) * tetshift_[1]
-             + 2; // tet(e)::abeg
-    case 19:
-      return p[0] * 6 + p[1] * tetshift_[0] + (p[2] - 1) * tetshift_[1]
-             + 3; // tet(e)::befg
-    case 20:
-      return (p[0] - 1) * 6 + p[1] * tetshift_[0] + (p[2] - 1) * tetshift_[1]
-             + 3; // tet(f)::befg
-    case 21:
-      return (p[0] - 1) * 6 + p[1] * tetshift_[0] + (p[2] - 1) * tetshift_[1]
-             + 4; // tet(f)::bfgh
-    case 22:
-      return (p[0] - 1) * 6 + (p[1] - 1) * tetshift_[0]
-             + (p[2] - 1) * tetshift_[1] + 4; // tet(h)::bfgh
-    case 23:
-      return (p[0] - 1) * 6 + (p[1] - 1) * tetshift_[0]
-             + (p[2] - 1) * tetshift_[1] + 5; // tet(h)::bdgh
-  }
-  return -1;
+  // (see setInputGrid())
+  return p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+         + vertexStarStencil_[id];
 }
 
 inline ttk::SimplexId
@@ -7684,4 +7656,244 @@ inline ttk::SimplexId ttk::ImplicitTriangulation::getTetrahedronNeighborBDGH(
   return -1;
 }
 
+inline ttk::SimplexId ttk::ImplicitTriangulation::getVertexNeighborNumber(
+  const SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(vertexId < 0 or vertexId >= vertexNumber_)
+    return -1;
+#endif
+
+  if(dimensionality_ == 3) {
+    SimplexId p[3];
+    vertexToPosition(vertexId, p);
+
+    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 14; // abcdefgh
+        else
+          return 10; // abdc ou efhg
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 10; // aefb
+        else if(p[2] == 0)
+          return 8; // ab
+        else
+          return 6; // ef
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 10; // ghdc
+        else if(p[2] == 0)
+          return 6; // cd
+        else
+          return 8; // gh
+      }
+    } else if(p[0] == 0) {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 10; // aegc
+        else if(p[2] == 0)
+          return 6; // ac
+        else
+          return 8; // eg
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 6; // ae
+        else
+          return 4; // a ou e
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 8; // cg
+        else if(p[2] == 0)
+          return 4; // c
+        else
+          return 7; // g
+      }
+    } else {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 10; // bfhd
+        else if(p[2] == 0)
+          return 8; // bd
+        else
+          return 6; // fh
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 8; // bf
+        else if(p[2] == 0)
+          return 7; // b
+        else
+          return 4; // f
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          return 6; // dh
+        else
+          return 4; // d ou h
+      }
+    }
+  } else if(dimensionality_ == 2) {
+    SimplexId p[2];
+    vertexToPosition2d(vertexId, p);
+
+    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        return 6; // abcd
+      else if(p[1] == 0)
+        return 4; // ab
+      else
+        return 4; // cd
+    } else if(p[0] == 0) {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        return 4; // ac
+      else if(p[1] == 0)
+        return 2; // a
+      else
+        return 3; // c
+    } else {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        return 4; // bd
+      else if(p[1] == 0)
+        return 3; // b
+      else
+        return 2; // d
+    }
+  } else if(dimensionality_ == 1) {
+    if(vertexId > 0 and vertexId < nbvoxels_[Di_])
+      return 2; // ab
+    else
+      return 1; // a ou b
+  }
+
+  return -1;
+}
+
+inline int ttk::ImplicitTriangulation::getVertexNeighbor(
+  const SimplexId &vertexId,
+  const int &localNeighborId,
+  SimplexId &neighborId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(localNeighborId < 0
+     or localNeighborId >= getVertexNeighborNumber(vertexId))
+    return -1;
+#endif
+
+  neighborId = -1;
+
+  if(dimensionality_ == 3) {
+    SimplexId p[3];
+    vertexToPosition(vertexId, p);
+
+    if(0 < p[0] and p[0] < nbvoxels_[0]) {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId
+            = getVertexNeighborABCDEFGH(vertexId, localNeighborId); // abcdefgh
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborABDC(vertexId, localNeighborId); // abdc
+        else
+          neighborId = getVertexNeighborEFHG(vertexId, localNeighborId); // efhg
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborAEFB(vertexId, localNeighborId); // aefb
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborAB(vertexId, localNeighborId); // ab
+        else
+          neighborId = getVertexNeighborEF(vertexId, localNeighborId); // ef
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborGHDC(vertexId, localNeighborId); // ghdc
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborCD(vertexId, localNeighborId); // cd
+        else
+          neighborId = getVertexNeighborGH(vertexId, localNeighborId); // gh
+      }
+    } else if(p[0] == 0) {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborAEGC(vertexId, localNeighborId); // aegc
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborAC(vertexId, localNeighborId); // ac
+        else
+          neighborId = getVertexNeighborEG(vertexId, localNeighborId); // eg
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborAE(vertexId, localNeighborId); // ae
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborA(vertexId, localNeighborId); // a
+        else
+          neighborId = getVertexNeighborE(vertexId, localNeighborId); // e
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborCG(vertexId, localNeighborId); // cg
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborC(vertexId, localNeighborId); // c
+        else
+          neighborId = getVertexNeighborG(vertexId, localNeighborId); // g
+      }
+    } else {
+      if(0 < p[1] and p[1] < nbvoxels_[1]) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborBFHD(vertexId, localNeighborId); // bfhd
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborBD(vertexId, localNeighborId); // bd
+        else
+          neighborId = getVertexNeighborFH(vertexId, localNeighborId); // fh
+      } else if(p[1] == 0) {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborBF(vertexId, localNeighborId); // bf
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborB(vertexId, localNeighborId); // b
+        else
+          neighborId = getVertexNeighborF(vertexId, localNeighborId); // f
+      } else {
+        if(0 < p[2] and p[2] < nbvoxels_[2])
+          neighborId = getVertexNeighborDH(vertexId, localNeighborId); // dh
+        else if(p[2] == 0)
+          neighborId = getVertexNeighborD(vertexId, localNeighborId); // d
+        else
+          neighborId = getVertexNeighborH(vertexId, localNeighborId); // h
+      }
+    }
+  } else if(dimensionality_ == 2) {
+    SimplexId p[2];
+    vertexToPosition2d(vertexId, p);
+
+    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        neighborId = getVertexNeighbor2dABCD(vertexId, localNeighborId); // abcd
+      else if(p[1] == 0)
+        neighborId = getVertexNeighbor2dAB(vertexId, localNeighborId); // ab
+      else
+        neighborId = getVertexNeighbor2dCD(vertexId, localNeighborId); // cd
+    } else if(p[0] == 0) {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        neighborId = getVertexNeighbor2dAC(vertexId, localNeighborId); // ac
+      else if(p[1] == 0)
+        neighborId = getVertexNeighbor2dA(vertexId, localNeighborId); // a
+      else
+        neighborId = getVertexNeighbor2dC(vertexId, localNeighborId); // c
+    } else {
+      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
+        neighborId = getVertexNeighbor2dBD(vertexId, localNeighborId); // bd
+      else if(p[1] == 0)
+        neighborId = getVertexNeighbor2dB(vertexId, localNeighborId); // b
+      else
+        neighborId = getVertexNeighbor2dD(vertexId, localNeighborId); // d
+    }
+  } else if(dimensionality_ == 1) {
+    // ab
+    if(vertexId > 0 and vertexId < nbvoxels_[Di_]) {
+      if(localNeighborId == 0)
+        neighborId = vertexId + 1;
+      else
+        neighborId = vertexId - 1;
+    } else if(vertexId == 0)
+      neighborId = vertexId + 1; // a
+    else
+      neighborId = vertexId - 1; // b
+  }
+
+  return 0;
+}
+
 #endif // _IMPLICITTRIANGULATION_H
@@ -20,6 +20,7 @@
 #include <Wrapper.h>
 
 // std includes
+#include <limits>
 #include <unordered_set>
 
 namespace ttk {
@@ -33,10 +34,17 @@ namespace ttk {
 
     template <typename dataType>
     inline float getDistance(const SimplexId &a, const SimplexId &b) const {
+      return getDistance<dataType>(triangulation_, a, b);
+    }
+
+    template <typename dataType, class triangulationType>
+    inline float getDistance(const triangulationType *triangulation,
+                             const SimplexId &a,
+                             const SimplexId &b) const {
       float p0[3];
-      triangulation_->getVertexPoint(a, p0[0], p0[1], p0[2]);
+      triangulation->getVertexPoint(a, p0[0], p0[1], p0[2]);
       float p1[3];
-      triangulation_->getVertexPoint(b, p1[0], p1[1], p1[2]);
+      triangulation->getVertexPoint(b, p1[0], p1[1], p1[2]);
 
       return Geometry::distance(p0, p1, 3);
     }
@@ -45,7 +53,16 @@ namespace ttk {
     inline float getGradient(const SimplexId &a,
                              const SimplexId &b,
                              dataType *scalars) const {
-      return fabs(scalars[b] - scalars[a]) / getDistance<dataType>(a, b);
+      return getGradient<dataType>(triangulation_, a, b, scalars);
+    }
+
+    template <typename dataType, class triangulationType>
+    inline float getGradient(const triangulationType *triangulation,
+                             const SimplexId &a,
+                             const SimplexId &b,
+                             dataType *scalars) const {
+      return fabs(scalars[b] - scalars[a])
+             / getDistance<dataType>(triangulation, a, b);
     }
 
     template <typename dataType, typename idType>
@@ -99,6 +116,16 @@ namespace ttk {
     }
 
   protected:
+    /// Integration kernel, instantiated for the concrete triangulation type
+    /// (see ttkTemplateMacro).
+    template <typename dataType,
+              typename idType,
+              class triangulationType,
+              class Compare>
+    int computeTrajectories(const triangulationType *triangulation,
+                            const std::vector<SimplexId> &seeds,
+                            Compare cmp) const;
+
     SimplexId vertexNumber_;
     SimplexId seedNumber_;
     int direction_;
@@ -112,11 +139,13 @@ namespace ttk {
 
 template <typename dataType, typename idType>
 int ttk::IntegralLines::execute() const {
-  idType *offsets = static_cast<idType *>(inputOffsets_);
+  return execute<dataType, idType>([](const SimplexId) { return false; });
+}
+
+template <typename dataType, typename idType, class Compare>
+int ttk::IntegralLines::execute(Compare cmp) const {
   SimplexId *identifiers
     = static_cast<SimplexId *>(vertexIdentifierScalarField_);
-  dataType *scalars = static_cast<dataType *>(inputScalarField_);
-  std::vector<std::vector<SimplexId>> *trajectories = outputTrajectories_;
 
   Timer t;
 
@@ -129,64 +158,10 @@ int ttk::IntegralLines::execute() const {
     seeds.push_back(k);
   isSeed.clear();
 
-  trajectories->resize(seeds.size());
-  for(SimplexId i = 0; i < (SimplexId)seeds.size(); ++i) {
-    SimplexId v{seeds[i]};
-    (*trajectories)[i].push_back(v);
-
-    bool isMax{};
-    while(!isMax) {
-      SimplexId vnext{-1};
-      float fnext = std::numeric_limits<float>::min();
-      SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
-      bool isLocalMax = true;
-      bool isLocalMin = true;
-      for(SimplexId k = 0; k < neighborNumber; ++k) {
-        SimplexId n;
-        triangulation_->getVertexNeighbor(v, k, n);
-
-        if(scalars[n] <= scalars[v])
-          isLocalMax = false;
-        if(scalars[n] >= scalars[v])
-          isLocalMin = false;
-
-        if((direction_ == static_cast<int>(Direction::Forward))
-           xor (scalars[n] < scalars[v])) {
-          const float f = getGradient<dataType>(v, n, scalars);
-          if(f > fnext) {
-            vnext = n;
-            fnext = f;
-          }
-        }
-      }
-
-      if(vnext == -1 and !isLocalMax and !isLocalMin) {
-        idType onext = -1;
-        for(SimplexId k = 0; k < neighborNumber; ++k) {
-          SimplexId n;
-          triangulation_->getVertexNeighbor(v, k, n);
-
-          if(scalars[n] == scalars[v]) {
-            const idType o = offsets[n];
-            if((direction_ == static_cast<int>(Direction::Forward))
-               xor (o < offsets[v])) {
-              if(o > onext) {
-                vnext = n;
-                onext = o;
-              }
-            }
-          }
-        }
-      }
-
-      if(vnext == -1)
-        isMax = true;
-      else {
-        v = vnext;
-        (*trajectories)[i].push_back(v);
-      }
-    }
-  }
+  int ret = 0;
+  ttkTemplateMacro(triangulation_->getDispatchType(),
+                   (ret = computeTrajectories<dataType, idType>(
+                      triangulation_->getData<TTK_TT>(), seeds, cmp)));
 
   {
     std::stringstream msg;
@@ -196,28 +171,21 @@ int ttk::IntegralLines::execute() const {
     dMsg(std::cout, msg.str(), timeMsg);
   }
 
-  return 0;
+  return ret;
 }
 
-template <typename dataType, typename idType, class Compare>
-int ttk::IntegralLines::execute(Compare cmp) const {
+template <typename dataType,
+          typename idType,
+          class triangulationType,
+          class Compare>
+int ttk::IntegralLines::computeTrajectories(
+  const triangulationType *triangulation,
+  const std::vector<SimplexId> &seeds,
+  Compare cmp) const {
   idType *offsets = static_cast<idType *>(inputOffsets_);
-  SimplexId *identifiers
-    = static_cast<SimplexId *>(vertexIdentifierScalarField_);
   dataType *scalars = static_cast<dataType *>(inputScalarField_);
   std::vector<std::vector<SimplexId>> *trajectories = outputTrajectories_;
 
-  Timer t;
-
-  // get the seeds
-  std::unordered_set<SimplexId> isSeed;
-  for(SimplexId k = 0; k < seedNumber_; ++k)
-    isSeed.insert(identifiers[k]);
-  std::vector<SimplexId> seeds;
-  for(auto k : isSeed)
-    seeds.push_back(k);
-  isSeed.clear();
-
   trajectories->resize(seeds.size());
   for(SimplexId i = 0; i < (SimplexId)seeds.size(); ++i) {
     SimplexId v{seeds[i]};
@@ -227,12 +195,12 @@ int ttk::IntegralLines::execute(Compare cmp) const {
     while(!isMax) {
       SimplexId vnext{-1};
       float fnext = std::numeric_limits<float>::min();
-      SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
+      SimplexId neighborNumber = triangulation->getVertexNeighborNumber(v);
       bool isLocalMax = true;
       bool isLocalMin = true;
       for(SimplexId k = 0; k < neighborNumber; ++k) {
         SimplexId n;
-        triangulation_->getVertexNeighbor(v, k, n);
+        triangulation->getVertexNeighbor(v, k, n);
 
         if(scalars[n] <= scalars[v])
           isLocalMax = false;
@@ -241,7 +209,7 @@ int ttk::IntegralLines::execute(Compare cmp) const {
 
         if((direction_ == static_cast<int>(Direction::Forward))
            xor (scalars[n] < scalars[v])) {
-          const float f = getGradient<dataType>(v, n, scalars);
+          const float f = getGradient<dataType>(triangulation, v, n, scalars);
           if(f > fnext) {
             vnext = n;
             fnext = f;
@@ -250,13 +218,13 @@ int ttk::IntegralLines::execute(Compare cmp) const {
       }
 
       if(vnext == -1 and !isLocalMax and !isLocalMin) {
-        SimplexId onext = -1;
+        idType onext = -1;
         for(SimplexId k = 0; k < neighborNumber; ++k) {
           SimplexId n;
-          triangulation_->getVertexNeighbor(v, k, n);
+          triangulation->getVertexNeighbor(v, k, n);
 
           if(scalars[n] == scalars[v]) {
-            const SimplexId o = offsets[n];
+            const idType o = offsets[n];
             if((direction_ == static_cast<int>(Direction::Forward))
                xor (o < offsets[v])) {
               if(o > onext) {
@@ -280,14 +248,6 @@ int ttk::IntegralLines::execute(Compare cmp) const {
     }
   }
 
-  {
-    std::stringstream msg;
-    msg << "[IntegralLines] Data-set (" << vertexNumber_
-        << " points) processed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << std::endl;
-    dMsg(std::cout, msg.str(), timeMsg);
-  }
-
   return 0;
 }
 
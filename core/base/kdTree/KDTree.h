@@ -5,6 +5,17 @@
 ///
 /// \brief TTK KD-Tree
 ///
+/// The nodes of the tree are stored in contiguous arrays (one array per
+/// coordinate, children and parents given by node indices): the tree is
+/// built in O(n log n) by recursive median partitions (std::nth_element) of
+/// a single permutation of the points, without any per-node allocation.
+///
+/// Each point can carry several weights (one per weight index, for instance
+/// the prices of a good in several concurrent auctions), which are added to
+/// the distances in the nearest neighbor queries. The weights can be updated
+/// in place (the minimum weight of each subtree is maintained along the path
+/// to the root), and the queries on different weight indices can run
+/// concurrently with the updates of the other weight indices.
 
 #pragma once
 
@@ -17,115 +28,56 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace ttk {
   template <typename dataType>
   class KDTree : public Debug {
 
   public:
-    KDTree *left_; // Lower half for the coordinate specified
-    KDTree *right_; // Higher half
-    KDTree *parent_;
-    int id_; // ID of the object saved here. The whole object is not kept in the
-             // KDTree Users should keep track of them in a table for instance
-    std::vector<dataType> coordinates_;
-    std::vector<dataType> coords_min_;
-    std::vector<dataType> coords_max_;
-    int level_;
-
-    std::vector<dataType> weight_;
-    std::vector<dataType> min_subweights_;
-
-    KDTree() {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = nullptr;
-
-      coords_number_ = 0;
-      p_ = 2;
-      include_weights_ = false;
-    }
-
-    KDTree(bool include_weights, int p) {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = nullptr;
-
-      coords_number_ = 0;
-      p_ = p;
-      include_weights_ = include_weights;
-    }
-
-    KDTree(KDTree *father, int coords_number, bool is_left) {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = father;
-
-      coords_number_ = coords_number;
-      p_ = father->p_;
-      include_weights_ = father->include_weights_;
-      is_left_ = is_left;
+    KDTree(const int p = 2) : p_(p) {
     }
 
     ~KDTree() {
-      delete left_;
-      delete right_;
-      // coordinates_.resize(0);
-      // coords_min_.resize(0);
-      // coords_max_.resize(0);
-      // weight_.resize(0);
-      // min_subweights_.resize(0);
     }
 
-    std::vector<KDTree<dataType> *> build(dataType *coordinates,
-                                          const int &ptNumber,
-                                          const int &dimension,
-                                          const int weight_number = 1);
-    std::vector<KDTree<dataType> *>
-      build(dataType *coordinates,
-            const int &ptNumber,
-            const int &dimension,
-            std::vector<std::vector<dataType>> &weights,
-            const int weight_number = 1);
-
-    void buildRecursive(dataType *coordinates,
-                        std::vector<int> indexes,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType> *parent,
-                        std::vector<KDTree<dataType> *> &correspondance_map,
-                        std::vector<std::vector<dataType>> &weights,
-                        const int weight_number = 1);
-    void buildRecursive(dataType *coordinates,
-                        std::vector<int> indexes,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType> *parent,
-                        std::vector<KDTree<dataType> *> &correspondance_map,
-                        const int weight_number = 1);
-
-    void updateWeight(dataType new_weight, const int weight_index = 0);
-    void updateMinSubweight(const int weight_index = 0);
+    /// Build the tree.
+    /// \param coordinates Coordinates of the points (\p dimension consecutive
+    /// values per point).
+    /// \param ptNumber Number of points.
+    /// \param dimension Number of coordinates per point.
+    /// \param weights Initial weights of the points (one vector per weight
+    /// index), zero if empty.
+    /// \param weightNumber Number of weight indices.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int build(const dataType *coordinates,
+              const int &ptNumber,
+              const int &dimension,
+              const std::vector<std::vector<dataType>> &weights = {},
+              const int weightNumber = 1);
+
+    /// Get the \p k points minimizing their distance to \p coordinates plus
+    /// their weight, sorted by increasing cost.
+    /// \param neighbours Identifiers of the points (in the order of build()).
+    /// \param costs Distances plus weights of the points.
     void getKClosest(const unsigned int k,
                      const std::vector<dataType> &coordinates,
-                     std::vector<KDTree<dataType> *> &neighbours,
+                     std::vector<int> &neighbours,
                      std::vector<dataType> &costs,
-                     const int weight_index = 0);
-    void recursiveGetKClosest(const unsigned int k,
-                              const std::vector<dataType> &coordinates,
-                              std::vector<KDTree<dataType> *> &neighbours,
-                              std::vector<dataType> &costs,
-                              const int weight_index = 0);
-
-    dataType cost(const std::vector<dataType> &coordinates);
-    dataType distanceToBox(KDTree<dataType> *subtree,
-                           const std::vector<dataType> &coordinates);
-    std::vector<dataType> getCoordinates();
-    dataType getWeight(const int weight_index = 0);
-    dataType getMinSubWeight(const int weight_index = 0);
-
-    bool isLeaf();
-    bool isRoot();
+                     const int weightIndex = 0) const;
+
+    /// Set the weight of the point \p id.
+    void updateWeight(const int &id,
+                      const dataType &weight,
+                      const int weightIndex = 0);
+
+    inline dataType getWeight(const int &id, const int weightIndex = 0) const {
+      return weights_[(size_t)weightIndex * nodeNumber_ + nodes_[id]];
+    }
+
+    inline int size() const {
+      return nodeNumber_;
+    }
 
     template <typename type>
     inline static type abs(const type var) {
@@ -133,321 +85,252 @@ namespace ttk {
     }
 
   protected:
-    bool is_left_; // Boolean indicating if the current node is a left node of
-                   // its parent
-    int coords_number_; // Indicates according to which coordinate the tree
-                        // splits its elements
-
-    int p_; // Power used for the computation of distances. p=2 yields euclidean
-            // distance
+    int buildRecursive(const dataType *coordinates,
+                       const std::vector<std::vector<dataType>> &weights,
+                       const int &begin,
+                       const int &end,
+                       const int &depth,
+                       const int &parent);
+
+    inline dataType power(const dataType &d) const {
+      return p_ == 1 ? d : p_ == 2 ? d * d : pow(d, p_);
+    }
 
-    bool include_weights_; // Wether or not the KDTree should include weights
-                           // that add up to distance for the computation of
-                           // nearest neighbours
+    /// Distance between \p coordinates and the bounding box of the subtree
+    /// rooted at \p node.
+    dataType distanceToBox(const int &node,
+                           const std::vector<dataType> &coordinates) const;
+
+    int p_; // Power used for the computation of distances. p=2 yields
+            // squared euclidean distances
+
+    int nodeNumber_{};
+    int dimension_{};
+
+    // The nodes are the points in the order of the (in-order) traversal of
+    // the tree. The coordinate k of the node i is stored at
+    // k * nodeNumber_ + i, and so are the bounding boxes of the subtrees and
+    // the weights.
+    std::vector<int> ids_; // node -> point
+    std::vector<int> nodes_; // point -> node
+    std::vector<int> parents_;
+    std::vector<int> children_; // left and right child of each node (or -1)
+    std::vector<dataType> coordinates_;
+    std::vector<dataType> boxMin_;
+    std::vector<dataType> boxMax_;
+    std::vector<dataType> weights_;
+    std::vector<dataType> minSubweights_;
   };
 
   template <typename dataType>
-  std::vector<dataType> KDTree<dataType>::getCoordinates() {
-    return coordinates_;
-  }
-
-  template <typename dataType>
-  dataType KDTree<dataType>::getWeight(const int weight_index) {
-    return weight_[weight_index];
-  }
+  int KDTree<dataType>::build(const dataType *coordinates,
+                              const int &ptNumber,
+                              const int &dimension,
+                              const std::vector<std::vector<dataType>> &weights,
+                              const int weightNumber) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(ptNumber < 0 || dimension <= 0 || weightNumber <= 0)
+      return -1;
+    if(!weights.empty() && (int)weights.size() < weightNumber)
+      return -2;
+#endif
 
-  template <typename dataType>
-  dataType KDTree<dataType>::getMinSubWeight(const int weight_index) {
-    return min_subweights_[weight_index];
+    nodeNumber_ = ptNumber;
+    dimension_ = dimension;
+
+    ids_.resize(ptNumber);
+    for(int i = 0; i < ptNumber; i++)
+      ids_[i] = i;
+    nodes_.resize(ptNumber);
+    parents_.resize(ptNumber);
+    children_.resize(2 * ptNumber);
+    coordinates_.resize((size_t)dimension * ptNumber);
+    boxMin_.resize((size_t)dimension * ptNumber);
+    boxMax_.resize((size_t)dimension * ptNumber);
+    weights_.resize((size_t)weightNumber * ptNumber);
+    minSubweights_.resize(weights_.size());
+
+    if(ptNumber > 0)
+      buildRecursive(coordinates, weights, 0, ptNumber, 0, -1);
+
+    return 0;
   }
 
   template <typename dataType>
-  std::vector<KDTree<dataType> *>
-    KDTree<dataType>::build(dataType *data,
-                            const int &ptNumber,
-                            const int &dimension,
-                            const int weight_number) {
-    std::vector<KDTree<dataType> *> correspondance_map(ptNumber);
-    // First, perform a argsort on the data
-    // initialize original index locations
-    for(int axis = 0; axis < dimension; axis++) {
-      coords_min_.push_back(std::numeric_limits<dataType>::lowest());
-      coords_max_.push_back(std::numeric_limits<dataType>::max());
-    }
-    std::vector<int> idx(ptNumber);
-    for(int i = 0; i < ptNumber; i++) {
-      idx[i] = i;
-    }
-    // sort indexes based on comparing values in coordinates
-    sort(idx.begin(), idx.end(), [&](int i1, int i2) {
-      return data[dimension * i1 + coords_number_]
-             < data[dimension * i2 + coords_number_];
-    });
-    int median_loc = (int)(ptNumber - 1) / 2;
-    int median_idx = idx[median_loc];
-    correspondance_map[median_idx] = this;
-
-    for(int axis = 0; axis < dimension; axis++) {
-      coordinates_.push_back(data[dimension * median_idx + axis]);
+  int KDTree<dataType>::buildRecursive(
+    const dataType *coordinates,
+    const std::vector<std::vector<dataType>> &weights,
+    const int &begin,
+    const int &end,
+    const int &depth,
+    const int &parent) {
+
+    // the median of the range (along the splitting axis) becomes the node,
+    // the lower and higher halves its subtrees
+    const int axis = depth % dimension_;
+    const int node = begin + (end - begin - 1) / 2;
+    std::nth_element(ids_.begin() + begin, ids_.begin() + node,
+                     ids_.begin() + end, [&](const int &i1, const int &i2) {
+                       return coordinates[dimension_ * i1 + axis]
+                              < coordinates[dimension_ * i2 + axis];
+                     });
+
+    const int id = ids_[node];
+    nodes_[id] = node;
+    parents_[node] = parent;
+    for(int k = 0; k < dimension_; k++) {
+      const size_t pos = (size_t)k * nodeNumber_ + node;
+      coordinates_[pos] = coordinates[dimension_ * id + k];
+      boxMin_[pos] = coordinates_[pos];
+      boxMax_[pos] = coordinates_[pos];
     }
-    for(int w = 0; w < weight_number; w++) {
-      weight_.push_back(0);
-      min_subweights_.push_back(0);
-    }
-    id_ = median_idx;
-    parent_ = nullptr;
-    level_ = 0;
-
-    if(idx.size() > 2) {
-      // Build left leaf
-      std::vector<int> idx_left;
-      for(int i = 0; i < median_loc; i++) {
-        idx_left.push_back(idx[i]);
-      }
 
-      KDTree *left = new KDTree(this, (coords_number_ + 1) % dimension, true);
-      left->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                           correspondance_map, weight_number);
-      left_ = left;
+    // the weights are stored by node
+    const int weightNumber = weights_.size() / nodeNumber_;
+    for(int w = 0; w < weightNumber; w++) {
+      const size_t pos = (size_t)w * nodeNumber_ + node;
+      weights_[pos] = weights.empty() ? 0 : weights[w][id];
+      minSubweights_[pos] = weights_[pos];
     }
 
-    if(idx.size() > 1) {
-      // Build right leaf
-      std::vector<int> idx_right(ptNumber - median_loc - 1);
-      for(int i = 0; i < ptNumber - median_loc - 1; i++) {
-        idx_right[i] = idx[i + median_loc + 1];
+    const int left
+      = begin < node
+          ? buildRecursive(coordinates, weights, begin, node, depth + 1, node)
+          : -1;
+    const int right
+      = node + 1 < end ? buildRecursive(
+          coordinates, weights, node + 1, end, depth + 1, node)
+                       : -1;
+    children_[2 * node] = left;
+    children_[2 * node + 1] = right;
+
+    // tight bounding boxes and minimum weights of the subtrees
+    for(const int child : {left, right}) {
+      if(child < 0)
+        continue;
+      for(int k = 0; k < dimension_; k++) {
+        const size_t pos = (size_t)k * nodeNumber_;
+        boxMin_[pos + node]
+          = std::min(boxMin_[pos + node], boxMin_[pos + child]);
+        boxMax_[pos + node]
+          = std::max(boxMax_[pos + node], boxMax_[pos + child]);
       }
-      KDTree *right = new KDTree(this, (coords_number_ + 1) % dimension, false);
-      right->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                            correspondance_map, weight_number);
-      right_ = right;
-    }
-
-    return correspondance_map;
-  }
-
-  template <typename dataType>
-  void KDTree<dataType>::buildRecursive(
-    dataType *data,
-    std::vector<int> idx_side,
-    const int &ptNumber,
-    const int &dimension,
-    KDTree<dataType> *parent,
-    std::vector<KDTree<dataType> *> &correspondance_map,
-    const int weight_number) {
-
-    // First, perform a argsort on the data
-    sort(idx_side.begin(), idx_side.end(), [&](int i1, int i2) {
-      return data[dimension * i1 + coords_number_]
-             < data[dimension * i2 + coords_number_];
-    });
-    int median_loc = (int)(idx_side.size() - 1) / 2;
-    int median_idx = idx_side[median_loc];
-    correspondance_map[median_idx] = this;
-
-    for(int axis = 0; axis < dimension; axis++) {
-      coordinates_.push_back(data[dimension * median_idx + axis]);
-    }
-    for(int w = 0; w < weight_number; w++) {
-      weight_.push_back(0);
-      min_subweights_.push_back(0);
-    }
-    id_ = median_idx;
-    parent_ = parent;
-    level_ = parent->level_ + 1;
-
-    // Create bounding box
-    for(int axis = 0; axis < dimension; axis++) {
-      coords_min_.push_back(parent_->coords_min_[axis]);
-      coords_max_.push_back(parent_->coords_max_[axis]);
-    }
-    if(is_left_ && !this->isRoot()) {
-      coords_max_[parent_->coords_number_]
-        = parent_->coordinates_[parent_->coords_number_];
-    } else if(!is_left_ && !this->isRoot()) {
-      coords_min_[parent_->coords_number_]
-        = parent_->coordinates_[parent_->coords_number_];
-    }
-
-    if(idx_side.size() > 2) {
-      // Build left leaf
-      std::vector<int> idx_left(median_loc);
-      for(int i = 0; i < median_loc; i++) {
-        idx_left[i] = idx_side[i];
+      for(int w = 0; w < weightNumber; w++) {
+        const size_t pos = (size_t)w * nodeNumber_;
+        minSubweights_[pos + node]
+          = std::min(minSubweights_[pos + node], minSubweights_[pos + child]);
       }
-
-      KDTree *left = new KDTree(this, (coords_number_ + 1) % dimension, true);
-      left->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                           correspondance_map, weight_number);
-      left_ = left;
     }
 
-    if(idx_side.size() > 1) {
-      // Build right leaf
-      std::vector<int> idx_right(idx_side.size() - median_loc - 1);
-      for(unsigned int i = 0; i < idx_side.size() - median_loc - 1; i++) {
-        idx_right[i] = idx_side[i + median_loc + 1];
-      }
-      KDTree *right = new KDTree(this, (coords_number_ + 1) % dimension, false);
-      right->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                            correspondance_map, weight_number);
-      right_ = right;
-    }
-    return;
-  }
-
-  template <typename dataType>
-  void KDTree<dataType>::updateWeight(dataType new_weight,
-                                      const int weight_index) {
-    weight_[weight_index] = new_weight;
-    updateMinSubweight(weight_index);
+    return node;
   }
 
   template <typename dataType>
-  void KDTree<dataType>::updateMinSubweight(const int weight_index) {
-    dataType new_min_subweight;
-    if(this->isLeaf()) {
-      new_min_subweight = weight_[weight_index];
-    } else if(!left_) {
-      new_min_subweight = std::min(
-        right_->min_subweights_[weight_index], weight_[weight_index]);
-    } else if(!right_) {
-      new_min_subweight
-        = std::min(left_->min_subweights_[weight_index], weight_[weight_index]);
-    } else {
-      new_min_subweight
-        = std::min(std::min(left_->min_subweights_[weight_index],
-                            right_->min_subweights_[weight_index]),
-                   weight_[weight_index]);
-    }
-
-    if(new_min_subweight != min_subweights_[weight_index]) {
-      min_subweights_[weight_index] = new_min_subweight;
-      if(!this->isRoot()) {
-        parent_->updateMinSubweight(weight_index);
+  dataType KDTree<dataType>::distanceToBox(
+    const int &node, const std::vector<dataType> &coordinates) const {
+    dataType d_min = 0;
+    for(int k = 0; k < dimension_; k++) {
+      const size_t pos = (size_t)k * nodeNumber_ + node;
+      if(boxMin_[pos] > coordinates[k]) {
+        d_min += power(boxMin_[pos] - coordinates[k]);
+      } else if(boxMax_[pos] < coordinates[k]) {
+        d_min += power(coordinates[k] - boxMax_[pos]);
       }
     }
+    return d_min;
   }
 
   template <typename dataType>
-  void
-    KDTree<dataType>::getKClosest(const unsigned int k,
-                                  const std::vector<dataType> &coordinates,
-                                  std::vector<KDTree<dataType> *> &neighbours,
-                                  std::vector<dataType> &costs,
-                                  const int weight_index) {
-    /// Puts the k closest points to the given coordinates in the "neighbours"
-    /// vector along with their costs in the "costs" vector The output is not
-    /// sorted, if you are interested in the k nearest neighbours in the order,
-    /// will need to sort them according to their cost.
-    if(this->isLeaf()) {
-      dataType cost = this->cost(coordinates);
-      cost += weight_[weight_index];
-      neighbours.push_back(this);
-      costs.push_back(cost);
-    } else {
-      this->recursiveGetKClosest(
-        k, coordinates, neighbours, costs, weight_index);
+  void KDTree<dataType>::updateWeight(const int &id,
+                                      const dataType &weight,
+                                      const int weightIndex) {
+    const size_t offset = (size_t)weightIndex * nodeNumber_;
+    int node = nodes_[id];
+    weights_[offset + node] = weight;
+
+    // update the minimum weights up to the root, as long as they change
+    while(node >= 0) {
+      dataType new_min_subweight = weights_[offset + node];
+      for(int c = 0; c < 2; c++) {
+        const int child = children_[2 * node + c];
+        if(child >= 0)
+          new_min_subweight
+            = std::min(new_min_subweight, minSubweights_[offset + child]);
+      }
+      if(new_min_subweight == minSubweights_[offset + node])
+        break;
+      minSubweights_[offset + node] = new_min_subweight;
+      node = parents_[node];
     }
-    // TODO sort neighbours and costs !
-    return;
   }
 
   template <typename dataType>
-  void KDTree<dataType>::recursiveGetKClosest(
-    const unsigned int k,
-    const std::vector<dataType> &coordinates,
-    std::vector<KDTree<dataType> *> &neighbours,
-    std::vector<dataType> &costs,
-    const int weight_index) {
-    // 1- Look wether or not to include the current point in the nearest
-    // neighbours
-    dataType cost = this->cost(coordinates);
-    cost += weight_[weight_index];
-
-    if(costs.size() < k) {
-      neighbours.push_back(this);
-      costs.push_back(cost);
-    } else {
-      // 1.1- Find the most costly amongst neighbours
-      std::vector<int> idx(k);
-      for(unsigned int i = 0; i < k; i++) {
-        idx[i] = i;
+  void KDTree<dataType>::getKClosest(const unsigned int k,
+                                     const std::vector<dataType> &coordinates,
+                                     std::vector<int> &neighbours,
+                                     std::vector<dataType> &costs,
+                                     const int weightIndex) const {
+    neighbours.clear();
+    costs.clear();
+    if(!nodeNumber_ || !k)
+      return;
+
+    const size_t offset = (size_t)weightIndex * nodeNumber_;
+
+    // depth-first traversal with an explicit stack, the k best candidates
+    // being kept sorted by cost
+    std::vector<int> stack;
+    stack.reserve(64);
+    stack.push_back((nodeNumber_ - 1) / 2);
+    while(!stack.empty()) {
+      const int node = stack.back();
+      stack.pop_back();
+
+      // better candidates may have been found since the node was pushed
+      if(costs.size() == k
+         && distanceToBox(node, coordinates) + minSubweights_[offset + node]
+              >= costs.back())
+        continue;
+
+      dataType cost = weights_[offset + node];
+      for(int i = 0; i < dimension_; i++)
+        cost += power(
+          abs<dataType>(coordinates[i] - coordinates_[i * nodeNumber_ + node]));
+
+      if(costs.size() < k || cost < costs.back()) {
+        if(costs.size() == k) {
+          costs.pop_back();
+          neighbours.pop_back();
+        }
+        size_t pos = costs.size();
+        costs.push_back(cost);
+        neighbours.push_back(ids_[node]);
+        for(; pos > 0 && costs[pos - 1] > cost; pos--) {
+          costs[pos] = costs[pos - 1];
+          neighbours[pos] = neighbours[pos - 1];
+        }
+        costs[pos] = cost;
+        neighbours[pos] = ids_[node];
       }
-      int idx_max_cost = *std::max_element(
-        idx.begin(), idx.end(),
-        [&costs](int &a, int &b) { return costs[a] < costs[b]; });
-      dataType max_cost = costs[idx_max_cost];
-
-      // 1.2- If the current KDTree is less costly, put it in the neighbours and
-      // update costs.
-      if(cost < max_cost) {
-        costs[idx_max_cost] = cost;
-        neighbours[idx_max_cost] = this;
-      }
-    }
 
-    // 2- Recursively visit KDTrees that are worth it
-    if(left_) {
-      dataType max_cost = *std::max_element(costs.begin(), costs.end());
-      dataType &min_subweight = left_->min_subweights_[weight_index];
-      dataType d_min = this->distanceToBox(left_, coordinates);
-      if(costs.size() < k || d_min + min_subweight < max_cost) {
-        // 2.2- It is possible that there exists a point in this subtree that is
-        // less costly than max_cost
-        left_->recursiveGetKClosest(
-          k, coordinates, neighbours, costs, weight_index);
+      // visit the closest child first (pushed last)
+      dataType childDistances[2];
+      for(int c = 0; c < 2; c++) {
+        const int child = children_[2 * node + c];
+        childDistances[c] = child < 0 ? std::numeric_limits<dataType>::max()
+                                      : distanceToBox(child, coordinates)
+                                          + minSubweights_[offset + child];
       }
-    }
-
-    if(right_) {
-      dataType max_cost = *std::max_element(costs.begin(), costs.end());
-      dataType &min_subweight = right_->min_subweights_[weight_index];
-      dataType d_min = this->distanceToBox(right_, coordinates);
-      if(costs.size() < k || d_min + min_subweight < max_cost) {
-        // 2.2- It is possible that there exists a point in this subtree that is
-        // less costly than max_cost
-        right_->recursiveGetKClosest(
-          k, coordinates, neighbours, costs, weight_index);
+      const int first = childDistances[1] < childDistances[0] ? 1 : 0;
+      for(const int c : {1 - first, first}) {
+        const int child = children_[2 * node + c];
+        if(child >= 0
+           && (costs.size() < k || childDistances[c] < costs.back()))
+          stack.push_back(child);
       }
     }
-    return;
-  }
-
-  template <typename dataType>
-  dataType KDTree<dataType>::cost(const std::vector<dataType> &coordinates) {
-    dataType cost = 0;
-    for(unsigned int i = 0; i < coordinates.size(); i++) {
-      cost += pow(abs(coordinates[i] - coordinates_[i]), p_);
-    }
-    return cost;
-  }
-
-  template <typename dataType>
-  dataType
-    KDTree<dataType>::distanceToBox(KDTree<dataType> *subtree,
-                                    const std::vector<dataType> &coordinates) {
-    dataType d_min = 0;
-    for(unsigned int axis = 0; axis < coordinates.size(); axis++) {
-      if(subtree->coords_min_[axis] > coordinates[axis]) {
-        d_min += pow(subtree->coords_min_[axis] - coordinates[axis], p_);
-      } else if(subtree->coords_max_[axis] < coordinates[axis]) {
-        d_min += pow(coordinates[axis] - subtree->coords_max_[axis], p_);
-      }
-    }
-    return d_min;
-  }
-
-  template <typename dataType>
-  bool KDTree<dataType>::isLeaf() {
-    return left_ == nullptr && right_ == nullptr;
-  }
-
-  template <typename dataType>
-  bool KDTree<dataType>::isRoot() {
-    return parent_ == nullptr;
   }
 } // namespace ttk
-#include <buildWeights.h>
 
 #endif
@@ -6,6 +6,8 @@ using namespace ttk;
 MandatoryCriticalPoints::MandatoryCriticalPoints() {
   inputUpperBoundField_ = NULL;
   inputLowerBoundField_ = NULL;
+  inputUpperBoundOrder_ = NULL;
+  inputLowerBoundOrder_ = NULL;
   outputMandatoryMinimum_ = NULL;
   outputMandatoryJoinSaddle_ = NULL;
   outputMandatorySplitSaddle_ = NULL;
@@ -25,6 +27,8 @@ MandatoryCriticalPoints::~MandatoryCriticalPoints() {
 void MandatoryCriticalPoints::flush() {
   inputUpperBoundField_ = NULL;
   inputLowerBoundField_ = NULL;
+  inputUpperBoundOrder_ = NULL;
+  inputLowerBoundOrder_ = NULL;
   outputMandatoryMinimum_ = NULL;
   outputMandatoryJoinSaddle_ = NULL;
   outputMandatorySplitSaddle_ = NULL;
@@ -105,6 +109,24 @@ int MandatoryCriticalPoints::buildSubTrees() {
   // value)
   lowerMinimumList_.clear();
   upperMaximumList_.clear();
+
+  // vertex comparisons, on the ranks of the vertices if an order field is
+  // given
+  const auto isLower = [&](const SimplexId &a, const SimplexId &b) {
+    if(inputLowerBoundOrder_)
+      return inputLowerBoundOrder_[a] < inputLowerBoundOrder_[b];
+    return (lowerVertexScalars_[a] < lowerVertexScalars_[b])
+           || ((lowerVertexScalars_[a] == lowerVertexScalars_[b])
+               && (vertexSoSoffsets_[a] < vertexSoSoffsets_[b]));
+  };
+  const auto isHigher = [&](const SimplexId &a, const SimplexId &b) {
+    if(inputUpperBoundOrder_)
+      return inputUpperBoundOrder_[a] > inputUpperBoundOrder_[b];
+    return (upperVertexScalars_[a] > upperVertexScalars_[b])
+           || ((upperVertexScalars_[a] == upperVertexScalars_[b])
+               && (vertexSoSoffsets_[a] > vertexSoSoffsets_[b]));
+  };
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
@@ -115,13 +137,9 @@ int MandatoryCriticalPoints::buildSubTrees() {
     for(SimplexId j = 0; j < neighborNumber; j++) {
       SimplexId neighborId;
       triangulation_->getVertexNeighbor(i, j, neighborId);
-      if((lowerVertexScalars_[neighborId] < lowerVertexScalars_[i])
-         || ((lowerVertexScalars_[neighborId] == lowerVertexScalars_[i])
-             && (vertexSoSoffsets_[neighborId] < vertexSoSoffsets_[i])))
+      if(isLower(neighborId, i))
         isLowerMin = false;
-      if((upperVertexScalars_[neighborId] > upperVertexScalars_[i])
-         || ((upperVertexScalars_[neighborId] == upperVertexScalars_[i])
-             && (vertexSoSoffsets_[neighborId] > vertexSoSoffsets_[i])))
+      if(isHigher(neighborId, i))
         isUpperMax = false;
       if(!isUpperMax && !isLowerMin)
         break;
@@ -152,6 +170,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   upperJoinTree_.setVertexPositions(&vertexPositions_);
   upperJoinTree_.setTriangulation(triangulation_);
   upperJoinTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  upperJoinTree_.setVertexOrder(inputUpperBoundOrder_);
   upperJoinTree_.buildExtremumList(upperMinimumList_, true);
   upperJoinTree_.build();
 }
@@ -164,6 +183,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   lowerJoinTree_.setVertexPositions(&vertexPositions_);
   lowerJoinTree_.setTriangulation(triangulation_);
   lowerJoinTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  lowerJoinTree_.setVertexOrder(inputLowerBoundOrder_);
   lowerJoinTree_.setMinimumList(lowerMinimumList_);
   lowerJoinTree_.build();
 }
@@ -176,6 +196,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   upperSplitTree_.setVertexPositions(&vertexPositions_);
   upperSplitTree_.setTriangulation(triangulation_);
   upperSplitTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  upperSplitTree_.setVertexOrder(inputUpperBoundOrder_);
   upperSplitTree_.setMaximumList(upperMaximumList_);
   upperSplitTree_.build();
 }
@@ -188,6 +209,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   lowerSplitTree_.setVertexPositions(&vertexPositions_);
   lowerSplitTree_.setTriangulation(triangulation_);
   lowerSplitTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  lowerSplitTree_.setVertexOrder(inputLowerBoundOrder_);
   lowerSplitTree_.buildExtremumList(lowerMaximumList_, false);
   lowerSplitTree_.build();
 }
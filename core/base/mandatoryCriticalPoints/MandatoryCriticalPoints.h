@@ -455,6 +455,17 @@ namespace ttk {
       return 0;
     }
 
+    /// Set an optional order field of the lower bound scalar field (rank of
+    /// each vertex in the order given by the scalars and the offsets of
+    /// setSoSoffsets(), see ttk::VertexOrder): the vertices are then
+    /// compared by their ranks only.
+    /// \param order Order field (NULL: no order field).
+    /// \return Returns 0 upon success, negative values otherwise.
+    inline int setLowerBoundOrderPointer(const SimplexId *order) {
+      inputLowerBoundOrder_ = order;
+      return 0;
+    }
+
     inline int setOutputJoinSaddleDataPointer(void *data) {
       outputMandatoryJoinSaddle_ = data;
       return 0;
@@ -492,6 +503,15 @@ namespace ttk {
       return 0;
     }
 
+    /// Set an optional order field of the upper bound scalar field (see
+    /// setLowerBoundOrderPointer()).
+    /// \param order Order field (NULL: no order field).
+    /// \return Returns 0 upon success, negative values otherwise.
+    inline int setUpperBoundOrderPointer(const SimplexId *order) {
+      inputUpperBoundOrder_ = order;
+      return 0;
+    }
+
     inline int setSimplificationThreshold(double normalizedThreshold) {
       normalizedThreshold_ = normalizedThreshold;
       return 0;
@@ -616,6 +636,10 @@ namespace ttk {
     void *inputUpperBoundField_;
     /// Void pointer to the input lower bound scalar field.
     void *inputLowerBoundField_;
+    /// Optional order field of the input upper bound scalar field.
+    const SimplexId *inputUpperBoundOrder_;
+    /// Optional order field of the input lower bound scalar field.
+    const SimplexId *inputLowerBoundOrder_;
     /// Void pointer to the output mandatory minima components.
     void *outputMandatoryMinimum_;
     /// Void pointer to the output mandatory join saddles components.
@@ -292,6 +292,33 @@ namespace ttk {
       return abstractMorseSmaleComplex_->setPrioritizeSpeedOverMemory(state);
     }
 
+    int setLowerStarGradient(const bool state) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setLowerStarGradient(state);
+    }
+
+    int setCompactGradient(const bool state) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setCompactGradient(state);
+    }
+
+    int setPointerJumpingSegmentation(const bool state) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setPointerJumpingSegmentation(state);
+    }
+
     int setupTriangulation(Triangulation *const data) {
       dimensionality_ = data->getCellVertexNumber(0) - 1;
 
@@ -437,6 +464,16 @@ namespace ttk {
       return 0;
     }
 
+    inline int setSeparatrices2Sink(const Separatrices2Sink &sink,
+                                    const SimplexId batchSize = 65536) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setSeparatrices2Sink(sink, batchSize);
+    }
+
     inline int setOutputMorseComplexes(void *const ascendingManifold,
                                        void *const descendingManifold,
                                        void *const morseSmaleManifold) {
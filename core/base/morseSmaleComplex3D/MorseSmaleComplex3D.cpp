@@ -203,6 +203,20 @@ int MorseSmaleComplex3D::getDescendingSeparatrices2(
   return 0;
 }
 
+int MorseSmaleComplex3D::flushSeparatrices2(Separatrices2Stream &stream,
+                                            const bool force) const {
+  Separatrices2Batch &batch = stream.batch_;
+  const SimplexId numberOfCells = batch.getNumberOfCells();
+  if(!numberOfCells or (!force and numberOfCells < separatrices2BatchSize_))
+    return 0;
+
+  const int ret = separatrices2Sink_(batch);
+  batch.clear();
+  batch.firstPointId_ = stream.pointId_;
+
+  return ret;
+}
+
 int MorseSmaleComplex3D::getDualPolygon(const SimplexId edgeId,
                                         vector<SimplexId> &polygon) const {
   // primal: star of edgeId -> dual: vertices of polygon
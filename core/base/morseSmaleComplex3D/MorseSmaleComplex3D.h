@@ -117,6 +117,35 @@ namespace ttk {
       const std::vector<std::set<SimplexId>> &separatricesSaddles) const;
 #endif
 
+    /**
+     * State of the streaming of the 2-separatrices: the current batch and
+     * the point and separatrix counters over all the batches.
+     */
+    struct Separatrices2Stream {
+      Separatrices2Batch batch_;
+      SimplexId pointId_{};
+      SimplexId separatrixId_{};
+    };
+
+    /**
+     * Hand the current batch to the 2-separatrices sink if it is full (or
+     * non-empty if \p force is true) and start a new one.
+     */
+    int flushSeparatrices2(Separatrices2Stream &stream,
+                           const bool force) const;
+
+    /**
+     * Compute the descending 2-separatrices wall after wall, and stream
+     * their geometry to the 2-separatrices sink (see setSeparatrices2Sink()).
+     * The walls are extracted in parallel by chunks of 4 walls per thread
+     * (with one visit marker per triangle and per thread), the sink being
+     * fed sequentially in the order of the saddles.
+     */
+    template <typename dataType>
+    int streamDescendingSeparatrices2(
+      const std::vector<dcg::Cell> &criticalPoints,
+      Separatrices2Stream &stream) const;
+
     int getDualPolygon(const SimplexId edgeId,
                        std::vector<SimplexId> &polygon) const;
 
@@ -155,6 +184,17 @@ namespace ttk {
       const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
       const std::vector<std::set<SimplexId>> &separatricesSaddles) const;
 #endif
+
+    /**
+     * Compute the ascending 2-separatrices wall after wall, and stream
+     * their geometry to the 2-separatrices sink (see setSeparatrices2Sink()).
+     * The walls and their dual polygons are computed in parallel, as in
+     * streamDescendingSeparatrices2().
+     */
+    template <typename dataType>
+    int streamAscendingSeparatrices2(
+      const std::vector<dcg::Cell> &criticalPoints,
+      Separatrices2Stream &stream) const;
   };
 } // namespace ttk
 
@@ -1237,6 +1277,243 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
   return 0;
 }
 
+template <typename dataType>
+int ttk::MorseSmaleComplex3D::streamDescendingSeparatrices2(
+  const std::vector<dcg::Cell> &criticalPoints,
+  Separatrices2Stream &stream) const {
+  const dataType *const scalars
+    = static_cast<const dataType *>(inputScalarField_);
+  Separatrices2Batch &batch = stream.batch_;
+
+  std::vector<dcg::Cell> saddles;
+  for(const dcg::Cell &saddle2 : criticalPoints)
+    if(saddle2.dim_ == 2)
+      saddles.push_back(saddle2);
+  const SimplexId numberOfSaddles = saddles.size();
+
+  // the walls are extracted in parallel, by chunks of a few walls per
+  // thread (only the walls of the current chunk are stored), and emitted in
+  // order: the output does not depend on the number of threads
+  const SimplexId chunkSize = 4 * threadNumber_;
+  std::vector<std::vector<dcg::Cell>> walls(chunkSize);
+  std::vector<std::set<SimplexId>> wallSaddles(chunkSize);
+  const SimplexId numberOfTriangles
+    = inputTriangulation_->getNumberOfTriangles();
+  std::vector<std::vector<dcg::wallId_t>> isVisitedWall(threadNumber_);
+  const SimplexId numberOfVertices = inputTriangulation_->getNumberOfVertices();
+  std::vector<SimplexId> isVisited(numberOfVertices, -1);
+
+  for(SimplexId begin = 0; begin < numberOfSaddles; begin += chunkSize) {
+    const SimplexId end = std::min(begin + chunkSize, numberOfSaddles);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(SimplexId i = begin; i < end; ++i) {
+      int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+      threadId = omp_get_thread_num();
+#endif
+      if(isVisitedWall[threadId].empty())
+        isVisitedWall[threadId].resize(numberOfTriangles, 0);
+      walls[i - begin].clear();
+      wallSaddles[i - begin].clear();
+      discreteGradient_.getDescendingWall(
+        saddles[i].id_, saddles[i], isVisitedWall[threadId], &walls[i - begin],
+        &wallSaddles[i - begin]);
+    }
+
+    for(SimplexId i = begin; i < end; ++i) {
+      const dcg::Cell &saddle2 = saddles[i];
+      const std::vector<dcg::Cell> &wall = walls[i - begin];
+      if(wall.empty())
+        continue;
+
+      const char separatrixType = 2;
+      const dataType separatrixFunctionMaximum
+        = discreteGradient_.scalarMax<dataType>(saddle2, scalars);
+      dataType separatrixFunctionMinimum{};
+
+      // get separatrix infos
+      char isOnBoundary{};
+      bool isFirst = true;
+      for(const SimplexId saddle1Id : wallSaddles[i - begin]) {
+        if(inputTriangulation_->isEdgeOnBoundary(saddle1Id))
+          ++isOnBoundary;
+
+        const dataType value = discreteGradient_.scalarMin<dataType>(
+          dcg::Cell(1, saddle1Id), scalars);
+        if(isFirst or value < separatrixFunctionMinimum)
+          separatrixFunctionMinimum = value;
+        isFirst = false;
+      }
+
+      const dataType separatrixFunctionDiff
+        = separatrixFunctionMaximum - separatrixFunctionMinimum;
+
+      for(const dcg::Cell &cell : wall) {
+        const SimplexId triangleId = cell.id_;
+
+        batch.cells_.push_back(3);
+        for(int k = 0; k < 3; ++k) {
+          SimplexId vertexId;
+          inputTriangulation_->getTriangleVertex(triangleId, k, vertexId);
+
+          if(isVisited[vertexId] == -1) {
+            float point[3];
+            inputTriangulation_->getVertexPoint(
+              vertexId, point[0], point[1], point[2]);
+            batch.points_.insert(batch.points_.end(), point, point + 3);
+
+            isVisited[vertexId] = stream.pointId_;
+            ++stream.pointId_;
+          }
+          batch.cells_.push_back(isVisited[vertexId]);
+        }
+        batch.cells_sourceIds_.push_back(saddle2.id_);
+        batch.cells_separatrixIds_.push_back(stream.separatrixId_);
+        batch.cells_separatrixTypes_.push_back(separatrixType);
+        batch.cells_separatrixFunctionMaxima_.push_back(
+          separatrixFunctionMaximum);
+        batch.cells_separatrixFunctionMinima_.push_back(
+          separatrixFunctionMinimum);
+        batch.cells_separatrixFunctionDiffs_.push_back(separatrixFunctionDiff);
+        batch.cells_isOnBoundary_.push_back(isOnBoundary);
+
+        if(flushSeparatrices2(stream, false))
+          return -1;
+      }
+
+      ++stream.separatrixId_;
+    }
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::MorseSmaleComplex3D::streamAscendingSeparatrices2(
+  const std::vector<dcg::Cell> &criticalPoints,
+  Separatrices2Stream &stream) const {
+  const dataType *const scalars
+    = static_cast<const dataType *>(inputScalarField_);
+  Separatrices2Batch &batch = stream.batch_;
+
+  std::vector<dcg::Cell> saddles;
+  for(const dcg::Cell &saddle1 : criticalPoints)
+    if(saddle1.dim_ == 1)
+      saddles.push_back(saddle1);
+  const SimplexId numberOfSaddles = saddles.size();
+
+  // the walls and their dual polygons are computed in parallel, by chunks
+  // of a few walls per thread (see streamDescendingSeparatrices2()), the
+  // polygons of a wall being stored as (number of vertices, vertices)
+  const SimplexId chunkSize = 4 * threadNumber_;
+  std::vector<std::vector<SimplexId>> wallPolygons(chunkSize);
+  std::vector<std::set<SimplexId>> wallSaddles(chunkSize);
+  const SimplexId numberOfEdges = inputTriangulation_->getNumberOfEdges();
+  std::vector<std::vector<dcg::wallId_t>> isVisitedWall(threadNumber_);
+  const SimplexId numberOfCells = inputTriangulation_->getNumberOfCells();
+  std::vector<SimplexId> isVisited(numberOfCells, -1);
+
+  for(SimplexId begin = 0; begin < numberOfSaddles; begin += chunkSize) {
+    const SimplexId end = std::min(begin + chunkSize, numberOfSaddles);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(SimplexId i = begin; i < end; ++i) {
+      int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+      threadId = omp_get_thread_num();
+#endif
+      if(isVisitedWall[threadId].empty())
+        isVisitedWall[threadId].resize(numberOfEdges, 0);
+      std::vector<dcg::Cell> wall;
+      wallSaddles[i - begin].clear();
+      discreteGradient_.getAscendingWall(saddles[i].id_, saddles[i],
+                                         isVisitedWall[threadId], &wall,
+                                         &wallSaddles[i - begin]);
+
+      // Transform to dual : edge -> polygon
+      std::vector<SimplexId> &polygons = wallPolygons[i - begin];
+      std::vector<SimplexId> polygon;
+      polygons.clear();
+      for(const dcg::Cell &edge : wall) {
+        getDualPolygon(edge.id_, polygon);
+        if(polygon.size() < 3)
+          continue;
+        sortDualPolygonVertices(polygon);
+        polygons.push_back(polygon.size());
+        polygons.insert(polygons.end(), polygon.begin(), polygon.end());
+      }
+    }
+
+    for(SimplexId i = begin; i < end; ++i) {
+      const dcg::Cell &saddle1 = saddles[i];
+      const std::vector<SimplexId> &polygons = wallPolygons[i - begin];
+      if(polygons.empty())
+        continue;
+
+      const char separatrixType = 1;
+      const dataType separatrixFunctionMinimum
+        = discreteGradient_.scalarMin<dataType>(saddle1, scalars);
+      dataType separatrixFunctionMaximum{};
+
+      // get separatrix infos
+      char isOnBoundary{};
+      bool isFirst = true;
+      for(const SimplexId saddle2Id : wallSaddles[i - begin]) {
+        if(inputTriangulation_->isTriangleOnBoundary(saddle2Id))
+          ++isOnBoundary;
+
+        const dataType value = discreteGradient_.scalarMax<dataType>(
+          dcg::Cell(2, saddle2Id), scalars);
+        if(isFirst or value > separatrixFunctionMaximum)
+          separatrixFunctionMaximum = value;
+        isFirst = false;
+      }
+
+      const dataType separatrixFunctionDiff
+        = separatrixFunctionMaximum - separatrixFunctionMinimum;
+
+      for(size_t j = 0; j < polygons.size(); j += polygons[j] + 1) {
+        const SimplexId vertexNumber = polygons[j];
+
+        batch.cells_.push_back(vertexNumber);
+        for(SimplexId k = 1; k <= vertexNumber; ++k) {
+          const SimplexId tetraId = polygons[j + k];
+          if(isVisited[tetraId] == -1) {
+            float point[3];
+            discreteGradient_.getCellIncenter(dcg::Cell(3, tetraId), point);
+            batch.points_.insert(batch.points_.end(), point, point + 3);
+
+            isVisited[tetraId] = stream.pointId_;
+            ++stream.pointId_;
+          }
+          batch.cells_.push_back(isVisited[tetraId]);
+        }
+        batch.cells_sourceIds_.push_back(saddle1.id_);
+        batch.cells_separatrixIds_.push_back(stream.separatrixId_);
+        batch.cells_separatrixTypes_.push_back(separatrixType);
+        batch.cells_separatrixFunctionMaxima_.push_back(
+          separatrixFunctionMaximum);
+        batch.cells_separatrixFunctionMinima_.push_back(
+          separatrixFunctionMinimum);
+        batch.cells_separatrixFunctionDiffs_.push_back(separatrixFunctionDiff);
+        batch.cells_isOnBoundary_.push_back(isOnBoundary);
+
+        if(flushSeparatrices2(stream, false))
+          return -1;
+      }
+
+      ++stream.separatrixId_;
+    }
+  }
+
+  return 0;
+}
+
 template <typename dataType, typename idType>
 int ttk::MorseSmaleComplex3D::execute() {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -1335,7 +1612,32 @@ int ttk::MorseSmaleComplex3D::execute() {
   }
 
   // 2-separatrices
-  if(ComputeDescendingSeparatrices2) {
+  if(separatrices2Sink_
+     and (ComputeDescendingSeparatrices2 or ComputeAscendingSeparatrices2)) {
+    Timer tmp;
+    Separatrices2Stream stream;
+    int ret{};
+    if(ComputeDescendingSeparatrices2)
+      ret = streamDescendingSeparatrices2<dataType>(criticalPoints, stream);
+    if(!ret and ComputeAscendingSeparatrices2)
+      ret = streamAscendingSeparatrices2<dataType>(criticalPoints, stream);
+    if(!ret)
+      ret = flushSeparatrices2(stream, true);
+    if(ret) {
+      std::cerr << "[MorseSmaleComplex3D] Error: 2-separatrices sink failed."
+                << std::endl;
+      return -1;
+    }
+
+    {
+      std::stringstream msg;
+      msg << "[MorseSmaleComplex3D] 2-separatrices streamed in "
+          << tmp.getElapsedTime() << " s." << std::endl;
+      dMsg(std::cout, msg.str(), timeMsg);
+    }
+  }
+
+  if(ComputeDescendingSeparatrices2 and !separatrices2Sink_) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
     std::vector<std::vector<dcg::Cell>> separatricesGeometry;
@@ -1359,7 +1661,7 @@ int ttk::MorseSmaleComplex3D::execute() {
     }
   }
 
-  if(ComputeAscendingSeparatrices2) {
+  if(ComputeAscendingSeparatrices2 and !separatrices2Sink_) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
     std::vector<std::vector<dcg::Cell>> separatricesGeometry;
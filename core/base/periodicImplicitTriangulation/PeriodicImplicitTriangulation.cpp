@@ -263,77 +263,15 @@ bool PeriodicImplicitTriangulation::isTriangleOnBoundary(
   return false;
 }
 
-inline SimplexId PeriodicImplicitTriangulation::getVertexNeighborNumber(
-  const SimplexId &vertexId) const {
-#ifndef TTK_ENABLE_KAMIKAZE
-  if(vertexId < 0 or vertexId >= vertexNumber_)
-    return -1;
-#endif
-
-  if(dimensionality_ == 3) {
-    return 14; // abcdefgh
-  } else if(dimensionality_ == 2) {
-    return 6; // abcd
-  } else if(dimensionality_ == 1) {
-    return 2; // ab
-  }
-
-  return -1;
-}
-
-int PeriodicImplicitTriangulation::getVertexNeighbor(
-  const SimplexId &vertexId,
-  const int &localNeighborId,
-  SimplexId &neighborId) const {
-#ifndef TTK_ENABLE_KAMIKAZE
-  if(localNeighborId < 0
-     or localNeighborId >= getVertexNeighborNumber(vertexId))
-    return -1;
-#endif
-
-  neighborId = -1;
-
-  if(dimensionality_ == 3) {
-    SimplexId p[3];
-    vertexToPosition(vertexId, p);
-    neighborId = getVertexNeighbor3d(p, vertexId, localNeighborId);
-  } else if(dimensionality_ == 2) {
-    SimplexId p[2];
-    vertexToPosition2d(vertexId, p);
-    neighborId = getVertexNeighbor2d(p, vertexId, localNeighborId);
-  } else if(dimensionality_ == 1) {
-    // ab
-    if(vertexId > 0 and vertexId < nbvoxels_[Di_]) {
-      if(localNeighborId == 0)
-        neighborId = vertexId + 1;
-      else
-        neighborId = vertexId - 1;
-    } else if(vertexId == 0) {
-      if(localNeighborId == 0)
-        neighborId = vertexId + 1; // a
-      else
-        neighborId = nbvoxels_[Di_];
-    } else {
-      if(localNeighborId == 0)
-        neighborId = 0; // a
-      else
-        neighborId = vertexId - 1; // b
-    }
-  }
-
-  return 0;
-}
-
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getVertexNeighbors() {
-  if(!vertexNeighborList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getVertexNeighbors() {
+  if(vertexNeighborList_.empty()) {
     Timer t;
-    vertexNeighborList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexNeighborList_[i].resize(getVertexNeighborNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexNeighborList_[i].size(); ++j)
-        getVertexNeighbor(i, j, vertexNeighborList_[i][j]);
-    }
+    vertexNeighborList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexNeighborNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexNeighbor(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -408,17 +346,16 @@ int PeriodicImplicitTriangulation::getVertexEdge(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getVertexEdges() {
-  if(!vertexEdgeList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getVertexEdges() {
+  if(vertexEdgeList_.empty()) {
     Timer t;
 
-    vertexEdgeList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexEdgeList_[i].resize(getVertexEdgeNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexEdgeList_[i].size(); ++j)
-        getVertexEdge(i, j, vertexEdgeList_[i][j]);
-    }
+    vertexEdgeList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexEdgeNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexEdge(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -465,17 +402,16 @@ int PeriodicImplicitTriangulation::getVertexTriangle(
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getVertexTriangles() {
-  if(!vertexTriangleList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getVertexTriangles() {
+  if(vertexTriangleList_.empty()) {
     Timer t;
 
-    vertexTriangleList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexTriangleList_[i].resize(getVertexTriangleNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexTriangleList_[i].size(); ++j)
-        getVertexTriangle(i, j, vertexTriangleList_[i][j]);
-    }
+    vertexTriangleList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexTriangleNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexTriangle(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -516,17 +452,16 @@ int PeriodicImplicitTriangulation::getVertexLink(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getVertexLinks() {
-  if(!vertexLinkList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getVertexLinks() {
+  if(vertexLinkList_.empty()) {
     Timer t;
 
-    vertexLinkList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexLinkList_[i].resize(getVertexLinkNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexLinkList_[i].size(); ++j)
-        getVertexLink(i, j, vertexLinkList_[i][j]);
-    }
+    vertexLinkList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexLinkNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexLink(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -578,16 +513,15 @@ int PeriodicImplicitTriangulation::getVertexStar(const SimplexId &vertexId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getVertexStars() {
-  if(!vertexStarList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getVertexStars() {
+  if(vertexStarList_.empty()) {
     Timer t;
-    vertexStarList_.resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      vertexStarList_[i].resize(getVertexStarNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)vertexStarList_[i].size(); ++j)
-        getVertexStar(i, j, vertexStarList_[i][j]);
-    }
+    vertexStarList_.fillRows(
+      vertexNumber_,
+      [this](const SimplexId &i) { return getVertexStarNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getVertexStar(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1061,17 +995,16 @@ int PeriodicImplicitTriangulation::getEdgeTriangle(
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getEdgeTriangles() {
-  if(!edgeTriangleList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getEdgeTriangles() {
+  if(edgeTriangleList_.empty()) {
     Timer t;
 
-    edgeTriangleList_.resize(edgeNumber_);
-    for(SimplexId i = 0; i < edgeNumber_; ++i) {
-      edgeTriangleList_[i].resize(getEdgeTriangleNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)edgeTriangleList_[i].size(); ++j)
-        getEdgeTriangle(i, j, edgeTriangleList_[i][j]);
-    }
+    edgeTriangleList_.fillRows(
+      edgeNumber_,
+      [this](const SimplexId &i) { return getEdgeTriangleNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getEdgeTriangle(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1147,16 +1080,16 @@ int PeriodicImplicitTriangulation::getEdgeLink(const SimplexId &edgeId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getEdgeLinks() {
-  if(!edgeLinkList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getEdgeLinks() {
+  if(edgeLinkList_.empty()) {
     Timer t;
 
-    edgeLinkList_.resize(edgeNumber_);
-    for(SimplexId i = 0; i < edgeNumber_; ++i) {
-      edgeLinkList_[i].resize(getEdgeLinkNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)edgeLinkList_[i].size(); ++j)
-        getEdgeLink(i, j, edgeLinkList_[i][j]);
-    }
+    edgeLinkList_.fillRows(
+      edgeNumber_,
+      [this](const SimplexId &i) { return getEdgeLinkNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getEdgeLink(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1270,16 +1203,16 @@ int PeriodicImplicitTriangulation::getEdgeStar(const SimplexId &edgeId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getEdgeStars() {
-  if(!edgeStarList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getEdgeStars() {
+  if(edgeStarList_.empty()) {
     Timer t;
 
-    edgeStarList_.resize(edgeNumber_);
-    for(SimplexId i = 0; i < edgeNumber_; ++i) {
-      edgeStarList_[i].resize(getEdgeStarNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)edgeStarList_[i].size(); ++j)
-        getEdgeStar(i, j, edgeStarList_[i][j]);
-    }
+    edgeStarList_.fillRows(
+      edgeNumber_,
+      [this](const SimplexId &i) { return getEdgeStarNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getEdgeStar(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1509,19 +1442,18 @@ int PeriodicImplicitTriangulation::getTriangleEdge(const SimplexId &triangleId,
 }
 
 int PeriodicImplicitTriangulation::getTriangleEdges(
-  vector<vector<SimplexId>> &edges) const {
-  edges.resize(triangleNumber_);
-  for(SimplexId i = 0; i < triangleNumber_; ++i) {
-    edges[i].resize(3);
-    for(int j = 0; j < 3; ++j)
-      getTriangleEdge(i, j, edges[i][j]);
-  }
+  FlatJaggedArray &edges) const {
+  edges.fillRows(
+    triangleNumber_,
+    [](const SimplexId &) { return 3; },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTriangleEdge(i, j, v);
+    });
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getTriangleEdges() {
-  if(!triangleEdgeList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getTriangleEdges() {
+  if(triangleEdgeList_.empty()) {
     Timer t;
 
     getTriangleEdges(triangleEdgeList_);
@@ -1539,16 +1471,16 @@ const vector<vector<SimplexId>> *
   return &triangleEdgeList_;
 }
 
-const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getTriangles() {
-  if(!triangleList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getTriangles() {
+  if(triangleList_.empty()) {
     Timer t;
 
-    triangleList_.resize(triangleNumber_);
-    for(SimplexId i = 0; i < triangleNumber_; ++i) {
-      triangleList_[i].resize(3);
-      for(int j = 0; j < 3; ++j)
-        getTriangleVertex(i, j, triangleList_[i][j]);
-    }
+    triangleList_.fillRows(
+      triangleNumber_,
+      [](const SimplexId &) { return 3; },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getTriangleVertex(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1615,17 +1547,16 @@ inline SimplexId PeriodicImplicitTriangulation::getTriangleLinkNumber(
   return getTriangleStarNumber(triangleId);
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getTriangleLinks() {
-  if(!triangleLinkList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getTriangleLinks() {
+  if(triangleLinkList_.empty()) {
     Timer t;
 
-    triangleLinkList_.resize(triangleNumber_);
-    for(SimplexId i = 0; i < triangleNumber_; ++i) {
-      triangleLinkList_[i].resize(getTriangleLinkNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)triangleLinkList_[i].size(); ++j)
-        getTriangleLink(i, j, triangleLinkList_[i][j]);
-    }
+    triangleLinkList_.fillRows(
+      triangleNumber_,
+      [this](const SimplexId &i) { return getTriangleLinkNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getTriangleLink(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1696,17 +1627,16 @@ int PeriodicImplicitTriangulation::getTriangleStar(const SimplexId &triangleId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getTriangleStars() {
-  if(!triangleStarList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getTriangleStars() {
+  if(triangleStarList_.empty()) {
     Timer t;
 
-    triangleStarList_.resize(triangleNumber_);
-    for(SimplexId i = 0; i < triangleNumber_; ++i) {
-      triangleStarList_[i].resize(getTriangleStarNumber(i));
-      for(SimplexId j = 0; j < (SimplexId)triangleStarList_[i].size(); ++j)
-        getTriangleStar(i, j, triangleStarList_[i][j]);
-    }
+    triangleStarList_.fillRows(
+      triangleNumber_,
+      [this](const SimplexId &i) { return getTriangleStarNumber(i); },
+      [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+        getTriangleStar(i, j, v);
+      });
 
     {
       stringstream msg;
@@ -1856,13 +1786,13 @@ int PeriodicImplicitTriangulation::getTriangleNeighbor(
 }
 
 int PeriodicImplicitTriangulation::getTriangleNeighbors(
-  vector<vector<SimplexId>> &neighbors) {
-  neighbors.resize(triangleNumber_);
-  for(SimplexId i = 0; i < triangleNumber_; ++i) {
-    neighbors[i].resize(getTriangleNeighborNumber(i));
-    for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
-      getTriangleNeighbor(i, j, neighbors[i][j]);
-  }
+  FlatJaggedArray &neighbors) {
+  neighbors.fillRows(
+    triangleNumber_,
+    [this](const SimplexId &i) { return getTriangleNeighborNumber(i); },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTriangleNeighbor(i, j, v);
+    });
   return 0;
 }
 
@@ -1949,13 +1879,13 @@ int PeriodicImplicitTriangulation::getTetrahedronEdge(const SimplexId &tetId,
 }
 
 int PeriodicImplicitTriangulation::getTetrahedronEdges(
-  vector<vector<SimplexId>> &edges) const {
-  edges.resize(tetrahedronNumber_);
-  for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
-    edges[i].resize(6);
-    for(int j = 0; j < 6; ++j)
-      getTetrahedronEdge(i, j, edges[i][j]);
-  }
+  FlatJaggedArray &edges) const {
+  edges.fillRows(
+    tetrahedronNumber_,
+    [](const SimplexId &) { return 6; },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTetrahedronEdge(i, j, v);
+    });
 
   return 0;
 }
@@ -2004,13 +1934,13 @@ int PeriodicImplicitTriangulation::getTetrahedronTriangle(
 }
 
 int PeriodicImplicitTriangulation::getTetrahedronTriangles(
-  vector<vector<SimplexId>> &triangles) const {
-  triangles.resize(tetrahedronNumber_);
-  for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
-    triangles[i].resize(4);
-    for(int j = 0; j < 4; ++j)
-      getTetrahedronTriangle(i, j, triangles[i][j]);
-  }
+  FlatJaggedArray &triangles) const {
+  triangles.fillRows(
+    tetrahedronNumber_,
+    [](const SimplexId &) { return 4; },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTetrahedronTriangle(i, j, v);
+    });
 
   return 0;
 }
@@ -2072,13 +2002,13 @@ int PeriodicImplicitTriangulation::getTetrahedronNeighbor(
 }
 
 int PeriodicImplicitTriangulation::getTetrahedronNeighbors(
-  vector<vector<SimplexId>> &neighbors) {
-  neighbors.resize(tetrahedronNumber_);
-  for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
-    neighbors[i].resize(getTetrahedronNeighborNumber(i));
-    for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
-      getTetrahedronNeighbor(i, j, neighbors[i][j]);
-  }
+  FlatJaggedArray &neighbors) {
+  neighbors.fillRows(
+    tetrahedronNumber_,
+    [this](const SimplexId &i) { return getTetrahedronNeighborNumber(i); },
+    [this](const SimplexId &i, const SimplexId &j, SimplexId &v) {
+      getTetrahedronNeighbor(i, j, v);
+    });
 
   return 0;
 }
@@ -2122,8 +2052,8 @@ int PeriodicImplicitTriangulation::getCellEdge(const SimplexId &cellId,
   return 0;
 }
 
-const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getCellEdges() {
-  if(!cellEdgeList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getCellEdges() {
+  if(cellEdgeList_.empty()) {
     Timer t;
 
     if(dimensionality_ == 3)
@@ -2154,9 +2084,8 @@ int PeriodicImplicitTriangulation::getCellTriangle(
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getCellTriangles() {
-  if(!cellTriangleList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getCellTriangles() {
+  if(cellTriangleList_.empty()) {
     Timer t;
 
     if(dimensionality_ == 3)
@@ -2211,9 +2140,8 @@ int PeriodicImplicitTriangulation::getCellNeighbor(
   return 0;
 }
 
-const vector<vector<SimplexId>> *
-  PeriodicImplicitTriangulation::getCellNeighbors() {
-  if(!cellNeighborList_.size()) {
+const FlatJaggedArray *PeriodicImplicitTriangulation::getCellNeighbors() {
+  if(cellNeighborList_.empty()) {
     Timer t;
 
     if(dimensionality_ == 3)
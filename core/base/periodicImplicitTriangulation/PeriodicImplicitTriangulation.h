@@ -36,7 +36,7 @@ namespace ttk {
 
     SimplexId getCellEdgeNumber(const SimplexId &cellId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getCellEdges() override;
+    const FlatJaggedArray *getCellEdges() override;
 
     int getCellNeighbor(const SimplexId &cellId,
                         const int &localNeighborId,
@@ -44,7 +44,7 @@ namespace ttk {
 
     SimplexId getCellNeighborNumber(const SimplexId &cellId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getCellNeighbors() override;
+    const FlatJaggedArray *getCellNeighbors() override;
 
     int getCellTriangle(const SimplexId &cellId,
                         const int &id,
@@ -56,7 +56,7 @@ namespace ttk {
       return 4;
     };
 
-    const std::vector<std::vector<SimplexId>> *getCellTriangles() override;
+    const FlatJaggedArray *getCellTriangles() override;
 
     int getCellVertex(const SimplexId &cellId,
                       const int &localVertexId,
@@ -74,7 +74,7 @@ namespace ttk {
 
     SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getEdgeLinks() override;
+    const FlatJaggedArray *getEdgeLinks() override;
 
     int getEdgeStar(const SimplexId &edgeId,
                     const int &localStarId,
@@ -82,7 +82,7 @@ namespace ttk {
 
     SimplexId getEdgeStarNumber(const SimplexId &edgeId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getEdgeStars() override;
+    const FlatJaggedArray *getEdgeStars() override;
 
     int getEdgeTriangle(const SimplexId &edgeId,
                         const int &id,
@@ -90,7 +90,7 @@ namespace ttk {
 
     SimplexId getEdgeTriangleNumber(const SimplexId &edgeId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getEdgeTriangles() override;
+    const FlatJaggedArray *getEdgeTriangles() override;
 
     int getEdgeVertex(const SimplexId &edgeId,
                       const int &localVertexId,
@@ -118,14 +118,13 @@ namespace ttk {
                            const int &id,
                            SimplexId &edgeId) const;
 
-    int getTetrahedronEdges(std::vector<std::vector<SimplexId>> &edges) const;
+    int getTetrahedronEdges(FlatJaggedArray &edges) const;
 
     int getTetrahedronTriangle(const SimplexId &tetId,
                                const int &id,
                                SimplexId &triangleId) const;
 
-    int getTetrahedronTriangles(
-      std::vector<std::vector<SimplexId>> &triangles) const;
+    int getTetrahedronTriangles(FlatJaggedArray &triangles) const;
 
     int getTetrahedronNeighbor(const SimplexId &tetId,
                                const int &localNeighborId,
@@ -133,7 +132,7 @@ namespace ttk {
 
     SimplexId getTetrahedronNeighborNumber(const SimplexId &tetId) const;
 
-    int getTetrahedronNeighbors(std::vector<std::vector<SimplexId>> &neighbors);
+    int getTetrahedronNeighbors(FlatJaggedArray &neighbors);
 
     int getTetrahedronVertex(const SimplexId &tetId,
                              const int &localVertexId,
@@ -150,9 +149,9 @@ namespace ttk {
       return 3;
     }
 
-    const std::vector<std::vector<SimplexId>> *getTriangleEdges() override;
+    const FlatJaggedArray *getTriangleEdges() override;
 
-    int getTriangleEdges(std::vector<std::vector<SimplexId>> &edges) const;
+    int getTriangleEdges(FlatJaggedArray &edges) const;
 
     int getTriangleLink(const SimplexId &triangleId,
                         const int &localLinkId,
@@ -160,7 +159,7 @@ namespace ttk {
 
     SimplexId getTriangleLinkNumber(const SimplexId &triangleId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getTriangleLinks() override;
+    const FlatJaggedArray *getTriangleLinks() override;
 
     int getTriangleNeighbor(const SimplexId &triangleId,
                             const int &localNeighborId,
@@ -168,7 +167,7 @@ namespace ttk {
 
     SimplexId getTriangleNeighborNumber(const SimplexId &triangleId) const;
 
-    int getTriangleNeighbors(std::vector<std::vector<SimplexId>> &neighbors);
+    int getTriangleNeighbors(FlatJaggedArray &neighbors);
 
     int getTriangleStar(const SimplexId &triangleId,
                         const int &localStarId,
@@ -176,13 +175,13 @@ namespace ttk {
 
     SimplexId getTriangleStarNumber(const SimplexId &triangleId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getTriangleStars() override;
+    const FlatJaggedArray *getTriangleStars() override;
 
     int getTriangleVertex(const SimplexId &triangleId,
                           const int &localVertexId,
                           SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getTriangles() override;
+    const FlatJaggedArray *getTriangles() override;
 
     int getVertexEdge(const SimplexId &vertexId,
                       const int &id,
@@ -190,7 +189,7 @@ namespace ttk {
 
     SimplexId getVertexEdgeNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexEdges() override;
+    const FlatJaggedArray *getVertexEdges() override;
 
     int getVertexLink(const SimplexId &vertexId,
                       const int &localLinkId,
@@ -198,7 +197,7 @@ namespace ttk {
 
     SimplexId getVertexLinkNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexLinks() override;
+    const FlatJaggedArray *getVertexLinks() override;
 
     int getVertexNeighbor(const SimplexId &vertexId,
                           const int &localNeighborId,
@@ -206,7 +205,7 @@ namespace ttk {
 
     SimplexId getVertexNeighborNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexNeighbors() override;
+    const FlatJaggedArray *getVertexNeighbors() override;
 
     int getVertexPoint(const SimplexId &vertexId,
                        float &x,
@@ -219,7 +218,7 @@ namespace ttk {
 
     SimplexId getVertexStarNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexStars() override;
+    const FlatJaggedArray *getVertexStars() override;
 
     int getVertexTriangle(const SimplexId &vertexId,
                           const int &id,
@@ -227,7 +226,7 @@ namespace ttk {
 
     SimplexId getVertexTriangleNumber(const SimplexId &vertexId) const override;
 
-    const std::vector<std::vector<SimplexId>> *getVertexTriangles() override;
+    const FlatJaggedArray *getVertexTriangles() override;
 
     bool isEdgeOnBoundary(const SimplexId &edgeId) const override;
 
@@ -3272,4 +3271,66 @@ inline ttk::SimplexId
   return -1;
 }
 
+inline ttk::SimplexId
+  ttk::PeriodicImplicitTriangulation::getVertexNeighborNumber(
+    const SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(vertexId < 0 or vertexId >= vertexNumber_)
+    return -1;
+#endif
+
+  if(dimensionality_ == 3) {
+    return 14; // abcdefgh
+  } else if(dimensionality_ == 2) {
+    return 6; // abcd
+  } else if(dimensionality_ == 1) {
+    return 2; // ab
+  }
+
+  return -1;
+}
+
+inline int ttk::PeriodicImplicitTriangulation::getVertexNeighbor(
+  const SimplexId &vertexId,
+  const int &localNeighborId,
+  SimplexId &neighborId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(localNeighborId < 0
+     or localNeighborId >= getVertexNeighborNumber(vertexId))
+    return -1;
+#endif
+
+  neighborId = -1;
+
+  if(dimensionality_ == 3) {
+    SimplexId p[3];
+    vertexToPosition(vertexId, p);
+    neighborId = getVertexNeighbor3d(p, vertexId, localNeighborId);
+  } else if(dimensionality_ == 2) {
+    SimplexId p[2];
+    vertexToPosition2d(vertexId, p);
+    neighborId = getVertexNeighbor2d(p, vertexId, localNeighborId);
+  } else if(dimensionality_ == 1) {
+    // ab
+    if(vertexId > 0 and vertexId < nbvoxels_[Di_]) {
+      if(localNeighborId == 0)
+        neighborId = vertexId + 1;
+      else
+        neighborId = vertexId - 1;
+    } else if(vertexId == 0) {
+      if(localNeighborId == 0)
+        neighborId = vertexId + 1; // a
+      else
+        neighborId = nbvoxels_[Di_];
+    } else {
+      if(localNeighborId == 0)
+        neighborId = 0; // a
+      else
+        neighborId = vertexId - 1; // b
+    }
+  }
+
+  return 0;
+}
+
 #endif // _PERIODICIMPLICITTRIANGULATION_H
@@ -1,14 +1,19 @@
 #include <PersistenceDiagram.h>
 
+#include <iterator>
+#include <unordered_map>
+
 using namespace std;
 using namespace ttk;
 
 using namespace ftm;
 
 PersistenceDiagram::PersistenceDiagram()
-  : ComputeSaddleConnectors{},
+  : ComputeSaddleConnectors{}, Backend{BACKEND::FTM}, Progressive{},
+    StartingResolutionLevel{-1}, StoppingResolutionLevel{},
 
-    triangulation_{}, inputScalars_{}, CTDiagram_{} {
+    triangulation_{}, inputScalars_{}, inputOffsets_{}, inputOrder_{},
+    CTDiagram_{} {
 }
 
 PersistenceDiagram::~PersistenceDiagram() {
@@ -44,3 +49,381 @@ CriticalType PersistenceDiagram::getNodeType(FTMTree_MT *tree,
       return CriticalType::Local_maximum;
   }
 }
+
+int PersistenceDiagram::jumpPointers(vector<SimplexId> &successors) const {
+  const SimplexId numberOfElements = successors.size();
+  vector<SimplexId> nextSuccessors(numberOfElements);
+
+  // double the length of the jumps until every chain points to its root (or
+  // to -1), reading from one buffer and writing to the other
+  bool hasChanged = true;
+  while(hasChanged) {
+    hasChanged = false;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasChanged)
+#endif
+    for(SimplexId i = 0; i < numberOfElements; ++i) {
+      const SimplexId successor = successors[i];
+      nextSuccessors[i] = successor;
+      if(successor != -1 and successors[successor] != successor) {
+        nextSuccessors[i] = successors[successor];
+        hasChanged = true;
+      }
+    }
+    successors.swap(nextSuccessors);
+  }
+
+  return 0;
+}
+
+int PersistenceDiagram::computeDiscreteGradientPairs(
+  const dcg::DiscreteGradient &discreteGradient,
+  const SimplexId *order,
+  vector<tuple<SimplexId, SimplexId, SimplexId>> &pairs) const {
+
+  using dcg::Cell;
+
+  const int dimensionality = discreteGradient.getDimensionality();
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(dimensionality != 2 and dimensionality != 3)
+    return -1;
+#endif
+
+  const SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
+  const SimplexId numberOfTopCells
+    = discreteGradient.getNumberOfCells(dimensionality);
+
+  // highest vertex of a cell, in the vertex order
+  auto getCellMaxVertex = [&](const int dim, const SimplexId id) {
+    if(dim == 0)
+      return id;
+    SimplexId maxVertex = -1;
+    for(int i = 0; i <= dim; ++i) {
+      SimplexId vertexId = -1;
+      if(dim == 1)
+        triangulation_->getEdgeVertex(id, i, vertexId);
+      else if(dim == 2 and dimensionality == 3)
+        triangulation_->getTriangleVertex(id, i, vertexId);
+      else
+        triangulation_->getCellVertex(id, i, vertexId);
+      if(maxVertex == -1 or order[vertexId] > order[maxVertex])
+        maxVertex = vertexId;
+    }
+    return maxVertex;
+  };
+
+  // critical cells by dimension, sorted by (rank of their highest vertex,
+  // identifier): the Morse boundary is triangular for this filtration
+  vector<Cell> criticalPoints;
+  discreteGradient.getCriticalPoints(criticalPoints);
+  vector<vector<pair<SimplexId, SimplexId>>> criticalCells(
+    dimensionality + 1);
+  for(const auto &c : criticalPoints)
+    criticalCells[c.dim_].emplace_back(
+      order[getCellMaxVertex(c.dim_, c.id_)], c.id_);
+  for(auto &cells : criticalCells)
+    std::sort(cells.begin(), cells.end());
+
+  const auto &saddles1 = criticalCells[1];
+  const auto &saddlesTop = criticalCells[dimensionality - 1];
+  const auto &maxima = criticalCells[dimensionality];
+
+  // minimum reached by the descending V-path of each vertex
+  vector<SimplexId> vertexMinima(numberOfVertices);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < numberOfVertices; ++i) {
+    const SimplexId edgeId = discreteGradient.getPairedCell(Cell(0, i));
+    if(edgeId == -1) {
+      vertexMinima[i] = i;
+      continue;
+    }
+    triangulation_->getEdgeVertex(edgeId, 0, vertexMinima[i]);
+    if(vertexMinima[i] == i)
+      triangulation_->getEdgeVertex(edgeId, 1, vertexMinima[i]);
+  }
+  jumpPointers(vertexMinima);
+
+  // maximum reached by the ascending V-path of each top cell (-1 if the
+  // V-path leaves the domain through its boundary)
+  vector<SimplexId> cellMaxima(numberOfTopCells);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < numberOfTopCells; ++i) {
+    const SimplexId facetId
+      = discreteGradient.getPairedCell(Cell(dimensionality, i), true);
+    if(facetId == -1) {
+      cellMaxima[i] = i;
+      continue;
+    }
+    cellMaxima[i] = -1;
+    const SimplexId starNumber
+      = dimensionality == 2 ? triangulation_->getEdgeStarNumber(facetId)
+                            : triangulation_->getTriangleStarNumber(facetId);
+    for(SimplexId j = 0; j < starNumber; ++j) {
+      SimplexId neighborId = -1;
+      if(dimensionality == 2)
+        triangulation_->getEdgeStar(facetId, j, neighborId);
+      else
+        triangulation_->getTriangleStar(facetId, j, neighborId);
+      if(neighborId != i)
+        cellMaxima[i] = neighborId;
+    }
+  }
+  jumpPointers(cellMaxima);
+
+  auto findRoot = [](vector<SimplexId> &parents, SimplexId x) {
+    while(parents[x] != x) {
+      parents[x] = parents[parents[x]];
+      x = parents[x];
+    }
+    return x;
+  };
+
+  // negative 1-saddles (paired with a minimum) and positive
+  // (d-1)-saddles (paired with a maximum)
+  vector<char> isPairedSaddle1(saddles1.size(), false);
+  vector<char> isPairedSaddleTop(saddlesTop.size(), false);
+  vector<tuple<SimplexId, SimplexId, SimplexId>> minSaddlePairs;
+  vector<tuple<SimplexId, SimplexId, SimplexId>> saddleMaxPairs;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel sections num_threads(threadNumber_)
+#endif
+  {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif
+    {
+      // D0: union-find on the minima, merged by the 1-saddles in
+      // increasing order (elder rule on the vertex order)
+      vector<SimplexId> parents(numberOfVertices);
+      for(SimplexId i = 0; i < numberOfVertices; ++i)
+        parents[i] = i;
+      for(size_t i = 0; i < saddles1.size(); ++i) {
+        const SimplexId edgeId = saddles1[i].second;
+        SimplexId v0 = -1, v1 = -1;
+        triangulation_->getEdgeVertex(edgeId, 0, v0);
+        triangulation_->getEdgeVertex(edgeId, 1, v1);
+        SimplexId r0 = findRoot(parents, vertexMinima[v0]);
+        SimplexId r1 = findRoot(parents, vertexMinima[v1]);
+        if(r0 == r1)
+          continue;
+        if(order[r0] < order[r1])
+          std::swap(r0, r1);
+        parents[r0] = r1;
+        isPairedSaddle1[i] = true;
+        minSaddlePairs.emplace_back(r0, getCellMaxVertex(1, edgeId), 0);
+      }
+    }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif
+    {
+      // D(d-1): union-find on the maxima, merged by the (d-1)-saddles in
+      // decreasing order. The outside of the domain is an extra node,
+      // older than any maximum, reached through the boundary.
+      const SimplexId outside = maxima.size();
+      vector<SimplexId> maximumIds(numberOfTopCells, -1);
+      for(size_t i = 0; i < maxima.size(); ++i)
+        maximumIds[maxima[i].second] = i;
+      vector<SimplexId> parents(maxima.size() + 1);
+      for(size_t i = 0; i < parents.size(); ++i)
+        parents[i] = i;
+
+      const int saddleDim = dimensionality - 1;
+      for(SimplexId i = saddlesTop.size() - 1; i >= 0; --i) {
+        const SimplexId saddleId = saddlesTop[i].second;
+        const SimplexId starNumber
+          = dimensionality == 2
+              ? triangulation_->getEdgeStarNumber(saddleId)
+              : triangulation_->getTriangleStarNumber(saddleId);
+        SimplexId roots[2] = {outside, outside};
+        for(SimplexId j = 0; j < starNumber and j < 2; ++j) {
+          SimplexId cellId = -1;
+          if(dimensionality == 2)
+            triangulation_->getEdgeStar(saddleId, j, cellId);
+          else
+            triangulation_->getTriangleStar(saddleId, j, cellId);
+          const SimplexId maximum = cellMaxima[cellId];
+          roots[j] = findRoot(
+            parents, maximum == -1 ? outside : maximumIds[maximum]);
+        }
+        roots[1] = findRoot(parents, roots[1]);
+        if(roots[0] == roots[1])
+          continue;
+        // the lowest maximum dies (the maxima are sorted by increasing
+        // order and the outside is last)
+        if(roots[0] > roots[1])
+          std::swap(roots[0], roots[1]);
+        parents[roots[0]] = roots[1];
+        isPairedSaddleTop[i] = true;
+        // the global maximum is reported with the global minimum instead
+        // (see below)
+        const SimplexId maximum
+          = getCellMaxVertex(dimensionality, maxima[roots[0]].second);
+        if(order[maximum] == numberOfVertices - 1)
+          continue;
+        saddleMaxPairs.emplace_back(
+          getCellMaxVertex(saddleDim, saddleId), maximum, 2);
+      }
+    }
+  }
+
+  pairs = std::move(minSaddlePairs);
+  pairs.insert(pairs.end(), saddleMaxPairs.begin(), saddleMaxPairs.end());
+
+  // D1 (3D): reduction of the boundary matrix of the negative 2-saddles
+  // (clearing) restricted to the positive 1-saddles (compression)
+  if(dimensionality == 3 and ComputeSaddleConnectors) {
+    const auto &saddles2 = criticalCells[2];
+
+    // rows, sorted by increasing order
+    unordered_map<SimplexId, SimplexId> saddle1Rows;
+    vector<SimplexId> rowVertices;
+    for(size_t i = 0; i < saddles1.size(); ++i) {
+      if(!isPairedSaddle1[i]) {
+        saddle1Rows[saddles1[i].second] = rowVertices.size();
+        rowVertices.push_back(getCellMaxVertex(1, saddles1[i].second));
+      }
+    }
+
+    // columns, sorted by increasing order
+    vector<SimplexId> columnSaddles;
+    for(size_t i = 0; i < saddles2.size(); ++i)
+      if(!isPairedSaddleTop[i])
+        columnSaddles.push_back(saddles2[i].second);
+    const SimplexId numberOfColumns = columnSaddles.size();
+    vector<vector<SimplexId>> columns(numberOfColumns);
+
+    // Morse boundary of each column: parity of the number of descending
+    // V-paths from the 2-saddle to each 1-saddle, propagated through the
+    // V-paths in a topological order of the (acyclic) gradient
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+    {
+      unordered_map<SimplexId, SimplexId> localIds;
+      vector<SimplexId> edges, successors, inDegrees, stack;
+      vector<char> parities;
+
+      auto visit = [&](const SimplexId edgeId) {
+        const auto it = localIds.emplace(edgeId, edges.size());
+        if(it.second) {
+          edges.push_back(edgeId);
+          inDegrees.push_back(0);
+          parities.push_back(0);
+          successors.push_back(-1);
+          successors.push_back(-1);
+          stack.push_back(it.first->second);
+        }
+        return it.first->second;
+      };
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for(SimplexId i = 0; i < numberOfColumns; ++i) {
+        localIds.clear();
+        edges.clear();
+        successors.clear();
+        inDegrees.clear();
+        parities.clear();
+
+        for(int j = 0; j < 3; ++j) {
+          SimplexId edgeId = -1;
+          triangulation_->getTriangleEdge(columnSaddles[i], j, edgeId);
+          parities[visit(edgeId)] ^= 1;
+        }
+
+        // discovery of the descending wall of the 2-saddle
+        while(!stack.empty()) {
+          const SimplexId e = stack.back();
+          stack.pop_back();
+          const SimplexId triangleId
+            = discreteGradient.getPairedCell(Cell(1, edges[e]));
+          if(triangleId == -1)
+            continue;
+          for(int j = 0, k = 0; j < 3; ++j) {
+            SimplexId edgeId = -1;
+            triangulation_->getTriangleEdge(triangleId, j, edgeId);
+            if(edgeId != edges[e]) {
+              const SimplexId f = visit(edgeId);
+              successors[2 * e + k++] = f;
+              ++inDegrees[f];
+            }
+          }
+        }
+
+        // propagation of the parities (Kahn's algorithm)
+        for(size_t e = 0; e < edges.size(); ++e)
+          if(!inDegrees[e])
+            stack.push_back(e);
+        while(!stack.empty()) {
+          const SimplexId e = stack.back();
+          stack.pop_back();
+          if(successors[2 * e] == -1) {
+            const auto row = saddle1Rows.find(edges[e]);
+            if(parities[e] and row != saddle1Rows.end())
+              columns[i].push_back(row->second);
+            continue;
+          }
+          for(int k = 0; k < 2; ++k) {
+            const SimplexId f = successors[2 * e + k];
+            parities[f] ^= parities[e];
+            if(!--inDegrees[f])
+              stack.push_back(f);
+          }
+        }
+
+        std::sort(columns[i].begin(), columns[i].end());
+      }
+    }
+
+    // sparse Z2 reduction, pivots on the highest rows
+    vector<SimplexId> pivotColumns(rowVertices.size(), -1);
+    vector<SimplexId> sum;
+    for(SimplexId i = 0; i < numberOfColumns; ++i) {
+      auto &column = columns[i];
+      while(!column.empty()) {
+        const SimplexId pivot = column.back();
+        if(pivotColumns[pivot] == -1) {
+          pivotColumns[pivot] = i;
+          pairs.emplace_back(rowVertices[pivot],
+                             getCellMaxVertex(2, columnSaddles[i]), 1);
+          break;
+        }
+        const auto &other = columns[pivotColumns[pivot]];
+        sum.clear();
+        std::set_symmetric_difference(column.begin(), column.end(),
+                                      other.begin(), other.end(),
+                                      std::back_inserter(sum));
+        column.swap(sum);
+      }
+    }
+  }
+
+  // pairs of cells in the same lower star have no persistence
+  pairs.erase(
+    std::remove_if(pairs.begin(), pairs.end(),
+                   [](const tuple<SimplexId, SimplexId, SimplexId> &p) {
+                     return get<0>(p) == get<1>(p);
+                   }),
+    pairs.end());
+
+  // the global minimum (which never dies) is paired with the global
+  // maximum, as with the FTM backend
+  SimplexId globalMin = 0, globalMax = 0;
+  for(SimplexId i = 0; i < numberOfVertices; ++i) {
+    if(order[i] == 0)
+      globalMin = i;
+    if(order[i] == numberOfVertices - 1)
+      globalMax = i;
+  }
+  pairs.emplace_back(globalMin, globalMax, 0);
+
+  return 0;
+}
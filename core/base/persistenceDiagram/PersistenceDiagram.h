@@ -15,6 +15,26 @@
 /// vertexId and critical type. Based on that, the persistence of the pair
 /// and its 2D embedding can easily be obtained.
 ///
+/// Two backends are available (see setBackend()). The default one extracts
+/// the extremum-saddle pairs from the join and split trees (and, optionally,
+/// the saddle-saddle pairs from the Morse-Smale complex). The discrete
+/// gradient backend skips the contour tree: it reduces the boundary matrix of
+/// the critical cells of a ttk::dcg::DiscreteGradient, which yields the exact
+/// persistence pairs of the sublevel sets in all dimensions. With this
+/// backend, a superlevel set component which reaches the boundary of the
+/// domain dies there (as in the persistent homology of the sublevel sets),
+/// instead of surviving until it merges with another one. Away from the
+/// boundary, both backends yield the same extremum-saddle pairs.
+///
+/// In progressive mode (see setProgressive()), the extremum-saddle pairs of a
+/// regular grid are first computed on a strided sub-grid (one vertex out of
+/// 2^L along each axis), then on finer and finer sub-grids down to the input
+/// grid. Each level reports its diagram and a guaranteed upper bound on its
+/// bottleneck distance to the exact diagram (see setProgressiveSink()), and
+/// the finest level yields the exact diagram. The critical points of a level
+/// are reused at the next one: a vertex is only re-classified if the relative
+/// order of its neighbors has changed.
+///
 /// Persistence diagrams are useful and stable concise representations of the
 /// topological features of a data-set. It is useful to fine-tune persistence
 /// thresholds for topological simplification or for fast similarity
@@ -31,11 +51,18 @@
 #define _PERSISTENCEDIAGRAM_H
 
 // base code includes
+#include <DiscreteGradient.h>
 #include <FTMTreePP.h>
+#include <FlatJaggedArray.h>
 #include <MorseSmaleComplex3D.h>
 #include <Triangulation.h>
+#include <VertexOrder.h>
 #include <Wrapper.h>
 
+#include <array>
+#include <cstdint>
+#include <functional>
+
 namespace ttk {
 
   /**
@@ -45,6 +72,33 @@ namespace ttk {
   class PersistenceDiagram : public Debug {
 
   public:
+    /// Algorithms computing the persistence pairs.
+    enum class BACKEND {
+      /// Join and split trees (ttk::ftm::FTMTreePP), saddle-saddle pairs
+      /// from the Morse-Smale complex.
+      FTM = 0,
+      /// Reduction of the boundary matrix of the critical cells of a discrete
+      /// gradient (see computeDiscreteGradientPairs()).
+      DISCRETE_GRADIENT = 1
+    };
+
+    /// Callback receiving the diagram of each level of the progressive mode,
+    /// from the coarsest to the finest one. The diagram of the level is in
+    /// the output diagram (see setOutputCTDiagram()) and \p errorBound bounds
+    /// its bottleneck distance to the exact diagram (0 at level 0). A non-zero
+    /// return value interrupts the computation.
+    using ProgressiveSink
+      = std::function<int(const int level, const double errorBound)>;
+
+    /// Throughput of a call to executeBatch().
+    struct BatchStatistics {
+      SimplexId fieldNumber{};
+      /// Elapsed time (in seconds).
+      double elapsedTime{};
+      /// Number of fields processed per second.
+      double throughput{};
+    };
+
     PersistenceDiagram();
     ~PersistenceDiagram();
 
@@ -53,6 +107,62 @@ namespace ttk {
       return 0;
     }
 
+    inline int setBackend(const BACKEND backend) {
+      Backend = backend;
+      return 0;
+    }
+
+    /// Enable/Disable the progressive mode (regular grids only, see
+    /// executeProgressive()). The saddle-saddle pairs are not computed in this
+    /// mode.
+    inline int setProgressive(const bool state) {
+      Progressive = state;
+      return 0;
+    }
+
+    /// Set the coarsest level of the progressive mode (stride of 2^level), -1
+    /// for the coarsest level with at least 3 vertices along each axis.
+    inline int setStartingResolutionLevel(const int level) {
+      StartingResolutionLevel = level;
+      return 0;
+    }
+
+    /// Set the finest level of the progressive mode (0 for the exact
+    /// diagram).
+    inline int setStoppingResolutionLevel(const int level) {
+      StoppingResolutionLevel = level;
+      return 0;
+    }
+
+    inline int setProgressiveSink(const ProgressiveSink &sink) {
+      progressiveSink_ = sink;
+      return 0;
+    }
+
+    /// Compute the persistence pairs of the lower star filtration from the
+    /// critical cells of \p discreteGradient, as (birth vertex, death vertex,
+    /// pair type) triplets (see execute() for the pair types). The cells are
+    /// sorted by the \p order of their highest vertex.
+    ///
+    /// D0 and D(d-1) are computed concurrently, by union-find on the
+    /// extrema reached by the V-paths of the saddles. In 3D, if the
+    /// saddle-saddle pairs are enabled, D1 is then obtained by reducing the
+    /// sparse Z2 boundary matrix of the 2-saddles over the 1-saddles, with
+    /// clearing (2-saddles paired with maxima are skipped) and compression
+    /// (1-saddles paired with minima are removed). The columns are computed
+    /// in parallel.
+    ///
+    /// As with the FTM backend, the last pair is the global (minimum,
+    /// maximum) pair: if the domain has a boundary, the global maximum dies
+    /// at a (d-1)-saddle in the sublevel set filtration, but this
+    /// (saddle, maximum) pair is not reported (the saddle is not paired
+    /// with another cell either), so that each maximum appears in a single
+    /// pair.
+    int computeDiscreteGradientPairs(
+      const dcg::DiscreteGradient &discreteGradient,
+      const SimplexId *order,
+      std::vector<std::tuple<SimplexId, SimplexId, SimplexId>> &pairs) const;
+
     ttk::CriticalType getNodeType(ftm::FTMTree_MT *tree,
                                   ftm::TreeType treeType,
                                   const SimplexId vertexId) const;
@@ -67,6 +177,15 @@ namespace ttk {
                                scalarType *scalars,
                                SimplexId *offsets) const;
 
+    template <typename scalarType>
+    int sortPersistenceDiagram(std::vector<std::tuple<ttk::SimplexId,
+                                                      ttk::CriticalType,
+                                                      ttk::SimplexId,
+                                                      ttk::CriticalType,
+                                                      scalarType,
+                                                      ttk::SimplexId>> &diagram,
+                               const SimplexId *order) const;
+
     template <typename scalarType>
     int computeCTPersistenceDiagram(
       ftm::FTMTreePP &tree,
@@ -83,6 +202,51 @@ namespace ttk {
     template <class scalarType, typename idType>
     int execute() const;
 
+    template <class scalarType, typename idType>
+    int executeDiscreteGradient() const;
+
+    /// Compute the extremum-saddle pairs of a batch of scalar fields defined
+    /// on the same triangulation (e.g. the members of an ensemble or the
+    /// timesteps of a time-varying data-set), which share the offsets given
+    /// by setInputOffsets() (the vertex identifiers if none). The output
+    /// diagrams are those of execute() without saddle-saddle pairs.
+    ///
+    /// The vertex adjacency of the triangulation is flattened once for the
+    /// whole batch and the fields are distributed over the threads. Instead
+    /// of building join and split trees (with their per-vertex allocations),
+    /// each field is processed by two union-find sweeps of its sorted
+    /// vertices, in buffers owned by the thread and recycled from one field
+    /// to the next.
+    template <class scalarType, typename idType>
+    int executeBatch(
+      const std::vector<void *> &fields,
+      std::vector<std::vector<std::tuple<ttk::SimplexId,
+                                         ttk::CriticalType,
+                                         ttk::SimplexId,
+                                         ttk::CriticalType,
+                                         scalarType,
+                                         ttk::SimplexId>>> &diagrams,
+      BatchStatistics *statistics = nullptr) const;
+
+    /// Compute the extremum-saddle pairs on a hierarchy of strided sub-grids
+    /// of the input regular grid, from the starting level to the stopping
+    /// level. At each level, the join (resp. split) pairs are obtained by
+    /// union-find on the minima (resp. maxima) reached by the steepest
+    /// descending (resp. ascending) paths of the neighbors of the saddles.
+    /// The output diagram holds the diagram of the stopping level.
+    template <class scalarType, typename idType>
+    int executeProgressive() const;
+
+    /// Compute, for each level of the progressive mode, an upper bound on the
+    /// bottleneck distance between its diagram and the exact one: the
+    /// largest range of the field over the boxes of the grid spanned by the
+    /// cells of the level (stability of persistence diagrams with respect to
+    /// the distance between the interpolated sub-grid and the input field).
+    template <class scalarType>
+    int computeErrorBounds(const std::vector<int> &dimensions,
+                           const int startingLevel,
+                           std::vector<double> &errorBounds) const;
+
     inline int
       setDMTPairs(std::vector<std::tuple<dcg::Cell, dcg::Cell>> *data) {
       dmt_pairs = data;
@@ -110,19 +274,64 @@ namespace ttk {
       return 0;
     }
 
+    /// Set an optional order field (rank of each vertex in the order given
+    /// by the scalars and the offsets, see ttk::VertexOrder), which replaces
+    /// the sort of the vertices.
+    inline int setInputOrder(void *data) {
+      inputOrder_ = data;
+      return 0;
+    }
+
     inline int setOutputCTDiagram(void *data) {
       CTDiagram_ = data;
       return 0;
     }
 
   protected:
+    /// Working memory of a thread in executeBatch().
+    struct BatchArena {
+      std::vector<SimplexId> sortedVertices;
+      std::vector<SimplexId> vertexOrder;
+      std::vector<SimplexId> parents;
+      std::vector<SimplexId> roots;
+    };
+
+    /// Compute the extremum-saddle pairs of \p scalars with the elder rule,
+    /// by union-find sweeps of the vertices by increasing (join pairs) and
+    /// decreasing (split pairs) order, in the memory of \p arena.
+    template <typename scalarType, typename idType>
+    int computeSweepDiagram(const FlatJaggedArray &vertexNeighbors,
+                            const scalarType *scalars,
+                            const idType *offsets,
+                            BatchArena &arena,
+                            std::vector<std::tuple<ttk::SimplexId,
+                                                   ttk::CriticalType,
+                                                   ttk::SimplexId,
+                                                   ttk::CriticalType,
+                                                   scalarType,
+                                                   ttk::SimplexId>> &diagram)
+      const;
+
+    /**
+     * Replace in parallel each successor of \p successors (-1 if none, the
+     * element itself for a root) by the root of its chain, by pointer jumping
+     * (path doubling): O(log(L)) parallel passes for chains of length L.
+     */
+    int jumpPointers(std::vector<SimplexId> &successors) const;
+
     std::vector<std::tuple<dcg::Cell, dcg::Cell>> *dmt_pairs;
 
     bool ComputeSaddleConnectors;
+    BACKEND Backend;
+    bool Progressive;
+    int StartingResolutionLevel;
+    int StoppingResolutionLevel;
+    ProgressiveSink progressiveSink_;
 
     Triangulation *triangulation_;
     void *inputScalars_;
     void *inputOffsets_;
+    void *inputOrder_;
     void *CTDiagram_;
   };
 } // namespace ttk
@@ -162,6 +371,30 @@ int ttk::PersistenceDiagram::sortPersistenceDiagram(
   return 0;
 }
 
+template <typename scalarType>
+int ttk::PersistenceDiagram::sortPersistenceDiagram(
+
+  std::vector<std::tuple<ttk::SimplexId,
+                         ttk::CriticalType,
+                         ttk::SimplexId,
+                         ttk::CriticalType,
+                         scalarType,
+                         ttk::SimplexId>> &diagram,
+  const SimplexId *order) const {
+  auto cmp
+    = [order](
+        const std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                         ttk::CriticalType, scalarType, ttk::SimplexId> &a,
+        const std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                         ttk::CriticalType, scalarType, ttk::SimplexId> &b) {
+        return order[std::get<0>(a)] < order[std::get<0>(b)];
+      };
+
+  std::sort(diagram.begin(), diagram.end(), cmp);
+
+  return 0;
+}
+
 template <typename scalarType>
 int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
   ftm::FTMTreePP &tree,
@@ -208,6 +441,11 @@ int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
 template <typename scalarType, typename idType>
 int ttk::PersistenceDiagram::execute() const {
 
+  if(Progressive)
+    return executeProgressive<scalarType, idType>();
+  if(Backend == BACKEND::DISCRETE_GRADIENT)
+    return executeDiscreteGradient<scalarType, idType>();
+
   // get data
   std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
                          ttk::CriticalType, scalarType, ttk::SimplexId>>
@@ -229,6 +467,7 @@ int ttk::PersistenceDiagram::execute() const {
   contourTree.setVertexScalars(inputScalars_);
   contourTree.setTreeType(ftm::TreeType::Join_Split);
   contourTree.setVertexSoSoffsets(voffsets.data());
+  contourTree.setVertexOrder(static_cast<const SimplexId *>(inputOrder_));
   contourTree.setThreadNumber(threadNumber_);
   contourTree.setDebugLevel(debugLevel_);
   contourTree.setSegmentation(false);
@@ -311,7 +550,734 @@ int ttk::PersistenceDiagram::execute() const {
   }
 
   // finally sort the diagram
-  sortPersistenceDiagram(CTDiagram, scalars, offsets);
+  if(inputOrder_)
+    sortPersistenceDiagram(
+      CTDiagram, static_cast<const SimplexId *>(inputOrder_));
+  else
+    sortPersistenceDiagram(CTDiagram, scalars, offsets);
+
+  return 0;
+}
+
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::computeSweepDiagram(
+  const FlatJaggedArray &vertexNeighbors,
+  const scalarType *scalars,
+  const idType *offsets,
+  BatchArena &arena,
+  std::vector<std::tuple<ttk::SimplexId,
+                         ttk::CriticalType,
+                         ttk::SimplexId,
+                         ttk::CriticalType,
+                         scalarType,
+                         ttk::SimplexId>> &diagram) const {
+
+  const SimplexId vertexNumber = vertexNeighbors.subvectorsNumber();
+  diagram.clear();
+  if(!vertexNumber)
+    return 0;
+
+  auto &sortedVertices = arena.sortedVertices;
+  auto &vertexOrder = arena.vertexOrder;
+  auto &parents = arena.parents;
+  auto &roots = arena.roots;
+  VertexOrder::sortVertices(
+    vertexNumber, scalars, offsets, sortedVertices, &vertexOrder, 1);
+  parents.resize(vertexNumber);
+
+  auto findRoot = [&parents](SimplexId x) {
+    while(parents[x] != x) {
+      parents[x] = parents[parents[x]];
+      x = parents[x];
+    }
+    return x;
+  };
+
+  // the root of each component is its extremum: at a saddle, the eldest
+  // component absorbs the others, whose extrema die
+  auto sweep = [&](const bool isJoin) {
+    for(SimplexId i = 0; i < vertexNumber; ++i) {
+      const SimplexId rank = isJoin ? i : vertexNumber - 1 - i;
+      const SimplexId v = sortedVertices[rank];
+      parents[v] = v;
+      roots.clear();
+      for(const auto u : vertexNeighbors[v]) {
+        if(isJoin ? vertexOrder[u] < rank : vertexOrder[u] > rank)
+          roots.push_back(findRoot(u));
+      }
+      if(roots.empty())
+        continue;
+
+      SimplexId eldest = roots[0];
+      for(const auto r : roots) {
+        if(isJoin ? vertexOrder[r] < vertexOrder[eldest]
+                  : vertexOrder[r] > vertexOrder[eldest])
+          eldest = r;
+      }
+      for(const auto r : roots) {
+        if(parents[r] != r or r == eldest)
+          continue;
+        parents[r] = eldest;
+        if(isJoin)
+          diagram.emplace_back(r, CriticalType::Local_minimum, v,
+                               CriticalType::Saddle1, scalars[v] - scalars[r],
+                               0);
+        else
+          diagram.emplace_back(v, CriticalType::Saddle2, r,
+                               CriticalType::Local_maximum,
+                               scalars[r] - scalars[v], 2);
+      }
+      parents[v] = eldest;
+    }
+  };
+
+  sweep(true);
+  sweep(false);
+
+  // global pair
+  const SimplexId globalMin = sortedVertices[0];
+  const SimplexId globalMax = sortedVertices[vertexNumber - 1];
+  diagram.emplace_back(globalMin, CriticalType::Local_minimum, globalMax,
+                       CriticalType::Local_maximum,
+                       scalars[globalMax] - scalars[globalMin], 0);
+
+  sortPersistenceDiagram(diagram, vertexOrder.data());
+
+  return 0;
+}
+
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::executeBatch(
+  const std::vector<void *> &fields,
+  std::vector<std::vector<std::tuple<ttk::SimplexId,
+                                     ttk::CriticalType,
+                                     ttk::SimplexId,
+                                     ttk::CriticalType,
+                                     scalarType,
+                                     ttk::SimplexId>>> &diagrams,
+  BatchStatistics *statistics) const {
+
+  Timer t;
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!triangulation_)
+    return -1;
+#endif
+
+  const SimplexId fieldNumber = fields.size();
+  const SimplexId vertexNumber = triangulation_->getNumberOfVertices();
+  const idType *offsets = static_cast<const idType *>(inputOffsets_);
+  diagrams.resize(fieldNumber);
+
+  // flat copy of the vertex adjacency, shared by all the fields
+  FlatJaggedArray vertexNeighbors;
+  {
+    std::vector<SimplexId> rowSizes(vertexNumber);
+    for(SimplexId v = 0; v < vertexNumber; ++v)
+      rowSizes[v] = triangulation_->getVertexNeighborNumber(v);
+    vertexNeighbors.setRowSizes(rowSizes);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId v = 0; v < vertexNumber; ++v) {
+      for(SimplexId j = 0; j < rowSizes[v]; ++j) {
+        SimplexId u = -1;
+        triangulation_->getVertexNeighbor(v, j, u);
+        vertexNeighbors.set(v, j, u);
+      }
+    }
+  }
+
+  const int arenaNumber = std::max(
+    1, static_cast<int>(std::min<SimplexId>(threadNumber_, fieldNumber)));
+  std::vector<BatchArena> arenas(arenaNumber);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(arenaNumber)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < fieldNumber; ++i) {
+#ifdef TTK_ENABLE_OPENMP
+    BatchArena &arena = arenas[omp_get_thread_num()];
+#else
+    BatchArena &arena = arenas[0];
+#endif // TTK_ENABLE_OPENMP
+    computeSweepDiagram(vertexNeighbors,
+                        static_cast<const scalarType *>(fields[i]), offsets,
+                        arena, diagrams[i]);
+  }
+
+  const double elapsedTime = t.getElapsedTime();
+  const double throughput
+    = elapsedTime > 0 ? fieldNumber / elapsedTime : fieldNumber;
+  if(statistics) {
+    statistics->fieldNumber = fieldNumber;
+    statistics->elapsedTime = elapsedTime;
+    statistics->throughput = throughput;
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[PersistenceDiagram] " << fieldNumber << " diagram(s) computed in "
+        << elapsedTime << " s. (" << throughput << " field(s)/s., "
+        << arenaNumber << " thread(s))." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::executeDiscreteGradient() const {
+
+  Timer t;
+
+  std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                         ttk::CriticalType, scalarType, ttk::SimplexId>>
+    &CTDiagram = *static_cast<
+      std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                             ttk::CriticalType, scalarType, ttk::SimplexId>> *>(
+      CTDiagram_);
+  scalarType *scalars = static_cast<scalarType *>(inputScalars_);
+  SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
+
+  const ttk::SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
+
+  // vertex order
+  std::vector<SimplexId> vertexOrder;
+  const SimplexId *order = static_cast<const SimplexId *>(inputOrder_);
+  if(!order) {
+    vertexOrder.resize(numberOfVertices);
+    VertexOrder::computeOrder(numberOfVertices, scalars,
+                              static_cast<const idType *>(inputOffsets_),
+                              vertexOrder.data(), threadNumber_);
+    order = vertexOrder.data();
+  }
+
+  // lower star gradient
+  dcg::DiscreteGradient discreteGradient;
+  discreteGradient.setDebugLevel(debugLevel_);
+  discreteGradient.setThreadNumber(threadNumber_);
+  discreteGradient.setLowerStarGradient(true);
+  discreteGradient.setupTriangulation(triangulation_);
+  discreteGradient.setInputScalarField(inputScalars_);
+  discreteGradient.setInputOffsets(inputOffsets_);
+  discreteGradient.buildGradient<scalarType, idType>();
+
+  std::vector<std::tuple<SimplexId, SimplexId, SimplexId>> pairs;
+  const int ret = computeDiscreteGradientPairs(discreteGradient, order, pairs);
+  if(ret)
+    return ret;
+
+  const int dimensionality = discreteGradient.getDimensionality();
+  CTDiagram.resize(pairs.size());
+  for(size_t i = 0; i < pairs.size(); ++i) {
+    const SimplexId v0 = std::get<0>(pairs[i]);
+    const SimplexId v1 = std::get<1>(pairs[i]);
+    const SimplexId pairType = std::get<2>(pairs[i]);
+
+    ttk::CriticalType t0 = ttk::CriticalType::Local_minimum;
+    ttk::CriticalType t1 = ttk::CriticalType::Saddle1;
+    if(pairType == 1) {
+      t0 = ttk::CriticalType::Saddle1;
+      t1 = ttk::CriticalType::Saddle2;
+    } else if(pairType == 2) {
+      t0 = dimensionality == 3 ? ttk::CriticalType::Saddle2
+                               : ttk::CriticalType::Saddle1;
+      t1 = ttk::CriticalType::Local_maximum;
+    }
+    // global pair
+    if(i == pairs.size() - 1)
+      t1 = ttk::CriticalType::Local_maximum;
+
+    CTDiagram[i]
+      = std::make_tuple(v0, t0, v1, t1, scalars[v1] - scalars[v0], pairType);
+  }
+
+  // finally sort the diagram
+  if(inputOrder_)
+    sortPersistenceDiagram(CTDiagram, order);
+  else
+    sortPersistenceDiagram(CTDiagram, scalars, offsets);
+
+  {
+    std::stringstream msg;
+    msg << "[PersistenceDiagram] " << CTDiagram.size()
+        << " pairs computed from the discrete gradient in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+namespace ttk {
+  /// Number of vertices of a grid axis of \p vertexNumber vertices sampled
+  /// with a stride of \p stride (the last vertex is always kept).
+  inline SimplexId getStridedVertexNumber(const SimplexId vertexNumber,
+                                          const SimplexId stride) {
+    return vertexNumber > 1 ? (vertexNumber - 2) / stride + 2 : 1;
+  }
+} // namespace ttk
+
+template <typename scalarType>
+int ttk::PersistenceDiagram::computeErrorBounds(
+  const std::vector<int> &dimensions,
+  const int startingLevel,
+  std::vector<double> &errorBounds) const {
+
+  const scalarType *scalars = static_cast<const scalarType *>(inputScalars_);
+
+  errorBounds.assign(startingLevel + 1, 0);
+
+  // range of the field over each box spanned by a cell of the level, from
+  // the input vertices at level 1 and from the boxes of the previous level
+  // above (each box is the union of at most 2 boxes along each axis)
+  std::array<SimplexId, 3> boxNumbers{};
+  std::vector<std::pair<scalarType, scalarType>> ranges;
+  for(int level = 1; level <= startingLevel; ++level) {
+    const SimplexId stride = (SimplexId)1 << level;
+    std::array<SimplexId, 3> levelBoxNumbers{};
+    for(int i = 0; i < 3; ++i)
+      levelBoxNumbers[i] = std::max(
+        getStridedVertexNumber(dimensions[i], stride) - 1, (SimplexId)1);
+    const SimplexId boxNumber
+      = levelBoxNumbers[0] * levelBoxNumbers[1] * levelBoxNumbers[2];
+    std::vector<std::pair<scalarType, scalarType>> levelRanges(boxNumber);
+
+    double errorBound = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(max : errorBound)
+#endif
+    for(SimplexId b = 0; b < boxNumber; ++b) {
+      const std::array<SimplexId, 3> box{
+        b % levelBoxNumbers[0], (b / levelBoxNumbers[0]) % levelBoxNumbers[1],
+        b / (levelBoxNumbers[0] * levelBoxNumbers[1])};
+      std::array<SimplexId, 3> first{}, last{};
+      for(int i = 0; i < 3; ++i) {
+        if(level == 1) {
+          first[i] = std::min(box[i] * stride, (SimplexId)dimensions[i] - 1);
+          last[i]
+            = std::min((box[i] + 1) * stride, (SimplexId)dimensions[i] - 1);
+        } else {
+          first[i] = 2 * box[i];
+          last[i] = std::min(2 * box[i] + 1, boxNumbers[i] - 1);
+        }
+      }
+
+      auto &range = levelRanges[b];
+      bool isEmpty = true;
+      for(SimplexId k = first[2]; k <= last[2]; ++k) {
+        for(SimplexId j = first[1]; j <= last[1]; ++j) {
+          for(SimplexId i = first[0]; i <= last[0]; ++i) {
+            std::pair<scalarType, scalarType> r;
+            if(level == 1) {
+              const scalarType value
+                = scalars[i + dimensions[0] * (j + dimensions[1] * k)];
+              r = std::make_pair(value, value);
+            } else {
+              r = ranges[i + boxNumbers[0] * (j + boxNumbers[1] * k)];
+            }
+            if(isEmpty or r.first < range.first)
+              range.first = r.first;
+            if(isEmpty or r.second > range.second)
+              range.second = r.second;
+            isEmpty = false;
+          }
+        }
+      }
+      errorBound
+        = std::max(errorBound, (double)range.second - (double)range.first);
+    }
+
+    errorBounds[level] = errorBound;
+    ranges.swap(levelRanges);
+    boxNumbers = levelBoxNumbers;
+  }
+
+  return 0;
+}
+
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::executeProgressive() const {
+
+  Timer t;
+
+  std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                         ttk::CriticalType, scalarType, ttk::SimplexId>>
+    &CTDiagram = *static_cast<
+      std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
+                             ttk::CriticalType, scalarType, ttk::SimplexId>> *>(
+      CTDiagram_);
+  scalarType *scalars = static_cast<scalarType *>(inputScalars_);
+  SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
+  const idType *sosOffsets = static_cast<const idType *>(inputOffsets_);
+
+  std::vector<int> dimensions;
+  if(triangulation_->getType() != Triangulation::Type::IMPLICIT
+     or triangulation_->getGridDimensions(dimensions)) {
+    std::stringstream msg;
+    msg << "[PersistenceDiagram] The progressive mode requires a regular "
+        << "grid (without periodic boundary conditions)." << std::endl;
+    dMsg(std::cerr, msg.str(), fatalMsg);
+    return -1;
+  }
+
+  // coarsest level with at least 3 vertices along each axis
+  SimplexId minExtent = -1;
+  for(const auto d : dimensions)
+    if(d > 1 and (minExtent == -1 or d - 1 < minExtent))
+      minExtent = d - 1;
+  int maxLevel = 0;
+  while(minExtent != -1 and ((SimplexId)4 << maxLevel) <= minExtent)
+    ++maxLevel;
+  const int startingLevel
+    = StartingResolutionLevel < 0 ? maxLevel
+                                  : std::min(StartingResolutionLevel, maxLevel);
+  const int stoppingLevel
+    = std::max(0, std::min(StoppingResolutionLevel, startingLevel));
+
+  std::vector<double> errorBounds;
+  computeErrorBounds<scalarType>(dimensions, startingLevel, errorBounds);
+
+  auto findRoot = [](std::vector<SimplexId> &parents, SimplexId x) {
+    while(parents[x] != x) {
+      parents[x] = parents[parents[x]];
+      x = parents[x];
+    }
+    return x;
+  };
+
+  // link signature (bit set of the upper neighbors, by grid direction) and
+  // saddle type (1: join, 2: split) of the vertices of the previous level
+  std::array<SimplexId, 3> previousCounts{};
+  std::vector<uint32_t> previousMasks;
+  std::vector<char> previousTypes;
+
+  for(int level = startingLevel; level >= stoppingLevel; --level) {
+    Timer levelTimer;
+
+    const SimplexId stride = (SimplexId)1 << level;
+    std::array<SimplexId, 3> counts{};
+    for(int i = 0; i < 3; ++i)
+      counts[i] = getStridedVertexNumber(dimensions[i], stride);
+    const SimplexId vertexNumber = counts[0] * counts[1] * counts[2];
+
+    // sub-grid and sampled field
+    Triangulation levelGrid;
+    levelGrid.setInputGrid(0, 0, 0, 1, 1, 1, counts[0], counts[1], counts[2]);
+    levelGrid.preprocessVertexNeighbors();
+    levelGrid.preprocessVertexStars();
+
+    std::vector<SimplexId> inputIds(vertexNumber), previousIds(vertexNumber);
+    std::vector<scalarType> levelScalars(vertexNumber);
+    std::vector<SimplexId> levelOffsets(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId v = 0; v < vertexNumber; ++v) {
+      const std::array<SimplexId, 3> index{
+        v % counts[0], (v / counts[0]) % counts[1],
+        v / (counts[0] * counts[1])};
+      SimplexId inputId = 0, previousId = 0;
+      for(int i = 2; i >= 0; --i) {
+        const SimplexId p
+          = std::min(index[i] * stride, (SimplexId)dimensions[i] - 1);
+        inputId = inputId * dimensions[i] + p;
+        // vertex of the previous level (even index or last vertex)
+        if(previousId != -1 and level < startingLevel) {
+          if(index[i] % 2 == 0)
+            previousId = previousId * previousCounts[i] + index[i] / 2;
+          else if(index[i] == counts[i] - 1)
+            previousId = previousId * previousCounts[i] + previousCounts[i] - 1;
+          else
+            previousId = -1;
+        }
+      }
+      inputIds[v] = inputId;
+      previousIds[v] = level < startingLevel ? previousId : -1;
+      levelScalars[v] = scalars[inputId];
+      levelOffsets[v] = sosOffsets[inputId];
+    }
+
+    auto isLower = [&levelScalars, &levelOffsets](
+                     const SimplexId a, const SimplexId b) {
+      return levelScalars[a] < levelScalars[b]
+             or (levelScalars[a] == levelScalars[b]
+                 and levelOffsets[a] < levelOffsets[b]);
+    };
+
+    // link edges of the vertices, as pairs of grid directions (from 0 to 26),
+    // for each boundary class of vertex (0: first, 1: inner, 2: last or 3:
+    // single vertex along each axis)
+    auto getDirection = [&counts](const SimplexId v, const SimplexId u) {
+      return (u % counts[0] - v % counts[0] + 1)
+             + 3 * ((u / counts[0]) % counts[1] - (v / counts[0]) % counts[1]
+                    + 1)
+             + 9 * (u / (counts[0] * counts[1]) - v / (counts[0] * counts[1])
+                    + 1);
+    };
+    auto getBoundaryClass = [&counts](const SimplexId v) {
+      const std::array<SimplexId, 3> index{
+        v % counts[0], (v / counts[0]) % counts[1],
+        v / (counts[0] * counts[1])};
+      int boundaryClass = 0;
+      for(int i = 2; i >= 0; --i) {
+        const int c = counts[i] == 1                ? 3
+                      : index[i] == 0               ? 0
+                      : index[i] == counts[i] - 1 ? 2
+                                                    : 1;
+        boundaryClass = 4 * boundaryClass + c;
+      }
+      return boundaryClass;
+    };
+    std::vector<std::vector<std::pair<int, int>>> linkEdges(64);
+    for(SimplexId k = 0; k < std::min(counts[2], (SimplexId)3); ++k) {
+      for(SimplexId j = 0; j < std::min(counts[1], (SimplexId)3); ++j) {
+        for(SimplexId i = 0; i < std::min(counts[0], (SimplexId)3); ++i) {
+          // representative of each class: first, second or last index
+          const SimplexId v
+            = (i == 2 ? counts[0] - 1 : i)
+              + counts[0]
+                  * ((j == 2 ? counts[1] - 1 : j)
+                     + counts[1] * (k == 2 ? counts[2] - 1 : k));
+          auto &edges = linkEdges[getBoundaryClass(v)];
+          if(!edges.empty())
+            continue;
+          const SimplexId starNumber = levelGrid.getVertexStarNumber(v);
+          for(SimplexId c = 0; c < starNumber; ++c) {
+            SimplexId cellId = -1;
+            levelGrid.getVertexStar(v, c, cellId);
+            const int cellSize = levelGrid.getCellVertexNumber(cellId);
+            for(int a = 0; a < cellSize; ++a) {
+              for(int b = a + 1; b < cellSize; ++b) {
+                SimplexId va = -1, vb = -1;
+                levelGrid.getCellVertex(cellId, a, va);
+                levelGrid.getCellVertex(cellId, b, vb);
+                if(va != v and vb != v) {
+                  const int da = getDirection(v, va);
+                  const int db = getDirection(v, vb);
+                  edges.emplace_back(std::min(da, db), std::max(da, db));
+                }
+              }
+            }
+          }
+          std::sort(edges.begin(), edges.end());
+          edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        }
+      }
+    }
+
+    // classification of the vertices (number of lower and upper link
+    // components), reused from the previous level if the link signature is
+    // unchanged (the link of a vertex at a level maps to its link at the
+    // previous level, direction by direction), and steepest descending and
+    // ascending neighbors
+    std::vector<uint32_t> masks(vertexNumber);
+    std::vector<char> types(vertexNumber);
+    std::vector<SimplexId> descents(vertexNumber), ascents(vertexNumber);
+    SimplexId reusedNumber = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(+ : reusedNumber)
+#endif
+    for(SimplexId v = 0; v < vertexNumber; ++v) {
+      uint32_t mask = 0;
+      int lowerNumber = 0, upperNumber = 0;
+      descents[v] = v;
+      ascents[v] = v;
+      const SimplexId neighborNumber = levelGrid.getVertexNeighborNumber(v);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId u = -1;
+        levelGrid.getVertexNeighbor(v, j, u);
+        if(isLower(u, v)) {
+          if(isLower(u, descents[v]))
+            descents[v] = u;
+          ++lowerNumber;
+        } else {
+          if(isLower(ascents[v], u))
+            ascents[v] = u;
+          mask |= 1u << getDirection(v, u);
+          ++upperNumber;
+        }
+      }
+      masks[v] = mask;
+
+      const SimplexId previousId = previousIds[v];
+      if(previousId != -1 and previousMasks[previousId] == mask) {
+        types[v] = previousTypes[previousId];
+        ++reusedNumber;
+        continue;
+      }
+
+      types[v] = 0;
+      if(descents[v] == v or ascents[v] == v)
+        continue;
+
+      // union-find on the directions of the link, lower and upper parts
+      std::array<int, 27> parents;
+      for(int d = 0; d < 27; ++d)
+        parents[d] = d;
+      auto findDirection = [&parents](int d) {
+        while(parents[d] != d)
+          d = parents[d] = parents[parents[d]];
+        return d;
+      };
+      for(const auto &e : linkEdges[getBoundaryClass(v)]) {
+        const bool isUpper0 = (mask >> e.first) & 1;
+        const bool isUpper1 = (mask >> e.second) & 1;
+        if(isUpper0 != isUpper1)
+          continue;
+        const int r0 = findDirection(e.first);
+        const int r1 = findDirection(e.second);
+        if(r0 == r1)
+          continue;
+        parents[r0] = r1;
+        if(isUpper0)
+          --upperNumber;
+        else
+          --lowerNumber;
+      }
+      types[v] = (lowerNumber > 1 ? 1 : 0) | (upperNumber > 1 ? 2 : 0);
+    }
+
+    jumpPointers(descents);
+    jumpPointers(ascents);
+
+    std::vector<SimplexId> joinSaddles, splitSaddles;
+    for(SimplexId v = 0; v < vertexNumber; ++v) {
+      if(types[v] & 1)
+        joinSaddles.push_back(v);
+      if(types[v] & 2)
+        splitSaddles.push_back(v);
+    }
+
+    // (birth, death, pair type) triplets on the sub-grid
+    std::vector<std::tuple<SimplexId, SimplexId, SimplexId>> joinPairs,
+      splitPairs;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel sections num_threads(threadNumber_)
+#endif
+    {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif
+      {
+        // join saddles in increasing order: the lower neighbors reach the
+        // minima of the merged components, the youngest ones die
+        std::sort(joinSaddles.begin(), joinSaddles.end(), isLower);
+        std::vector<SimplexId> parents(vertexNumber), roots;
+        for(SimplexId v = 0; v < vertexNumber; ++v)
+          parents[v] = v;
+        for(const auto s : joinSaddles) {
+          roots.clear();
+          const SimplexId neighborNumber = levelGrid.getVertexNeighborNumber(s);
+          for(SimplexId j = 0; j < neighborNumber; ++j) {
+            SimplexId u = -1;
+            levelGrid.getVertexNeighbor(s, j, u);
+            if(isLower(u, s))
+              roots.push_back(findRoot(parents, descents[u]));
+          }
+          std::sort(roots.begin(), roots.end(), isLower);
+          roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+          for(size_t j = 1; j < roots.size(); ++j) {
+            parents[roots[j]] = roots[0];
+            joinPairs.emplace_back(roots[j], s, 0);
+          }
+        }
+      }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif
+      {
+        // split saddles in decreasing order, symmetrically
+        std::sort(splitSaddles.begin(), splitSaddles.end(), isLower);
+        std::vector<SimplexId> parents(vertexNumber), roots;
+        for(SimplexId v = 0; v < vertexNumber; ++v)
+          parents[v] = v;
+        for(auto it = splitSaddles.rbegin(); it != splitSaddles.rend(); ++it) {
+          const SimplexId s = *it;
+          roots.clear();
+          const SimplexId neighborNumber = levelGrid.getVertexNeighborNumber(s);
+          for(SimplexId j = 0; j < neighborNumber; ++j) {
+            SimplexId u = -1;
+            levelGrid.getVertexNeighbor(s, j, u);
+            if(isLower(s, u))
+              roots.push_back(findRoot(parents, ascents[u]));
+          }
+          std::sort(roots.begin(), roots.end(), isLower);
+          roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+          for(size_t j = 0; j + 1 < roots.size(); ++j) {
+            parents[roots[j]] = roots.back();
+            splitPairs.emplace_back(s, roots[j], 2);
+          }
+        }
+      }
+    }
+
+    // global pair
+    SimplexId globalMin = 0, globalMax = 0;
+    for(SimplexId v = 1; v < vertexNumber; ++v) {
+      if(isLower(v, globalMin))
+        globalMin = v;
+      if(isLower(globalMax, v))
+        globalMax = v;
+    }
+    joinPairs.insert(joinPairs.end(), splitPairs.begin(), splitPairs.end());
+    joinPairs.emplace_back(globalMin, globalMax, 0);
+
+    CTDiagram.resize(joinPairs.size());
+    for(size_t i = 0; i < joinPairs.size(); ++i) {
+      const SimplexId v0 = inputIds[std::get<0>(joinPairs[i])];
+      const SimplexId v1 = inputIds[std::get<1>(joinPairs[i])];
+      const SimplexId pairType = std::get<2>(joinPairs[i]);
+      ttk::CriticalType t0 = ttk::CriticalType::Local_minimum;
+      ttk::CriticalType t1 = ttk::CriticalType::Saddle1;
+      if(pairType == 2) {
+        t0 = ttk::CriticalType::Saddle2;
+        t1 = ttk::CriticalType::Local_maximum;
+      }
+      if(i == joinPairs.size() - 1)
+        t1 = ttk::CriticalType::Local_maximum;
+      CTDiagram[i]
+        = std::make_tuple(v0, t0, v1, t1, scalars[v1] - scalars[v0], pairType);
+    }
+
+    if(inputOrder_)
+      sortPersistenceDiagram(
+        CTDiagram, static_cast<const SimplexId *>(inputOrder_));
+    else
+      sortPersistenceDiagram(CTDiagram, scalars, offsets);
+
+    {
+      std::stringstream msg;
+      msg << "[PersistenceDiagram] Level " << level << " (" << counts[0]
+          << "x" << counts[1] << "x" << counts[2] << "): " << CTDiagram.size()
+          << " pairs, bottleneck error <= " << errorBounds[level] << ", "
+          << reusedNumber << " vertex classification(s) reused, "
+          << levelTimer.getElapsedTime() << " s." << std::endl;
+      dMsg(std::cout, msg.str(), infoMsg);
+    }
+
+    if(progressiveSink_) {
+      const int ret = progressiveSink_(level, errorBounds[level]);
+      if(ret)
+        return ret;
+    }
+
+    previousCounts = counts;
+    previousMasks.swap(masks);
+    previousTypes.swap(types);
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[PersistenceDiagram] Progressive diagram computed in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
 
   return 0;
 }
@@ -19,6 +19,8 @@
 //
 #include <KDTree.h>
 //
+#include <MPIUtils.h>
+//
 #include <limits>
 //
 #include <PersistenceDiagramBarycenter.h>
@@ -43,6 +45,7 @@ namespace ttk {
       deterministic_ = false;
       epsilon_decreases_ = true;
       early_stoppage_ = true;
+      use_mpi_ = false;
     };
 
     ~PDBarycenter(){};
@@ -68,24 +71,33 @@ namespace ttk {
     dataType getMaxPersistence();
     dataType getLowestPersistence();
     dataType getMinimalPrice(int i);
-    std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> getKDTree();
+    void buildKDTree(KDTree<dataType> &kdt);
 
     void runMatching(dataType *total_cost,
                      dataType epsilon,
                      std::vector<int> sizes,
                      KDTree<dataType> *kdt,
-                     std::vector<KDTree<dataType> *> *correspondance_kdt_map,
                      std::vector<dataType> *min_diag_price,
                      std::vector<dataType> *min_price,
                      std::vector<std::vector<matchingTuple>> *all_matchings,
                      bool use_kdt,
                      int compute_only_distance);
 
+    /// Gather on every process the results of the auctions run by the other
+    /// processes in runMatching() (distributed mode): costs, prices,
+    /// precisions and matchings of the diagrams of their blocks.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int gatherMatchings(const int &begin,
+                        const int &end,
+                        std::vector<dataType> &costs,
+                        std::vector<dataType> *min_diag_price,
+                        std::vector<dataType> *min_price,
+                        std::vector<std::vector<matchingTuple>> *all_matchings);
+
     void runMatchingAuction(
       dataType *total_cost,
       std::vector<int> sizes,
       KDTree<dataType> *kdt,
-      std::vector<KDTree<dataType> *> *correspondance_kdt_map,
       std::vector<dataType> *min_diag_price,
       std::vector<std::vector<matchingTuple>> *all_matchings,
       bool use_kdt);
@@ -158,6 +170,12 @@ namespace ttk {
       use_progressive_ = use_progressive;
     }
 
+    /// Distribute the auctions of runMatching() over the MPI processes (the
+    /// inputs being replicated on every process).
+    inline void setUseMPI(const bool use_mpi) {
+      use_mpi_ = use_mpi;
+    }
+
     inline void setTimeLimit(const double time_limit) {
       time_limit_ = time_limit;
     }
@@ -249,6 +267,7 @@ namespace ttk {
     int numberOfInputs_;
     int threadNumber_;
     bool use_progressive_;
+    bool use_mpi_;
     double time_limit_;
     float epsilon_min_;
     std::vector<std::vector<diagramTuple>> *inputDiagrams_;
@@ -51,25 +51,38 @@ void PDBarycenter<dataType>::runMatching(
   dataType epsilon,
   std::vector<int> sizes,
   KDTree<dataType> *kdt,
-  std::vector<KDTree<dataType> *> *correspondance_kdt_map,
   std::vector<dataType> *min_diag_price,
   std::vector<dataType> *min_price,
   std::vector<std::vector<matchingTuple>> *all_matchings,
   bool use_kdt,
   int actual_distance) {
   Timer time_matchings;
+
+  // in the distributed mode, each process runs the auctions of a block of
+  // diagrams
+  int rank = 0, size = 1;
+  if(use_mpi_)
+    MPIUtils::getPartition(rank, size);
+  int begin, end;
+  MPIUtils::getBlock(numberOfInputs_, rank, size, begin, end);
+
+  // the costs are summed in the order of the diagrams, so that the total
+  // cost depends neither on the number of threads nor on the number of
+  // processes
+  std::vector<dataType> costs(numberOfInputs_);
+
 #ifdef TTK_ENABLE_OPENMP
   omp_set_num_threads(threadNumber_);
 #pragma omp parallel for schedule(dynamic, 1)
 #endif
 
-  for(int i = 0; i < numberOfInputs_; i++) {
+  for(int i = begin; i < end; i++) {
     // cout<<"input "<<i<<" sizes : "<<current_bidder_diagrams_.size()<<"
     // "<<barycenter_goods_.size()<<" "<<min_diag_price->size()<<endl;
     Auction<dataType> auction = Auction<dataType>(
       &current_bidder_diagrams_.at(i), &barycenter_goods_.at(i), wasserstein_,
-      geometrical_factor_, lambda_, 0.01, kdt, *correspondance_kdt_map, epsilon,
-      min_diag_price->at(i), use_kdt);
+      geometrical_factor_, lambda_, 0.01, kdt, epsilon, min_diag_price->at(i),
+      use_kdt);
     // cout<<"\n RUN MATCHINGS : "<<i<<endl;
     // cout<<use_kdt<<endl;
     // cout<<epsilon<<endl;
@@ -88,9 +101,9 @@ void PDBarycenter<dataType>::runMatching(
     dataType cost = auction.getMatchingsAndDistance(&matchings, true);
     all_matchings->at(i) = matchings;
     if(actual_distance) {
-      (*total_cost) += cost;
+      costs[i] = cost;
     } else {
-      (*total_cost) += cost * cost;
+      costs[i] = cost * cost;
     }
 
     // cout<<auction.getMinimalDiagonalPrice()<<endl;
@@ -113,6 +126,14 @@ void PDBarycenter<dataType>::runMatching(
     // TODO do this inside the auction !
     current_bidder_diagrams_[i].bidders_.resize(sizes[i]);
   }
+
+  if(size > 1) {
+    gatherMatchings(
+      begin, end, costs, min_diag_price, min_price, all_matchings);
+  }
+  for(int i = 0; i < numberOfInputs_; i++) {
+    (*total_cost) += costs[i];
+  }
   // cout<<endl;
   /* print matchings
           for(long unsigned int i=0; i<(*all_matchings).size(); i++){
@@ -126,12 +147,90 @@ void PDBarycenter<dataType>::runMatching(
   // cout<<time_matchings.getElapsedTime()<<endl;
 }
 
+template <typename dataType>
+int PDBarycenter<dataType>::gatherMatchings(
+  const int &begin,
+  const int &end,
+  std::vector<dataType> &costs,
+  std::vector<dataType> *min_diag_price,
+  std::vector<dataType> *min_price,
+  std::vector<std::vector<matchingTuple>> *all_matchings) {
+
+  // Pack the results of the local diagrams: cost, minimal prices and
+  // precision, then the diagonal prices of the bidders, the prices and
+  // owners of the goods and the matchings. Only the first bidders (the
+  // diagonal bidders being removed after the auctions) are exchanged.
+  std::vector<double> localBuffer;
+  for(int i = begin; i < end; i++) {
+    localBuffer.push_back(costs[i]);
+    localBuffer.push_back(min_diag_price->at(i));
+    localBuffer.push_back(min_price->at(i));
+    localBuffer.push_back(precision_[i]);
+    for(int j = 0; j < current_bidder_diagrams_[i].size(); j++) {
+      localBuffer.push_back(current_bidder_diagrams_[i].get(j).diagonal_price_);
+    }
+    for(int j = 0; j < barycenter_goods_[i].size(); j++) {
+      Good<dataType> &g = barycenter_goods_[i].get(j);
+      localBuffer.push_back(g.getPrice());
+      localBuffer.push_back(g.getOwner());
+    }
+    localBuffer.push_back(all_matchings->at(i).size());
+    for(const auto &m : all_matchings->at(i)) {
+      localBuffer.push_back(std::get<0>(m));
+      localBuffer.push_back(std::get<1>(m));
+      localBuffer.push_back(std::get<2>(m));
+    }
+  }
+
+  std::vector<double> buffer;
+  std::vector<int> offsets;
+  if(MPIUtils::allGather(localBuffer, buffer, &offsets)) {
+    return -1;
+  }
+
+  // unpack the results of the other processes, whose blocks are in rank
+  // order
+  int rank, size;
+  MPIUtils::getPartition(rank, size);
+  size_t pos = 0;
+  for(int r = 0; r < size; r++) {
+    if(r == rank) {
+      pos = offsets[r + 1];
+      continue;
+    }
+    int r_begin, r_end;
+    MPIUtils::getBlock(numberOfInputs_, r, size, r_begin, r_end);
+    for(int i = r_begin; i < r_end; i++) {
+      costs[i] = buffer[pos++];
+      min_diag_price->at(i) = buffer[pos++];
+      min_price->at(i) = buffer[pos++];
+      precision_[i] = buffer[pos++];
+      for(int j = 0; j < current_bidder_diagrams_[i].size(); j++) {
+        current_bidder_diagrams_[i].get(j).setDiagonalPrice(buffer[pos++]);
+      }
+      for(int j = 0; j < barycenter_goods_[i].size(); j++) {
+        Good<dataType> &g = barycenter_goods_[i].get(j);
+        g.setPrice(buffer[pos++]);
+        g.setOwner(buffer[pos++]);
+      }
+      std::vector<matchingTuple> &matchings = all_matchings->at(i);
+      matchings.resize(buffer[pos++]);
+      for(auto &m : matchings) {
+        std::get<0>(m) = buffer[pos++];
+        std::get<1>(m) = buffer[pos++];
+        std::get<2>(m) = buffer[pos++];
+      }
+    }
+  }
+
+  return 0;
+}
+
 template <typename dataType>
 void PDBarycenter<dataType>::runMatchingAuction(
   dataType *total_cost,
   std::vector<int> sizes,
   KDTree<dataType> *kdt,
-  std::vector<KDTree<dataType> *> *correspondance_kdt_map,
   std::vector<dataType> *min_diag_price,
   std::vector<std::vector<matchingTuple>> *all_matchings,
   bool use_kdt) {
@@ -142,8 +241,7 @@ void PDBarycenter<dataType>::runMatchingAuction(
   for(int i = 0; i < numberOfInputs_; i++) {
     Auction<dataType> auction = Auction<dataType>(
       &current_bidder_diagrams_[i], &barycenter_goods_[i], wasserstein_,
-      geometrical_factor_, lambda_, 0.01, kdt, *correspondance_kdt_map,
-      (*min_diag_price)[i], use_kdt);
+      geometrical_factor_, lambda_, 0.01, kdt, (*min_diag_price)[i], use_kdt);
     std::vector<matchingTuple> matchings;
     dataType cost = auction.run(&matchings);
     all_matchings->at(i) = matchings;
@@ -650,10 +748,8 @@ void PDBarycenter<dataType>::setInitialBarycenter(dataType min_persistence) {
 }
 
 template <typename dataType>
-std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>>
-  PDBarycenter<dataType>::getKDTree() {
+void PDBarycenter<dataType>::buildKDTree(KDTree<dataType> &kdt) {
   Timer tm;
-  KDTree<dataType> *kdt = new KDTree<dataType>(true, wasserstein_);
 
   const int dimension = geometrical_factor_ >= 1 ? 2 : 5;
 
@@ -679,15 +775,11 @@ std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>>
       weights[idx].push_back(g.getPrice());
     }
   }
-  // Correspondance map : position in barycenter_goods_ --> KDT node
-
-  std::vector<KDTree<dataType> *> correspondance_kdt_map
-    = kdt->build(coordinates.data(), barycenter_goods_[0].size(), dimension,
-                 weights, barycenter_goods_.size());
+  kdt.build(coordinates.data(), barycenter_goods_[0].size(), dimension,
+            weights, barycenter_goods_.size());
   if(debugLevel_ > 3)
     std::cout << "[Building KD-Tree] Time elapsed : " << tm.getElapsedTime()
               << " s." << std::endl;
-  return std::make_pair(kdt, correspondance_kdt_map);
 }
 
 // template <typename dataType>
@@ -836,21 +928,20 @@ std::vector<std::vector<matchingTuple>>
   bool finished = false;
   dataType total_cost;
 
+  // The KD-tree buffers are reused by each iteration
+  KDTree<dataType> kdt(wasserstein_);
+
   while(!finished) {
     Timer tm;
 
     n_iterations += 1;
 
-    std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
     bool use_kdt = false;
-    // If the barycenter is empty, do not compute the kdt (or it will crash :/)
-    // TODO Fix KDTree to handle empty inputs...
+    // If the barycenter is empty, do not compute the kdt
     if(barycenter_goods_[0].size() > 0) {
-      pair = this->getKDTree();
+      this->buildKDTree(kdt);
       use_kdt = true;
     }
-    KDTree<dataType> *kdt = pair.first;
-    std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
     std::vector<std::vector<matchingTuple>> all_matchings(numberOfInputs_);
     std::vector<int> sizes(numberOfInputs_);
@@ -869,8 +960,8 @@ std::vector<std::vector<matchingTuple>>
       barycenter.push_back(t);
     }
 
-    runMatchingAuction(&total_cost, sizes, kdt, &correspondance_kdt_map,
-                       &min_diag_price, &all_matchings, use_kdt);
+    runMatchingAuction(
+      &total_cost, sizes, &kdt, &min_diag_price, &all_matchings, use_kdt);
 
     std::cout << "[PersistenceDiagramsBarycenter] Barycenter cost : "
               << total_cost << std::endl;
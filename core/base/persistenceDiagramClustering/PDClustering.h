@@ -19,6 +19,8 @@
 //
 #include <KDTree.h>
 //
+#include <MPIUtils.h>
+//
 #include <limits>
 //
 
@@ -49,6 +51,7 @@ namespace ttk {
       cost_sad_ = 0;
       UseDeltaLim_ = false;
       distanceWritingOptions_ = 0;
+      use_mpi_ = false;
     };
 
     ~PDClustering(){};
@@ -106,6 +109,16 @@ namespace ttk {
       std::vector<int> min_points_to_add,
       bool add_points_to_barycenter);
 
+    /// Get the contiguous block [\p begin, \p end) of the diagrams handled by
+    /// the current process (all the diagrams if MPI is not used).
+    /// \return Returns the number of processes.
+    int getInputBlock(int &begin, int &end);
+    /// Gather on every process the values computed by the other processes
+    /// for the diagrams of their blocks (\p width consecutive values per
+    /// diagram).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int gatherBlocks(std::vector<dataType> &values, const int &width);
+
     std::vector<std::vector<dataType>> getDistanceMatrix();
     void getCentroidDistanceMatrix();
 
@@ -172,6 +185,16 @@ namespace ttk {
       use_progressive_ = use_progressive;
     }
 
+    /// Distribute the distance computations and the auctions over the MPI
+    /// processes (each process handling a contiguous block of diagrams).
+    /// The inputs must be replicated on every process and the outputs are
+    /// the same on every process. The per-diagram results being gathered
+    /// and reduced in the order of the diagrams, the outputs match those of
+    /// a single process run.
+    inline void setUseMPI(const bool use_mpi) {
+      use_mpi_ = use_mpi;
+    }
+
     inline void setKMeanspp(const bool use_kmeanspp) {
       use_kmeanspp_ = use_kmeanspp;
     }
@@ -280,6 +303,7 @@ namespace ttk {
     int numberOfInputs_;
     int threadNumber_;
     bool use_progressive_;
+    bool use_mpi_;
     bool use_accelerated_;
     bool use_kmeanspp_;
     bool use_kdtree_;
@@ -92,6 +92,14 @@ std::vector<int> PDClustering<dataType>::execute(
     n_iterations_ = 0;
     double total_time = 0;
 
+    // in the distributed mode, the random draws (rand()) of all the
+    // processes must be the same
+    if(use_mpi_ && !deterministic_) {
+      unsigned int seed = rand();
+      MPIUtils::broadcast(seed);
+      srand(seed);
+    }
+
     // dataType cost = std::numeric_limits<dataType>::max();
     setBidderDiagrams();
     cost_ = std::numeric_limits<dataType>::max();
@@ -481,13 +489,18 @@ std::vector<int> PDClustering<dataType>::execute(
       // dataType real_cost = 0;
       // Timer t_real_cost;
       // real_cost = computeRealCost();
-      total_time
-        += t_inside.getElapsedTime(); // - t_real_cost.getElapsedTime();
+      double iteration_time = t_inside.getElapsedTime();
+      // in the distributed mode, the timings of the process 0 drive all the
+      // processes (they must stop at the same iteration)
+      if(use_mpi_) {
+        MPIUtils::broadcast(iteration_time);
+      }
+      total_time += iteration_time; // - t_real_cost.getElapsedTime();
       // cout<<"SO FAR TIME : "<<total_time<<endl;
       // cout<<"SO FAR REAL COST : "<<real_cost<<endl;
       // std::cout<<"total_cost_ "<<cost_<<"times "<<total_time<<"
       // "<<t_inside.getElapsedTime()<<" "<<time_limit_<<std::endl;
-      if(total_time + t_inside.getElapsedTime() > 0.9 * time_limit_) {
+      if(total_time + iteration_time > 0.9 * time_limit_) {
         min_cost_min = cost_min_;
         min_cost_sad = cost_sad_;
         min_cost_max = cost_max_;
@@ -1114,7 +1127,11 @@ void PDClustering<dataType>::initializeCentroidsKMeanspp() {
     dataType maximal_distance = 0;
     int candidate_centroid = 0;
 
-    for(int i = 0; i < numberOfInputs_; i++) {
+    // each process computes the distances of its block (distributed mode)
+    int begin, end;
+    getInputBlock(begin, end);
+
+    for(int i = begin; i < end; i++) {
       // cout<<"test1"<<i<<endl;
       min_distance_to_centroid[i] = std::numeric_limits<dataType>::max();
       if(std::find(indexes_clusters.begin(), indexes_clusters.end(), i)
@@ -1158,6 +1175,10 @@ void PDClustering<dataType>::initializeCentroidsKMeanspp() {
           // cout<<"test "<<j<<endl;
         }
       }
+    }
+    gatherBlocks(min_distance_to_centroid, 1);
+
+    for(int i = 0; i < numberOfInputs_; i++) {
       probabilities[i] = pow(min_distance_to_centroid[i], 2);
 
       // The following block is useful in case of need for a deterministic
@@ -1176,6 +1197,10 @@ void PDClustering<dataType>::initializeCentroidsKMeanspp() {
 
     if(!deterministic_) {
       candidate_centroid = distribution(gen);
+      // the draw of the process 0 is used by all the processes
+      if(use_mpi_) {
+        MPIUtils::broadcast(candidate_centroid);
+      }
     }
 
     indexes_clusters.push_back(candidate_centroid);
@@ -1232,11 +1257,47 @@ void PDClustering<dataType>::initializeAcceleratedKMeans() {
   return;
 }
 
+template <typename dataType>
+int PDClustering<dataType>::getInputBlock(int &begin, int &end) {
+  int rank = 0, size = 1;
+  if(use_mpi_) {
+    MPIUtils::getPartition(rank, size);
+  }
+  MPIUtils::getBlock(numberOfInputs_, rank, size, begin, end);
+  return size;
+}
+
+template <typename dataType>
+int PDClustering<dataType>::gatherBlocks(std::vector<dataType> &values,
+                                         const int &width) {
+  int begin, end;
+  if(getInputBlock(begin, end) == 1) {
+    return 0;
+  }
+
+  std::vector<double> localBuffer(values.begin() + (size_t)begin * width,
+                                  values.begin() + (size_t)end * width);
+  std::vector<double> buffer;
+  if(MPIUtils::allGather(localBuffer, buffer)) {
+    return -1;
+  }
+
+  // the blocks being contiguous and gathered in rank order, the values are
+  // in the order of the diagrams
+  for(size_t i = 0; i < values.size(); ++i) {
+    values[i] = buffer[i];
+  }
+  return 0;
+}
+
 template <typename dataType>
 std::vector<std::vector<dataType>> PDClustering<dataType>::getDistanceMatrix() {
-  std::vector<std::vector<dataType>> D(numberOfInputs_);
+  // each process computes the rows of its block (distributed mode)
+  std::vector<dataType> distances((size_t)numberOfInputs_ * k_);
+  int begin, end;
+  getInputBlock(begin, end);
 
-  for(int i = 0; i < numberOfInputs_; ++i) {
+  for(int i = begin; i < end; ++i) {
     BidderDiagram<dataType> D1_min, D1_sad, D1_max;
     if(do_min_) {
       D1_min = diagramWithZeroPrices(current_bidder_diagrams_min_[i]);
@@ -1262,9 +1323,16 @@ std::vector<std::vector<dataType>> PDClustering<dataType>::getDistanceMatrix() {
         D2_max = centroids_max_[c];
         distance += computeDistance(D1_max, D2_max, 0.01);
       }
-      D[i].push_back(distance);
+      distances[(size_t)i * k_ + c] = distance;
     }
   }
+  gatherBlocks(distances, k_);
+
+  std::vector<std::vector<dataType>> D(numberOfInputs_);
+  for(int i = 0; i < numberOfInputs_; ++i) {
+    D[i].assign(distances.begin() + (size_t)i * k_,
+                distances.begin() + (size_t)(i + 1) * k_);
+  }
   return D;
 }
 
@@ -1426,7 +1494,30 @@ void PDClustering<dataType>::acceleratedUpdateClusters() {
   bool do_sad = original_dos[1];
   bool do_max = original_dos[2];
 
+  // Step 2, assign the diagrams not yet assigned to a cluster (the prices
+  // of their centroids are reset in step 4)
+  std::vector<int> reassigned(numberOfInputs_, 0);
   for(int i = 0; i < numberOfInputs_; ++i) {
+    if(inv_clustering_[i] == -1) {
+      // If not yet assigned, assign it first to a random cluster
+
+      if(deterministic_) {
+        inv_clustering_[i] = i % k_;
+      } else {
+        std::cout << " - ASSIGNED TO A RANDOM CLUSTER " << '\n';
+        inv_clustering_[i] = rand() % (k_);
+      }
+
+      r_[i] = true;
+      reassigned[i] = 1;
+    }
+  }
+
+  // each process handles the diagrams of its block (distributed mode)
+  int begin, end;
+  const int process_number = getInputBlock(begin, end);
+
+  for(int i = begin; i < end; ++i) {
     // Step 3 find potential changes of clusters
     BidderDiagram<dataType> D1_min, D1_sad, D1_max;
     if(do_min) {
@@ -1440,31 +1531,6 @@ void PDClustering<dataType>::acceleratedUpdateClusters() {
     }
 
     for(int c = 0; c < k_; ++c) {
-      if(inv_clustering_[i] == -1) {
-        // If not yet assigned, assign it first to a random cluster
-
-        if(deterministic_) {
-          inv_clustering_[i] = i % k_;
-        } else {
-          std::cout << " - ASSIGNED TO A RANDOM CLUSTER " << '\n';
-          inv_clustering_[i] = rand() % (k_);
-        }
-
-        r_[i] = true;
-        if(do_min) {
-          centroids_with_price_min_[i]
-            = centroidWithZeroPrices(centroids_min_[inv_clustering_[i]]);
-        }
-        if(do_sad) {
-          centroids_with_price_saddle_[i]
-            = centroidWithZeroPrices(centroids_saddle_[inv_clustering_[i]]);
-        }
-        if(do_max) {
-          centroids_with_price_max_[i]
-            = centroidWithZeroPrices(centroids_max_[inv_clustering_[i]]);
-        }
-      }
-
       if(c != inv_clustering_[i] && u_[i] > l_[i][c]
          && u_[i] > 0.5 * d_[inv_clustering_[i]][c]) {
         // Step 3a, If necessary, recompute the distance to centroid
@@ -1519,29 +1585,62 @@ void PDClustering<dataType>::acceleratedUpdateClusters() {
           // TODO Prices are lost here... If distance<self.u[i], we should keep
           // the prices
           if(distance < u_[i]) {
-            // Changing cluster
-            resetDosToOriginalValues();
-            barycenter_inputs_reset_flag = true;
+            // Changing cluster (the prices are reset in step 4)
             u_[i] = distance;
             inv_clustering_[i] = c;
-
-            if(do_min) {
-              centroids_with_price_min_[i]
-                = centroidWithZeroPrices(centroids_min_[c]);
-            }
-            if(do_sad) {
-              centroids_with_price_saddle_[i]
-                = centroidWithZeroPrices(centroids_saddle_[c]);
-            }
-            if(do_max) {
-              centroids_with_price_max_[i]
-                = centroidWithZeroPrices(centroids_max_[c]);
-            }
+            reassigned[i] = 2;
           }
         }
       }
     }
   }
+
+  // Gather the bounds and the clusters of the diagrams of the other
+  // processes: upper bound, recomputation flag, cluster, reassignment and
+  // lower bounds of each diagram.
+  if(process_number > 1) {
+    const int width = k_ + 4;
+    std::vector<dataType> states((size_t)numberOfInputs_ * width);
+    for(int i = begin; i < end; ++i) {
+      dataType *state = &states[(size_t)i * width];
+      state[0] = u_[i];
+      state[1] = r_[i];
+      state[2] = inv_clustering_[i];
+      state[3] = reassigned[i];
+      std::copy(l_[i].begin(), l_[i].end(), state + 4);
+    }
+    gatherBlocks(states, width);
+    for(int i = 0; i < numberOfInputs_; ++i) {
+      const dataType *state = &states[(size_t)i * width];
+      u_[i] = state[0];
+      r_[i] = state[1];
+      inv_clustering_[i] = state[2];
+      reassigned[i] = state[3];
+      std::copy(state + 4, state + width, l_[i].begin());
+    }
+  }
+
+  // Step 4, reset the prices of the centroids of the reassigned diagrams
+  for(int i = 0; i < numberOfInputs_; ++i) {
+    if(reassigned[i] == 2) {
+      resetDosToOriginalValues();
+      barycenter_inputs_reset_flag = true;
+    }
+    if(reassigned[i]) {
+      if(do_min) {
+        centroids_with_price_min_[i]
+          = centroidWithZeroPrices(centroids_min_[inv_clustering_[i]]);
+      }
+      if(do_sad) {
+        centroids_with_price_saddle_[i]
+          = centroidWithZeroPrices(centroids_saddle_[inv_clustering_[i]]);
+      }
+      if(do_max) {
+        centroids_with_price_max_[i]
+          = centroidWithZeroPrices(centroids_max_[inv_clustering_[i]]);
+      }
+    }
+  }
   invertInverseClusters();
   for(int c = 0; c < k_; ++c) {
     if(clustering_[c].size() == 0) {
@@ -1862,14 +1961,12 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         //     min_price[i] = 0;
         // }
         // cout << "min diag prices and all done" << endl;
-        std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+        KDTree<dataType> kdt(wasserstein_);
         bool use_kdt = false;
         if(barycenter_computer_min_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_min_[c].getKDTree();
+          barycenter_computer_min_[c].buildKDTree(kdt);
           use_kdt = true;
         }
-        KDTree<dataType> *kdt = pair.first;
-        std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
         // cout<<"size of bidders :
         // "<<barycenter_computer_min_[c].getCurrentBidders().size()<<endl;
@@ -1878,9 +1975,8 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // "<<time_preprocess_bary.getElapsedTime()<<endl; cout<<"time_matchings
         // min "; cout<<"run matchings "<<endl;
         barycenter_computer_min_[c].runMatching(
-          &total_cost, epsilon_[0], sizes, kdt, &correspondance_kdt_map,
-          &(min_diag_price->at(0)), &(min_price->at(0)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[0], sizes, &kdt, &(min_diag_price->at(0)),
+          &(min_price->at(0)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][0][ii].resize(
             all_matchings[ii].size());
@@ -1938,7 +2034,6 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         }
         // cout<<"heredend"<<endl;
 
-        delete kdt;
       }
 
       // std::cout<<"here 3"<<std::endl;
@@ -1989,20 +2084,17 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         //     min_price[i] = 0;
         // }
 
-        std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+        KDTree<dataType> kdt(wasserstein_);
         bool use_kdt = false;
         if(barycenter_computer_sad_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_sad_[c].getKDTree();
+          barycenter_computer_sad_[c].buildKDTree(kdt);
           use_kdt = true;
         }
-        KDTree<dataType> *kdt = pair.first;
-        std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
         // std::cout<<"sad : run matchings"<<std::endl;
         barycenter_computer_sad_[c].runMatching(
-          &total_cost, epsilon_[1], sizes, kdt, &correspondance_kdt_map,
-          &(min_diag_price->at(1)), &(min_price->at(1)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[1], sizes, &kdt, &(min_diag_price->at(1)),
+          &(min_price->at(1)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][1][ii].resize(
             all_matchings[ii].size());
@@ -2043,7 +2135,6 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
           wasserstein_shift
             += computeDistance(old_centroid, centroids_saddle_[c], 0.01);
 
-        delete kdt;
       }
 
       if(do_max_) {
@@ -2103,15 +2194,13 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // "<<centroids_with_price_max.size()<<"
         // "<<centroids_with_price_max[0].size()<<endl;
 
-        std::pair<KDTree<dataType> *, std::vector<KDTree<dataType> *>> pair;
+        KDTree<dataType> kdt(wasserstein_);
         bool use_kdt = false;
         if(barycenter_computer_max_[c].getCurrentBarycenter()[0].size() > 0) {
-          pair = barycenter_computer_max_[c].getKDTree();
+          barycenter_computer_max_[c].buildKDTree(kdt);
           use_kdt = true;
         }
         // cout<<"here?"<<endl;
-        KDTree<dataType> *kdt = pair.first;
-        std::vector<KDTree<dataType> *> &correspondance_kdt_map = pair.second;
 
         // cout<<"max time_preprocess_bary
         // "<<time_preprocess_bary.getElapsedTime()<<endl; std::cout<<"max : run
@@ -2157,9 +2246,8 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
         // // cout<<"running matchings max"<<endl;
         // cout<<"size centroid "<<centroids_with_price_max[c].size()<<endl;
         barycenter_computer_max_[c].runMatching(
-          &total_cost, epsilon_[2], sizes, kdt, &correspondance_kdt_map,
-          &(min_diag_price->at(2)), &(min_price->at(2)), &(all_matchings),
-          use_kdt, only_matchings);
+          &total_cost, epsilon_[2], sizes, &kdt, &(min_diag_price->at(2)),
+          &(min_price->at(2)), &(all_matchings), use_kdt, only_matchings);
         for(unsigned int ii = 0; ii < all_matchings.size(); ii++) {
           all_matchings_per_type_and_cluster[c][2][ii].resize(
             all_matchings[ii].size());
@@ -2213,11 +2301,6 @@ std::vector<dataType> PDClustering<dataType>::updateCentroidsPosition(
             += computeDistance(old_centroid, centroids_max_[c], 0.01);
           // cout<<"here end"<<endl;
         }
-        delete kdt;
-        // for(unsigned int i_kdt=0; i_kdt<correspondance_kdt_map.size();
-        // i_kdt++){
-        //     delete correspondance_kdt_map[i_kdt];
-        // }
       }
 
       cost_ = cost_min_ + cost_sad_ + cost_max_;
@@ -2735,6 +2818,7 @@ void PDClustering<dataType>::initializeBarycenterComputers(
       // cout << "here2" << endl;
       barycenter_computer_min_[c] = PDBarycenter<dataType>();
       barycenter_computer_min_[c].setThreadNumber(threadNumber_);
+      barycenter_computer_min_[c].setUseMPI(use_mpi_);
       barycenter_computer_min_[c].setWasserstein(wasserstein_);
       barycenter_computer_min_[c].setDiagramType(0);
       barycenter_computer_min_[c].setUseProgressive(false);
@@ -2767,6 +2851,7 @@ void PDClustering<dataType>::initializeBarycenterComputers(
       }
       barycenter_computer_sad_[c] = PDBarycenter<dataType>();
       barycenter_computer_sad_[c].setThreadNumber(threadNumber_);
+      barycenter_computer_sad_[c].setUseMPI(use_mpi_);
       barycenter_computer_sad_[c].setWasserstein(wasserstein_);
       barycenter_computer_sad_[c].setDiagramType(1);
       barycenter_computer_sad_[c].setUseProgressive(false);
@@ -2799,6 +2884,7 @@ void PDClustering<dataType>::initializeBarycenterComputers(
       barycenter_computer_max_[c] = PDBarycenter<dataType>();
       barycenter_computer_max_[c].setDiagrams(inputDiagramsMax_);
       barycenter_computer_max_[c].setThreadNumber(threadNumber_);
+      barycenter_computer_max_[c].setUseMPI(use_mpi_);
       barycenter_computer_max_[c].setWasserstein(wasserstein_);
       barycenter_computer_max_[c].setDiagramType(2);
       barycenter_computer_max_[c].setUseProgressive(false);
@@ -63,6 +63,7 @@ namespace ttk {
       inputData_ = NULL;
       numberOfInputs_ = 0;
       threadNumber_ = 1;
+      use_mpi_ = false;
       debugLevel_ = 2;
     };
 
@@ -100,6 +101,14 @@ namespace ttk {
       use_progressive_ = use_progressive;
     }
 
+    /// Distribute the clustering over the MPI processes (requires
+    /// TTK_ENABLE_MPI). The input diagrams must be replicated on every
+    /// process, the outputs are the same on every process and match those
+    /// of a single process run (see PDClustering::setUseMPI()).
+    inline void setUseMPI(const bool use_mpi) {
+      use_mpi_ = use_mpi;
+    }
+
     inline void setAlpha(const double alpha) {
       alpha_ = alpha;
     }
@@ -170,6 +179,7 @@ namespace ttk {
     void *inputData_; // TODO : std::vector<void*>
     int threadNumber_;
     bool use_progressive_;
+    bool use_mpi_;
     bool use_accelerated_;
     bool use_kmeanspp_;
     double alpha_;
@@ -190,6 +200,10 @@ namespace ttk {
 
     Timer tm;
     {
+      int rank = 0, process_number = 1;
+      if(use_mpi_) {
+        MPIUtils::getPartition(rank, process_number);
+      }
       if(debugLevel_ > 1) {
         std::cout << "[PersistenceDiagramClustering] Clustering "
                   << numberOfInputs_ << " diagrams in " << n_clusters_
@@ -298,7 +312,10 @@ namespace ttk {
       KMeans.setLambda(lambda_);
       KMeans.setDeterministic(deterministic_);
       KMeans.setForceUseOfAlgorithm(forceUseOfAlgorithm_);
-      KMeans.setDebugLevel(debugLevel_);
+      KMeans.setUseMPI(use_mpi_);
+      // all the processes computing the same outputs, only the process 0
+      // reports the progress of the clustering
+      KMeans.setDebugLevel(rank == 0 ? debugLevel_ : 0);
       KMeans.setDeltaLim(deltaLim_);
       KMeans.setUseDeltaLim(useDeltaLim_);
       KMeans.setDistanceWritingOptions(distanceWritingOptions_);
@@ -312,8 +329,11 @@ namespace ttk {
 
       std::stringstream msg;
       msg << "[PersistenceDiagramClustering] processed in "
-          << tm.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
-          << std::endl;
+          << tm.getElapsedTime() << " s. (" << threadNumber_ << " thread(s)";
+      if(process_number > 1) {
+        msg << ", " << process_number << " process(es)";
+      }
+      msg << ")." << std::endl;
       dMsg(std::cout, msg.str(), timeMsg);
 
       /// Reconstruct matchings
@@ -0,0 +1,283 @@
+#include <RawVolume.h>
+
+#ifdef _WIN32
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <windows.h>
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+#include <limits>
+
+using namespace std;
+using namespace ttk;
+
+RawVolume::RawVolume() {
+
+  data_ = nullptr;
+  scalarSize_ = 0;
+  dimensions_[0] = dimensions_[1] = dimensions_[2] = 0;
+
+  mapping_ = nullptr;
+  mappingSize_ = 0;
+  mappingOffset_ = 0;
+
+#ifdef _WIN32
+  fileHandle_ = nullptr;
+  mappingHandle_ = nullptr;
+#endif
+}
+
+RawVolume::~RawVolume() {
+
+  closeFile();
+}
+
+int RawVolume::adviseAccess(const Access &access,
+                            const SimplexId &begin,
+                            const SimplexId &end) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!mapping_)
+    return -1;
+  if((begin < 0) || (begin > getNumberOfVertices()))
+    return -2;
+  if(end > getNumberOfVertices())
+    return -3;
+#endif
+
+#ifdef _WIN32
+  // no equivalent hints
+#else
+  const SimplexId last = (end < 0) ? getNumberOfVertices() : end;
+  if(last <= begin)
+    return 0;
+
+  // madvise() requires page-aligned addresses
+  const size_t pageSize = sysconf(_SC_PAGESIZE);
+  size_t first = mappingOffset_ + (size_t)begin * scalarSize_;
+  const size_t length = mappingOffset_ + (size_t)last * scalarSize_;
+  first -= first % pageSize;
+
+  int advice = MADV_NORMAL;
+  switch(access) {
+    case Access::NORMAL:
+      advice = MADV_NORMAL;
+      break;
+    case Access::RANDOM:
+      advice = MADV_RANDOM;
+      break;
+    case Access::SEQUENTIAL:
+      advice = MADV_SEQUENTIAL;
+      break;
+    case Access::WILL_NEED:
+      advice = MADV_WILLNEED;
+      break;
+    case Access::DONT_NEED:
+      advice = MADV_DONTNEED;
+      break;
+  }
+
+  if(madvise((char *)mapping_ + first, length - first, advice)) {
+    stringstream msg;
+    msg << "[RawVolume] Could not pass the access hint to the system."
+        << endl;
+    dMsg(cerr, msg.str(), detailedInfoMsg);
+    return -4;
+  }
+#endif
+
+  return 0;
+}
+
+int RawVolume::closeFile() {
+
+  if(!mapping_)
+    return 0;
+
+#ifdef _WIN32
+  UnmapViewOfFile(mapping_);
+  CloseHandle(mappingHandle_);
+  CloseHandle(fileHandle_);
+  mappingHandle_ = nullptr;
+  fileHandle_ = nullptr;
+#else
+  munmap(mapping_, mappingSize_);
+#endif
+
+  data_ = nullptr;
+  mapping_ = nullptr;
+  mappingSize_ = 0;
+  mappingOffset_ = 0;
+
+  return 0;
+}
+
+int RawVolume::openFile(const string &fileName,
+                        const SimplexId &xDim,
+                        const SimplexId &yDim,
+                        const SimplexId &zDim,
+                        const size_t &scalarSize,
+                        const size_t &headerSize) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((xDim < 1) || (yDim < 1) || (zDim < 1) || (!scalarSize))
+    return -1;
+#endif
+
+  // number of vertices and of cells (1, 2 or 6 per grid cube depending on
+  // the dimension of the grid) of the implicit triangulation
+  const SimplexId dimensions[3] = {xDim, yDim, zDim};
+  const long double maxNumber = numeric_limits<SimplexId>::max();
+  long double vertexNumber = 1, cubeNumber = 1;
+  int dimensionNumber = 0;
+  for(int i = 0; i < 3; i++) {
+    vertexNumber *= dimensions[i];
+    if(dimensions[i] > 1) {
+      cubeNumber *= dimensions[i] - 1;
+      dimensionNumber++;
+    }
+  }
+  const long double cellNumber
+    = cubeNumber * (dimensionNumber == 3 ? 6 : dimensionNumber);
+
+  if((vertexNumber > maxNumber) || (cellNumber > maxNumber)) {
+    stringstream msg;
+    msg << "[RawVolume] Grid too large (" << xDim << "x" << yDim << "x"
+        << zDim << "): its number of vertices or of cells exceeds "
+        << numeric_limits<SimplexId>::max() << "." << endl;
+#ifndef TTK_ENABLE_64BIT_IDS
+    msg << "[RawVolume] Such grids require TTK_ENABLE_64BIT_IDS." << endl;
+#endif
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -4;
+  }
+
+  closeFile();
+
+  Timer t;
+
+  const size_t size
+    = headerSize + (size_t)xDim * (size_t)yDim * (size_t)zDim * scalarSize;
+  size_t fileSize = 0;
+
+#ifdef _WIN32
+  fileHandle_
+    = CreateFileA(fileName.data(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if(fileHandle_ == INVALID_HANDLE_VALUE) {
+    fileHandle_ = nullptr;
+  } else {
+    LARGE_INTEGER largeSize;
+    if(GetFileSizeEx(fileHandle_, &largeSize))
+      fileSize = largeSize.QuadPart;
+  }
+#else
+  const int fileDescriptor = open(fileName.data(), O_RDONLY);
+  if(fileDescriptor != -1) {
+    struct stat fileStatus;
+    if(!fstat(fileDescriptor, &fileStatus))
+      fileSize = fileStatus.st_size;
+  }
+#endif
+
+  if(fileSize < size) {
+    stringstream msg;
+    if(!fileSize) {
+      msg << "[RawVolume] Could not open file `" << fileName << "'." << endl;
+    } else {
+      msg << "[RawVolume] File `" << fileName << "' is too small ("
+          << fileSize << " bytes, expected " << size << " bytes)." << endl;
+    }
+    dMsg(cerr, msg.str(), fatalMsg);
+#ifdef _WIN32
+    if(fileHandle_)
+      CloseHandle(fileHandle_);
+    fileHandle_ = nullptr;
+#else
+    if(fileDescriptor != -1)
+      close(fileDescriptor);
+#endif
+    return -2;
+  }
+
+#ifdef _WIN32
+  mappingHandle_
+    = CreateFileMappingA(fileHandle_, NULL, PAGE_READONLY, 0, 0, NULL);
+  if(mappingHandle_)
+    mapping_ = MapViewOfFile(mappingHandle_, FILE_MAP_READ, 0, 0, size);
+  if(!mapping_) {
+    if(mappingHandle_)
+      CloseHandle(mappingHandle_);
+    CloseHandle(fileHandle_);
+    mappingHandle_ = nullptr;
+    fileHandle_ = nullptr;
+  }
+#else
+  mapping_ = mmap(NULL, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+  if(mapping_ == MAP_FAILED)
+    mapping_ = nullptr;
+  // the mapping remains valid once the file is closed
+  close(fileDescriptor);
+#endif
+
+  if(!mapping_) {
+    stringstream msg;
+    msg << "[RawVolume] Could not map file `" << fileName << "'." << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -3;
+  }
+
+  mappingSize_ = size;
+  mappingOffset_ = headerSize;
+  scalarSize_ = scalarSize;
+  dimensions_[0] = xDim;
+  dimensions_[1] = yDim;
+  dimensions_[2] = zDim;
+  data_ = (const char *)mapping_ + headerSize;
+
+  {
+    stringstream msg;
+    msg << "[RawVolume] File `" << fileName << "' mapped ("
+        << xDim << "x" << yDim << "x" << zDim << ", "
+        << (size / 1024) / 1024 << " MB) in " << t.getElapsedTime() << " s."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int RawVolume::setupTriangulation(Triangulation *triangulation,
+                                  const float origin[3],
+                                  const float spacing[3]) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!triangulation)
+    return -1;
+  if(!data_)
+    return -2;
+#endif
+
+  const float defaultOrigin[3] = {0, 0, 0};
+  const float defaultSpacing[3] = {1, 1, 1};
+  const float *o = origin ? origin : defaultOrigin;
+  const float *s = spacing ? spacing : defaultSpacing;
+
+  return triangulation->setInputGrid(o[0], o[1], o[2], s[0], s[1], s[2],
+                                     dimensions_[0], dimensions_[1],
+                                     dimensions_[2]);
+}
@@ -0,0 +1,210 @@
+/// \ingroup base
+/// \class ttk::RawVolume
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief TTK out-of-core access to raw volumes.
+///
+/// %RawVolume memory-maps a raw volume file (scalar values stored one after
+/// the other, in row-major order, after an optional header) and exposes it
+/// to the TTK base code without copying it:
+///   - the grid is passed to a ttk::Triangulation (implicit triangulation);
+///   - the scalar values are exposed through a read-only pointer, which can
+///   be passed directly to ttk::ftm::FTMTree, ttk::ScalarFieldCriticalPoints
+///   or ttk::dcg::DiscreteGradient.
+///
+/// The volume is thus never loaded explicitly in memory: its pages are read
+/// on demand (and evicted if needed) by the operating system, which enables
+/// the processing of volumes larger than the available memory. Access hints
+/// (see adviseAccess()) can be given to the operating system before each
+/// sweep over the data.
+///
+/// The only sweep which reads the whole volume in memory order is the sort
+/// of its vertices: computeOrder() performs it under a sequential access
+/// hint and outputs the order field of the volume (see ttk::VertexOrder),
+/// which the modules then use instead of sorting the mapped values again
+/// (by random accesses).
+///
+/// Usage example:
+/// \code
+/// ttk::RawVolume volume;
+/// volume.openFile("volume.raw", 2048, 2048, 2048, sizeof(float));
+///
+/// ttk::Triangulation triangulation;
+/// volume.setupTriangulation(&triangulation);
+///
+/// std::vector<ttk::SimplexId> order(volume.getNumberOfVertices());
+/// volume.computeOrder<float>(order.data(), threadNumber);
+///
+/// ftmTree.setScalars(volume.getData());
+/// ftmTree.setVertexOrder(order.data());
+/// \endcode
+///
+/// \note Volumes with more than 2^31 vertices (or cells) require TTK to be
+/// built with TTK_ENABLE_64BIT_IDS (see openFile()). The arrays computed by
+/// the TTK modules (offsets, segmentations, etc.) remain in memory.
+///
+/// \sa ttk::ImplicitTriangulation
+
+#ifndef _RAWVOLUME_H
+#define _RAWVOLUME_H
+
+// base code includes
+#include <Triangulation.h>
+#include <VertexOrder.h>
+#include <Wrapper.h>
+
+#include <string>
+
+namespace ttk {
+
+  class RawVolume : public Debug {
+
+  public:
+    /// Access patterns (see adviseAccess()).
+    enum class Access {
+      /// No specific pattern.
+      NORMAL,
+      /// Random accesses (disables read-ahead).
+      RANDOM,
+      /// Sequential sweep (aggressive read-ahead, pages can be evicted
+      /// quickly once read).
+      SEQUENTIAL,
+      /// The range will be accessed soon (asynchronous prefetch).
+      WILL_NEED,
+      /// The range will not be accessed soon (its pages can be evicted).
+      DONT_NEED
+    };
+
+    RawVolume();
+
+    ~RawVolume();
+
+    /// Give a hint to the operating system on the upcoming accesses to the
+    /// scalar values of the vertices [\p begin, \p end).
+    /// \param access Access pattern.
+    /// \param begin First vertex identifier of the range.
+    /// \param end Last vertex identifier of the range (excluded). -1 stands
+    /// for the end of the volume.
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \note On systems without madvise() support, this function has no
+    /// effect.
+    int adviseAccess(const Access &access,
+                     const SimplexId &begin = 0,
+                     const SimplexId &end = -1) const;
+
+    /// Compute the order field of the volume (see
+    /// ttk::VertexOrder::computeOrder()), in a single sequential sweep over
+    /// the mapped values (ties are broken by vertex identifiers).
+    /// \param order Output rank of each vertex (getNumberOfVertices()
+    /// entries, allocated by the caller).
+    /// \param threadNumber Number of threads.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename dataType>
+    int computeOrder(SimplexId *order, const ThreadId &threadNumber = 1) const;
+
+    /// Unmap the current file (if any).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int closeFile();
+
+    /// Get a read-only pointer to the scalar values of the volume.
+    inline const void *getData() const {
+      return data_;
+    }
+
+    /// Get the number of vertices of the volume.
+    inline SimplexId getNumberOfVertices() const {
+      return (long long int)dimensions_[0] * dimensions_[1] * dimensions_[2];
+    }
+
+    /// Get a typed read-only pointer to the scalar values of the volume.
+    template <typename dataType>
+    inline const dataType *getScalars() const {
+      return static_cast<const dataType *>(data_);
+    }
+
+    inline bool isOpen() const {
+      return data_ != nullptr;
+    }
+
+    /// Memory-map a raw volume file (read-only).
+    /// \param fileName Path to the file.
+    /// \param xDim Number of vertices along the x dimension.
+    /// \param yDim Number of vertices along the y dimension.
+    /// \param zDim Number of vertices along the z dimension.
+    /// \param scalarSize Size of a scalar value, in bytes.
+    /// \param headerSize Size of the file header to skip, in bytes.
+    /// \return Returns 0 upon success, negative values otherwise (for
+    /// instance if the number of vertices or of cells of the grid cannot be
+    /// represented by a SimplexId).
+    int openFile(const std::string &fileName,
+                 const SimplexId &xDim,
+                 const SimplexId &yDim,
+                 const SimplexId &zDim,
+                 const size_t &scalarSize,
+                 const size_t &headerSize = 0);
+
+    /// Pass the grid of the volume to a triangulation (implicit
+    /// triangulation, no memory overhead).
+    /// \param triangulation Triangulation to set up.
+    /// \param origin Coordinates of the first vertex (default: 0, 0, 0).
+    /// \param spacing Spacing of the grid (default: 1, 1, 1).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setupTriangulation(Triangulation *triangulation,
+                           const float origin[3] = nullptr,
+                           const float spacing[3] = nullptr) const;
+
+  protected:
+    const void *data_;
+    size_t scalarSize_;
+    SimplexId dimensions_[3];
+
+    // actual mapping (page aligned), including the header
+    void *mapping_;
+    size_t mappingSize_;
+    size_t mappingOffset_;
+
+#ifdef _WIN32
+    void *fileHandle_;
+    void *mappingHandle_;
+#endif
+  };
+} // namespace ttk
+
+template <typename dataType>
+int ttk::RawVolume::computeOrder(SimplexId *order,
+                                 const ThreadId &threadNumber) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!data_)
+    return -1;
+  if(scalarSize_ != sizeof(dataType))
+    return -2;
+#endif
+
+  Timer t;
+
+  // the hints are best effort, their failure is not an error
+  adviseAccess(Access::SEQUENTIAL);
+
+  const int ret = VertexOrder::computeOrder(
+    getNumberOfVertices(), getScalars<dataType>(),
+    static_cast<const SimplexId *>(nullptr), order, threadNumber);
+
+  // the modules then access the values by neighborhoods
+  adviseAccess(Access::NORMAL);
+
+  if(ret)
+    return ret;
+
+  {
+    std::stringstream msg;
+    msg << "[RawVolume] Order field computed in " << t.getElapsedTime()
+        << " s. (" << threadNumber << " thread(s))." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+#endif // _RAWVOLUME_H
@@ -44,17 +44,18 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     int execute();
 
-    std::pair<SimplexId, SimplexId>
-      getNumberOfLowerUpperComponents(const SimplexId vertexId,
-                                      Triangulation *triangulation) const;
+    template <class triangulationType>
+    std::pair<SimplexId, SimplexId> getNumberOfLowerUpperComponents(
+      const SimplexId vertexId, const triangulationType *triangulation) const;
 
     char getCriticalType(const SimplexId &vertexId) const {
 
       return getCriticalType(vertexId, triangulation_);
     }
 
+    template <class triangulationType>
     char getCriticalType(const SimplexId &vertexId,
-                         Triangulation *triangulation) const;
+                         const triangulationType *triangulation) const;
 
     char getCriticalType(const SimplexId &vertexId,
                          const std::vector<std::pair<SimplexId, SimplexId>>
@@ -139,6 +140,12 @@ namespace ttk {
     }
 
   protected:
+    /// Classification kernel, instantiated for the concrete triangulation
+    /// type (see ttkTemplateMacro).
+    template <class triangulationType>
+    int getCriticalTypes(const triangulationType *triangulation,
+                         std::vector<char> &vertexTypes) const;
+
     int dimension_;
     SimplexId vertexNumber_;
     const dataType *scalarValues_;
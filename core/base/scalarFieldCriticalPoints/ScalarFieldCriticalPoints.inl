@@ -69,13 +69,9 @@ int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
   std::vector<char> vertexTypes(vertexNumber_);
 
   if(triangulation_) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)vertexNumber_; i++) {
-
-      vertexTypes[i] = getCriticalType(i, triangulation_);
-    }
+    ttkTemplateMacro(
+      triangulation_->getDispatchType(),
+      getCriticalTypes(triangulation_->getData<TTK_TT>(), vertexTypes));
   } else if(vertexLinkEdgeLists_) {
     // legacy implementation
 #ifdef TTK_ENABLE_OPENMP
@@ -199,9 +195,27 @@ int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
 }
 
 template <class dataType>
+template <class triangulationType>
+int ttk::ScalarFieldCriticalPoints<dataType>::getCriticalTypes(
+  const triangulationType *triangulation,
+  std::vector<char> &vertexTypes) const {
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < (SimplexId)vertexNumber_; i++) {
+
+    vertexTypes[i] = getCriticalType(i, triangulation);
+  }
+
+  return 0;
+}
+
+template <class dataType>
+template <class triangulationType>
 std::pair<ttk::SimplexId, ttk::SimplexId>
   ttk::ScalarFieldCriticalPoints<dataType>::getNumberOfLowerUpperComponents(
-    const SimplexId vertexId, Triangulation *triangulation) const {
+    const SimplexId vertexId, const triangulationType *triangulation) const {
 
   SimplexId neighborNumber = triangulation->getVertexNeighborNumber(vertexId);
   std::vector<SimplexId> lowerNeighbors, upperNeighbors;
@@ -339,8 +353,9 @@ std::pair<ttk::SimplexId, ttk::SimplexId>
 }
 
 template <class dataType>
+template <class triangulationType>
 char ttk::ScalarFieldCriticalPoints<dataType>::getCriticalType(
-  const SimplexId &vertexId, Triangulation *triangulation) const {
+  const SimplexId &vertexId, const triangulationType *triangulation) const {
 
   SimplexId downValence, upValence;
   std::tie(downValence, upValence)
@@ -54,8 +54,8 @@ namespace ttk {
 
       triangulation_ = triangulation;
 
-      // Pre-condition functions.
-      if(triangulation_) {
+      // Pre-condition functions (built upon the first query in lazy mode).
+      if((triangulation_) && (!triangulation_->isLazyPreprocessing())) {
         triangulation_->preprocessVertexNeighbors();
       }
 
@@ -65,6 +65,12 @@ namespace ttk {
     template <class dataType>
     int smooth(const int &numberOfIterations) const;
 
+    /// Smoothing kernel, instantiated for the concrete triangulation type
+    /// (see ttkTemplateMacro).
+    template <class dataType, class triangulationType>
+    int smooth(const triangulationType *triangulation,
+               const int &numberOfIterations) const;
+
   protected:
     int dimensionNumber_;
     void *inputData_, *outputData_;
@@ -78,8 +84,6 @@ namespace ttk {
 template <class dataType>
 int ttk::ScalarFieldSmoother::smooth(const int &numberOfIterations) const {
 
-  Timer t;
-
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!triangulation_)
     return -1;
@@ -91,9 +95,23 @@ int ttk::ScalarFieldSmoother::smooth(const int &numberOfIterations) const {
     return -4;
 #endif
 
+  int ret = 0;
+  ttkTemplateMacro(
+    triangulation_->getDispatchType(),
+    (ret = smooth<dataType>(
+       triangulation_->getData<TTK_TT>(), numberOfIterations)));
+  return ret;
+}
+
+template <class dataType, class triangulationType>
+int ttk::ScalarFieldSmoother::smooth(const triangulationType *triangulation,
+                                     const int &numberOfIterations) const {
+
+  Timer t;
+
   int count = 0;
 
-  SimplexId vertexNumber = triangulation_->getNumberOfVertices();
+  SimplexId vertexNumber = triangulation->getNumberOfVertices();
 
   std::vector<dataType> tmpData(vertexNumber * dimensionNumber_, 0);
 
@@ -124,10 +142,10 @@ int ttk::ScalarFieldSmoother::smooth(const int &numberOfIterations) const {
         for(int j = 0; j < dimensionNumber_; j++) {
           tmpData[dimensionNumber_ * i + j] = 0;
 
-          SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(i);
+          SimplexId neighborNumber = triangulation->getVertexNeighborNumber(i);
           for(SimplexId k = 0; k < neighborNumber; k++) {
             SimplexId neighborId = -1;
-            triangulation_->getVertexNeighbor(i, k, neighborId);
+            triangulation->getVertexNeighbor(i, k, neighborId);
             tmpData[dimensionNumber_ * i + j]
               += outputData[dimensionNumber_ * (neighborId) + j];
           }
@@ -11,47 +11,56 @@ OneSkeleton::~OneSkeleton() {
 
 int OneSkeleton::buildEdgeLinks(
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  const vector<vector<SimplexId>> &edgeStars,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &edgeLinks) const {
+  const FlatJaggedArray &edgeStars,
+  const CellArray &cellArray,
+  FlatJaggedArray &edgeLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(edgeList.empty())
     return -1;
-  if((edgeStars.empty()) || (edgeStars.size() != edgeList.size()))
+  if((edgeStars.empty())
+     || (edgeStars.subvectorsNumber() != (SimplexId)edgeList.size()))
     return -2;
-  if(!cellArray)
+  if(cellArray.empty())
     return -3;
 #endif
 
   Timer t;
 
-  edgeLinks.resize(edgeList.size());
+  const SimplexId edgeNumber = edgeList.size();
 
-  SimplexId verticesPerCell = cellArray[0];
+  // one link vertex per triangle of the star
+  vector<SimplexId> linkSizes(edgeNumber);
+  for(SimplexId i = 0; i < edgeNumber; i++)
+    linkSizes[i] = edgeStars.size(i);
+  edgeLinks.setRowSizes(linkSizes);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)edgeLinks.size(); i++) {
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    linkSizes[i] = 0;
     for(SimplexId j = 0; j < (SimplexId)edgeStars[i].size(); j++) {
 
       SimplexId vertexId = -1;
       for(int k = 0; k < 3; k++) {
-        if((cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k]
+        if((cellArray.getCellVertex(edgeStars[i][j], k)
             != edgeList[i].first)
-           && (cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k]
+           && (cellArray.getCellVertex(edgeStars[i][j], k)
                != edgeList[i].second)) {
-          vertexId = cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k];
+          vertexId = cellArray.getCellVertex(edgeStars[i][j], k);
           break;
         }
       }
       if(vertexId != -1) {
-        edgeLinks[i].push_back(vertexId);
+        edgeLinks.set(i, linkSizes[i]++, vertexId);
       }
     }
   }
 
+  // degenerate triangles (if any) have no link vertex
+  edgeLinks.shrinkRows(linkSizes);
+
   {
     stringstream msg;
     msg << "[OneSkeleton] Edge links built in " << t.getElapsedTime() << " s. ("
@@ -64,14 +73,15 @@ int OneSkeleton::buildEdgeLinks(
 
 int OneSkeleton::buildEdgeLinks(
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  const vector<vector<SimplexId>> &edgeStars,
-  const vector<vector<SimplexId>> &cellEdges,
-  vector<vector<SimplexId>> &edgeLinks) const {
+  const FlatJaggedArray &edgeStars,
+  const FlatJaggedArray &cellEdges,
+  FlatJaggedArray &edgeLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(edgeList.empty())
     return -1;
-  if((edgeStars.empty()) || (edgeStars.size() != edgeList.size()))
+  if((edgeStars.empty())
+     || (edgeStars.subvectorsNumber() != (SimplexId)edgeList.size()))
     return -2;
   if(cellEdges.empty())
     return -3;
@@ -79,12 +89,18 @@ int OneSkeleton::buildEdgeLinks(
 
   Timer t;
 
-  edgeLinks.resize(edgeList.size());
+  const SimplexId edgeNumber = edgeList.size();
+
+  // one link edge per tetrahedron of the star
+  vector<SimplexId> linkSizes(edgeNumber);
+  for(SimplexId i = 0; i < edgeNumber; i++)
+    linkSizes[i] = edgeStars.size(i);
+  edgeLinks.setRowSizes(linkSizes);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)edgeLinks.size(); i++) {
+  for(SimplexId i = 0; i < edgeNumber; i++) {
 
     SimplexId otherEdgeId = -1;
 
@@ -105,7 +121,7 @@ int OneSkeleton::buildEdgeLinks(
         }
       }
 
-      edgeLinks[i].push_back(linkEdgeId);
+      edgeLinks.set(i, j, linkEdgeId);
     }
   }
 
@@ -122,42 +138,31 @@ int OneSkeleton::buildEdgeLinks(
 int OneSkeleton::buildEdgeList(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
+  const CellArray &cellArray,
   vector<pair<SimplexId, SimplexId>> &edgeList) const {
 
-  ThreadId oldThreadNumber = threadNumber_;
-
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  threadNumber_ = 1;
-
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(!cellArray)
+  if(cellArray.empty())
     return -1;
 #endif
 
-  Timer t;
+  // NOTE: the per-vertex deduplication below does not scale in parallel.
+  // with several threads, let's sort the edge keys instead.
+  if(threadNumber_ > 1)
+    return buildEdgeList(vertexNumber, cellNumber, cellArray, edgeList, NULL);
 
-  vector<vector<vector<SimplexId>>> threadedEdgeTable(threadNumber_);
+  Timer t;
 
-  for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable.size(); i++) {
-    threadedEdgeTable[i].resize(vertexNumber);
-  }
+  vector<vector<SimplexId>> edgeTable(vertexNumber);
 
   // WARNING!
   // assuming triangulations here
-  SimplexId verticesPerCell = cellArray[0];
+  SimplexId verticesPerCell = cellArray.getCellVertexNumber();
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
   for(SimplexId i = 0; i < cellNumber; i++) {
 
-    ThreadId threadId = 0, tmpVertexId = 0;
+    SimplexId tmpVertexId = 0;
     pair<SimplexId, SimplexId> edgeIds;
-#ifdef TTK_ENABLE_OPENMP
-    threadId = omp_get_thread_num();
-#endif
 
     // tet case
     // 0 - 1
@@ -169,8 +174,8 @@ int OneSkeleton::buildEdgeList(
     for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
       for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
         // edge processing
-        edgeIds.first = cellArray[(verticesPerCell + 1) * i + 1 + j];
-        edgeIds.second = cellArray[(verticesPerCell + 1) * i + 1 + k];
+        edgeIds.first = cellArray.getCellVertex(i, j);
+        edgeIds.second = cellArray.getCellVertex(i, k);
 
         if(edgeIds.first > edgeIds.second) {
           tmpVertexId = edgeIds.first;
@@ -179,71 +184,149 @@ int OneSkeleton::buildEdgeList(
         }
 
         bool hasFound = false;
-        for(SimplexId l = 0;
-            l < (SimplexId)threadedEdgeTable[threadId][edgeIds.first].size();
+        for(SimplexId l = 0; l < (SimplexId)edgeTable[edgeIds.first].size();
             l++) {
-          if(edgeIds.second == threadedEdgeTable[threadId][edgeIds.first][l]) {
+          if(edgeIds.second == edgeTable[edgeIds.first][l]) {
             hasFound = true;
             break;
           }
         }
         if(!hasFound) {
-          threadedEdgeTable[threadId][edgeIds.first].push_back(edgeIds.second);
+          edgeTable[edgeIds.first].push_back(edgeIds.second);
         }
         // end of edge processing
       }
     }
   }
 
-  // now merge the thing
   SimplexId edgeCount = 0;
-  vector<vector<SimplexId>> edgeTable;
+  for(SimplexId i = 0; i < (SimplexId)edgeTable.size(); i++)
+    edgeCount += edgeTable[i].size();
+
+  edgeList.resize(edgeCount);
+  edgeCount = 0;
+  for(SimplexId i = 0; i < (SimplexId)edgeTable.size(); i++) {
+
+    for(SimplexId j = 0; j < (SimplexId)edgeTable[i].size(); j++) {
+
+      edgeList[edgeCount].first = i;
+      edgeList[edgeCount].second = edgeTable[i][j];
+      edgeCount++;
+    }
+  }
+
+  {
+    stringstream msg;
+    msg << "[OneSkeleton] Edge-list built in " << t.getElapsedTime() << " s. ("
+        << edgeList.size() << " edges, 1 thread(s))." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
+  // 1 thread: 10.4979 s
+  // 24 threads: 12.3994 s [not efficient in parallel]
 
-  if(threadNumber_ > 1) {
-    edgeTable.resize(vertexNumber);
-    for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable.size(); i++) {
+  return 0;
+}
 
-      for(SimplexId j = 0; j < (SimplexId)threadedEdgeTable[i].size(); j++) {
+int OneSkeleton::buildEdgeList(const SimplexId &vertexNumber,
+                               const SimplexId &cellNumber,
+                               const CellArray &cellArray,
+                               vector<pair<SimplexId, SimplexId>> &edgeList,
+                               FlatJaggedArray *cellEdges,
+                               FlatJaggedArray *vertexEdges) const {
 
-        for(SimplexId k = 0; k < (SimplexId)threadedEdgeTable[i][j].size();
-            k++) {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(cellArray.empty())
+    return -1;
+#endif
 
-          // search if it already exists
-          bool hasFound = false;
+  Timer t;
 
-          for(SimplexId l = 0; l < (SimplexId)edgeTable[j].size(); l++) {
+  struct EdgeItem {
+    SimplexId v0, v1;
+    // position of the edge in the enumeration of the cell vertex pairs
+    LongSimplexId occurrence;
+  };
 
-            if(edgeTable[j][l] == threadedEdgeTable[i][j][k]) {
-              hasFound = true;
-              break;
-            }
-          }
-          if(!hasFound) {
-            edgeTable[j].push_back(threadedEdgeTable[i][j][k]);
-            edgeCount++;
-          }
-        }
+  // WARNING!
+  // assuming triangulations here
+  const SimplexId verticesPerCell = cellArray.getCellVertexNumber();
+  const SimplexId edgesPerCell = verticesPerCell * (verticesPerCell - 1) / 2;
+  const LongSimplexId itemNumber = (LongSimplexId)cellNumber * edgesPerCell;
+
+  // 1) one (min, max) vertex key per vertex pair of each cell
+  vector<EdgeItem> items(itemNumber);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    LongSimplexId itemId = (LongSimplexId)i * edgesPerCell;
+    for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
+      for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
+        const LongSimplexId vj = cellArray.getCellVertex(i, j);
+        const LongSimplexId vk = cellArray.getCellVertex(i, k);
+        EdgeItem &item = items[itemId];
+        item.v0 = std::min(vj, vk);
+        item.v1 = std::max(vj, vk);
+        item.occurrence = itemId;
+        itemId++;
       }
     }
-  } else {
-    for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable[0].size(); i++)
-      edgeCount += threadedEdgeTable[0][i].size();
   }
 
-  vector<vector<SimplexId>> *masterEdgeTable = &edgeTable;
-  if(threadNumber_ == 1) {
-    masterEdgeTable = &(threadedEdgeTable[0]);
+  // 2) lexicographic sort of the keys (the sort is stable, the occurrences
+  // of a given edge remain ordered)
+  const int vertexBits = RadixSort::bitNumber(vertexNumber);
+  RadixSort::sort(
+    items, [](const EdgeItem &e) { return (unsigned long long)e.v1; },
+    vertexBits, threadNumber_);
+  RadixSort::sort(
+    items, [](const EdgeItem &e) { return (unsigned long long)e.v0; },
+    vertexBits, threadNumber_);
+
+  // 3) one range of items per edge
+  vector<pair<size_t, size_t>> edges;
+  RadixSort::equalRanges(
+    items,
+    [](const EdgeItem &a, const EdgeItem &b) {
+      return (a.v0 == b.v0) && (a.v1 == b.v1);
+    },
+    edges, threadNumber_);
+
+  // 4) edge identifiers: same ordering as the sequential enumeration (by
+  // minimum vertex, then by first occurrence in the cells)
+  RadixSort::sort(
+    edges,
+    [&items](const pair<size_t, size_t> &e) {
+      return (unsigned long long)items[e.first].occurrence;
+    },
+    RadixSort::bitNumber(itemNumber), threadNumber_);
+  RadixSort::sort(
+    edges,
+    [&items](const pair<size_t, size_t> &e) {
+      return (unsigned long long)items[e.first].v0;
+    },
+    vertexBits, threadNumber_);
+
+  // 5) outputs
+  edgeList.resize(edges.size());
+  if(cellEdges) {
+    cellEdges->setRowSizes(vector<SimplexId>(cellNumber, edgesPerCell));
   }
 
-  edgeList.resize(edgeCount);
-  edgeCount = 0;
-  for(SimplexId i = 0; i < (SimplexId)masterEdgeTable->size(); i++) {
-
-    for(SimplexId j = 0; j < (SimplexId)(*masterEdgeTable)[i].size(); j++) {
-
-      edgeList[edgeCount].first = i;
-      edgeList[edgeCount].second = (*masterEdgeTable)[i][j];
-      edgeCount++;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < (SimplexId)edges.size(); i++) {
+    edgeList[i].first = items[edges[i].first].v0;
+    edgeList[i].second = items[edges[i].first].v1;
+    if(cellEdges) {
+      for(size_t j = edges[i].first; j < edges[i].second; j++) {
+        cellEdges->set(items[j].occurrence / edgesPerCell,
+                       items[j].occurrence % edgesPerCell, i);
+      }
     }
   }
 
@@ -255,11 +338,12 @@ int OneSkeleton::buildEdgeList(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // 1 thread: 10.4979 s
-  // 24 threads: 12.3994 s [not efficient in parallel]
+  if(vertexEdges) {
+    ZeroSkeleton zeroSkeleton;
+    zeroSkeleton.setDebugLevel(debugLevel_);
+    zeroSkeleton.setThreadNumber(threadNumber_);
+    return zeroSkeleton.buildVertexEdges(vertexNumber, edgeList, *vertexEdges);
+  }
 
   return 0;
 }
@@ -309,13 +393,13 @@ int OneSkeleton::buildEdgeLists(
 
 int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
                                 const SimplexId &cellNumber,
-                                const LongSimplexId *cellArray,
-                                vector<vector<SimplexId>> &starList,
+                                const CellArray &cellArray,
+                                FlatJaggedArray &starList,
                                 vector<pair<SimplexId, SimplexId>> *edgeList,
-                                vector<vector<SimplexId>> *vertexStars) const {
+                                FlatJaggedArray *vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(!cellArray)
+  if(cellArray.empty())
     return -1;
 #endif
 
@@ -331,16 +415,12 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
     buildEdgeList(vertexNumber, cellNumber, cellArray, *localEdgeList);
   }
 
-  starList.resize(localEdgeList->size());
-  for(SimplexId i = 0; i < (SimplexId)starList.size(); i++)
-    starList[i].reserve(16);
-
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
-  if((SimplexId)localVertexStars->size() != vertexNumber) {
+  if(localVertexStars->subvectorsNumber() != vertexNumber) {
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setThreadNumber(threadNumber_);
     zeroSkeleton.setDebugLevel(debugLevel_);
@@ -348,37 +428,47 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
       vertexNumber, cellNumber, cellArray, *localVertexStars);
   }
 
+  const SimplexId edgeNumber = localEdgeList->size();
+
+  // the star of an edge is at most as large as the stars of its vertices
+  vector<SimplexId> starSizes(edgeNumber);
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    starSizes[i] = std::min(localVertexStars->size((*localEdgeList)[i].first),
+                            localVertexStars->size((*localEdgeList)[i].second));
+  }
+  starList.setRowSizes(starSizes);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-
-    SimplexId vertex0 = (*localEdgeList)[i].first;
-    SimplexId vertex1 = (*localEdgeList)[i].second;
-
-    // merge the two vertex stars
-    for(SimplexId j = 0; j < (SimplexId)(*localVertexStars)[vertex0].size();
-        j++) {
-
-      bool hasFound = false;
-      for(SimplexId k = 0; k < (SimplexId)(*localVertexStars)[vertex1].size();
-          k++) {
-        if((*localVertexStars)[vertex0][j] == (*localVertexStars)[vertex1][k]) {
-          hasFound = true;
-          break;
-        }
-      }
-      if(hasFound) {
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+
+    const auto star0 = (*localVertexStars)[(*localEdgeList)[i].first];
+    const auto star1 = (*localVertexStars)[(*localEdgeList)[i].second];
+
+    // intersect the two (sorted) vertex stars
+    starSizes[i] = 0;
+    size_t pos0 = 0, pos1 = 0;
+    while((pos0 < star0.size()) && (pos1 < star1.size())) {
+      if(star0[pos0] < star1[pos1]) {
+        pos0++;
+      } else if(star1[pos1] < star0[pos0]) {
+        pos1++;
+      } else {
         // common to the two vertex stars
-        starList[i].push_back((*localVertexStars)[vertex0][j]);
+        starList.set(i, starSizes[i]++, star0[pos0]);
+        pos0++;
+        pos1++;
       }
     }
   }
 
+  starList.shrinkRows(starSizes);
+
   {
     stringstream msg;
     msg << "[OneSkeleton] Edge stars built in " << t.getElapsedTime() << " s. ("
-        << starList.size() << " edges, " << threadNumber_ << " thread(s))"
+        << edgeNumber << " edges, " << threadNumber_ << " thread(s))"
         << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
@@ -393,7 +483,7 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
 
 int OneSkeleton::buildEdgeSubList(
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
+  const CellArray &cellArray,
   vector<pair<SimplexId, SimplexId>> &edgeList) const {
 
   // NOTE: here we're dealing with a subportion of the mesh.
@@ -406,7 +496,7 @@ int OneSkeleton::buildEdgeSubList(
   map<pair<SimplexId, SimplexId>, bool> edgeMap;
   edgeList.clear();
 
-  SimplexId verticesPerCell = cellArray[0];
+  SimplexId verticesPerCell = cellArray.getCellVertexNumber();
   for(SimplexId i = 0; i < cellNumber; i++) {
 
     pair<SimplexId, SimplexId> edgeIds;
@@ -421,8 +511,8 @@ int OneSkeleton::buildEdgeSubList(
     for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
       for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
 
-        edgeIds.first = cellArray[(verticesPerCell + 1) * i + 1 + j];
-        edgeIds.second = cellArray[(verticesPerCell + 1) * i + 1 + k];
+        edgeIds.first = cellArray.getCellVertex(i, j);
+        edgeIds.second = cellArray.getCellVertex(i, k);
 
         if(edgeIds.first > edgeIds.second) {
           tmpVertexId = edgeIds.first;
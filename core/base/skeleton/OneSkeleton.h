@@ -16,6 +16,7 @@
 #include <map>
 
 // base code includes
+#include <RadixSort.h>
 #include <Wrapper.h>
 #include <ZeroSkeleton.h>
 
@@ -33,47 +34,44 @@ namespace ttk {
     /// \param edgeList List of edges. The size of this std::vector
     /// should be equal to the number of edges in the triangulation. Each
     /// entry is a std::pair of vertex identifiers.
-    /// \param edgeStars List of edge stars. The size of this std::vector
-    /// should be
-    /// equal to the number of edges. Each entry is a std::vector of triangle
+    /// \param edgeStars List of edge stars. The number of rows of this table
+    /// should be equal to the number of edges. Each row lists triangle
     /// identifiers.
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param edgeLinks Output edge links. The size of this std::vector
-    /// will be equal to the number of edges in the triangulation. Each
-    /// entry will be a std::vector listing the vertices in the link of the
-    /// corresponding vertex.
+    /// \param edgeLinks Output edge links. The number of rows of this table
+    /// will be equal to the number of edges in the triangulation. Each row
+    /// will list the vertices in the link of the corresponding edge (one per
+    /// triangle of its star).
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeLinks(
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      const std::vector<std::vector<SimplexId>> &edgeStars,
-      const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &edgeLinks) const;
+      const FlatJaggedArray &edgeStars,
+      const CellArray &cellArray,
+      FlatJaggedArray &edgeLinks) const;
 
     /// Compute the link of each edge of a 3D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
     /// \param edgeList List of edges. The size of this std::vector
     /// should be equal to the number of edges in the triangulation. Each
     /// entry is a std::pair of vertex identifiers.
-    /// \param edgeStars List of edge stars. The size of this std::vector
-    /// should be
-    /// equal to the number of edges. Each entry is a std::vector of
-    /// tetrahedron
+    /// \param edgeStars List of edge stars. The number of rows of this table
+    /// should be equal to the number of edges. Each row lists tetrahedron
     /// identifiers.
-    /// \param cellEdges List of celle edges. The size of this std::vector
+    /// \param cellEdges List of cell edges. The number of rows of this table
     /// should be equal to the number of tetrahedra in the triangulation. Each
-    /// entry is a std::vector of edge identifiers.
-    /// \param edgeLinks Output edge links. The size of this std::vector
-    /// will be equal to the number of edges in the triangulation. Each
-    /// entry will be a std::vector listing the vertices in the link of the
-    /// corresponding vertex.
+    /// row lists edge identifiers.
+    /// \param edgeLinks Output edge links. The number of rows of this table
+    /// will be equal to the number of edges in the triangulation. Each row
+    /// will list the edges in the link of the corresponding edge (one per
+    /// tetrahedron of its star).
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeLinks(
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      const std::vector<std::vector<SimplexId>> &edgeStars,
-      const std::vector<std::vector<SimplexId>> &cellEdges,
-      std::vector<std::vector<SimplexId>> &edgeLinks) const;
+      const FlatJaggedArray &edgeStars,
+      const FlatJaggedArray &cellEdges,
+      FlatJaggedArray &edgeLinks) const;
 
     /// Compute the list of edges of a valid triangulation.
     /// \param vertexNumber Number of vertices in the triangulation.
@@ -89,9 +87,39 @@ namespace ttk {
     int buildEdgeList(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
-      const LongSimplexId *cellArray,
+      const CellArray &cellArray,
       std::vector<std::pair<SimplexId, SimplexId>> &edgeList) const;
 
+    /// Compute the list of edges of a valid triangulation, as well as
+    /// (optionally) the edges of each cell and the edges of each vertex,
+    /// in a single pass.
+    ///
+    /// The edge keys of all the cells are sorted and uniquified in parallel
+    /// (radix sort), instead of being deduplicated by a per-vertex linear
+    /// scan. The edge identifiers are identical to the sequential
+    /// enumeration of the 4-argument version.
+    /// \param vertexNumber Number of vertices in the triangulation.
+    /// \param cellNumber Number of maximum-dimensional cells in the
+    /// triangulation (number of tetrahedra in 3D, triangles in 2D, etc.)
+    /// \param cellArray Pointer to a contiguous array of cells. Each entry
+    /// starts by the number of vertices in the cell, followed by the vertex
+    /// identifiers of the cell.
+    /// \param edgeList Output edge list (each entry is an ordered std::pair
+    /// of vertex identifiers).
+    /// \param cellEdges Optional output list of cell edges (for each cell,
+    /// identifiers of its edges, in the order of its vertex pairs). Ignored
+    /// if NULL.
+    /// \param vertexEdges Optional output list of vertex edges (for each
+    /// vertex, identifiers of its edges, by increasing identifier). Ignored
+    /// if NULL.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int buildEdgeList(const SimplexId &vertexNumber,
+                      const SimplexId &cellNumber,
+                      const CellArray &cellArray,
+                      std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
+                      FlatJaggedArray *cellEdges,
+                      FlatJaggedArray *vertexEdges = NULL) const;
+
     /// Compute the list of edges of multiple triangulations.
     /// \param cellArrays Vector of cells. For each triangulation, each entry
     /// starts by the number of vertices in the cell, followed by the vertex
@@ -113,11 +141,10 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param starList Output list of 3-stars. The size of this std::vector
-    /// will
-    /// be equal to the number of edges in the mesh. Each entry stores a
-    /// std::vector that lists the identifiers of all 3-dimensional cells
-    /// connected to the entry's edge.
+    /// \param starList Output list of 3-stars. The number of rows of this
+    /// table will be equal to the number of edges in the mesh. Each row lists
+    /// the identifiers of all 3-dimensional cells connected to the row's
+    /// edge, by increasing identifiers.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
     /// If not NULL but pointing to an empty std::vector, the function will
@@ -130,24 +157,23 @@ namespace ttk {
     /// this
     /// std::vector is not empty but incorrect, the behavior is unspecified.
     /// \param vertexStars Optional list of vertex stars (list of
-    /// 3-dimensional cells connected to each vertex). If NULL, the
+    /// 3-dimensional cells connected to each vertex, by increasing
+    /// identifiers, see ZeroSkeleton::buildVertexStars()). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty table, the
+    /// function will fill this empty table (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
-    /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// to a non-empty table, this function will use this table as internal
+    /// vertex star list. If this table is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeStars(const SimplexId &vertexNumber,
                        const SimplexId &cellNumber,
-                       const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &starList,
+                       const CellArray &cellArray,
+                       FlatJaggedArray &starList,
                        std::vector<std::pair<SimplexId, SimplexId>> *edgeList
                        = NULL,
-                       std::vector<std::vector<SimplexId>> *vertexStars
-                       = NULL) const;
+                       FlatJaggedArray *vertexStars = NULL) const;
 
     /// Compute the list of edges of a sub-portion of a valid triangulation.
     /// \param cellNumber Number of maximum-dimensional cells in the
@@ -162,7 +188,7 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeSubList(
       const SimplexId &cellNumber,
-      const LongSimplexId *cellArray,
+      const CellArray &cellArray,
       std::vector<std::pair<SimplexId, SimplexId>> &edgeList) const;
 
   protected:
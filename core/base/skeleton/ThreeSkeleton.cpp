@@ -12,17 +12,17 @@ ThreeSkeleton::~ThreeSkeleton() {
 int ThreeSkeleton::buildCellEdges(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellEdges,
+  const CellArray &cellArray,
+  FlatJaggedArray &cellEdges,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *vertexEdges) const {
+  FlatJaggedArray *vertexEdges) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexNumber <= 0)
     return -1;
   if(cellNumber <= 0)
     return -2;
-  if(!cellArray)
+  if(cellArray.empty())
     return -3;
 #endif
 
@@ -31,7 +31,7 @@ int ThreeSkeleton::buildCellEdges(
   auto localEdgeList = edgeList;
   auto localVertexEdges = vertexEdges;
   vector<pair<SimplexId, SimplexId>> defaultEdgeList{};
-  vector<vector<SimplexId>> defaultVertexEdges{};
+  FlatJaggedArray defaultVertexEdges{};
 
   if(!localEdgeList) {
     localEdgeList = &defaultEdgeList;
@@ -50,7 +50,7 @@ int ThreeSkeleton::buildCellEdges(
     localVertexEdges = &defaultVertexEdges;
   }
 
-  if(!localVertexEdges->size()) {
+  if(localVertexEdges->empty()) {
 
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setDebugLevel(debugLevel_);
@@ -59,13 +59,11 @@ int ThreeSkeleton::buildCellEdges(
       vertexNumber, *localEdgeList, *localVertexEdges);
   }
 
-  cellEdges.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellEdges.size(); i++) {
-    // optimized for tet meshes
-    cellEdges[i].reserve(6);
-  }
+  int vertexPerCell = cellArray.getCellVertexNumber();
 
-  int vertexPerCell = cellArray[0];
+  // one edge per pair of vertices of the cell
+  cellEdges.setRowSizes(
+    vector<SimplexId>(cellNumber, vertexPerCell * (vertexPerCell - 1) / 2));
 
   // for each cell, for each pair of vertices, find the edge
   // TODO: check for parallel efficiency here
@@ -74,21 +72,20 @@ int ThreeSkeleton::buildCellEdges(
 #endif
   for(SimplexId i = 0; i < cellNumber; i++) {
 
-    SimplexId cellId = (vertexPerCell + 1) * i;
+    SimplexId localEdgeNumber = 0;
 
     for(SimplexId j = 0; j < vertexPerCell; j++) {
 
       for(SimplexId k = j + 1; k < vertexPerCell; k++) {
 
-        SimplexId vertexId0 = cellArray[cellId + 1 + j];
-        SimplexId vertexId1 = cellArray[cellId + 1 + k];
+        SimplexId vertexId0 = cellArray.getCellVertex(i, j);
+        SimplexId vertexId1 = cellArray.getCellVertex(i, k);
 
         // loop around the edges of vertexId0 in search of vertexId1
         SimplexId edgeId = -1;
-        for(SimplexId l = 0;
-            l < (SimplexId)(*localVertexEdges)[vertexId0].size(); l++) {
+        for(SimplexId l = 0; l < localVertexEdges->size(vertexId0); l++) {
 
-          SimplexId localEdgeId = (*localVertexEdges)[vertexId0][l];
+          SimplexId localEdgeId = localVertexEdges->get(vertexId0, l);
           if(((*localEdgeList)[localEdgeId].first == vertexId1)
              || ((*localEdgeList)[localEdgeId].second == vertexId1)) {
             edgeId = localEdgeId;
@@ -96,7 +93,7 @@ int ThreeSkeleton::buildCellEdges(
           }
         }
 
-        cellEdges[i].push_back(edgeId);
+        cellEdges.set(i, localEdgeNumber++, edgeId);
       }
     }
   }
@@ -114,19 +111,19 @@ int ThreeSkeleton::buildCellEdges(
 int ThreeSkeleton::buildCellNeighborsFromTriangles(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *triangleStars) const {
+  const CellArray &cellArray,
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *triangleStars) const {
 
   Timer t;
 
   auto localTriangleStars = triangleStars;
-  vector<vector<SimplexId>> defaultTriangleStars{};
+  FlatJaggedArray defaultTriangleStars{};
   if(!localTriangleStars) {
     localTriangleStars = &defaultTriangleStars;
   }
 
-  if(!localTriangleStars->size()) {
+  if(localTriangleStars->empty()) {
 
     TwoSkeleton twoSkeleton;
     twoSkeleton.setThreadNumber(threadNumber_);
@@ -135,86 +132,37 @@ int ThreeSkeleton::buildCellNeighborsFromTriangles(
       vertexNumber, cellNumber, cellArray, NULL, localTriangleStars);
   }
 
-  SimplexId vertexPerCell = cellArray[0];
+  SimplexId vertexPerCell = cellArray.getCellVertexNumber();
 
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++) {
-    cellNeighbors[i].reserve(vertexPerCell);
-  }
+  // at most one neighbor per face of the cell
+  vector<SimplexId> neighborNumbers(cellNumber, vertexPerCell);
+  cellNeighbors.setRowSizes(neighborNumbers);
+  std::fill(neighborNumbers.begin(), neighborNumbers.end(), 0);
 
   // NOTE: not efficient so far in parallel
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
-  if(threadNumber_ == 1) {
-
-    for(SimplexId i = 0; i < (SimplexId)localTriangleStars->size(); i++) {
-
-      if((*localTriangleStars)[i].size() == 2) {
+  for(SimplexId i = 0; i < localTriangleStars->subvectorsNumber(); i++) {
 
-        // interior triangle
-        cellNeighbors[(*localTriangleStars)[i][0]].push_back(
-          (*localTriangleStars)[i][1]);
+    if(localTriangleStars->size(i) == 2) {
 
-        cellNeighbors[(*localTriangleStars)[i][1]].push_back(
-          (*localTriangleStars)[i][0]);
-      }
-    }
-  } else {
-
-    vector<vector<vector<SimplexId>>> threadedCellNeighbors(threadNumber_);
+      // interior triangle
+      const SimplexId cell0 = localTriangleStars->get(i, 0);
+      const SimplexId cell1 = localTriangleStars->get(i, 1);
 
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedCellNeighbors[i].resize(cellNumber);
-      for(SimplexId j = 0; j < (SimplexId)threadedCellNeighbors[i].size(); j++)
-        threadedCellNeighbors[i][j].reserve(4);
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)(*localTriangleStars).size(); i++) {
-
-      ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      if((*localTriangleStars)[i].size() == 2) {
-
-        // interior triangles
-
-        threadedCellNeighbors[threadId][(*localTriangleStars)[i][0]].push_back(
-          (*localTriangleStars)[i][1]);
-
-        threadedCellNeighbors[threadId][(*localTriangleStars)[i][1]].push_back(
-          (*localTriangleStars)[i][0]);
-      }
-    }
-
-    // now merge things
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < (SimplexId)threadedCellNeighbors[i].size();
-          j++) {
-
-        for(SimplexId k = 0; k < (SimplexId)threadedCellNeighbors[i][j].size();
-            k++) {
-          cellNeighbors[j].push_back(threadedCellNeighbors[i][j][k]);
-        }
-      }
+      cellNeighbors.set(cell0, neighborNumbers[cell0]++, cell1);
+      cellNeighbors.set(cell1, neighborNumbers[cell1]++, cell0);
     }
   }
 
+  cellNeighbors.shrinkRows(neighborNumbers);
+
   {
     stringstream msg;
     msg << "[ThreeSkeleton] Cell neighbors (" << cellNumber
-        << " cells) computed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << endl;
+        << " cells) computed in " << t.getElapsedTime() << " s. (1 thread(s))."
+        << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiol.vtu, 8.7Mtets, vger (4coresHT)
   // 1 thread: 9.80 s
   // 4 threads: 14.18157 s
@@ -237,11 +185,11 @@ int ThreeSkeleton::buildCellNeighborsFromTriangles(
 int ThreeSkeleton::buildCellNeighborsFromVertices(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *vertexStars) const {
+  const CellArray &cellArray,
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *vertexStars) const {
 
-  if(cellArray[0] == 3) {
+  if(cellArray.getCellVertexNumber() == 3) {
 
     TwoSkeleton twoSkeleton;
     twoSkeleton.setDebugLevel(debugLevel_);
@@ -250,7 +198,7 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
       vertexNumber, cellNumber, cellArray, cellNeighbors, vertexStars);
   }
 
-  if(cellArray[0] == 2) {
+  if(cellArray.getCellVertexNumber() == 2) {
     // 1D
     stringstream msg;
     msg << "[ThreeSkeleton] buildCellNeighborsFromVertices in 1D:" << endl;
@@ -262,13 +210,13 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
 
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
 
-  if(!localVertexStars->size()) {
+  if(localVertexStars->empty()) {
 
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setThreadNumber(threadNumber_);
@@ -277,85 +225,79 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
       vertexNumber, cellNumber, cellArray, *localVertexStars);
   }
 
-  int vertexPerCell = cellArray[0];
+  int vertexPerCell = cellArray.getCellVertexNumber();
 
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++)
-    cellNeighbors[i].reserve(vertexPerCell);
-
-    // pre-sort vertex stars
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    sort((*localVertexStars)[i].begin(), (*localVertexStars)[i].end());
+  // at most one neighbor per face of the cell
+  vector<SimplexId> neighborNumbers(cellNumber, vertexPerCell);
+  cellNeighbors.setRowSizes(neighborNumbers);
 
+  // NOTE: the vertex stars are sorted by construction (see
+  // ZeroSkeleton::buildVertexStars())
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId i = 0; i < cellNumber; i++) {
 
+    neighborNumbers[i] = 0;
+
     // go triangle by triangle
     for(SimplexId j = 0; j < vertexPerCell; j++) {
 
       SimplexId v0
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j) % vertexPerCell];
+        = cellArray.getCellVertex(i, j % vertexPerCell);
       SimplexId v1
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j + 1) % vertexPerCell];
+        = cellArray.getCellVertex(i, (j + 1) % vertexPerCell);
       SimplexId v2
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j + 2) % vertexPerCell];
+        = cellArray.getCellVertex(i, (j + 2) % vertexPerCell);
 
       // perform an intersection of the 3 (sorted) star lists
       SimplexId pos0 = 0, pos1 = 0, pos2 = 0;
       SimplexId intersection = -1;
 
-      while((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-            && (pos1 < (SimplexId)(*localVertexStars)[v1].size())
-            && (pos2 < (SimplexId)(*localVertexStars)[v2].size())) {
+      const auto star0 = (*localVertexStars)[v0];
+      const auto star1 = (*localVertexStars)[v1];
+      const auto star2 = (*localVertexStars)[v2];
 
-        SimplexId biggest = (*localVertexStars)[v0][pos0];
-        if((*localVertexStars)[v1][pos1] > biggest) {
-          biggest = (*localVertexStars)[v1][pos1];
+      while((pos0 < (SimplexId)star0.size()) && (pos1 < (SimplexId)star1.size())
+            && (pos2 < (SimplexId)star2.size())) {
+
+        SimplexId biggest = star0[pos0];
+        if(star1[pos1] > biggest) {
+          biggest = star1[pos1];
         }
-        if((*localVertexStars)[v2][pos2] > biggest) {
-          biggest = (*localVertexStars)[v2][pos2];
+        if(star2[pos2] > biggest) {
+          biggest = star2[pos2];
         }
 
-        for(SimplexId l = pos0; l < (SimplexId)(*localVertexStars)[v0].size();
-            l++) {
-          if((*localVertexStars)[v0][l] < biggest) {
+        for(SimplexId l = pos0; l < (SimplexId)star0.size(); l++) {
+          if(star0[l] < biggest) {
             pos0++;
           } else {
             break;
           }
         }
-        for(SimplexId l = pos1; l < (SimplexId)(*localVertexStars)[v1].size();
-            l++) {
-          if((*localVertexStars)[v1][l] < biggest) {
+        for(SimplexId l = pos1; l < (SimplexId)star1.size(); l++) {
+          if(star1[l] < biggest) {
             pos1++;
           } else {
             break;
           }
         }
-        for(SimplexId l = pos2; l < (SimplexId)(*localVertexStars)[v2].size();
-            l++) {
-          if((*localVertexStars)[v2][l] < biggest) {
+        for(SimplexId l = pos2; l < (SimplexId)star2.size(); l++) {
+          if(star2[l] < biggest) {
             pos2++;
           } else {
             break;
           }
         }
 
-        if((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-           && (pos1 < (SimplexId)(*localVertexStars)[v1].size())
-           && (pos2 < (SimplexId)(*localVertexStars)[v2].size())) {
+        if((pos0 < (SimplexId)star0.size()) && (pos1 < (SimplexId)star1.size())
+           && (pos2 < (SimplexId)star2.size())) {
 
-          if(((*localVertexStars)[v0][pos0] == (*localVertexStars)[v1][pos1])
-             && ((*localVertexStars)[v0][pos0]
-                 == (*localVertexStars)[v2][pos2])) {
+          if((star0[pos0] == star1[pos1]) && (star0[pos0] == star2[pos2])) {
 
-            if((*localVertexStars)[v0][pos0] != i) {
-              intersection = (*localVertexStars)[v0][pos0];
+            if(star0[pos0] != i) {
+              intersection = star0[pos0];
               break;
             }
 
@@ -367,11 +309,13 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
       }
 
       if(intersection != -1) {
-        cellNeighbors[i].push_back(intersection);
+        cellNeighbors.set(i, neighborNumbers[i]++, intersection);
       }
     }
   }
 
+  cellNeighbors.shrinkRows(neighborNumbers);
+
   {
     stringstream msg;
     msg << "[ThreeSkeleton] Cell neighbors (" << cellNumber
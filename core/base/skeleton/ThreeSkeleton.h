@@ -37,10 +37,9 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param cellEdges Output edge lists. The size of this std::vector
-    /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the edge identifiers of the entry's cell's
-    /// edges.
+    /// \param cellEdges Output edge lists. The number of rows of this table
+    /// will be equal to the number of cells in the mesh. Each row will list
+    /// the edge identifiers of the row's cell's edges.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
     /// If not NULL but pointing to an empty std::vector, the function will
@@ -54,23 +53,20 @@ namespace ttk {
     /// std::vector is not empty but incorrect, the behavior is unspecified.
     /// \param vertexEdges Optional list of edges for each vertex. If NULL,
     /// the function will compute this list anyway and free the related
-    /// memory upon return. If not NULL but pointing to an empty std::vector,
-    /// the function will fill this empty std::vector (useful if this list
-    /// needs to
+    /// memory upon return. If not NULL but pointing to an empty table,
+    /// the function will fill this empty table (useful if this list needs to
     /// be used later on by the calling program). If not NULL but pointing to
-    /// a non-empty std::vector, this function will use this std::vector as
-    /// internal
-    /// vertex edge list. If this std::vector is not empty but incorrect, the
+    /// a non-empty table, this function will use this table as internal
+    /// vertex edge list. If this table is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildCellEdges(const SimplexId &vertexNumber,
                        const SimplexId &cellNumber,
-                       const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &cellEdges,
+                       const CellArray &cellArray,
+                       FlatJaggedArray &cellEdges,
                        std::vector<std::pair<SimplexId, SimplexId>> *edgeList
                        = NULL,
-                       std::vector<std::vector<SimplexId>> *vertexEdges
-                       = NULL) const;
+                       FlatJaggedArray *vertexEdges = NULL) const;
 
     /// Compute the list of cell-neighbors of each cell of a triangulation
     /// (unspecified behavior if the input mesh is not a triangulation).
@@ -83,29 +79,25 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param cellNeighbors Output neighbor list. The size of this
-    /// std::vector
-    /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the cell identifiers of the entry's cell's
-    /// neighbors.
+    /// \param cellNeighbors Output neighbor list. The number of rows of this
+    /// table will be equal to the number of cells in the mesh. Each row will
+    /// list the cell identifiers of the row's cell's neighbors.
     /// \param triangleStars Optional list of triangle stars (list of
     /// 3-dimensional cells connected to each triangle). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty table, the
+    /// function will fill this empty table (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
-    /// internal
-    /// triangle star list. If this std::vector is not empty but incorrect,
-    /// the
+    /// to a non-empty table, this function will use this table as internal
+    /// triangle star list. If this table is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildCellNeighborsFromTriangles(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
-      const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *triangleStars = NULL) const;
+      const CellArray &cellArray,
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *triangleStars = NULL) const;
 
     /// Compute the list of cell-neighbors of each cell of a triangulation
     /// (unspecified behavior if the input mesh is not a triangulation).
@@ -115,28 +107,26 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param cellNeighbors Output neighbor list. The size of this
-    /// std::vector
-    /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the cell identifiers of the entry's cell's
-    /// neighbors.
+    /// \param cellNeighbors Output neighbor list. The number of rows of this
+    /// table will be equal to the number of cells in the mesh. Each row will
+    /// list the cell identifiers of the row's cell's neighbors.
     /// \param vertexStars Optional list of vertex stars (list of
-    /// 3-dimensional cells connected to each vertex). If NULL, the
+    /// 3-dimensional cells connected to each vertex, by increasing
+    /// identifiers, see ZeroSkeleton::buildVertexStars()). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty table, the
+    /// function will fill this empty table (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
-    /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// to a non-empty table, this function will use this table as internal
+    /// vertex star list. If this table is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildCellNeighborsFromVertices(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
-      const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *vertexStars = NULL) const;
+      const CellArray &cellArray,
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *vertexStars = NULL) const;
 
   protected:
   };
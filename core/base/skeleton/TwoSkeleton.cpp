@@ -12,20 +12,20 @@ TwoSkeleton::~TwoSkeleton() {
 int TwoSkeleton::buildCellNeighborsFromVertices(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *vertexStars) const {
+  const CellArray &cellArray,
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *vertexStars) const {
 
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
 
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
 
-  if(!localVertexStars->size()) {
+  if(localVertexStars->empty()) {
 
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setThreadNumber(threadNumber_);
@@ -34,63 +34,63 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
       vertexNumber, cellNumber, cellArray, *localVertexStars);
   }
 
-  SimplexId vertexPerCell = cellArray[0];
+  SimplexId vertexPerCell = cellArray.getCellVertexNumber();
 
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++)
-    cellNeighbors[i].reserve(vertexPerCell);
-
-    // pre-sort vertex stars
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    sort((*localVertexStars)[i].begin(), (*localVertexStars)[i].end());
+  // at most one neighbor per edge of the cell
+  vector<SimplexId> neighborNumbers(cellNumber, vertexPerCell);
+  cellNeighbors.setRowSizes(neighborNumbers);
 
+  // NOTE: the vertex stars are sorted by construction (see
+  // ZeroSkeleton::buildVertexStars())
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId i = 0; i < cellNumber; i++) {
 
+    neighborNumbers[i] = 0;
+
     for(SimplexId j = 0; j < vertexPerCell; j++) {
 
-      SimplexId v0 = cellArray[(vertexPerCell + 1) * i + 1 + j];
+      SimplexId v0 = cellArray.getCellVertex(i, j);
       SimplexId v1
-        = cellArray[(vertexPerCell + 1) * i + 1 + (j + 1) % vertexPerCell];
+        = cellArray.getCellVertex(i, (j + 1) % vertexPerCell);
+
+      const auto star0 = (*localVertexStars)[v0];
+      const auto star1 = (*localVertexStars)[v1];
 
       // perform an intersection of the 2 sorted star lists
       SimplexId pos0 = 0, pos1 = 0;
       SimplexId intersection = -1;
 
-      while((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-            && (pos1 < (SimplexId)(*localVertexStars)[v1].size())) {
+      while((pos0 < (SimplexId)star0.size())
+            && (pos1 < (SimplexId)star1.size())) {
 
-        SimplexId biggest = (*localVertexStars)[v0][pos0];
-        if((*localVertexStars)[v1][pos1] > biggest) {
-          biggest = (*localVertexStars)[v1][pos1];
+        SimplexId biggest = star0[pos0];
+        if(star1[pos1] > biggest) {
+          biggest = star1[pos1];
         }
 
-        for(SimplexId l = pos0; l < (SimplexId)(*localVertexStars)[v0].size();
-            l++) {
-          if((*localVertexStars)[v0][l] < biggest) {
+        for(SimplexId l = pos0; l < (SimplexId)star0.size(); l++) {
+          if(star0[l] < biggest) {
             pos0++;
           } else {
             break;
           }
         }
-        for(SimplexId l = pos1; l < (SimplexId)(*localVertexStars)[v1].size();
-            l++) {
-          if((*localVertexStars)[v1][l] < biggest) {
+        for(SimplexId l = pos1; l < (SimplexId)star1.size(); l++) {
+          if(star1[l] < biggest) {
             pos1++;
           } else {
             break;
           }
         }
 
-        if((*localVertexStars)[v0][pos0] == (*localVertexStars)[v1][pos1]) {
+        if((pos0 < (SimplexId)star0.size())
+           && (pos1 < (SimplexId)star1.size())
+           && (star0[pos0] == star1[pos1])) {
 
-          if((*localVertexStars)[v0][pos0] != i) {
-            intersection = (*localVertexStars)[v0][pos0];
+          if(star0[pos0] != i) {
+            intersection = star0[pos0];
             break;
           }
 
@@ -100,11 +100,13 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
       }
 
       if(intersection != -1) {
-        cellNeighbors[i].push_back(intersection);
+        cellNeighbors.set(i, neighborNumbers[i]++, intersection);
       }
     }
   }
 
+  cellNeighbors.shrinkRows(neighborNumbers);
+
   {
     stringstream msg;
     msg << "[TwoSkeleton] Cell neighbors (" << cellNumber
@@ -119,14 +121,14 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
 int TwoSkeleton::buildEdgeTriangles(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &edgeTriangleList,
-  vector<vector<SimplexId>> *vertexStarList,
+  const CellArray &cellArray,
+  FlatJaggedArray &edgeTriangleList,
+  FlatJaggedArray *vertexStarList,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *edgeStarList,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStarList,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+  FlatJaggedArray *edgeStarList,
+  FlatJaggedArray *triangleList,
+  FlatJaggedArray *triangleStarList,
+  FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
@@ -136,7 +138,7 @@ int TwoSkeleton::buildEdgeTriangles(
     return -1;
   if(cellNumber <= 0)
     return -2;
-  if(!cellArray)
+  if(cellArray.empty())
     return -3;
 #endif
 
@@ -151,13 +153,13 @@ int TwoSkeleton::buildEdgeTriangles(
   }
 
   auto localEdgeStarList = edgeStarList;
-  vector<vector<SimplexId>> defaultEdgeStarList{};
+  FlatJaggedArray defaultEdgeStarList{};
   if(!localEdgeStarList) {
     localEdgeStarList = &defaultEdgeStarList;
   }
 
   auto localTriangleList = triangleList;
-  vector<vector<SimplexId>> defaultTriangleList{};
+  FlatJaggedArray defaultTriangleList{};
   if(!localTriangleList) {
     localTriangleList = &defaultTriangleList;
   }
@@ -167,7 +169,7 @@ int TwoSkeleton::buildEdgeTriangles(
   // need it.
 
   auto localCellTriangleList = cellTriangleList;
-  vector<vector<SimplexId>> defaultCellTriangleList{};
+  FlatJaggedArray defaultCellTriangleList{};
   if(!localCellTriangleList) {
     localCellTriangleList = &defaultCellTriangleList;
   }
@@ -189,31 +191,51 @@ int TwoSkeleton::buildEdgeTriangles(
   }
 
   if((localTriangleList->empty()) || (localCellTriangleList->empty())) {
-    buildTriangleList(vertexNumber, cellNumber, cellArray, localTriangleList,
-                      triangleStarList, localCellTriangleList);
+    // only fill the tables which have not been computed yet
+    FlatJaggedArray *triangleOutput = NULL, *triangleStarOutput = NULL,
+                    *cellTriangleOutput = NULL;
+    if(localTriangleList->empty())
+      triangleOutput = localTriangleList;
+    if((triangleStarList) && (triangleStarList->empty()))
+      triangleStarOutput = triangleStarList;
+    if(localCellTriangleList->empty())
+      cellTriangleOutput = localCellTriangleList;
+    buildTriangleList(vertexNumber, cellNumber, cellArray, triangleOutput,
+                      triangleStarOutput, cellTriangleOutput);
   }
 
-  edgeTriangleList.resize(localEdgeList->size());
+  const SimplexId edgeNumber = localEdgeList->size();
+
+  // upper bound: all the triangles of the tetrahedra of the edge star
+  vector<SimplexId> triangleNumbers(edgeNumber, 0);
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    for(SimplexId j = 0; j < localEdgeStarList->size(i); j++) {
+      triangleNumbers[i]
+        += localCellTriangleList->size(localEdgeStarList->get(i, j));
+    }
+  }
+  edgeTriangleList.setRowSizes(triangleNumbers);
 
   // alright, let's get things done now.
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
+  for(SimplexId i = 0; i < edgeNumber; i++) {
     SimplexId vertexId0, vertexId1, vertexId2;
 
-    for(SimplexId j = 0; j < (SimplexId)(*localEdgeStarList)[i].size(); j++) {
-      SimplexId tetId = (*localEdgeStarList)[i][j];
+    triangleNumbers[i] = 0;
 
-      for(SimplexId k = 0;
-          k < (SimplexId)(*localCellTriangleList)[tetId].size(); k++) {
-        SimplexId triangleId = (*localCellTriangleList)[tetId][k];
+    for(SimplexId j = 0; j < localEdgeStarList->size(i); j++) {
+      SimplexId tetId = localEdgeStarList->get(i, j);
+
+      for(SimplexId k = 0; k < localCellTriangleList->size(tetId); k++) {
+        SimplexId triangleId = localCellTriangleList->get(tetId, k);
 
         bool isAttached = false;
 
-        vertexId0 = (*localTriangleList)[triangleId][0];
-        vertexId1 = (*localTriangleList)[triangleId][1];
-        vertexId2 = (*localTriangleList)[triangleId][2];
+        vertexId0 = localTriangleList->get(triangleId, 0);
+        vertexId1 = localTriangleList->get(triangleId, 1);
+        vertexId2 = localTriangleList->get(triangleId, 2);
 
         if((*localEdgeList)[i].first == vertexId0) {
           if(((*localEdgeList)[i].second == vertexId1)
@@ -239,22 +261,23 @@ int TwoSkeleton::buildEdgeTriangles(
         if(isAttached) {
 
           bool isIn = false;
-          for(SimplexId l = 0; l < (SimplexId)edgeTriangleList[i].size(); l++) {
-            if(edgeTriangleList[i][l] == triangleId) {
+          for(SimplexId l = 0; l < triangleNumbers[i]; l++) {
+            if(edgeTriangleList.get(i, l) == triangleId) {
               isIn = true;
               break;
             }
           }
           if(!isIn) {
-            edgeTriangleList[i].push_back(triangleId);
+            edgeTriangleList.set(i, triangleNumbers[i]++, triangleId);
           }
         }
       }
     }
   }
 
-  SimplexId edgeNumber = localEdgeList->size();
-  SimplexId triangleNumber = localTriangleList->size();
+  edgeTriangleList.shrinkRows(triangleNumbers);
+
+  SimplexId triangleNumber = localTriangleList->subvectorsNumber();
 
   {
     stringstream msg;
@@ -267,21 +290,15 @@ int TwoSkeleton::buildEdgeTriangles(
   return 0;
 }
 
-int TwoSkeleton::buildTriangleList(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStars,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+int TwoSkeleton::buildTriangleList(const SimplexId &vertexNumber,
+                                   const SimplexId &cellNumber,
+                                   const CellArray &cellArray,
+                                   FlatJaggedArray *triangleList,
+                                   FlatJaggedArray *triangleStars,
+                                   FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
   SimplexId triangleNumber = 0;
 
   // check the consistency of the variables -- to adapt
@@ -290,7 +307,7 @@ int TwoSkeleton::buildTriangleList(
     return -1;
   if(cellNumber <= 0)
     return -2;
-  if(!cellArray)
+  if(cellArray.empty())
     return -3;
   if((!triangleList) && (!triangleStars) && (!cellTriangleList)) {
     // we've got nothing to do here.
@@ -298,24 +315,17 @@ int TwoSkeleton::buildTriangleList(
   }
 #endif
 
-  if(triangleList) {
-    // NOTE: 9 is pretty empirical here...
-    triangleList->clear();
-    triangleList->reserve(9 * vertexNumber);
-  }
-  if(triangleStars) {
-    triangleStars->clear();
-    triangleStars->reserve(9 * vertexNumber);
-  }
-  if(cellTriangleList) {
-    cellTriangleList->resize(cellNumber);
-    for(SimplexId i = 0; i < cellNumber; i++)
-      // assuming tet-mesh here
-      (*cellTriangleList)[i].resize(4, -1);
-  }
+  // for each face of each tet, identifier of its triangle
+  // (assuming tet-mesh here)
+  vector<SimplexId> faceTriangles(4 * (LongSimplexId)cellNumber, -1);
+  // for each triangle, its sorted vertex identifiers
+  vector<SimplexId> triangleVertices;
 
   if(threadNumber_ == 1) {
 
+    // NOTE: 9 is pretty empirical here...
+    triangleVertices.reserve(3 * 9 * (LongSimplexId)vertexNumber);
+
     // for each vertex,
     //   list of triangles
     //    each triangle is a list vertex Id + a triangleId
@@ -334,7 +344,7 @@ int TwoSkeleton::buildTriangleList(
           // doing triangle j
 
           for(int k = 0; k < 3; k++) {
-            triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
+            triangle[k] = cellArray.getCellVertex(i, (j + k) % 4);
           }
           sort(triangle.begin(), triangle.end());
 
@@ -356,32 +366,12 @@ int TwoSkeleton::buildTriangleList(
               pair<vector<SimplexId>, SimplexId>(triangle, triangleNumber));
             triangleNumber++;
 
-            if(triangleList) {
-              triangleList->size();
-              triangleList->push_back(triangle);
-            }
-            if(triangleStars) {
-              triangleStars->resize(triangleStars->size() + 1);
-              triangleStars->back().resize(1);
-              // store the tet i in the triangleStars list
-              triangleStars->back().back() = i;
-            }
-          } else {
-            if(triangleStars) {
-              // add tet i as a neighbor of triangleId
-              (*triangleStars)[triangleId].push_back(i);
-            }
+            triangleVertices.insert(
+              triangleVertices.end(), triangle.begin(), triangle.end());
           }
 
-          if(cellTriangleList) {
-            // add the triangle to the cell
-            for(int k = 0; k < 4; k++) {
-              if((*cellTriangleList)[i][k] == -1) {
-                (*cellTriangleList)[i][k] = triangleId;
-                break;
-              }
-            }
-          }
+          // add the triangle to the cell
+          faceTriangles[4 * (LongSimplexId)i + j] = triangleId;
         }
 
         // update the progress bar of the wrapping code -- to adapt
@@ -394,191 +384,100 @@ int TwoSkeleton::buildTriangleList(
     }
   } else {
 
-    Timer memTimer;
-    //  for each thread,
-    //    for each vertex
-    //      for each triangle
-    //        vertex ids
-    //        triangleId
-    vector<vector<vector<pair<vector<SimplexId>, SimplexId>>>>
-      threadedTriangleTable(threadNumber_);
-
-    vector<SimplexId> triangleNumbers(threadNumber_, 0);
+    // NOTE: the per-vertex deduplication above does not scale in parallel.
+    // with several threads, let's sort the triangle keys instead.
+    struct TriangleItem {
+      SimplexId v[3];
+      // position of the triangle in the enumeration of the cell faces
+      LongSimplexId occurrence;
+    };
 
-    vector<vector<vector<SimplexId>>> threadedTriangleStars(threadNumber_);
+    // 1) one sorted vertex triplet per face of each tet
+    vector<TriangleItem> items(4 * (LongSimplexId)cellNumber);
 
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedTriangleTable[i].resize(vertexNumber);
-    }
-
-    int count = 0;
-
-    // the following open-mp processing is only relevant for embarassingly
-    // parallel algorithms (such as smoothing) -- to adapt
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-    for(SimplexId i = 0; i < (SimplexId)cellNumber; i++) {
-
-      // avoid any processing if the abort signal is sent
-      if((!wrapper_) || ((wrapper_) && (!wrapper_->needsToAbort()))) {
-
-        ThreadId threadId = 1;
-#ifdef TTK_ENABLE_OPENMP
-        threadId = omp_get_thread_num();
-#endif
-
-        vector<SimplexId> triangle(3);
-
-        for(int j = 0; j < 4; j++) {
-          // doing triangle j
-
-          for(int k = 0; k < 3; k++) {
-            triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
-          }
-          sort(triangle.begin(), triangle.end());
-
-          SimplexId triangleId = -1;
-          for(SimplexId k = 0;
-              k
-              < (SimplexId)threadedTriangleTable[threadId][triangle[0]].size();
-              k++) {
-
-            // processing a triangle stored for that vertex
-            if((threadedTriangleTable[threadId][triangle[0]][k].first[1]
-                == triangle[1])
-               && (threadedTriangleTable[threadId][triangle[0]][k].first[2]
-                   == triangle[2])) {
-              triangleId
-                = threadedTriangleTable[threadId][triangle[0]][k].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-            // not visited by this thread
-            threadedTriangleTable[threadId][triangle[0]].push_back(
-              pair<vector<SimplexId>, SimplexId>(
-                triangle, triangleNumbers[threadId]));
-            triangleNumbers[threadId]++;
-
-            if(triangleStars) {
-              threadedTriangleStars[threadId].resize(
-                threadedTriangleStars[threadId].size() + 1);
-              threadedTriangleStars[threadId].back().resize(1);
-              threadedTriangleStars[threadId].back().back() = i;
-            }
-          } else {
-            if(triangleStars) {
-              threadedTriangleStars[threadId][triangleId].push_back(i);
-            }
-          }
-        }
-
-        // update the progress bar of the wrapping code -- to adapt
-        if(debugLevel_ > advancedInfoMsg) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
-          {
-            if((wrapper_) && (!(count % ((cellNumber) / 10)))) {
-              wrapper_->updateProgress((count + 1.0) / cellNumber);
-            }
-
-            count++;
-          }
+    for(SimplexId i = 0; i < cellNumber; i++) {
+      for(int j = 0; j < 4; j++) {
+        TriangleItem &item = items[4 * (LongSimplexId)i + j];
+        for(int k = 0; k < 3; k++) {
+          item.v[k] = cellArray.getCellVertex(i, (j + k) % 4);
         }
+        sort(item.v, item.v + 3);
+        item.occurrence = 4 * (LongSimplexId)i + j;
       }
     }
 
-    Timer mergeTimer;
-    // now merge the lists
-    vector<vector<pair<vector<SimplexId>, SimplexId>>> mainTriangleTable(
-      vertexNumber);
-    //     for(int i = 0; i < vertexNumber; i++){
-    //       mainTriangleTable[i].reserve(32);
-    //     }
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-
-      // vertex j
-      for(SimplexId j = 0; j < (SimplexId)threadedTriangleTable[i].size();
-          j++) {
-
-        // triangle k
-        for(SimplexId k = 0; k < (SimplexId)threadedTriangleTable[i][j].size();
-            k++) {
-
-          SimplexId triangleId = -1;
-          // triangle l
-          for(SimplexId l = 0; l < (SimplexId)mainTriangleTable[j].size();
-              l++) {
-            if((threadedTriangleTable[i][j][k].first[0]
-                == mainTriangleTable[j][l].first[0])
-               && (threadedTriangleTable[i][j][k].first[1]
-                   == mainTriangleTable[j][l].first[1])
-               && (threadedTriangleTable[i][j][k].first[2]
-                   == mainTriangleTable[j][l].first[2])) {
-
-              triangleId = mainTriangleTable[j][l].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-
-            triangleId = triangleNumber;
-            mainTriangleTable[j].push_back(pair<vector<SimplexId>, SimplexId>(
-              threadedTriangleTable[i][j][k].first, triangleNumber));
-            triangleNumber++;
+    // 2) lexicographic sort of the keys (the sort is stable, the
+    // occurrences of a given triangle remain ordered)
+    const int vertexBits = RadixSort::bitNumber(vertexNumber);
+    for(int k = 2; k >= 0; k--) {
+      RadixSort::sort(
+        items,
+        [k](const TriangleItem &item) {
+          return (unsigned long long)item.v[k];
+        },
+        vertexBits, threadNumber_);
+    }
 
-            if(triangleList)
-              triangleList->push_back(mainTriangleTable[j].back().first);
+    // 3) one range of items per triangle
+    vector<pair<size_t, size_t>> triangles;
+    RadixSort::equalRanges(
+      items,
+      [](const TriangleItem &a, const TriangleItem &b) {
+        return (a.v[0] == b.v[0]) && (a.v[1] == b.v[1]) && (a.v[2] == b.v[2]);
+      },
+      triangles, threadNumber_);
+
+    // 4) triangle identifiers: same ordering as the sequential enumeration
+    // (by first occurrence in the cells)
+    RadixSort::sort(
+      triangles,
+      [&items](const pair<size_t, size_t> &triangle) {
+        return (unsigned long long)items[triangle.first].occurrence;
+      },
+      RadixSort::bitNumber(items.size()), threadNumber_);
+
+    triangleNumber = triangles.size();
+    triangleVertices.resize(3 * (LongSimplexId)triangleNumber);
 
-            if(triangleStars) {
-              triangleStars->resize(triangleStars->size() + 1);
-              triangleStars->back().resize(1);
-              triangleStars->back()
-                = threadedTriangleStars[i]
-                                       [threadedTriangleTable[i][j][k].second];
-            }
-          } else {
-            if(triangleStars) {
-              for(SimplexId l = 0;
-                  l < (SimplexId)threadedTriangleStars
-                        [i][threadedTriangleTable[i][j][k].second]
-                          .size();
-                  l++) {
-                (*triangleStars)[triangleId].push_back(
-                  threadedTriangleStars[i][threadedTriangleTable[i][j][k]
-                                             .second][l]);
-              }
-            }
-          }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < triangleNumber; i++) {
+      const size_t begin = triangles[i].first;
+      for(int k = 0; k < 3; k++)
+        triangleVertices[3 * (LongSimplexId)i + k] = items[begin].v[k];
+      for(size_t j = begin; j < triangles[i].second; j++)
+        faceTriangles[items[j].occurrence] = i;
+    }
+  }
 
-          if(cellTriangleList) {
-            // add the triangle to the cell
-            SimplexId cellId = -1;
-
-            for(SimplexId l = 0;
-                l
-                < (SimplexId)
-                    threadedTriangleStars[i]
-                                         [threadedTriangleTable[i][j][k].second]
-                                           .size();
-                l++) {
-              cellId = threadedTriangleStars[i][threadedTriangleTable[i][j][k]
-                                                  .second][l];
-              for(int m = 0; m < 4; m++) {
-                if((*cellTriangleList)[cellId][m] == -1) {
-                  (*cellTriangleList)[cellId][m] = triangleId;
-                  break;
-                }
-              }
-            }
-          }
-        }
-      }
+  // outputs
+  if(triangleStars) {
+    // the tets of the star are listed by increasing identifiers
+    vector<SimplexId> starSizes(triangleNumber, 0);
+    for(size_t i = 0; i < faceTriangles.size(); i++) {
+      if(faceTriangles[i] != -1)
+        starSizes[faceTriangles[i]]++;
+    }
+    triangleStars->setRowSizes(starSizes);
+    std::fill(starSizes.begin(), starSizes.end(), 0);
+    for(size_t i = 0; i < faceTriangles.size(); i++) {
+      const SimplexId triangleId = faceTriangles[i];
+      if(triangleId != -1)
+        triangleStars->set(triangleId, starSizes[triangleId]++, i / 4);
     }
   }
+  if(triangleList) {
+    triangleList->fillFrom(
+      vector<SimplexId>(triangleNumber, 3), std::move(triangleVertices));
+  }
+  if(cellTriangleList) {
+    cellTriangleList->fillFrom(
+      vector<SimplexId>(cellNumber, 4), std::move(faceTriangles));
+  }
 
   {
     stringstream msg;
@@ -588,8 +487,6 @@ int TwoSkeleton::buildTriangleList(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
   // 1 thread: 58.5631 s
   // 24 threads: 87.5816 s (~)
@@ -612,13 +509,13 @@ int TwoSkeleton::buildTriangleList(
 int TwoSkeleton::buildTriangleEdgeList(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &triangleEdgeList,
-  vector<vector<SimplexId>> *vertexEdgeList,
+  const CellArray &cellArray,
+  FlatJaggedArray &triangleEdgeList,
+  FlatJaggedArray *vertexEdgeList,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStarList,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+  FlatJaggedArray *triangleList,
+  FlatJaggedArray *triangleStarList,
+  FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
@@ -638,12 +535,12 @@ int TwoSkeleton::buildTriangleEdgeList(
   }
 
   auto localVertexEdgeList = vertexEdgeList;
-  vector<vector<SimplexId>> defaultVertexEdgeList{};
+  FlatJaggedArray defaultVertexEdgeList{};
   if(!localVertexEdgeList) {
     localVertexEdgeList = &defaultVertexEdgeList;
   }
 
-  if(!localVertexEdgeList->size()) {
+  if(localVertexEdgeList->empty()) {
 
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setDebugLevel(debugLevel_);
@@ -658,17 +555,31 @@ int TwoSkeleton::buildTriangleEdgeList(
   // can compute them for free optionally.
 
   auto localTriangleList = triangleList;
-  vector<vector<SimplexId>> defaultTriangleList{};
+  FlatJaggedArray defaultTriangleList{};
   if(!localTriangleList) {
     localTriangleList = &defaultTriangleList;
   }
-  if(!localTriangleList->size()) {
+  if(localTriangleList->empty()) {
 
+    FlatJaggedArray *triangleStarOutput = NULL, *cellTriangleOutput = NULL;
+    if((triangleStarList) && (triangleStarList->empty()))
+      triangleStarOutput = triangleStarList;
+    if((cellTriangleList) && (cellTriangleList->empty()))
+      cellTriangleOutput = cellTriangleList;
     buildTriangleList(vertexNumber, cellNumber, cellArray, localTriangleList,
-                      triangleStarList, cellTriangleList);
+                      triangleStarOutput, cellTriangleOutput);
   }
 
-  triangleEdgeList.resize(localTriangleList->size());
+  const SimplexId triangleNumber = localTriangleList->subvectorsNumber();
+
+  // at most one edge per pair of vertices of the triangle
+  vector<SimplexId> edgeNumbers(triangleNumber, 0);
+  for(SimplexId i = 0; i < triangleNumber; i++) {
+    const SimplexId triangleVertexNumber = localTriangleList->size(i);
+    edgeNumbers[i] = triangleVertexNumber * (triangleVertexNumber - 1) / 2;
+  }
+  triangleEdgeList.setRowSizes(edgeNumbers);
+  std::fill(edgeNumbers.begin(), edgeNumbers.end(), 0);
 
   // now for each triangle, grab its vertices, add the edges in the triangle
   // with no duplicate
@@ -676,14 +587,13 @@ int TwoSkeleton::buildTriangleEdgeList(
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localTriangleList->size(); i++) {
-    SimplexId vertexId = -1;
-    for(SimplexId j = 0; j < (SimplexId)(*localTriangleList)[i].size(); j++) {
-      vertexId = (*localTriangleList)[i][j];
+  for(SimplexId i = 0; i < triangleNumber; i++) {
+    const FlatJaggedArray::Slice triangle = (*localTriangleList)[i];
+    for(SimplexId j = 0; j < (SimplexId)triangle.size(); j++) {
+      const SimplexId vertexId = triangle[j];
 
-      for(SimplexId k = 0;
-          k < (SimplexId)(*localVertexEdgeList)[vertexId].size(); k++) {
-        SimplexId edgeId = (*localVertexEdgeList)[vertexId][k];
+      for(SimplexId k = 0; k < localVertexEdgeList->size(vertexId); k++) {
+        const SimplexId edgeId = localVertexEdgeList->get(vertexId, k);
 
         SimplexId otherVertexId = (*localEdgeList)[edgeId].first;
 
@@ -692,9 +602,8 @@ int TwoSkeleton::buildTriangleEdgeList(
         }
 
         bool isInTriangle = false;
-        for(SimplexId l = 0; l < (SimplexId)(*localTriangleList)[i].size();
-            l++) {
-          if((*localTriangleList)[i][l] == otherVertexId) {
+        for(SimplexId l = 0; l < (SimplexId)triangle.size(); l++) {
+          if(triangle[l] == otherVertexId) {
             isInTriangle = true;
             break;
           }
@@ -702,21 +611,22 @@ int TwoSkeleton::buildTriangleEdgeList(
 
         if(isInTriangle) {
           bool isIn = false;
-          for(SimplexId l = 0; l < (SimplexId)triangleEdgeList[i].size(); l++) {
-            if(triangleEdgeList[i][l] == edgeId) {
+          for(SimplexId l = 0; l < edgeNumbers[i]; l++) {
+            if(triangleEdgeList.get(i, l) == edgeId) {
               isIn = true;
               break;
             }
           }
           if(!isIn) {
-            triangleEdgeList[i].push_back(edgeId);
+            triangleEdgeList.set(i, edgeNumbers[i]++, edgeId);
           }
         }
       }
     }
   }
 
-  SimplexId triangleNumber = localTriangleList->size();
+  triangleEdgeList.shrinkRows(edgeNumbers);
+
   SimplexId edgeNumber = localEdgeList->size();
 
   {
@@ -731,44 +641,56 @@ int TwoSkeleton::buildTriangleEdgeList(
   return 0;
 }
 
-int TwoSkeleton::buildTriangleLinks(
-  const vector<vector<SimplexId>> &triangleList,
-  const vector<vector<SimplexId>> &triangleStars,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &triangleLinks) const {
+int TwoSkeleton::buildTriangleLinks(const FlatJaggedArray &triangleList,
+                                    const FlatJaggedArray &triangleStars,
+                                    const CellArray &cellArray,
+                                    FlatJaggedArray &triangleLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(triangleList.empty())
     return -1;
-  if((triangleStars.empty()) || (triangleStars.size() != triangleList.size()))
+  if((triangleStars.empty())
+     || (triangleStars.subvectorsNumber()
+         != triangleList.subvectorsNumber()))
     return -2;
-  if(!cellArray)
+  if(cellArray.empty())
     return -3;
 #endif
 
   Timer t;
 
-  triangleLinks.resize(triangleList.size());
+  const SimplexId triangleNumber = triangleList.subvectorsNumber();
+
+  // at most one link vertex per tet of the star
+  vector<SimplexId> linkSizes(triangleNumber, 0);
+  for(SimplexId i = 0; i < triangleNumber; i++)
+    linkSizes[i] = triangleStars.size(i);
+  triangleLinks.setRowSizes(linkSizes);
+  std::fill(linkSizes.begin(), linkSizes.end(), 0);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
+  for(SimplexId i = 0; i < triangleNumber; i++) {
 
-    for(SimplexId j = 0; j < (SimplexId)triangleStars[i].size(); j++) {
+    for(SimplexId j = 0; j < triangleStars.size(i); j++) {
 
       for(int k = 0; k < 4; k++) {
-        SimplexId vertexId = cellArray[5 * triangleStars[i][j] + 1 + k];
+        SimplexId vertexId
+          = cellArray.getCellVertex(triangleStars.get(i, j), k);
 
-        if((vertexId != triangleList[i][0]) && (vertexId != triangleList[i][1])
-           && (vertexId != triangleList[i][2])) {
-          triangleLinks[i].push_back(vertexId);
+        if((vertexId != triangleList.get(i, 0))
+           && (vertexId != triangleList.get(i, 1))
+           && (vertexId != triangleList.get(i, 2))) {
+          triangleLinks.set(i, linkSizes[i]++, vertexId);
           break;
         }
       }
     }
   }
 
+  triangleLinks.shrinkRows(linkSizes);
+
   {
     stringstream msg;
     msg << "[TwoSkeleton] Triangle links built in " << t.getElapsedTime()
@@ -781,62 +703,37 @@ int TwoSkeleton::buildTriangleLinks(
 
 int TwoSkeleton::buildVertexTriangles(
   const SimplexId &vertexNumber,
-  const vector<vector<SimplexId>> &triangleList,
-  vector<vector<SimplexId>> &vertexTriangleList) const {
+  const FlatJaggedArray &triangleList,
+  FlatJaggedArray &vertexTriangleList) const {
 
   Timer t;
 
-  ThreadId oldThreadNumber = threadNumber_;
-
-  threadNumber_ = 1;
-
-  if(threadNumber_ != 1) {
-    vector<vector<vector<SimplexId>>> threadedLists(threadNumber_);
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedLists[i].resize(vertexNumber);
+  // counting pass: number of triangles per vertex
+  vector<SimplexId> triangleNumbers(vertexNumber, 0);
+  for(SimplexId i = 0; i < triangleList.subvectorsNumber(); i++) {
+    for(SimplexId j = 0; j < triangleList.size(i); j++) {
+      triangleNumbers[triangleList.get(i, j)]++;
     }
+  }
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
-      ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      for(SimplexId j = 0; j < (SimplexId)triangleList[i].size(); j++) {
-        threadedLists[threadId][triangleList[i][j]].push_back(i);
-      }
-    }
+  vertexTriangleList.setRowSizes(triangleNumbers);
 
-    // merge back
-    vertexTriangleList.resize(vertexNumber, vector<SimplexId>());
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < vertexNumber; j++) {
-        for(SimplexId k = 0; k < (SimplexId)threadedLists[i][j].size(); k++) {
-          vertexTriangleList[j].push_back(threadedLists[i][j][k]);
-        }
-      }
-    }
-  } else {
-    vertexTriangleList.resize(vertexNumber);
-    for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
-      for(SimplexId j = 0; j < (SimplexId)triangleList[i].size(); j++) {
-        vertexTriangleList[triangleList[i][j]].push_back(i);
-      }
+  // filling pass (triangles are listed by increasing identifiers)
+  std::fill(triangleNumbers.begin(), triangleNumbers.end(), 0);
+  for(SimplexId i = 0; i < triangleList.subvectorsNumber(); i++) {
+    for(SimplexId j = 0; j < triangleList.size(i); j++) {
+      const SimplexId vertexId = triangleList.get(i, j);
+      vertexTriangleList.set(vertexId, triangleNumbers[vertexId]++, i);
     }
   }
 
   {
     stringstream msg;
     msg << "[TwoSkeleton] Vertex triangle list (" << vertexNumber
-        << " vertices) computed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << endl;
+        << " vertices) computed in " << t.getElapsedTime()
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   return 0;
 }
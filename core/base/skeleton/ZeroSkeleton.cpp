@@ -13,98 +13,107 @@ ZeroSkeleton::~ZeroSkeleton() {
 int ZeroSkeleton::buildVertexEdges(
   const SimplexId &vertexNumber,
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  vector<vector<SimplexId>> &vertexEdges) const {
+  FlatJaggedArray &vertexEdges) const {
 
   Timer t;
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
-  vertexEdges.resize(vertexNumber);
-  for(SimplexId i = 0; i < (SimplexId)vertexEdges.size(); i++) {
-    vertexEdges[i].clear();
-  }
+  if(threadNumber_ > 1) {
 
-  if(threadNumber_ == 1) {
-    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
-      vertexEdges[edgeList[i].first].push_back(i);
-      vertexEdges[edgeList[i].second].push_back(i);
-    }
-  } else {
-    vector<vector<vector<SimplexId>>> threadedVertexEdges(threadNumber_);
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedVertexEdges[i].resize(vertexNumber);
-    }
+    // one (vertex, edge) item per edge extremity, sorted by vertex. the sort
+    // being stable, the edges of each vertex remain sorted by identifier.
+    vector<pair<SimplexId, SimplexId>> items(2 * edgeList.size());
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
     for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
+      items[2 * i] = pair<SimplexId, SimplexId>(edgeList[i].first, i);
+      items[2 * i + 1] = pair<SimplexId, SimplexId>(edgeList[i].second, i);
+    }
+
+    RadixSort::sort(
+      items,
+      [](const pair<SimplexId, SimplexId> &item) {
+        return (unsigned long long)item.first;
+      },
+      RadixSort::bitNumber(vertexNumber), threadNumber_);
+
+    vector<pair<size_t, size_t>> ranges;
+    RadixSort::equalRanges(
+      items,
+      [](const pair<SimplexId, SimplexId> &a,
+         const pair<SimplexId, SimplexId> &b) { return a.first == b.first; },
+      ranges, threadNumber_);
 
-      ThreadId threadId = 0;
+    vector<SimplexId> edgeNumbers(vertexNumber, 0);
+    vector<SimplexId> edgeIds(items.size());
 
 #ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
+#pragma omp parallel for num_threads(threadNumber_)
 #endif
-
-      threadedVertexEdges[threadId][edgeList[i].first].push_back(i);
-      threadedVertexEdges[threadId][edgeList[i].second].push_back(i);
+    for(SimplexId i = 0; i < (SimplexId)ranges.size(); i++) {
+      edgeNumbers[items[ranges[i].first].first]
+        = ranges[i].second - ranges[i].first;
+      for(size_t j = ranges[i].first; j < ranges[i].second; j++)
+        edgeIds[j] = items[j].second;
     }
 
-    // now merge the thing
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < (SimplexId)threadedVertexEdges[i].size(); j++) {
-        for(SimplexId k = 0; k < (SimplexId)threadedVertexEdges[i][j].size();
-            k++) {
-
-          bool hasFound = false;
-          for(SimplexId l = 0; l < (SimplexId)vertexEdges[j].size(); l++) {
-            if(vertexEdges[j][l] == threadedVertexEdges[i][j][k]) {
-              hasFound = true;
-              break;
-            }
-          }
-          if(!hasFound)
-            vertexEdges[j].push_back(threadedVertexEdges[i][j][k]);
-        }
-      }
+    vertexEdges.fillFrom(edgeNumbers, std::move(edgeIds));
+
+    {
+      stringstream msg;
+      msg << "[ZeroSkeleton] Vertex edges built in " << t.getElapsedTime()
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
+      dMsg(cout, msg.str(), timeMsg);
     }
+
+    return 0;
+  }
+
+  // counting pass
+  vector<SimplexId> edgeNumbers(vertexNumber, 0);
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
+    edgeNumbers[edgeList[i].first]++;
+    edgeNumbers[edgeList[i].second]++;
+  }
+
+  vertexEdges.setRowSizes(edgeNumbers);
+
+  // filling pass
+  std::fill(edgeNumbers.begin(), edgeNumbers.end(), 0);
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
+    const SimplexId v0 = edgeList[i].first;
+    const SimplexId v1 = edgeList[i].second;
+    vertexEdges.set(v0, edgeNumbers[v0]++, i);
+    vertexEdges.set(v1, edgeNumbers[v1]++, i);
   }
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex edges built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // 1 thread: 11.85 s
-  // 24 threads: 20.93 s [not efficient]
-
   return 0;
 }
 
 int ZeroSkeleton::buildVertexLink(const SimplexId &vertexId,
                                   const SimplexId &cellNumber,
-                                  const LongSimplexId *cellArray,
+                                  const CellArray &cellArray,
                                   vector<LongSimplexId> &vertexLink) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(!cellArray)
+  if(cellArray.empty())
     return -1;
 #endif
 
-  SimplexId verticesPerCell = cellArray[0];
+  SimplexId verticesPerCell = cellArray.getCellVertexNumber();
 
   vector<SimplexId> vertexStar;
   for(SimplexId i = 0; i < cellNumber; i++) {
-    for(SimplexId j = 1; j < verticesPerCell; j++) {
-      if(cellArray[(verticesPerCell + 1) * i + j] == vertexId) {
+    for(SimplexId j = 0; j < verticesPerCell - 1; j++) {
+      if(cellArray.getCellVertex(i, j) == vertexId) {
         vertexStar.push_back(i);
         break;
       }
@@ -123,21 +132,21 @@ int ZeroSkeleton::buildVertexLink(const SimplexId &vertexId,
 
     // iterate on the cell's faces
     for(int k = 0; k < 2; k++) {
-      faceIds[1] = cellArray[(verticesPerCell + 1) * cellId + 1 + k];
+      faceIds[1] = cellArray.getCellVertex(cellId, k);
 
       if(faceIds[1] != vertexId) {
 
         if(verticesPerCell > 2) {
 
           for(SimplexId l = k + 1; l <= verticesPerCell - 1; l++) {
-            faceIds[2] = cellArray[(verticesPerCell + 1) * cellId + 1 + l];
+            faceIds[2] = cellArray.getCellVertex(cellId, l);
 
             if(faceIds[2] != vertexId) {
 
               if(verticesPerCell == 4) {
                 // tet case, faceIds has 4 entries to fill
                 for(SimplexId m = l + 1; m < verticesPerCell; m++) {
-                  faceIds[3] = cellArray[(verticesPerCell + 1) * cellId + m];
+                  faceIds[3] = cellArray.getCellVertex(cellId, m - 1);
 
                   if(faceIds[3] != vertexId) {
 
@@ -183,24 +192,24 @@ int ZeroSkeleton::buildVertexLink(const SimplexId &vertexId,
 int ZeroSkeleton::buildVertexLinks(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
+  const CellArray &cellArray,
   vector<vector<LongSimplexId>> &vertexLinks,
-  vector<vector<SimplexId>> *vertexStars) const {
+  FlatJaggedArray *vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(!cellArray)
+  if(cellArray.empty())
     return -1;
 #endif
 
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
 
-  if((SimplexId)localVertexStars->size() != vertexNumber) {
+  if(localVertexStars->subvectorsNumber() != vertexNumber) {
     ZeroSkeleton zeroSkeleton;
     zeroSkeleton.setDebugLevel(debugLevel_);
     zeroSkeleton.setThreadNumber(threadNumber_);
@@ -210,12 +219,12 @@ int ZeroSkeleton::buildVertexLinks(
 
   // WARNING
   // assuming triangulations
-  int verticesPerCell = cellArray[0];
+  int verticesPerCell = cellArray.getCellVertexNumber();
 
   if((SimplexId)vertexLinks.size() != vertexNumber) {
     vertexLinks.resize(vertexNumber);
     for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
-      vertexLinks[i].resize((*localVertexStars)[i].size() * verticesPerCell);
+      vertexLinks[i].resize(localVertexStars->size(i) * verticesPerCell);
     }
   }
 
@@ -244,9 +253,9 @@ int ZeroSkeleton::buildVertexLinks(
     threadId = omp_get_thread_num();
 #endif
 
-    for(SimplexId j = 0; j < (SimplexId)(*localVertexStars)[i].size(); j++) {
+    for(SimplexId j = 0; j < localVertexStars->size(i); j++) {
 
-      SimplexId cellId = (*localVertexStars)[i][j];
+      SimplexId cellId = localVertexStars->get(i, j);
 
       // tet case (4)
       // 0 - 1 - 2
@@ -266,7 +275,7 @@ int ZeroSkeleton::buildVertexLinks(
       for(int k = 0; k < 2; k++) {
 
         faceIds[threadId][1]
-          = cellArray[(verticesPerCell + 1) * cellId + 1 + k];
+          = cellArray.getCellVertex(cellId, k);
 
         if(faceIds[threadId][1] != i) {
 
@@ -274,7 +283,7 @@ int ZeroSkeleton::buildVertexLinks(
 
             for(SimplexId l = k + 1; l <= verticesPerCell - 1; l++) {
               faceIds[threadId][2]
-                = cellArray[(verticesPerCell + 1) * cellId + 1 + l];
+                = cellArray.getCellVertex(cellId, l);
 
               if(faceIds[threadId][2] != i) {
 
@@ -282,7 +291,7 @@ int ZeroSkeleton::buildVertexLinks(
                   // tet case, faceIds[threadId] has 4 entries to fill
                   for(SimplexId m = l + 1; m < verticesPerCell; m++) {
                     faceIds[threadId][3]
-                      = cellArray[(verticesPerCell + 1) * cellId + 1 + m];
+                      = cellArray.getCellVertex(cellId, m);
 
                     // now test if this face contains our vertex or not
                     // there's should be only one face
@@ -363,10 +372,10 @@ int ZeroSkeleton::buildVertexLinks(
 }
 
 int ZeroSkeleton::buildVertexLinks(
-  const vector<vector<SimplexId>> &vertexStars,
-  const vector<vector<SimplexId>> &cellEdges,
+  const FlatJaggedArray &vertexStars,
+  const FlatJaggedArray &cellEdges,
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  vector<vector<SimplexId>> &vertexLinks) const {
+  FlatJaggedArray &vertexLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexStars.empty())
@@ -379,12 +388,20 @@ int ZeroSkeleton::buildVertexLinks(
 
   Timer t;
 
-  vertexLinks.resize(vertexStars.size());
+  const SimplexId vertexNumber = vertexStars.subvectorsNumber();
+
+  // one link edge per triangle of the star
+  vector<SimplexId> linkSizes(vertexNumber);
+  for(SimplexId i = 0; i < vertexNumber; i++)
+    linkSizes[i] = vertexStars.size(i);
+  vertexLinks.setRowSizes(linkSizes);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+
+    linkSizes[i] = 0;
 
     for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
       for(SimplexId k = 0; k < (SimplexId)cellEdges[vertexStars[i][j]].size();
@@ -395,12 +412,16 @@ int ZeroSkeleton::buildVertexLinks(
         SimplexId vertexId1 = edgeList[edgeId].second;
 
         if((vertexId0 != i) && (vertexId1 != i)) {
-          vertexLinks[i].push_back(edgeId);
+          vertexLinks.set(i, linkSizes[i]++, edgeId);
+          break;
         }
       }
     }
   }
 
+  // degenerate triangles (if any) have no link edge
+  vertexLinks.shrinkRows(linkSizes);
+
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex links built in " << t.getElapsedTime()
@@ -411,11 +432,10 @@ int ZeroSkeleton::buildVertexLinks(
   return 0;
 }
 
-int ZeroSkeleton::buildVertexLinks(
-  const vector<vector<SimplexId>> &vertexStars,
-  const vector<vector<SimplexId>> &cellTriangles,
-  const vector<vector<SimplexId>> &triangleList,
-  vector<vector<SimplexId>> &vertexLinks) const {
+int ZeroSkeleton::buildVertexLinks(const FlatJaggedArray &vertexStars,
+                                   const FlatJaggedArray &cellTriangles,
+                                   const FlatJaggedArray &triangleList,
+                                   FlatJaggedArray &vertexLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexStars.empty())
@@ -428,12 +448,20 @@ int ZeroSkeleton::buildVertexLinks(
 
   Timer t;
 
-  vertexLinks.resize(vertexStars.size());
+  const SimplexId vertexNumber = vertexStars.subvectorsNumber();
+
+  // one link triangle per tetrahedron of the star
+  vector<SimplexId> linkSizes(vertexNumber);
+  for(SimplexId i = 0; i < vertexNumber; i++)
+    linkSizes[i] = vertexStars.size(i);
+  vertexLinks.setRowSizes(linkSizes);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+
+    linkSizes[i] = 0;
 
     for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
       for(SimplexId k = 0;
@@ -449,12 +477,16 @@ int ZeroSkeleton::buildVertexLinks(
         }
 
         if(!hasVertex) {
-          vertexLinks[i].push_back(triangleId);
+          vertexLinks.set(i, linkSizes[i]++, triangleId);
+          break;
         }
       }
     }
   }
 
+  // degenerate tetrahedra (if any) have no link triangle
+  vertexLinks.shrinkRows(linkSizes);
+
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex links built in " << t.getElapsedTime()
@@ -468,19 +500,17 @@ int ZeroSkeleton::buildVertexLinks(
 int ZeroSkeleton::buildVertexNeighbors(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &oneSkeleton,
+  const CellArray &cellArray,
+  FlatJaggedArray &vertexNeighbors,
   vector<pair<SimplexId, SimplexId>> *edgeList) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(!cellArray)
+  if(cellArray.empty())
     return -1;
 #endif
 
   Timer t;
 
-  oneSkeleton.resize(vertexNumber);
-
   auto localEdgeList = edgeList;
   vector<pair<SimplexId, SimplexId>> defaultEdgeList{};
   if(!localEdgeList) {
@@ -494,11 +524,22 @@ int ZeroSkeleton::buildVertexNeighbors(
     osk.buildEdgeList(vertexNumber, cellNumber, cellArray, *localEdgeList);
   }
 
+  // counting pass
+  vector<SimplexId> neighborNumbers(vertexNumber, 0);
+  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
+    neighborNumbers[(*localEdgeList)[i].first]++;
+    neighborNumbers[(*localEdgeList)[i].second]++;
+  }
+
+  vertexNeighbors.setRowSizes(neighborNumbers);
+
+  // filling pass (same neighbor order as the jagged version)
+  std::fill(neighborNumbers.begin(), neighborNumbers.end(), 0);
   for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-    oneSkeleton[(*localEdgeList)[i].first].push_back(
-      (*localEdgeList)[i].second);
-    oneSkeleton[(*localEdgeList)[i].second].push_back(
-      (*localEdgeList)[i].first);
+    const SimplexId v0 = (*localEdgeList)[i].first;
+    const SimplexId v1 = (*localEdgeList)[i].second;
+    vertexNeighbors.set(v0, neighborNumbers[v0]++, v1);
+    vertexNeighbors.set(v1, neighborNumbers[v1]++, v0);
   }
 
   {
@@ -508,127 +549,49 @@ int ZeroSkeleton::buildVertexNeighbors(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // (only merging step, after edge list creation)
-  // 1 thread: 9.16 s
-  // 24 threads: 13.21 s [not efficient in parallel]
-
   return 0;
 }
 
-int ZeroSkeleton::buildVertexStars(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &vertexStars) const {
+int ZeroSkeleton::buildVertexStars(const SimplexId &vertexNumber,
+                                   const SimplexId &cellNumber,
+                                   const CellArray &cellArray,
+                                   FlatJaggedArray &vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(!cellArray)
+  if(cellArray.empty())
     return -1;
 #endif
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
   Timer t;
 
-  vertexStars.resize(vertexNumber);
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    vertexStars[i].reserve(32);
-
-  vector<vector<vector<SimplexId>> *> threadedZeroSkeleton(threadNumber_);
-  if(threadNumber_ == 1) {
-    threadedZeroSkeleton[0] = &vertexStars;
-  } else {
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedZeroSkeleton[i] = new vector<vector<SimplexId>>();
-      threadedZeroSkeleton[i]->resize(vertexNumber);
-      for(SimplexId j = 0; j < (SimplexId)threadedZeroSkeleton[i]->size();
-          j++) {
-        (*threadedZeroSkeleton[i])[j].reserve(32);
-      }
-    }
-  }
+  const SimplexId vertexNumberPerCell = cellArray.getCellVertexNumber();
 
-  SimplexId vertexNumberPerCell = cellArray[0];
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
+  // counting pass
+  vector<SimplexId> starNumbers(vertexNumber, 0);
   for(SimplexId i = 0; i < cellNumber; i++) {
-
-    ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-    threadId = omp_get_thread_num();
-#endif
-
     for(SimplexId j = 0; j < vertexNumberPerCell; j++) {
-      (*threadedZeroSkeleton[threadId])[cellArray[(vertexNumberPerCell + 1) * i
-                                                  + 1 + j]]
-        .push_back(i);
+      starNumbers[cellArray.getCellVertex(i, j)]++;
     }
   }
 
-  if(threadNumber_ > 1) {
-    // now merge the thing
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-
-      // looping on vertices
-      for(SimplexId j = 0; j < (SimplexId)threadedZeroSkeleton[i]->size();
-          j++) {
-
-        // looping on the vertex star
-        for(SimplexId k = 0;
-            k < (SimplexId)(*threadedZeroSkeleton[i])[j].size(); k++) {
-
-          bool hasFound = false;
-          if(threadNumber_) {
-            for(SimplexId l = 0; l < (SimplexId)vertexStars[j].size(); l++) {
-              if(vertexStars[j][l] == (*threadedZeroSkeleton[i])[j][k]) {
-                hasFound = true;
-                break;
-              }
-            }
-          }
-          if(!hasFound)
-            vertexStars[j].push_back((*threadedZeroSkeleton[i])[j][k]);
-        }
-      }
-    }
+  vertexStars.setRowSizes(starNumbers);
 
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      delete threadedZeroSkeleton[i];
+  // filling pass (cells are visited by increasing identifiers)
+  std::fill(starNumbers.begin(), starNumbers.end(), 0);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(SimplexId j = 0; j < vertexNumberPerCell; j++) {
+      const SimplexId vertexId
+        = cellArray.getCellVertex(i, j);
+      vertexStars.set(vertexId, starNumbers[vertexId]++, i);
     }
   }
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex stars built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  if(debugLevel_ >= Debug::advancedInfoMsg) {
-    stringstream msg;
-
-    for(SimplexId i = 0; i < (SimplexId)vertexStars.size(); i++) {
-      msg << "[ZeroSkeleton] Vertex #" << i << " (" << vertexStars[i].size()
-          << " cell(s)): ";
-      for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-        msg << " " << vertexStars[i][j];
-      }
-      msg << endl;
-    }
-    dMsg(cout, msg.str(), Debug::advancedInfoMsg);
-  }
-
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiol.vtu, 8.7Mtets, hal9000 (12coresHT)
-  // 1 thread: 0.53 s
-  // 24 threads: 7.99 s
-
   return 0;
 }
@@ -16,6 +16,9 @@
 #include <map>
 
 // base code includes
+#include <CellArray.h>
+#include <FlatJaggedArray.h>
+#include <RadixSort.h>
 #include <Wrapper.h>
 
 namespace ttk {
@@ -27,19 +30,20 @@ namespace ttk {
 
     ~ZeroSkeleton();
 
-    /// Compute the list of edges connected to each vertex of a triangulation.
+    /// Compute the list of edges connected to each vertex of a triangulation
+    /// (the edges of each vertex are listed by increasing identifiers). With
+    /// several threads, the edge extremities are radix sorted by vertex.
     /// \param vertexNumber Number of vertices in the triangulation.
     /// \param edgeList List of edges. Each entry is represented by the
     /// ordered std::pair of identifiers of the entry's edge's vertices.
-    /// \param vertexEdges Output vertex links. The size of this std::vector
-    /// will be equal to the number of vertices in the mesh. Each entry will
-    /// be a std::vector listing the identifiers of the edges connected to the
-    /// entry's vertex.
+    /// \param vertexEdges Output vertex edges. The number of rows of this
+    /// table will be equal to the number of vertices in the mesh. Each row
+    /// will list the identifiers of the edges connected to the row's vertex.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexEdges(
       const SimplexId &vertexNumber,
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      std::vector<std::vector<SimplexId>> &vertexEdges) const;
+      FlatJaggedArray &vertexEdges) const;
 
     /// Compute the link of a single vertex of a triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
@@ -56,7 +60,7 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexLink(const SimplexId &vertexId,
                         const SimplexId &cellNumber,
-                        const LongSimplexId *cellArray,
+                        const CellArray &cellArray,
                         std::vector<LongSimplexId> &vertexLink) const;
 
     /// Compute the link of each vertex of a triangulation (unspecified
@@ -78,61 +82,57 @@ namespace ttk {
     /// \param vertexStars Optional list of vertex stars (list of
     /// 3-dimensional cells connected to each vertex). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty table, the
+    /// function will fill this empty table (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector
-    /// as internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// to a non-empty table, this function will use this table as internal
+    /// vertex star list. If this table is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexLinks(const SimplexId &vertexNumber,
                          const SimplexId &cellNumber,
-                         const LongSimplexId *cellArray,
+                         const CellArray &cellArray,
                          std::vector<std::vector<LongSimplexId>> &vertexLinks,
-                         std::vector<std::vector<SimplexId>> *vertexStars
-                         = NULL) const;
+                         FlatJaggedArray *vertexStars = NULL) const;
 
     /// Compute the link of each vertex of a 2D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
-    /// \param vertexStars List of vertex stars. The size of this std::vector
-    /// should be equal to the number of vertices in the triangulation. Each
-    /// entry is a std::vector listing the identifiers of triangles.
-    /// \param cellEdges List of cell edges. The size of this std::vector
-    /// should be
-    /// equal to the number of triangles. Each entry is a std::vector of
+    /// \param vertexStars List of vertex stars. The number of rows of this
+    /// table should be equal to the number of vertices in the triangulation.
+    /// Each row lists the identifiers of triangles.
+    /// \param cellEdges List of cell edges. The number of rows of this table
+    /// should be equal to the number of triangles. Each row lists
     /// identifiers of edges.
-    /// \param vertexLinks Output vertex links. The size of this std::vector
-    /// will be equal to the number of vertices in the triangulation. Each
-    /// entry will be a std::vector listing the edges in the link of the
-    /// corresponding vertex.
+    /// \param edgeList List of edges.
+    /// \param vertexLinks Output vertex links. The number of rows of this
+    /// table will be equal to the number of vertices in the triangulation.
+    /// Each row will list the edges in the link of the corresponding vertex
+    /// (one per triangle of its star).
     /// \return Returns 0 upon success, negative values otherwise.
     int buildVertexLinks(
-      const std::vector<std::vector<SimplexId>> &vertexStars,
-      const std::vector<std::vector<SimplexId>> &cellEdges,
+      const FlatJaggedArray &vertexStars,
+      const FlatJaggedArray &cellEdges,
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      std::vector<std::vector<SimplexId>> &vertexLinks) const;
+      FlatJaggedArray &vertexLinks) const;
 
     /// Compute the link of each vertex of a 3D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
-    /// \param vertexStars List of vertex stars. The size of this std::vector
-    /// should be equal to the number of vertices in the triangulation. Each
-    /// entry is a std::vector listing the identifiers of tetrahedra.
-    /// \param cellTriangles List of cell triangles. The size of this
-    /// std::vector
-    /// should be equal to the number of tetrahedra. Each entry is a
-    /// std::vector
-    /// of identifiers of triangles.
-    /// \param vertexLinks Output vertex links. The size of this std::vector
-    /// will be equal to the number of vertices in the triangulation. Each
-    /// entry will be a std::vector listing the triangles in the link of the
-    /// corresponding vertex.
+    /// \param vertexStars List of vertex stars. The number of rows of this
+    /// table should be equal to the number of vertices in the triangulation.
+    /// Each row lists the identifiers of tetrahedra.
+    /// \param cellTriangles List of cell triangles. The number of rows of
+    /// this table should be equal to the number of tetrahedra. Each row
+    /// lists identifiers of triangles.
+    /// \param triangleList List of triangles.
+    /// \param vertexLinks Output vertex links. The number of rows of this
+    /// table will be equal to the number of vertices in the triangulation.
+    /// Each row will list the triangles in the link of the corresponding
+    /// vertex (one per tetrahedron of its star).
     /// \return Returns 0 upon success, negative values otherwise.
-    int
-      buildVertexLinks(const std::vector<std::vector<SimplexId>> &vertexStars,
-                       const std::vector<std::vector<SimplexId>> &cellTriangles,
-                       const std::vector<std::vector<SimplexId>> &triangleList,
-                       std::vector<std::vector<SimplexId>> &vertexLinks) const;
+    int buildVertexLinks(const FlatJaggedArray &vertexStars,
+                         const FlatJaggedArray &cellTriangles,
+                         const FlatJaggedArray &triangleList,
+                         FlatJaggedArray &vertexLinks) const;
 
     /// Compute the list of neighbors of each vertex of a triangulation.
     /// Unspecified behavior if the input mesh is not a valid triangulation).
@@ -142,11 +142,9 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param vertexNeighbors Output neighbor list. The size of this
-    /// std::vector
-    /// will be equal to the number of vertices in the mesh. Each entry will
-    /// be std::vector listing the vertex identifiers of the entry's vertex'
-    /// neighbors.
+    /// \param vertexNeighbors Output neighbor list. The number of rows of
+    /// this table will be equal to the number of vertices in the mesh. Each
+    /// row will list the vertex identifiers of the row's vertex' neighbors.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
     /// If not NULL but pointing to an empty std::vector, the function will
@@ -162,8 +160,8 @@ namespace ttk {
     int buildVertexNeighbors(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
-      const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &vertexNeighbors,
+      const CellArray &cellArray,
+      FlatJaggedArray &vertexNeighbors,
       std::vector<std::pair<SimplexId, SimplexId>> *edgeList = NULL) const;
 
     /// Compute the star of each vertex of a triangulation. Unspecified
@@ -174,17 +172,16 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param vertexStars Output vertex stars. The size of this std::vector
-    /// will be equal to the number of vertices in the mesh. Each entry will
-    /// be a std::vector listing the identifiers of the maximum-dimensional
-    /// cells
-    /// (3D: tetrahedra, 2D: triangles, etc.) connected to the entry's vertex.
+    /// \param vertexStars Output vertex stars. The number of rows of this
+    /// table will be equal to the number of vertices in the mesh. Each row
+    /// will list the identifiers of the maximum-dimensional cells (3D:
+    /// tetrahedra, 2D: triangles, etc.) connected to the row's vertex, by
+    /// increasing identifiers.
     /// \return Returns 0 upon success, negative values otherwise.
-    int
-      buildVertexStars(const SimplexId &vertexNumber,
-                       const SimplexId &cellNumber,
-                       const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &vertexStars) const;
+    int buildVertexStars(const SimplexId &vertexNumber,
+                         const SimplexId &cellNumber,
+                         const CellArray &cellArray,
+                         FlatJaggedArray &vertexStars) const;
 
   protected:
   };
@@ -6,9 +6,11 @@ using namespace ttk;
 TopologicalSimplification::TopologicalSimplification()
   : triangulation_{}, vertexNumber_{}, constraintNumber_{},
     inputScalarFieldPointer_{}, vertexIdentifierScalarFieldPointer_{},
-    inputOffsetScalarFieldPointer_{}, considerIdentifierAsBlackList_{},
-    addPerturbation_{}, outputScalarFieldPointer_{},
-    outputOffsetScalarFieldPointer_{} {
+    inputOffsetScalarFieldPointer_{}, inputOrderScalarFieldPointer_{},
+    considerIdentifierAsBlackList_{}, addPerturbation_{},
+    outputScalarFieldPointer_{},
+    outputOffsetScalarFieldPointer_{}, outputOrderScalarFieldPointer_{},
+    constraintPersistence_{} {
   considerIdentifierAsBlackList_ = false;
   addPerturbation_ = false;
 }
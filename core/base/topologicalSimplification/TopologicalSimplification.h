@@ -27,9 +27,13 @@
 // base code includes
 #include <Wrapper.h>
 
+#include <IndexedHeap.h>
 #include <Triangulation.h>
+#include <VertexOrder.h>
+#include <algorithm>
 #include <cmath>
-#include <set>
+#include <functional>
+#include <queue>
 #include <tuple>
 #include <type_traits>
 
@@ -102,14 +106,94 @@ namespace ttk {
                           SimplexId *offsets,
                           std::vector<SimplexId> &minList,
                           std::vector<SimplexId> &maxList,
-                          std::vector<bool> &blackList) const;
+                          const std::vector<bool> &blackList) const;
 
     template <typename dataType>
     int addPerturbation(dataType *scalars, SimplexId *offsets) const;
 
+    /// Remove the minima and the maxima of the scalar field that are not
+    /// maintained by \p extrema (see setConsiderIdentifierAsBlackList()), by
+    /// alternating sweep() from the minima and from the maxima until
+    /// convergence.
+    /// \param inputOrder Optional order field of the input \p scalars and
+    /// \p offsets (see ttk::VertexOrder), which replaces their first sort
+    /// (NULL: not available).
+    template <typename dataType>
+    int simplify(dataType *scalars,
+                 SimplexId *offsets,
+                 const std::vector<bool> &extrema,
+                 int &iteration,
+                 const SimplexId *inputOrder = nullptr) const;
+
+    /// One sweep of simplify(), from the minima (\p isIncreasingOrder) or
+    /// from the maxima flagged in \p isSeed.
+    ///
+    /// The output is the same as with a sequential flooding of the domain
+    /// from the seeds (by increasing or decreasing values), each vertex
+    /// being levelled to the highest (or lowest) vertex visited before it.
+    /// However, the flooding is only performed in the regions which are not
+    /// drained to a seed by their steepest path:
+    ///  -# the steepest paths are computed in parallel (pointer jumping),
+    ///  -# the other vertices are grouped in lakes (the connected regions
+    /// that are flooded from a single vertex, their anchor) by a union-find
+    /// sweep, without priority queue,
+    ///  -# the lakes are flooded in parallel, each from its anchor.
+    ///
+    /// The offsets are replaced by the ranks of the vertices in
+    /// [1, vertexNumber] and the identifiers of the levelled vertices are
+    /// appended to \p levelledVertices. The vertices are sorted from
+    /// \p inputOrder if it is the order field of \p scalars and \p offsets.
+    /// \return Returns 0 upon success, negative values if a vertex cannot be
+    /// reached from the seeds.
+    template <typename dataType>
+    int sweep(dataType *scalars,
+              SimplexId *offsets,
+              const std::vector<bool> &isSeed,
+              const bool isIncreasingOrder,
+              std::vector<SimplexId> &levelledVertices,
+              const SimplexId *inputOrder = nullptr) const;
+
+    /// Remove the minima (\p isIncreasingOrder) or the maxima of the scalar
+    /// field that are not maintained by \p extrema (as in simplify()) by
+    /// filling their basins only.
+    ///
+    /// Each basin is flooded from its extremum until the region draining to
+    /// a maintained extremum is reached, and is then flooded back from that
+    /// region: the filled vertices receive the same values as with the sweep
+    /// of simplify(), without visiting the rest of the domain. The offsets
+    /// are replaced by the ranks of the vertices in [1, vertexNumber].
+    ///
+    /// Filling a basin may create other critical points, hence this
+    /// function is a fast pre-processing for simplify() (which completes
+    /// the simplification if needed) when few extrema have to be removed.
+    /// \return Returns 0 upon success, negative values if an extremum
+    /// cannot reach a maintained one.
+    template <typename dataType>
+    int simplifyLocally(dataType *scalars,
+                        SimplexId *offsets,
+                        const std::vector<bool> &extrema,
+                        const bool isIncreasingOrder) const;
+
     template <typename dataType, typename idType>
     int execute() const;
 
+    /// Multi-level simplification: compute one simplified scalar field
+    /// (and offset field) per persistence threshold, in a single run.
+    ///
+    /// The constraints are the extrema of the persistence pairs (see
+    /// setConstraintPersistencePointer()): at each level, only the
+    /// constraints whose persistence is greater or equal to the threshold
+    /// are maintained. The levels are processed by increasing threshold and
+    /// each level starts from the simplified field of the previous one
+    /// (which already lacks the extrema of lower persistence) instead of
+    /// from the input field, so each level only removes the extrema that
+    /// appeared between two consecutive thresholds.
+    ///
+    /// See setPersistenceThresholds(), setOutputScalarFieldPointers() and
+    /// setOutputOffsetScalarFieldPointers().
+    template <typename dataType, typename idType>
+    int executeMultiLevel() const;
+
     inline int setupTriangulation(Triangulation *triangulation) {
       triangulation_ = triangulation;
       if(triangulation_) {
@@ -144,6 +228,15 @@ namespace ttk {
       return 0;
     }
 
+    /// Set an optional input order field (rank of each vertex in the order
+    /// of the input scalar and offset fields, see ttk::VertexOrder): the
+    /// first sort of the simplification is then replaced by a linear-time
+    /// inversion of this field (NULL: not used).
+    inline int setInputOrderScalarFieldPointer(void *data) {
+      inputOrderScalarFieldPointer_ = data;
+      return 0;
+    }
+
     inline int setConsiderIdentifierAsBlackList(bool onOff) {
       considerIdentifierAsBlackList_ = onOff;
       return 0;
@@ -164,6 +257,43 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the persistence of each constraint (setConstraintNumber() values,
+    /// for executeMultiLevel() only).
+    inline int setConstraintPersistencePointer(const double *data) {
+      constraintPersistence_ = data;
+      return 0;
+    }
+
+    /// Set the persistence thresholds of executeMultiLevel(), in increasing
+    /// order.
+    inline int setPersistenceThresholds(const std::vector<double> &thresholds) {
+      persistenceThresholds_ = thresholds;
+      return 0;
+    }
+
+    /// Set the output scalar fields of executeMultiLevel() (one per
+    /// persistence threshold).
+    inline int setOutputScalarFieldPointers(const std::vector<void *> &data) {
+      outputScalarFieldPointers_ = data;
+      return 0;
+    }
+
+    /// Set the output offset fields of executeMultiLevel() (one per
+    /// persistence threshold).
+    inline int
+      setOutputOffsetScalarFieldPointers(const std::vector<void *> &data) {
+      outputOffsetScalarFieldPointers_ = data;
+      return 0;
+    }
+
+    /// Set an optional output order field (rank of each vertex in the order
+    /// of the simplified scalar field, see ttk::VertexOrder), to be shared
+    /// with the subsequent topological filters (NULL: not computed).
+    inline int setOutputOrderScalarFieldPointer(void *data) {
+      outputOrderScalarFieldPointer_ = data;
+      return 0;
+    }
+
   protected:
     Triangulation *triangulation_;
     SimplexId vertexNumber_;
@@ -171,10 +301,16 @@ namespace ttk {
     void *inputScalarFieldPointer_;
     void *vertexIdentifierScalarFieldPointer_;
     void *inputOffsetScalarFieldPointer_;
+    void *inputOrderScalarFieldPointer_;
     bool considerIdentifierAsBlackList_;
     bool addPerturbation_;
     void *outputScalarFieldPointer_;
     void *outputOffsetScalarFieldPointer_;
+    void *outputOrderScalarFieldPointer_;
+    const double *constraintPersistence_;
+    std::vector<double> persistenceThresholds_;
+    std::vector<void *> outputScalarFieldPointers_;
+    std::vector<void *> outputOffsetScalarFieldPointers_;
   };
 } // namespace ttk
 
@@ -256,7 +392,7 @@ int ttk::TopologicalSimplification::getCriticalPoints(
   SimplexId *offsets,
   std::vector<SimplexId> &minima,
   std::vector<SimplexId> &maxima,
-  std::vector<bool> &extrema) const {
+  const std::vector<bool> &extrema) const {
   std::vector<int> type(vertexNumber_);
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
@@ -288,24 +424,646 @@ int ttk::TopologicalSimplification::addPerturbation(dataType *scalars,
   else
     return -1;
 
-  std::vector<std::tuple<dataType, SimplexId, SimplexId>> perturbation(
-    vertexNumber_);
-  for(SimplexId i = 0; i < vertexNumber_; ++i) {
-    std::get<0>(perturbation[i]) = scalars[i];
-    std::get<1>(perturbation[i]) = offsets[i];
-    std::get<2>(perturbation[i]) = i;
+  std::vector<SimplexId> sortedVertices;
+  VertexOrder::sortVertices(vertexNumber_, scalars, offsets, sortedVertices,
+                            nullptr, threadNumber_);
+
+  for(SimplexId i = 1; i < vertexNumber_; ++i) {
+    const SimplexId vertex = sortedVertices[i];
+    const SimplexId previousVertex = sortedVertices[i - 1];
+    if(scalars[vertex] <= scalars[previousVertex])
+      scalars[vertex] = scalars[previousVertex] + epsilon;
   }
 
-  SweepCmp cmp(true);
-  sort(perturbation.begin(), perturbation.end(), cmp);
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalSimplification::sweep(
+  dataType *scalars,
+  SimplexId *offsets,
+  const std::vector<bool> &isSeed,
+  const bool isIncreasingOrder,
+  std::vector<SimplexId> &levelledVertices,
+  const SimplexId *inputOrder) const {
+
+  // rank of the vertices along the sweep
+  std::vector<SimplexId> sortedVertices;
+  std::vector<SimplexId> order;
+  if(inputOrder)
+    VertexOrder::sortVerticesFromOrder(
+      vertexNumber_, inputOrder, sortedVertices, &order, threadNumber_);
+  else
+    VertexOrder::sortVertices(vertexNumber_, scalars, offsets,
+                              sortedVertices, &order, threadNumber_);
+  if(!isIncreasingOrder) {
+    std::reverse(sortedVertices.begin(), sortedVertices.end());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId k = 0; k < vertexNumber_; ++k)
+      order[k] = vertexNumber_ - 1 - order[k];
+  }
+
+  // 1. a vertex whose steepest path reaches a seed is swept after the
+  // vertices below it: it is not levelled (drained vertex)
+  std::vector<SimplexId> extremum(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    SimplexId lowest = k;
+    if(!isSeed[k]) {
+      const SimplexId neighborNumber
+        = triangulation_->getVertexNeighborNumber(k);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId neighbor;
+        triangulation_->getVertexNeighbor(k, j, neighbor);
+        if(order[neighbor] < order[lowest])
+          lowest = neighbor;
+      }
+    }
+    extremum[k] = lowest;
+  }
+  {
+    std::vector<SimplexId> nextExtremum(vertexNumber_);
+    bool hasChanged = true;
+    while(hasChanged) {
+      hasChanged = false;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasChanged)
+#endif
+      for(SimplexId k = 0; k < vertexNumber_; ++k) {
+        nextExtremum[k] = extremum[extremum[k]];
+        if(nextExtremum[k] != extremum[k])
+          hasChanged = true;
+      }
+      extremum.swap(nextExtremum);
+    }
+  }
+
+  std::vector<char> isDrained(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k)
+    isDrained[k] = isSeed[extremum[k]];
+
+  // drained vertices adjacent to the other ones
+  std::vector<char> isShore(vertexNumber_, 0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    if(!isDrained[k])
+      continue;
+    const SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(k);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(k, j, neighbor);
+      if(!isDrained[neighbor]) {
+        isShore[k] = 1;
+        break;
+      }
+    }
+  }
+
+  // 2. union-find sweep of the other vertices: a connected region of
+  // undrained vertices is a lake until a vertex connects it to a drained
+  // one, this vertex is the anchor of the lake (the lakes of a same anchor
+  // are merged)
+  std::vector<SimplexId> parent(vertexNumber_, -1);
+  std::vector<SimplexId> componentSize(vertexNumber_, 0);
+  std::vector<SimplexId> firstMember(vertexNumber_, -1);
+  std::vector<SimplexId> lastMember(vertexNumber_, -1);
+  std::vector<SimplexId> nextMember(vertexNumber_, -1);
+  std::vector<SimplexId> lakeAnchor(vertexNumber_, -1);
+  std::vector<SimplexId> anchors;
+  std::vector<SimplexId> lakeOffsets(1, 0);
+  std::vector<SimplexId> lowerNeighbors;
+
+  const auto find = [&parent](SimplexId v) {
+    while(parent[v] != v) {
+      parent[v] = parent[parent[v]];
+      v = parent[v];
+    }
+    return v;
+  };
+
+  // drain the lakes below the vertex v
+  const auto drainLakes = [&](const SimplexId v) {
+    SimplexId lakeSize = 0;
+    const SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(v, j, neighbor);
+      if(isDrained[neighbor] or order[neighbor] > order[v])
+        continue;
+      for(SimplexId m = firstMember[find(neighbor)]; m != -1;
+          m = nextMember[m]) {
+        isDrained[m] = 1;
+        lakeAnchor[m] = v;
+        ++lakeSize;
+      }
+    }
+    if(lakeSize) {
+      anchors.push_back(v);
+      lakeOffsets.push_back(lakeOffsets.back() + lakeSize);
+    }
+  };
+
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    const SimplexId vertexId = sortedVertices[k];
+    if(isDrained[vertexId]) {
+      if(isShore[vertexId])
+        drainLakes(vertexId);
+      continue;
+    }
+
+    // the vertex is reached if one of its lower neighbors is drained,
+    // otherwise it joins their lakes
+    bool isReached = false;
+    lowerNeighbors.clear();
+    const SimplexId neighborNumber
+      = triangulation_->getVertexNeighborNumber(vertexId);
+    for(SimplexId j = 0; j < neighborNumber and !isReached; ++j) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(vertexId, j, neighbor);
+      if(order[neighbor] < k) {
+        if(isDrained[neighbor])
+          isReached = true;
+        else
+          lowerNeighbors.push_back(neighbor);
+      }
+    }
+
+    if(isReached) {
+      isDrained[vertexId] = 1;
+      drainLakes(vertexId);
+      continue;
+    }
+
+    SimplexId root = vertexId;
+    parent[vertexId] = vertexId;
+    componentSize[vertexId] = 1;
+    firstMember[vertexId] = lastMember[vertexId] = vertexId;
+    for(SimplexId neighbor : lowerNeighbors) {
+      SimplexId neighborRoot = find(neighbor);
+      if(root == neighborRoot)
+        continue;
+      if(componentSize[root] < componentSize[neighborRoot])
+        std::swap(root, neighborRoot);
+      parent[neighborRoot] = root;
+      componentSize[root] += componentSize[neighborRoot];
+      nextMember[lastMember[root]] = firstMember[neighborRoot];
+      lastMember[root] = lastMember[neighborRoot];
+    }
+  }
+
+  // the remaining vertices are not connected to any seed
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    if(!isDrained[k])
+      return -1;
+  }
+
+  // 3. flood the lakes, each from its anchor
+  const SimplexId lakeNumber = anchors.size();
+  std::vector<SimplexId> lakeSequence(lakeOffsets.back());
+  std::vector<char> isQueued(vertexNumber_, 0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+  for(SimplexId i = 0; i < lakeNumber; ++i) {
+    const SimplexId anchor = anchors[i];
+    SimplexId position = lakeOffsets[i];
+    std::priority_queue<SimplexId, std::vector<SimplexId>,
+                        std::greater<SimplexId>>
+      front;
+    front.push(order[anchor]);
+    while(!front.empty()) {
+      const SimplexId vertexId = sortedVertices[front.top()];
+      front.pop();
+      if(vertexId != anchor)
+        lakeSequence[position++] = vertexId;
+
+      const SimplexId neighborNumber
+        = triangulation_->getVertexNeighborNumber(vertexId);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId neighbor;
+        triangulation_->getVertexNeighbor(vertexId, j, neighbor);
+        if(lakeAnchor[neighbor] == anchor and !isQueued[neighbor]) {
+          front.push(order[neighbor]);
+          isQueued[neighbor] = 1;
+        }
+      }
+    }
+  }
+
+  // 4. the lakes are swept right after their anchor
+  std::vector<SimplexId> adjustmentSequence;
+  adjustmentSequence.reserve(vertexNumber_);
+  SimplexId lakeId = 0;
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    const SimplexId vertexId = sortedVertices[k];
+    if(lakeAnchor[vertexId] != -1)
+      continue;
+    adjustmentSequence.push_back(vertexId);
+    if(lakeId < lakeNumber and anchors[lakeId] == vertexId) {
+      adjustmentSequence.insert(adjustmentSequence.end(),
+                                lakeSequence.begin() + lakeOffsets[lakeId],
+                                lakeSequence.begin() + lakeOffsets[lakeId + 1]);
+      ++lakeId;
+    }
+  }
+
+  // save offsets and rearrange scalars
+  SimplexId offset = (isIncreasingOrder ? 0 : vertexNumber_ + 1);
+
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+
+    if(isIncreasingOrder) {
+      if(k
+         and scalars[adjustmentSequence[k]]
+               <= scalars[adjustmentSequence[k - 1]])
+        scalars[adjustmentSequence[k]] = scalars[adjustmentSequence[k - 1]];
+      ++offset;
+    } else {
+      if(k
+         and scalars[adjustmentSequence[k]]
+               >= scalars[adjustmentSequence[k - 1]])
+        scalars[adjustmentSequence[k]] = scalars[adjustmentSequence[k - 1]];
+      --offset;
+    }
+    offsets[adjustmentSequence[k]] = offset;
+  }
+
+  levelledVertices.insert(
+    levelledVertices.end(), lakeSequence.begin(), lakeSequence.end());
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalSimplification::simplify(
+  dataType *scalars,
+  SimplexId *offsets,
+  const std::vector<bool> &extrema,
+  int &iteration,
+  const SimplexId *inputOrder) const {
+  // critical type of each vertex, only updated around the levelled vertices
+  std::vector<int> type(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k)
+    type[k] = getCriticalType<dataType>(k, scalars, offsets);
+
+  std::vector<bool> isAuthorizedMinimum(vertexNumber_, false);
+  std::vector<bool> isAuthorizedMaximum(vertexNumber_, false);
+  SimplexId authorizedMinimumNumber = 0;
+  SimplexId authorizedMaximumNumber = 0;
+  SimplexId minimumNumber = 0;
+  SimplexId maximumNumber = 0;
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    if(type[k] < 0) {
+      ++minimumNumber;
+      if(considerIdentifierAsBlackList_ xor extrema[k]) {
+        isAuthorizedMinimum[k] = true;
+        ++authorizedMinimumNumber;
+      }
+    } else if(type[k] > 0) {
+      ++maximumNumber;
+      if(considerIdentifierAsBlackList_ xor extrema[k]) {
+        isAuthorizedMaximum[k] = true;
+        ++authorizedMaximumNumber;
+      }
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalSimplification] Maintaining " << constraintNumber_
+        << " constraints (" << authorizedMinimumNumber << " minima and "
+        << authorizedMaximumNumber << " maxima)." << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  // processing
+  iteration = 0;
+
+  // nothing to remove (for instance if the field was already simplified):
+  // the sweeps would not level any vertex and would only replace the
+  // offsets by the ranks of the vertices
+  if(minimumNumber == authorizedMinimumNumber
+     and maximumNumber == authorizedMaximumNumber) {
+    std::vector<SimplexId> order;
+    if(!inputOrder) {
+      std::vector<SimplexId> sortedVertices;
+      VertexOrder::sortVertices(vertexNumber_, scalars, offsets,
+                                sortedVertices, &order, threadNumber_);
+      inputOrder = order.data();
+    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId k = 0; k < vertexNumber_; ++k)
+      offsets[k] = inputOrder[k] + 1;
+
+    if(addPerturbation_)
+      addPerturbation<dataType>(scalars, offsets);
+    return 0;
+  }
+
+  // number of minima and maxima which are not authorized
+  SimplexId forbiddenExtremumNumber = minimumNumber - authorizedMinimumNumber
+                                      + maximumNumber - authorizedMaximumNumber;
+  const auto isForbidden = [&](const SimplexId v, const int t) {
+    return t and !isAuthorizedMinimum[v] and !isAuthorizedMaximum[v];
+  };
+
+  std::vector<SimplexId> levelledVertices;
+  std::vector<SimplexId> modifiedVertices;
+  std::vector<int> modifiedTypes;
+  std::vector<SimplexId> lastIteration(vertexNumber_, -1);
 
   for(SimplexId i = 0; i < vertexNumber_; ++i) {
-    if(i) {
-      if(std::get<0>(perturbation[i]) <= std::get<0>(perturbation[i - 1]))
-        std::get<0>(perturbation[i])
-          = std::get<0>(perturbation[i - 1]) + epsilon;
+
+    {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Starting simplifying iteration #" << i
+          << "..." << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
+
+    levelledVertices.clear();
+    for(int j = 0; j < 2; ++j) {
+
+      bool isIncreasingOrder = !j;
+
+      // the input order is only valid until the first sweep
+      const int ret = sweep<dataType>(
+        scalars, offsets,
+        isIncreasingOrder ? isAuthorizedMinimum : isAuthorizedMaximum,
+        isIncreasingOrder, levelledVertices,
+        (!i and !j) ? inputOrder : nullptr);
+      if(ret)
+        return ret;
+    }
+
+    // test convergence: the order of two vertices only changes if one of
+    // them has been levelled
+    modifiedVertices.clear();
+    for(SimplexId k : levelledVertices) {
+      if(lastIteration[k] != i) {
+        lastIteration[k] = i;
+        modifiedVertices.push_back(k);
+      }
+      const SimplexId neighborNumber
+        = triangulation_->getVertexNeighborNumber(k);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId neighbor;
+        triangulation_->getVertexNeighbor(k, j, neighbor);
+        if(lastIteration[neighbor] != i) {
+          lastIteration[neighbor] = i;
+          modifiedVertices.push_back(neighbor);
+        }
+      }
+    }
+
+    const SimplexId modifiedNumber = modifiedVertices.size();
+    modifiedTypes.resize(modifiedNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId k = 0; k < modifiedNumber; ++k)
+      modifiedTypes[k]
+        = getCriticalType<dataType>(modifiedVertices[k], scalars, offsets);
+
+    for(SimplexId k = 0; k < modifiedNumber; ++k) {
+      const SimplexId vertexId = modifiedVertices[k];
+      minimumNumber += (modifiedTypes[k] < 0) - (type[vertexId] < 0);
+      maximumNumber += (modifiedTypes[k] > 0) - (type[vertexId] > 0);
+      forbiddenExtremumNumber += isForbidden(vertexId, modifiedTypes[k])
+                                 - isForbidden(vertexId, type[vertexId]);
+      type[vertexId] = modifiedTypes[k];
+    }
+
+    bool needForMoreIterations{false};
+    if(maximumNumber > authorizedMaximumNumber)
+      needForMoreIterations = true;
+    if(minimumNumber > authorizedMinimumNumber)
+      needForMoreIterations = true;
+
+    {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Current status: " << minimumNumber
+          << " minima, " << maximumNumber << " maxima." << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
+
+    if(forbiddenExtremumNumber)
+      needForMoreIterations = true;
+
+    // optional adding of perturbation
+    if(addPerturbation_)
+      addPerturbation<dataType>(scalars, offsets);
+
+    ++iteration;
+    if(!needForMoreIterations)
+      break;
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::TopologicalSimplification::simplifyLocally(
+  dataType *scalars,
+  SimplexId *offsets,
+  const std::vector<bool> &extrema,
+  const bool isIncreasingOrder) const {
+
+  // rank of the vertices along the sweep
+  std::vector<SimplexId> sortedVertices;
+  std::vector<SimplexId> order;
+  VertexOrder::sortVertices(vertexNumber_, scalars, offsets, sortedVertices,
+                            &order, threadNumber_);
+  if(!isIncreasingOrder) {
+    std::reverse(sortedVertices.begin(), sortedVertices.end());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId k = 0; k < vertexNumber_; ++k)
+      order[k] = vertexNumber_ - 1 - order[k];
+  }
+
+  // extremum reached by the steepest path of each vertex
+  std::vector<SimplexId> extremum(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    SimplexId lowest = k;
+    const SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(k);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(k, j, neighbor);
+      if(order[neighbor] < order[lowest])
+        lowest = neighbor;
+    }
+    extremum[k] = lowest;
+  }
+  {
+    std::vector<SimplexId> nextExtremum(vertexNumber_);
+    bool hasChanged = true;
+    while(hasChanged) {
+      hasChanged = false;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasChanged)
+#endif
+      for(SimplexId k = 0; k < vertexNumber_; ++k) {
+        nextExtremum[k] = extremum[extremum[k]];
+        if(nextExtremum[k] != extremum[k])
+          hasChanged = true;
+      }
+      extremum.swap(nextExtremum);
+    }
+  }
+
+  // a vertex is drained if its steepest path reaches a maintained extremum
+  // (or a basin filled before)
+  std::vector<bool> isDrainedExtremum(vertexNumber_, false);
+  std::vector<SimplexId> removedExtrema;
+  for(SimplexId k : sortedVertices) {
+    if(extremum[k] == k) {
+      if(considerIdentifierAsBlackList_ xor extrema[k])
+        isDrainedExtremum[k] = true;
+      else
+        removedExtrema.push_back(k);
+    }
+  }
+  if(removedExtrema.empty())
+    return 0;
+
+  // the filled vertices are ordered right after the vertex they are
+  // levelled to (their anchor), by filling order
+  using Key = std::pair<SimplexId, SimplexId>;
+  std::vector<SimplexId> anchorOrder(order);
+  std::vector<SimplexId> fillingRank(vertexNumber_, 0);
+  const auto key = [&anchorOrder, &fillingRank](const SimplexId v) {
+    return Key(anchorOrder[v], fillingRank[v]);
+  };
+
+  IndexedHeap<Key, std::less<Key>> front;
+  front.reserve(vertexNumber_, 0);
+  std::vector<SimplexId> visited(vertexNumber_, -1);
+  std::vector<SimplexId> toFill(vertexNumber_, -1);
+  std::vector<SimplexId> basin;
+  std::vector<SimplexId> outlets;
+  SimplexId filledNumber = 0;
+
+  for(size_t i = 0; i < removedExtrema.size(); ++i) {
+    const SimplexId basinId = i;
+    const SimplexId seed = removedExtrema[i];
+    if(isDrainedExtremum[seed])
+      continue;
+
+    // 1. flood the basin until the drained region is reached: the level of
+    // the basin is the highest vertex visited by then, collect what is below
+    basin.clear();
+    outlets.clear();
+    SimplexId level = seed;
+    bool hasOutlet = false;
+    front.push(seed, key(seed));
+    visited[seed] = basinId;
+    while(!front.empty()) {
+      if(hasOutlet and !(front.topKey() < key(level)))
+        break;
+      const SimplexId vertexId = front.pop();
+      if(!hasOutlet and key(level) < key(vertexId))
+        level = vertexId;
+      if(isDrainedExtremum[extremum[vertexId]]) {
+        outlets.push_back(vertexId);
+        hasOutlet = true;
+        continue;
+      }
+      basin.push_back(vertexId);
+      toFill[vertexId] = basinId;
+
+      const SimplexId neighborNumber
+        = triangulation_->getVertexNeighborNumber(vertexId);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId neighbor;
+        triangulation_->getVertexNeighbor(vertexId, j, neighbor);
+        if(visited[neighbor] != basinId) {
+          front.push(neighbor, key(neighbor));
+          visited[neighbor] = basinId;
+        }
+      }
+    }
+    front.clear();
+    if(!hasOutlet)
+      return -1;
+
+    // 2. sweep the basin from the drained vertices met during the flooding
+    // (as simplify() would do from the maintained extrema)
+    level = outlets[0];
+    for(SimplexId k : outlets) {
+      front.push(k, key(k));
+      if(key(k) < key(level))
+        level = k;
+    }
+    while(!front.empty()) {
+      const SimplexId vertexId = front.pop();
+      if(key(vertexId) < key(level)) {
+        scalars[vertexId] = scalars[level];
+        anchorOrder[vertexId] = anchorOrder[level];
+        fillingRank[vertexId] = ++filledNumber;
+      } else {
+        level = vertexId;
+      }
+
+      const SimplexId neighborNumber
+        = triangulation_->getVertexNeighborNumber(vertexId);
+      for(SimplexId j = 0; j < neighborNumber; ++j) {
+        SimplexId neighbor;
+        triangulation_->getVertexNeighbor(vertexId, j, neighbor);
+        if(toFill[neighbor] == basinId) {
+          front.push(neighbor, key(neighbor));
+          toFill[neighbor] = -1;
+        }
+      }
+    }
+
+    for(SimplexId k : basin)
+      isDrainedExtremum[extremum[k]] = true;
+  }
+
+  // new offsets (ranks along the sweep)
+  std::vector<std::pair<Key, SimplexId>> filledVertices;
+  filledVertices.reserve(filledNumber);
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    if(fillingRank[k])
+      filledVertices.emplace_back(key(k), k);
+  }
+  std::sort(filledVertices.begin(), filledVertices.end());
+
+  SimplexId rank = 0;
+  size_t filledPos = 0;
+  const auto setRank = [&](const SimplexId v) {
+    offsets[v] = (isIncreasingOrder ? rank + 1 : vertexNumber_ - rank);
+    ++rank;
+  };
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    const SimplexId vertexId = sortedVertices[k];
+    if(fillingRank[vertexId])
+      continue;
+    setRank(vertexId);
+    while(filledPos < filledVertices.size()
+          and filledVertices[filledPos].first.first == k) {
+      setRank(filledVertices[filledPos].second);
+      ++filledPos;
     }
-    scalars[std::get<2>(perturbation[i])] = std::get<0>(perturbation[i]);
   }
 
   return 0;
@@ -320,22 +1078,30 @@ int ttk::TopologicalSimplification::execute() const {
   idType *identifiers
     = static_cast<idType *>(vertexIdentifierScalarFieldPointer_);
   idType *inputOffsets = static_cast<idType *>(inputOffsetScalarFieldPointer_);
+  const SimplexId *inputOrder
+    = static_cast<SimplexId *>(inputOrderScalarFieldPointer_);
   SimplexId *offsets
     = static_cast<SimplexId *>(outputOffsetScalarFieldPointer_);
 
   Timer t;
 
   // pre-processing
+  bool hasNaN = false;
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasNaN)
 #endif
   for(SimplexId k = 0; k < vertexNumber_; ++k) {
     scalars[k] = inputScalars[k];
-    if(std::isnan((double)scalars[k]))
+    if(std::isnan((double)scalars[k])) {
       scalars[k] = 0;
+      hasNaN = true;
+    }
 
     offsets[k] = inputOffsets[k];
   }
+  // the input order does not account for the replaced NaN values
+  if(hasNaN)
+    inputOrder = nullptr;
 
   // get the user extremum list
   std::vector<bool> extrema(vertexNumber_, false);
@@ -348,155 +1114,149 @@ int ttk::TopologicalSimplification::execute() const {
       extrema[identifierId] = true;
   }
 
-  std::vector<SimplexId> authorizedMinima;
-  std::vector<SimplexId> authorizedMaxima;
-  std::vector<bool> authorizedExtrema(vertexNumber_, false);
-
-  getCriticalPoints<dataType>(
-    scalars, offsets, authorizedMinima, authorizedMaxima, extrema);
+  int iteration{};
+  const int ret
+    = simplify<dataType>(scalars, offsets, extrema, iteration, inputOrder);
+  if(ret)
+    return ret;
+
+  if(outputOrderScalarFieldPointer_) {
+    VertexOrder::computeOrder(
+      vertexNumber_, scalars, offsets,
+      static_cast<SimplexId *>(outputOrderScalarFieldPointer_), threadNumber_);
+  }
 
   {
     std::stringstream msg;
-    msg << "[TopologicalSimplification] Maintaining " << constraintNumber_
-        << " constraints (" << authorizedMinima.size() << " minima and "
-        << authorizedMaxima.size() << " maxima)." << std::endl;
-    dMsg(std::cout, msg.str(), advancedInfoMsg);
+    msg << "[TopologicalSimplification] Scalar field simplified"
+        << " in " << t.getElapsedTime() << " s. (" << threadNumber_
+        << " threads(s), " << iteration << " ite.)." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
   }
 
-  // declare the tuple-comparison functor
-  SweepCmp cmp;
-
-  // processing
-  int iteration{};
-  for(SimplexId i = 0; i < vertexNumber_; ++i) {
+  return 0;
+}
 
-    {
-      std::stringstream msg;
-      msg << "[TopologicalSimplification] Starting simplifying iteration #" << i
-          << "..." << std::endl;
-      dMsg(std::cout, msg.str(), advancedInfoMsg);
-    }
+template <typename dataType, typename idType>
+int ttk::TopologicalSimplification::executeMultiLevel() const {
 
-    for(int j = 0; j < 2; ++j) {
+  // get input data
+  dataType *inputScalars = static_cast<dataType *>(inputScalarFieldPointer_);
+  idType *identifiers
+    = static_cast<idType *>(vertexIdentifierScalarFieldPointer_);
+  idType *inputOffsets = static_cast<idType *>(inputOffsetScalarFieldPointer_);
+  const SimplexId *inputOrder
+    = static_cast<SimplexId *>(inputOrderScalarFieldPointer_);
+  const size_t levelNumber = persistenceThresholds_.size();
 
-      bool isIncreasingOrder = !j;
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!constraintPersistence_)
+    return -1;
+  if(outputScalarFieldPointers_.size() != levelNumber
+     or outputOffsetScalarFieldPointers_.size() != levelNumber)
+    return -2;
+  if(!std::is_sorted(
+       persistenceThresholds_.begin(), persistenceThresholds_.end()))
+    return -3;
+  // the constraints are the extrema to maintain
+  if(considerIdentifierAsBlackList_)
+    return -4;
+#endif
 
-      cmp.setIsIncreasingOrder(isIncreasingOrder);
-      std::set<std::tuple<dataType, SimplexId, SimplexId>, decltype(cmp)>
-        sweepFront(cmp);
-      std::vector<bool> visitedVertices(vertexNumber_, false);
-      std::vector<SimplexId> adjustmentSequence(vertexNumber_);
-
-      // add the seeds
-      if(isIncreasingOrder) {
-        for(SimplexId k : authorizedMinima) {
-          authorizedExtrema[k] = true;
-          sweepFront.emplace(scalars[k], offsets[k], k);
-          visitedVertices[k] = true;
-        }
-      } else {
-        for(SimplexId k : authorizedMaxima) {
-          authorizedExtrema[k] = true;
-          sweepFront.emplace(scalars[k], offsets[k], k);
-          visitedVertices[k] = true;
-        }
-      }
+  Timer t;
 
-      // growth by neighborhood of the seeds
-      SimplexId adjustmentPos = 0;
-      do {
-        auto front = sweepFront.begin();
-        if(front == sweepFront.end())
-          return -1;
-
-        SimplexId vertexId = std::get<2>(*front);
-        sweepFront.erase(front);
-
-        SimplexId neighborNumber
-          = triangulation_->getVertexNeighborNumber(vertexId);
-        for(SimplexId k = 0; k < neighborNumber; ++k) {
-          SimplexId neighbor;
-          triangulation_->getVertexNeighbor(vertexId, k, neighbor);
-          if(!visitedVertices[neighbor]) {
-            sweepFront.emplace(scalars[neighbor], offsets[neighbor], neighbor);
-            visitedVertices[neighbor] = true;
-          }
-        }
-        adjustmentSequence[adjustmentPos] = vertexId;
-        ++adjustmentPos;
-      } while(!sweepFront.empty());
+  std::vector<bool> extrema;
+  for(size_t l = 0; l < levelNumber; ++l) {
+    Timer tl;
 
-      // save offsets and rearrange scalars
-      SimplexId offset = (isIncreasingOrder ? 0 : vertexNumber_ + 1);
+    dataType *scalars = static_cast<dataType *>(outputScalarFieldPointers_[l]);
+    SimplexId *offsets
+      = static_cast<SimplexId *>(outputOffsetScalarFieldPointers_[l]);
 
+    // start from the previous level (or from the input for the first one)
+    if(!l) {
+      bool hasNaN = false;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasNaN)
+#endif
       for(SimplexId k = 0; k < vertexNumber_; ++k) {
-
-        if(isIncreasingOrder) {
-          if(k
-             and scalars[adjustmentSequence[k]]
-                   <= scalars[adjustmentSequence[k - 1]])
-            scalars[adjustmentSequence[k]] = scalars[adjustmentSequence[k - 1]];
-          ++offset;
-        } else {
-          if(k
-             and scalars[adjustmentSequence[k]]
-                   >= scalars[adjustmentSequence[k - 1]])
-            scalars[adjustmentSequence[k]] = scalars[adjustmentSequence[k - 1]];
-          --offset;
+        scalars[k] = inputScalars[k];
+        if(std::isnan((double)scalars[k])) {
+          scalars[k] = 0;
+          hasNaN = true;
         }
-        offsets[adjustmentSequence[k]] = offset;
+
+        offsets[k] = inputOffsets[k];
       }
+      if(hasNaN)
+        inputOrder = nullptr;
+    } else {
+      const dataType *previousScalars
+        = static_cast<dataType *>(outputScalarFieldPointers_[l - 1]);
+      const SimplexId *previousOffsets
+        = static_cast<SimplexId *>(outputOffsetScalarFieldPointers_[l - 1]);
+      std::copy(previousScalars, previousScalars + vertexNumber_, scalars);
+      std::copy(previousOffsets, previousOffsets + vertexNumber_, offsets);
     }
 
-    // test convergence
-    bool needForMoreIterations{false};
-    std::vector<SimplexId> minima;
-    std::vector<SimplexId> maxima;
-    getCriticalPoints<dataType>(scalars, offsets, minima, maxima);
+    // get the extrema maintained at this level
+    extrema.assign(vertexNumber_, false);
+    for(SimplexId k = 0; k < constraintNumber_; ++k) {
+      const SimplexId identifierId = identifiers[k];
 
-    if(maxima.size() > authorizedMaxima.size())
-      needForMoreIterations = true;
-    if(minima.size() > authorizedMinima.size())
-      needForMoreIterations = true;
-
-    {
-      std::stringstream msg;
-      msg << "[TopologicalSimplification] Current status: " << minima.size()
-          << " minima, " << maxima.size() << " maxima." << std::endl;
-      dMsg(std::cout, msg.str(), advancedInfoMsg);
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(identifierId >= 0 and identifierId < vertexNumber_)
+#endif
+        if(constraintPersistence_[k] >= persistenceThresholds_[l])
+          extrema[identifierId] = true;
     }
 
-    if(!needForMoreIterations) {
-      for(SimplexId k : minima) {
-        if(!authorizedExtrema[k]) {
-          needForMoreIterations = true;
-          break;
-        }
-      }
-    }
-    if(!needForMoreIterations) {
-      for(SimplexId k : maxima) {
-        if(!authorizedExtrema[k]) {
-          needForMoreIterations = true;
-          break;
-        }
+    // the previous level only has a few extra extrema: fill their basins,
+    // simplify() then completes the simplification if needed
+    if(l) {
+      int ret = simplifyLocally<dataType>(scalars, offsets, extrema, true);
+      if(!ret)
+        ret = simplifyLocally<dataType>(scalars, offsets, extrema, false);
+      if(ret) {
+        // a basin without outlet: restart from the previous level, the
+        // global simplification of this level does not need any outlet
+        const dataType *previousScalars
+          = static_cast<dataType *>(outputScalarFieldPointers_[l - 1]);
+        const SimplexId *previousOffsets
+          = static_cast<SimplexId *>(outputOffsetScalarFieldPointers_[l - 1]);
+        std::copy(previousScalars, previousScalars + vertexNumber_, scalars);
+        std::copy(previousOffsets, previousOffsets + vertexNumber_, offsets);
+
+        std::stringstream msg;
+        msg << "[TopologicalSimplification] Level #" << l
+            << ": local simplification failed (" << ret
+            << "), falling back to the global one." << std::endl;
+        dMsg(std::cout, msg.str(), advancedInfoMsg);
       }
     }
 
-    // optional adding of perturbation
-    if(addPerturbation_)
-      addPerturbation<dataType>(scalars, offsets);
+    // the input order is only valid for the first level
+    int iteration{};
+    const int ret = simplify<dataType>(
+      scalars, offsets, extrema, iteration, l ? nullptr : inputOrder);
+    if(ret)
+      return ret;
 
-    ++iteration;
-    if(!needForMoreIterations)
-      break;
+    {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Level #" << l << " (persistence "
+          << persistenceThresholds_[l] << ") simplified in "
+          << tl.getElapsedTime() << " s. (" << iteration << " ite.)."
+          << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
   }
 
   {
     std::stringstream msg;
-    msg << "[TopologicalSimplification] Scalar field simplified"
-        << " in " << t.getElapsedTime() << " s. (" << threadNumber_
-        << " threads(s), " << iteration << " ite.)." << std::endl;
+    msg << "[TopologicalSimplification] " << levelNumber
+        << " scalar fields simplified in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " threads(s))." << std::endl;
     dMsg(std::cout, msg.str(), timeMsg);
   }
 
@@ -99,26 +99,31 @@ int ttk::TrackingFromFields::performDiagramComputation(
   std::vector<std::vector<diagramTuple>> &persistenceDiagrams,
   const ttk::Wrapper *wrapper) {
 
+  // one triangulation and one set of offsets for all the fields: the
+  // diagrams are computed in a single batch
+  ttk::PersistenceDiagram persistenceDiagram;
+  persistenceDiagram.setWrapper(wrapper);
+  persistenceDiagram.setThreadNumber(threadNumber_);
+  persistenceDiagram.setDebugLevel(debugLevel_);
+  persistenceDiagram.setupTriangulation(triangulation_);
+  persistenceDiagram.setInputOffsets(inputOffsets_);
+  persistenceDiagram.setComputeSaddleConnectors(false);
+
+  const std::vector<void *> fields(
+    inputData_.begin(), inputData_.begin() + fieldNumber);
+  using pairType = std::tuple<ttk::SimplexId, CriticalType, ttk::SimplexId,
+                              CriticalType, dataType, ttk::SimplexId>;
+  std::vector<std::vector<pairType>> CTDiagrams;
+  const int ret = persistenceDiagram.executeBatch<dataType, ttk::SimplexId>(
+    fields, CTDiagrams);
+  if(ret)
+    return ret;
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
   for(int i = 0; i < fieldNumber; ++i) {
-    ttk::PersistenceDiagram persistenceDiagram_;
-    persistenceDiagram_.setWrapper(wrapper);
-    persistenceDiagram_.setupTriangulation(triangulation_);
-    persistenceDiagram_.setThreadNumber(1);
-    // should have been done before
-
-    std::vector<std::tuple<ttk::dcg::Cell, ttk::dcg::Cell>> dmt_pairs;
-    persistenceDiagram_.setDMTPairs(&dmt_pairs);
-    persistenceDiagram_.setInputScalars(inputData_[i]);
-    persistenceDiagram_.setInputOffsets(inputOffsets_);
-    persistenceDiagram_.setComputeSaddleConnectors(false);
-    std::vector<std::tuple<int, CriticalType, int, CriticalType, dataType, int>>
-      CTDiagram;
-
-    persistenceDiagram_.setOutputCTDiagram(&CTDiagram);
-    persistenceDiagram_.execute<dataType, int>();
+    const auto &CTDiagram = CTDiagrams[i];
 
     // Copy diagram into augmented diagram.
     persistenceDiagrams[i] = std::vector<diagramTuple>(CTDiagram.size());
@@ -127,8 +132,8 @@ int ttk::TrackingFromFields::performDiagramComputation(
       float p[3];
       float q[3];
       auto currentTuple = CTDiagram[j];
-      const int a = std::get<0>(currentTuple);
-      const int b = std::get<2>(currentTuple);
+      const ttk::SimplexId a = std::get<0>(currentTuple);
+      const ttk::SimplexId b = std::get<2>(currentTuple);
       triangulation_->getVertexPoint(a, p[0], p[1], p[2]);
       triangulation_->getVertexPoint(b, q[0], q[1], q[2]);
       const double sa = ((double *)inputData_[i])[a];
@@ -40,7 +40,8 @@ namespace ttk {
       double pz,
       double ps,
       double pe,
-      const ttk::Wrapper *wrapper);
+      const ttk::Wrapper *wrapper,
+      std::array<DenseAssignment, 3> *denseAssignments = nullptr);
 
     template <typename dataType>
     int performMatchings(
@@ -94,6 +95,10 @@ namespace ttk {
   protected:
     int numberOfInputs_;
     void **inputData_;
+
+    // dense matching solvers of each thread, reused from one matching to the
+    // next
+    std::vector<std::array<DenseAssignment, 3>> denseAssignments_;
   };
 } // namespace ttk
 
@@ -141,9 +146,11 @@ int ttk::TrackingFromPersistenceDiagrams::performSingleMatching(
   double pz,
   double ps,
   double pe,
-  const ttk::Wrapper *wrapper) {
+  const ttk::Wrapper *wrapper,
+  std::array<DenseAssignment, 3> *denseAssignments) {
   ttk::BottleneckDistance bottleneckDistance_;
   bottleneckDistance_.setWrapper(wrapper);
+  bottleneckDistance_.setDenseAssignments(denseAssignments);
   bottleneckDistance_.setPersistencePercentThreshold(tolerance);
   bottleneckDistance_.setPX(px);
   bottleneckDistance_.setPY(py);
@@ -178,17 +185,24 @@ int ttk::TrackingFromPersistenceDiagrams::performMatchings(
   double pe,
   const ttk::Wrapper *wrapper) {
 
+  denseAssignments_.resize(threadNumber_);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
   for(int i = 0; i < numInputs - 1; ++i) {
+    int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+#endif // TTK_ENABLE_OPENMP
     performSingleMatching<dataType>(
       i, inputPersistenceDiagrams, outputMatchings,
       algorithm, // Not from paraview, from enclosing tracking plugin
       wasserstein, tolerance, is3D,
       alpha, // Blending
       px, py, pz, ps, pe, // Coefficients
-      wrapper // Wrapper for accessing threadNumber
+      wrapper, // Wrapper for accessing threadNumber
+      &denseAssignments_[threadId] // Reused matching buffers
     );
   }
 
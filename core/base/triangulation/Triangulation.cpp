@@ -5,7 +5,9 @@ using namespace ttk;
 
 Triangulation::Triangulation()
   : AbstractTriangulation{}, gridDimensions_{-1, -1, -1},
-    abstractTriangulation_{nullptr}, usePeriodicBoundaries_{false} {
+    abstractTriangulation_{nullptr}, usePeriodicBoundaries_{false},
+    lazyPreprocessing_{false}, lazyRelations_{0}, lazilyBuiltRelations_{0},
+    preprocessMutex_{make_shared<recursive_mutex>()} {
   debugLevel_ = 0; // overrides the global debug level.
 }
 
@@ -15,7 +17,10 @@ Triangulation::Triangulation(const Triangulation &rhs)
     explicitTriangulation_{rhs.explicitTriangulation_},
     implicitTriangulation_{rhs.implicitTriangulation_},
     periodicImplicitTriangulation_{rhs.periodicImplicitTriangulation_},
-    usePeriodicBoundaries_{rhs.usePeriodicBoundaries_} {
+    usePeriodicBoundaries_{rhs.usePeriodicBoundaries_},
+    lazyPreprocessing_{rhs.lazyPreprocessing_}, lazyRelations_{0},
+    lazilyBuiltRelations_{rhs.lazilyBuiltRelations_},
+    preprocessMutex_{make_shared<recursive_mutex>()} {
 
   if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
     abstractTriangulation_ = &explicitTriangulation_;
@@ -23,6 +28,10 @@ Triangulation::Triangulation(const Triangulation &rhs)
     abstractTriangulation_ = &implicitTriangulation_;
   } else if(rhs.abstractTriangulation_ == &rhs.periodicImplicitTriangulation_) {
     abstractTriangulation_ = &periodicImplicitTriangulation_;
+  } else if(rhs.abstractTriangulation_) {
+    // shared implementation (see setInputTriangulation())
+    abstractTriangulation_ = rhs.abstractTriangulation_;
+    preprocessMutex_ = rhs.preprocessMutex_;
   }
 }
 
@@ -34,7 +43,10 @@ Triangulation::Triangulation(Triangulation &&rhs)
     implicitTriangulation_{std::move(rhs.implicitTriangulation_)},
     periodicImplicitTriangulation_{
       std::move(rhs.periodicImplicitTriangulation_)},
-    usePeriodicBoundaries_{std::move(rhs.usePeriodicBoundaries_)} {
+    usePeriodicBoundaries_{std::move(rhs.usePeriodicBoundaries_)},
+    lazyPreprocessing_{rhs.lazyPreprocessing_}, lazyRelations_{0},
+    lazilyBuiltRelations_{rhs.lazilyBuiltRelations_},
+    preprocessMutex_{make_shared<recursive_mutex>()} {
 
   if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
     abstractTriangulation_ = &explicitTriangulation_;
@@ -42,6 +54,10 @@ Triangulation::Triangulation(Triangulation &&rhs)
     abstractTriangulation_ = &implicitTriangulation_;
   } else if(rhs.abstractTriangulation_ == &rhs.periodicImplicitTriangulation_) {
     abstractTriangulation_ = &periodicImplicitTriangulation_;
+  } else if(rhs.abstractTriangulation_) {
+    // shared implementation (see setInputTriangulation())
+    abstractTriangulation_ = rhs.abstractTriangulation_;
+    preprocessMutex_ = rhs.preprocessMutex_;
   }
 }
 
@@ -54,6 +70,10 @@ Triangulation &Triangulation::operator=(const Triangulation &rhs) {
     implicitTriangulation_ = rhs.implicitTriangulation_;
     periodicImplicitTriangulation_ = rhs.periodicImplicitTriangulation_;
     usePeriodicBoundaries_ = rhs.usePeriodicBoundaries_;
+    lazyPreprocessing_ = rhs.lazyPreprocessing_;
+    lazyRelations_ = 0;
+    lazilyBuiltRelations_ = rhs.lazilyBuiltRelations_;
+    preprocessMutex_ = make_shared<recursive_mutex>();
 
     if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
       abstractTriangulation_ = &explicitTriangulation_;
@@ -62,6 +82,10 @@ Triangulation &Triangulation::operator=(const Triangulation &rhs) {
     } else if(rhs.abstractTriangulation_
               == &rhs.periodicImplicitTriangulation_) {
       abstractTriangulation_ = &periodicImplicitTriangulation_;
+    } else if(rhs.abstractTriangulation_) {
+      // shared implementation (see setInputTriangulation())
+      abstractTriangulation_ = rhs.abstractTriangulation_;
+      preprocessMutex_ = rhs.preprocessMutex_;
     }
   }
   return *this;
@@ -77,6 +101,10 @@ Triangulation &Triangulation::operator=(Triangulation &&rhs) {
     periodicImplicitTriangulation_
       = std::move(rhs.periodicImplicitTriangulation_);
     usePeriodicBoundaries_ = std::move(rhs.usePeriodicBoundaries_);
+    lazyPreprocessing_ = rhs.lazyPreprocessing_;
+    lazyRelations_ = 0;
+    lazilyBuiltRelations_ = rhs.lazilyBuiltRelations_;
+    preprocessMutex_ = make_shared<recursive_mutex>();
 
     if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
       abstractTriangulation_ = &explicitTriangulation_;
@@ -85,9 +113,265 @@ Triangulation &Triangulation::operator=(Triangulation &&rhs) {
     } else if(rhs.abstractTriangulation_
               == &rhs.periodicImplicitTriangulation_) {
       abstractTriangulation_ = &periodicImplicitTriangulation_;
+    } else if(rhs.abstractTriangulation_) {
+      // shared implementation (see setInputTriangulation())
+      abstractTriangulation_ = rhs.abstractTriangulation_;
+      preprocessMutex_ = rhs.preprocessMutex_;
     }
   }
   return *this;
 }
 
 Triangulation::~Triangulation() = default;
+
+int Triangulation::setInputTriangulation(const Triangulation &triangulation) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(triangulation.getType() != Type::EXPLICIT)
+    return -1;
+  if(triangulation.isEmpty())
+    return -2;
+#endif
+
+  abstractTriangulation_ = triangulation.abstractTriangulation_;
+  gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+  lazyRelations_ = 0;
+  preprocessMutex_ = triangulation.preprocessMutex_;
+
+  return 0;
+}
+
+unique_lock<recursive_mutex> Triangulation::lockPreprocessing() const {
+
+  unique_lock<recursive_mutex> lock(*preprocessMutex_);
+
+  // the implementations of the current object already have its context
+  if((abstractTriangulation_)
+     && (abstractTriangulation_ != &explicitTriangulation_)
+     && (abstractTriangulation_ != &implicitTriangulation_)
+     && (abstractTriangulation_ != &periodicImplicitTriangulation_)) {
+    abstractTriangulation_->setDebugLevel(debugLevel_);
+    abstractTriangulation_->setThreadNumber(threadNumber_);
+  }
+
+  return lock;
+}
+
+const char *Triangulation::getRelationName(const Relation &relation) {
+
+  switch(relation) {
+    case Relation::BoundaryEdges:
+      return "BoundaryEdges";
+    case Relation::BoundaryTriangles:
+      return "BoundaryTriangles";
+    case Relation::BoundaryVertices:
+      return "BoundaryVertices";
+    case Relation::CellEdges:
+      return "CellEdges";
+    case Relation::CellNeighbors:
+      return "CellNeighbors";
+    case Relation::CellTriangles:
+      return "CellTriangles";
+    case Relation::Edges:
+      return "Edges";
+    case Relation::EdgeLinks:
+      return "EdgeLinks";
+    case Relation::EdgeStars:
+      return "EdgeStars";
+    case Relation::EdgeTriangles:
+      return "EdgeTriangles";
+    case Relation::Triangles:
+      return "Triangles";
+    case Relation::TriangleEdges:
+      return "TriangleEdges";
+    case Relation::TriangleLinks:
+      return "TriangleLinks";
+    case Relation::TriangleStars:
+      return "TriangleStars";
+    case Relation::VertexEdges:
+      return "VertexEdges";
+    case Relation::VertexLinks:
+      return "VertexLinks";
+    case Relation::VertexNeighbors:
+      return "VertexNeighbors";
+    case Relation::VertexStars:
+      return "VertexStars";
+    case Relation::VertexTriangles:
+      return "VertexTriangles";
+    default:
+      break;
+  }
+
+  return "";
+}
+
+bool Triangulation::hasPreprocessedRelation(const Relation &relation) const {
+
+  if(!abstractTriangulation_)
+    return false;
+
+  switch(relation) {
+    case Relation::BoundaryEdges:
+      return abstractTriangulation_->hasPreprocessedBoundaryEdges();
+    case Relation::BoundaryTriangles:
+      return abstractTriangulation_->hasPreprocessedBoundaryTriangles();
+    case Relation::BoundaryVertices:
+      return abstractTriangulation_->hasPreprocessedBoundaryVertices();
+    case Relation::CellEdges:
+      return abstractTriangulation_->hasPreprocessedCellEdges();
+    case Relation::CellNeighbors:
+      return abstractTriangulation_->hasPreprocessedCellNeighbors();
+    case Relation::CellTriangles:
+      return abstractTriangulation_->hasPreprocessedCellTriangles();
+    case Relation::Edges:
+      return abstractTriangulation_->hasPreprocessedEdges();
+    case Relation::EdgeLinks:
+      return abstractTriangulation_->hasPreprocessedEdgeLinks();
+    case Relation::EdgeStars:
+      return abstractTriangulation_->hasPreprocessedEdgeStars();
+    case Relation::EdgeTriangles:
+      return abstractTriangulation_->hasPreprocessedEdgeTriangles();
+    case Relation::Triangles:
+      return abstractTriangulation_->hasPreprocessedTriangles();
+    case Relation::TriangleEdges:
+      return abstractTriangulation_->hasPreprocessedTriangleEdges();
+    case Relation::TriangleLinks:
+      return abstractTriangulation_->hasPreprocessedTriangleLinks();
+    case Relation::TriangleStars:
+      return abstractTriangulation_->hasPreprocessedTriangleStars();
+    case Relation::VertexEdges:
+      return abstractTriangulation_->hasPreprocessedVertexEdges();
+    case Relation::VertexLinks:
+      return abstractTriangulation_->hasPreprocessedVertexLinks();
+    case Relation::VertexNeighbors:
+      return abstractTriangulation_->hasPreprocessedVertexNeighbors();
+    case Relation::VertexStars:
+      return abstractTriangulation_->hasPreprocessedVertexStars();
+    case Relation::VertexTriangles:
+      return abstractTriangulation_->hasPreprocessedVertexTriangles();
+    default:
+      break;
+  }
+
+  return false;
+}
+
+size_t Triangulation::footprint() const {
+
+  if(!abstractTriangulation_)
+    return 0;
+
+  stringstream msg;
+  msg << "[Triangulation] Materialized relations:";
+  for(int i = 0; i < static_cast<int>(Relation::NumberOfRelations); i++) {
+    const Relation relation = static_cast<Relation>(i);
+    if(hasPreprocessedRelation(relation)) {
+      msg << " " << getRelationName(relation);
+      if(lazilyBuiltRelations_ & (1 << i))
+        msg << " (lazy)";
+    }
+  }
+  msg << endl;
+  dMsg(cout, msg.str(), memoryMsg);
+
+  return abstractTriangulation_->footprint();
+}
+
+int Triangulation::lazyPreprocessRelation(const Relation &relation) const {
+
+  const auto lock = lockPreprocessing();
+
+  const int bit = 1 << static_cast<int>(relation);
+
+  // another thread may have built the relation in the meantime
+  if(lazyRelations_.load(memory_order_relaxed) & bit)
+    return 0;
+
+  int ret = 0;
+
+  if(!hasPreprocessedRelation(relation)) {
+
+    // the pre-processing functions only complete the internal tables, the
+    // triangulation itself is left unchanged
+    Triangulation *triangulation = const_cast<Triangulation *>(this);
+
+    switch(relation) {
+      case Relation::BoundaryEdges:
+        ret = triangulation->preprocessBoundaryEdges();
+        break;
+      case Relation::BoundaryTriangles:
+        ret = triangulation->preprocessBoundaryTriangles();
+        break;
+      case Relation::BoundaryVertices:
+        ret = triangulation->preprocessBoundaryVertices();
+        break;
+      case Relation::CellEdges:
+        ret = triangulation->preprocessCellEdges();
+        break;
+      case Relation::CellNeighbors:
+        ret = triangulation->preprocessCellNeighbors();
+        break;
+      case Relation::CellTriangles:
+        ret = triangulation->preprocessCellTriangles();
+        break;
+      case Relation::Edges:
+        ret = triangulation->preprocessEdges();
+        break;
+      case Relation::EdgeLinks:
+        ret = triangulation->preprocessEdgeLinks();
+        break;
+      case Relation::EdgeStars:
+        ret = triangulation->preprocessEdgeStars();
+        break;
+      case Relation::EdgeTriangles:
+        ret = triangulation->preprocessEdgeTriangles();
+        break;
+      case Relation::Triangles:
+        ret = triangulation->preprocessTriangles();
+        break;
+      case Relation::TriangleEdges:
+        ret = triangulation->preprocessTriangleEdges();
+        break;
+      case Relation::TriangleLinks:
+        ret = triangulation->preprocessTriangleLinks();
+        break;
+      case Relation::TriangleStars:
+        ret = triangulation->preprocessTriangleStars();
+        break;
+      case Relation::VertexEdges:
+        ret = triangulation->preprocessVertexEdges();
+        break;
+      case Relation::VertexLinks:
+        ret = triangulation->preprocessVertexLinks();
+        break;
+      case Relation::VertexNeighbors:
+        ret = triangulation->preprocessVertexNeighbors();
+        break;
+      case Relation::VertexStars:
+        ret = triangulation->preprocessVertexStars();
+        break;
+      case Relation::VertexTriangles:
+        ret = triangulation->preprocessVertexTriangles();
+        break;
+      default:
+        break;
+    }
+
+    // a failed pre-processing is neither recorded nor published, the next
+    // query will try again
+    if(ret)
+      return ret;
+
+    lazilyBuiltRelations_ |= bit;
+
+    stringstream msg;
+    msg << "[Triangulation] Lazily pre-processed relation "
+        << getRelationName(relation) << "." << endl;
+    dMsg(cout, msg.str(), detailedInfoMsg);
+  }
+
+  // publish the relation to the other threads
+  lazyRelations_.fetch_or(bit, memory_order_release);
+
+  return 0;
+}
@@ -29,7 +29,8 @@
 ///
 /// \note
 /// Only pre-process the information you need! See the documentation further
-/// down.
+/// down. Alternatively, the relations can be built upon their first query,
+/// see setLazyPreprocessing().
 /// \sa ttkTriangulation
 
 #ifndef _TRIANGULATION_H
@@ -42,6 +43,9 @@
 #include <PeriodicImplicitTriangulation.h>
 
 #include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace ttk {
 
@@ -59,6 +63,9 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     inline int clear() override {
 
+      lazyRelations_ = 0;
+      lazilyBuiltRelations_ = 0;
+
       if(abstractTriangulation_) {
         return abstractTriangulation_->clear();
       }
@@ -66,16 +73,11 @@ namespace ttk {
       return 0;
     }
 
-    /// Computes and displays the memory footprint of the data-structure.
-    /// \return Returns 0 upon success, negative values otherwise.
-    inline size_t footprint() const override {
-
-      if(abstractTriangulation_) {
-        return abstractTriangulation_->footprint();
-      }
-
-      return 0;
-    }
+    /// Computes and displays the memory footprint of the data-structure,
+    /// along with the list of the relations which have been materialized
+    /// (explicitly or lazily, see setLazyPreprocessing()).
+    /// \return Returns the memory footprint in bytes.
+    size_t footprint() const override;
 
     /// Get the \p localEdgeId-th edge of the \p cellId-th cell.
     ///
@@ -102,6 +104,8 @@ namespace ttk {
                            const int &localEdgeId,
                            SimplexId &edgeId) const override {
 
+      lazyPreprocess(Relation::CellEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       edgeId = -1;
@@ -147,6 +151,8 @@ namespace ttk {
     /// \return Returns the number of cell edges.
     /// \sa getCellNeighborNumber()
     inline SimplexId getCellEdgeNumber(const SimplexId &cellId) const override {
+      lazyPreprocess(Relation::CellEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -181,8 +187,8 @@ namespace ttk {
     /// dimension (3D: tetrahedra, 2D: triangles, 1D: edges).
     ///
     /// The number of entries in this list is equal to the number of cells.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of edges for the corresponding cell.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of edges for the corresponding cell.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -199,7 +205,9 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the cell edge list.
     /// \sa getCellNeighbors()
-    inline const std::vector<std::vector<SimplexId>> *getCellEdges() override {
+    inline const FlatJaggedArray *getCellEdges() override {
+      lazyPreprocess(Relation::CellEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -247,6 +255,8 @@ namespace ttk {
                                const int &localNeighborId,
                                SimplexId &neighborId) const override {
 
+      lazyPreprocess(Relation::CellNeighbors);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       neighborId = -1;
@@ -286,6 +296,8 @@ namespace ttk {
     inline SimplexId
       getCellNeighborNumber(const SimplexId &cellId) const override {
 
+      lazyPreprocess(Relation::CellNeighbors);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -314,8 +326,8 @@ namespace ttk {
     /// dimension (3D: tetrahedra, 2D: triangles, 1D: edges).
     ///
     /// The number of entries in this list is equal to the number of cells.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of neighbor cells for the corresponding cell.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of neighbor cells for the corresponding cell.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -329,8 +341,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the cell neighbor list.
-    inline const std::vector<std::vector<SimplexId>> *
-      getCellNeighbors() override {
+    inline const FlatJaggedArray *getCellNeighbors() override {
+      lazyPreprocess(Relation::CellNeighbors);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -375,6 +388,8 @@ namespace ttk {
                                const int &localTriangleId,
                                SimplexId &triangleId) const override {
 
+      lazyPreprocess(Relation::CellTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       triangleId = -1;
@@ -426,6 +441,8 @@ namespace ttk {
     /// \sa getCellNeighborNumber()
     inline SimplexId
       getCellTriangleNumber(const SimplexId &cellId) const override {
+      lazyPreprocess(Relation::CellTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -466,8 +483,8 @@ namespace ttk {
     /// has a dimension greater than 2 (otherwise, use the cell information).
     ///
     /// The number of entries in this list is equal to the number of cells.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of triangles for the corresponding cell.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of triangles for the corresponding cell.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -484,8 +501,9 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the cell triangle list.
     /// \sa getCellNeighbors()
-    inline const std::vector<std::vector<SimplexId>> *
-      getCellTriangles() override {
+    inline const FlatJaggedArray *getCellTriangles() override {
+      lazyPreprocess(Relation::CellTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -593,6 +611,8 @@ namespace ttk {
     /// \return Returns a pointer to the edge list.
     inline const std::vector<std::pair<SimplexId, SimplexId>> *
       getEdges() override {
+      lazyPreprocess(Relation::Edges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -636,6 +656,8 @@ namespace ttk {
     inline int getEdgeLink(const SimplexId &edgeId,
                            const int &localLinkId,
                            SimplexId &linkId) const override {
+      lazyPreprocess(Relation::EdgeLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       linkId = -1;
@@ -675,6 +697,8 @@ namespace ttk {
     /// \param edgeId Input global edge identifier.
     /// \return Returns the number of cells in the link of the edge.
     inline SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const override {
+      lazyPreprocess(Relation::EdgeLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -703,9 +727,8 @@ namespace ttk {
     /// Get the list of link simplices for all edges.
     ///
     /// The number of entries in this list is equal to the number of edges.
-    /// Each entry is a std::vector of identifiers representing vertices in
-    /// 2D and
-    /// edges in 3D. It returns NULL in 1D.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers
+    /// representing vertices in 2D and edges in 3D. It returns NULL in 1D.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -719,7 +742,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge link list.
-    inline const std::vector<std::vector<SimplexId>> *getEdgeLinks() override {
+    inline const FlatJaggedArray *getEdgeLinks() override {
+      lazyPreprocess(Relation::EdgeLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -766,6 +791,8 @@ namespace ttk {
     inline int getEdgeStar(const SimplexId &edgeId,
                            const int &localStarId,
                            SimplexId &starId) const override {
+      lazyPreprocess(Relation::EdgeStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       starId = -1;
@@ -808,6 +835,8 @@ namespace ttk {
     /// \param edgeId Input global edge identifier
     /// \return Returns the number of star cells.
     inline SimplexId getEdgeStarNumber(const SimplexId &edgeId) const override {
+      lazyPreprocess(Relation::EdgeStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -842,8 +871,8 @@ namespace ttk {
     /// dimension greater than 1 (otherwise, use the cell information).
     ///
     /// The number of entries in this list is equal to the number of edges.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of star cells for the corresponding edge.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of star cells for the corresponding edge.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -857,7 +886,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge star list.
-    inline const std::vector<std::vector<SimplexId>> *getEdgeStars() override {
+    inline const FlatJaggedArray *getEdgeStars() override {
+      lazyPreprocess(Relation::EdgeStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -902,6 +933,8 @@ namespace ttk {
                                const int &localTriangleId,
                                SimplexId &triangleId) const override {
 
+      lazyPreprocess(Relation::EdgeTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       triangleId = -1;
@@ -949,6 +982,8 @@ namespace ttk {
     /// \return Returns the number of edge triangles.
     /// \sa getEdgeStarNumber
     inline SimplexId getEdgeTriangleNumber(const SimplexId &edgeId) const {
+      lazyPreprocess(Relation::EdgeTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -984,8 +1019,8 @@ namespace ttk {
     /// Get the list of triangles for all edges.
     ///
     /// The number of entries in this list is equal to the number of edges.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of triangles for the corresponding edge.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of triangles for the corresponding edge.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -1002,8 +1037,9 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge triangle list.
     /// \sa getEdgeStars
-    inline const std::vector<std::vector<SimplexId>> *
-      getEdgeTriangles() override {
+    inline const FlatJaggedArray *getEdgeTriangles() override {
+      lazyPreprocess(Relation::EdgeTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -1052,6 +1088,8 @@ namespace ttk {
     inline int getEdgeVertex(const SimplexId &edgeId,
                              const int &localVertexId,
                              SimplexId &vertexId) const override {
+      lazyPreprocess(Relation::Edges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       vertexId = -1;
@@ -1130,6 +1168,8 @@ namespace ttk {
     /// \return Returns the number of edges.
     /// \sa getNumberOfCells()
     inline SimplexId getNumberOfEdges() const override {
+      lazyPreprocess(Relation::Edges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1166,6 +1206,8 @@ namespace ttk {
     /// \return Returns the number of triangles.
     /// \sa getNumberOfCells()
     inline SimplexId getNumberOfTriangles() const override {
+      lazyPreprocess(Relation::Triangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
 
       if(isEmptyCheck())
@@ -1214,7 +1256,7 @@ namespace ttk {
     ///
     /// The number of entries in this list is equal to the number of
     /// triangles.
-    /// Each entry is a std::vector of vertex identifiers.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of vertex identifiers.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -1227,7 +1269,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle list.
-    inline const std::vector<std::vector<SimplexId>> *getTriangles() override {
+    inline const FlatJaggedArray *getTriangles() override {
+      lazyPreprocess(Relation::Triangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -1267,6 +1311,8 @@ namespace ttk {
     inline int getTriangleEdge(const SimplexId &triangleId,
                                const int &localEdgeId,
                                SimplexId &edgeId) const override {
+      lazyPreprocess(Relation::TriangleEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       edgeId = -1;
@@ -1315,6 +1361,8 @@ namespace ttk {
     /// \sa getCellEdgeNumber()
     inline SimplexId
       getTriangleEdgeNumber(const SimplexId &triangleId) const override {
+      lazyPreprocess(Relation::TriangleEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1349,8 +1397,8 @@ namespace ttk {
     /// Get the list of edges for all triangles.
     ///
     /// The number of entries in this list is equal to the number of
-    /// triangles. Each entry is a std::vector of identifiers representing the
-    /// edges connected to the triangle (3).
+    /// triangles. Each entry is a row (see ttk::FlatJaggedArray) of identifiers
+    /// representing the edges connected to the triangle (3).
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -1367,8 +1415,9 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle edge list.
     /// \sa getCellEdges()
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleEdges() override {
+    inline const FlatJaggedArray *getTriangleEdges() override {
+      lazyPreprocess(Relation::TriangleEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -1418,6 +1467,8 @@ namespace ttk {
     inline int getTriangleLink(const SimplexId &triangleId,
                                const int &localLinkId,
                                SimplexId &linkId) const override {
+      lazyPreprocess(Relation::TriangleLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       linkId = -1;
@@ -1460,6 +1511,8 @@ namespace ttk {
     /// \return Returns the number of simplices in the link of the triangle.
     inline SimplexId
       getTriangleLinkNumber(const SimplexId &triangleId) const override {
+      lazyPreprocess(Relation::TriangleLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1489,7 +1542,8 @@ namespace ttk {
     ///
     /// The number of entries in this list is equal to the number of
     /// triangles.
-    /// Each entry is a std::vector of identifiers representing a vertex.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers
+    /// representing a vertex.
     ///
     /// The notion of triangle link only makes sense in 3D.
     ///
@@ -1505,8 +1559,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle link list.
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleLinks() override {
+    inline const FlatJaggedArray *getTriangleLinks() override {
+      lazyPreprocess(Relation::TriangleLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -1551,6 +1606,8 @@ namespace ttk {
     inline int getTriangleStar(const SimplexId &triangleId,
                                const int &localStarId,
                                SimplexId &starId) const override {
+      lazyPreprocess(Relation::TriangleStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       starId = -1;
@@ -1592,6 +1649,8 @@ namespace ttk {
     /// \return Returns the number of star cells.
     inline SimplexId
       getTriangleStarNumber(const SimplexId &triangleId) const override {
+      lazyPreprocess(Relation::TriangleStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1621,8 +1680,8 @@ namespace ttk {
     ///
     /// The number of entries in this list is equal to the number of
     /// triangles.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of star cells for the corresponding triangle.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of star cells for the corresponding triangle.
     ///
     /// The notion of triangle star only makes sense in 3D.
     ///
@@ -1638,8 +1697,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle star list.
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleStars() override {
+    inline const FlatJaggedArray *getTriangleStars() override {
+      lazyPreprocess(Relation::TriangleStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -1682,6 +1742,8 @@ namespace ttk {
                                  const int &localVertexId,
                                  SimplexId &vertexId) const override {
 
+      lazyPreprocess(Relation::Triangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       vertexId = -1;
@@ -1736,6 +1798,8 @@ namespace ttk {
                              const int &localEdgeId,
                              SimplexId &edgeId) const override {
 
+      lazyPreprocess(Relation::VertexEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       edgeId = -1;
@@ -1781,6 +1845,8 @@ namespace ttk {
     /// \sa getVertexStarNumber()
     inline SimplexId
       getVertexEdgeNumber(const SimplexId &vertexId) const override {
+      lazyPreprocess(Relation::VertexEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1813,8 +1879,8 @@ namespace ttk {
     ///
     /// The number of entries in this list is equal to the number of
     /// vertices.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of edges connected to the corresponding vertex.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of edges connected to the corresponding vertex.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -1831,8 +1897,9 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex edge list.
     /// \sa getVertexStars()
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexEdges() override {
+    inline const FlatJaggedArray *getVertexEdges() override {
+      lazyPreprocess(Relation::VertexEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -1880,6 +1947,8 @@ namespace ttk {
                              const int &localLinkId,
                              SimplexId &linkId) const override {
 
+      lazyPreprocess(Relation::VertexLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       linkId = -1;
@@ -1919,6 +1988,8 @@ namespace ttk {
     inline SimplexId
       getVertexLinkNumber(const SimplexId &vertexId) const override {
 
+      lazyPreprocess(Relation::VertexLinks);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -1945,9 +2016,8 @@ namespace ttk {
     ///
     /// The number of entries in this list is equal to the number of
     /// vertices.
-    /// Each entry is a std::vector of identifiers representing edges in 2D
-    /// and
-    /// triangles in 3D.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers
+    /// representing edges in 2D and triangles in 3D.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -1961,8 +2031,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex link list.
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexLinks() override {
+    inline const FlatJaggedArray *getVertexLinks() override {
+
+      lazyPreprocess(Relation::VertexLinks);
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
@@ -2002,6 +2073,8 @@ namespace ttk {
                                  const int &localNeighborId,
                                  SimplexId &neighborId) const override {
 
+      lazyPreprocess(Relation::VertexNeighbors);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       neighborId = -1;
@@ -2038,6 +2111,8 @@ namespace ttk {
     inline SimplexId
       getVertexNeighborNumber(const SimplexId &vertexId) const override {
 
+      lazyPreprocess(Relation::VertexNeighbors);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2064,8 +2139,8 @@ namespace ttk {
     ///
     /// The number of entries in this list is equal to the number of
     /// vertices.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of vertex neighbors for the corresponding vertex.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of vertex neighbors for the corresponding vertex.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -2079,8 +2154,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex neighbor list.
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexNeighbors() override {
+    inline const FlatJaggedArray *getVertexNeighbors() override {
+      lazyPreprocess(Relation::VertexNeighbors);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -2146,6 +2222,8 @@ namespace ttk {
                              const int &localStarId,
                              SimplexId &starId) const override {
 
+      lazyPreprocess(Relation::VertexStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       starId = -1;
@@ -2184,6 +2262,8 @@ namespace ttk {
     /// \return Returns the number of star cells.
     inline SimplexId
       getVertexStarNumber(const SimplexId &vertexId) const override {
+      lazyPreprocess(Relation::VertexStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2212,8 +2292,8 @@ namespace ttk {
     /// dimension (3D: tetrahedra, 2D: triangles, 1D: edges).
     ///
     /// The number of entries in this list is equal to the number of vertices.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of star cells for the corresponding vertex.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of star cells for the corresponding vertex.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -2227,8 +2307,9 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex star list.
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexStars() override {
+    inline const FlatJaggedArray *getVertexStars() override {
+      lazyPreprocess(Relation::VertexStars);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return NULL;
@@ -2271,6 +2352,8 @@ namespace ttk {
                                  const int &localTriangleId,
                                  SimplexId &triangleId) const override {
 
+      lazyPreprocess(Relation::VertexTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       // initialize output variable before early return
       triangleId = -1;
@@ -2320,6 +2403,8 @@ namespace ttk {
     inline SimplexId
       getVertexTriangleNumber(const SimplexId &vertexId) const override {
 
+      lazyPreprocess(Relation::VertexTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return -1;
@@ -2355,8 +2440,8 @@ namespace ttk {
     /// Get the list of triangles for all vertices.
     ///
     /// The number of entries in this list is equal to the number of vertices.
-    /// Each entry is a std::vector of identifiers whose size is equal to the
-    /// number of triangles for the corresponding vertex.
+    /// Each entry is a row (see ttk::FlatJaggedArray) of identifiers whose size
+    /// is equal to the number of triangles for the corresponding vertex.
     ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
@@ -2373,8 +2458,9 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex triangle list.
     /// \sa getVertexStars()
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexTriangles() override {
+    inline const FlatJaggedArray *getVertexTriangles() override {
+
+      lazyPreprocess(Relation::VertexTriangles);
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
@@ -2423,6 +2509,8 @@ namespace ttk {
     /// \param edgeId Input global edge identifier.
     /// \return Returns true if the edge is on the boundary, false otherwise.
     inline bool isEdgeOnBoundary(const SimplexId &edgeId) const override {
+      lazyPreprocess(Relation::BoundaryEdges);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return false;
@@ -2469,6 +2557,8 @@ namespace ttk {
     /// otherwise.
     inline bool
       isTriangleOnBoundary(const SimplexId &triangleId) const override {
+      lazyPreprocess(Relation::BoundaryTriangles);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return false;
@@ -2505,6 +2595,8 @@ namespace ttk {
     /// \return Returns true if the vertex is on the boundary, false
     /// otherwise.
     inline bool isVertexOnBoundary(const SimplexId &vertexId) const override {
+      lazyPreprocess(Relation::BoundaryVertices);
+
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
         return false;
@@ -2541,6 +2633,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessBoundaryEdges())
                && (hasPreprocessedBoundaryEdges_ = true));
@@ -2564,6 +2657,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessBoundaryTriangles())
                && (hasPreprocessedBoundaryTriangles_ = true));
@@ -2587,6 +2681,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessBoundaryVertices())
                && (hasPreprocessedBoundaryVertices_ = true));
@@ -2612,6 +2707,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
       if(getDimensionality() == 1)
         return !((!abstractTriangulation_->preprocessCellNeighbors())
                  && (hasPreprocessedCellEdges_ = true)
@@ -2644,6 +2740,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessCellNeighbors())
                && (hasPreprocessedCellNeighbors_ = true));
@@ -2675,6 +2772,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
       if(getDimensionality() == 2)
         return !((!abstractTriangulation_->preprocessCellNeighbors())
                  && (hasPreprocessedCellTriangles_ = true)
@@ -2707,6 +2805,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessEdges())
                && (hasPreprocessedBoundaryEdges_ = true));
@@ -2738,6 +2837,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessEdgeLinks())
                && (hasPreprocessedEdgeLinks_ = true));
@@ -2769,6 +2869,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessEdgeStars())
                && (hasPreprocessedEdgeStars_ = true));
@@ -2800,6 +2901,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
 
       if(getDimensionality() == 2) {
         return !((!abstractTriangulation_->preprocessEdgeStars())
@@ -2837,6 +2939,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       if(getDimensionality() == 2)
         return 0;
@@ -2871,6 +2974,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
 
       if(getDimensionality() == 2)
         return !((!abstractTriangulation_->preprocessCellEdges())
@@ -2907,6 +3011,7 @@ namespace ttk {
       if(getDimensionality() != 3)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessTriangleLinks())
                && (hasPreprocessedTriangleLinks_ = true));
@@ -2938,6 +3043,7 @@ namespace ttk {
       if(getDimensionality() != 3)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessTriangleStars())
                && (hasPreprocessedTriangleStars_ = true));
@@ -2966,6 +3072,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
       if(getDimensionality() == 1)
         return !((!abstractTriangulation_->preprocessVertexStars())
                  && (hasPreprocessedVertexEdges_ = true)
@@ -2998,6 +3105,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessVertexLinks())
                && (hasPreprocessedVertexLinks_ = true));
@@ -3026,6 +3134,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessVertexNeighbors())
                && (hasPreprocessedVertexNeighbors_ = true));
@@ -3054,6 +3163,7 @@ namespace ttk {
       if(isEmptyCheck())
         return -1;
 #endif
+      const auto lock = lockPreprocessing();
 
       return !((!abstractTriangulation_->preprocessVertexStars())
                && (hasPreprocessedVertexStars_ = true));
@@ -3084,6 +3194,7 @@ namespace ttk {
       if(getDimensionality() == 1)
         return -2;
 #endif
+      const auto lock = lockPreprocessing();
       if(getDimensionality() == 2) {
         return !((!abstractTriangulation_->preprocessVertexStars())
                  && (hasPreprocessedVertexTriangles_ = true)
@@ -3154,10 +3265,79 @@ namespace ttk {
 
       abstractTriangulation_ = &explicitTriangulation_;
       gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      lazyRelations_ = 0;
 
       return explicitTriangulation_.setInputCells(cellNumber, cellArray);
     }
 
+    /// Set the input cells for the triangulation, from 32-bit identifiers
+    /// (legacy VTK layout, no copy).
+    ///
+    /// \param cellNumber Number of input cells.
+    /// \param cellArray Pointer to the input cells (each cell starts by the
+    /// number of vertices in it, followed by the identifiers of its
+    /// vertices).
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa setInputCells()
+    inline int setInputCells(const SimplexId &cellNumber,
+                             const int *cellArray) {
+
+      abstractTriangulation_ = &explicitTriangulation_;
+      gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      lazyRelations_ = 0;
+
+      return explicitTriangulation_.setInputCells(
+        cellNumber, CellArray(cellArray));
+    }
+
+    /// Set the input cells for the triangulation, from a connectivity array
+    /// and an offsets array (VTK 9 layout), without copying them.
+    ///
+    /// \param cellNumber Number of input cells.
+    /// \param connectivity Pointer to the vertex identifiers of the cells,
+    /// cell after cell (int or long long int).
+    /// \param offsets Pointer to the position of the first vertex of each
+    /// cell in \p connectivity (\p cellNumber + 1 entries). All the cells
+    /// must have the same number of vertices.
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa setInputCells()
+    template <typename idType>
+    inline int setInputCells(const SimplexId &cellNumber,
+                             const idType *connectivity,
+                             const idType *offsets) {
+
+      abstractTriangulation_ = &explicitTriangulation_;
+      gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      lazyRelations_ = 0;
+
+      return explicitTriangulation_.setInputCells(
+        cellNumber, connectivity, offsets);
+    }
+
+    /// Set the input cells of a homogeneous triangulation (tetrahedra,
+    /// triangles or edges only) from a connectivity array, without copying
+    /// it.
+    ///
+    /// \param cellNumber Number of input cells.
+    /// \param vertexNumber Number of vertices per cell (4: tetrahedra,
+    /// 3: triangles, 2: edges).
+    /// \param connectivity Pointer to the vertex identifiers of the cells,
+    /// cell after cell (int or long long int).
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa setInputCells()
+    template <typename idType>
+    inline int setInputCells(const SimplexId &cellNumber,
+                             const int &vertexNumber,
+                             const idType *connectivity) {
+
+      abstractTriangulation_ = &explicitTriangulation_;
+      gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      lazyRelations_ = 0;
+
+      return explicitTriangulation_.setInputCells(
+        cellNumber, CellArray(connectivity, vertexNumber));
+    }
+
     /// Set the specifications of the input grid to implicitly represent as a
     /// triangulation.
     /// \param xOrigin Input x coordinate of the grid origin.
@@ -3199,6 +3379,8 @@ namespace ttk {
                                                     xSpacing, ySpacing,
                                                     zSpacing, xDim, yDim, zDim);
 
+      lazyRelations_ = 0;
+
       if(usePeriodicBoundaries_) {
         abstractTriangulation_ = &periodicImplicitTriangulation_;
         return retPeriodic;
@@ -3222,6 +3404,7 @@ namespace ttk {
           return;
         }
         usePeriodicBoundaries_ = usePeriodicBoundaries;
+        lazyRelations_ = 0;
         if(usePeriodicBoundaries_) {
           abstractTriangulation_ = &periodicImplicitTriangulation_;
         } else {
@@ -3236,6 +3419,48 @@ namespace ttk {
       return usePeriodicBoundaries_;
     }
 
+    /// Concrete implementations of the triangulation (GENERIC stands for
+    /// the current object itself, see getDispatchType()).
+    /// \sa getType()
+    /// \sa ttkTemplateMacro
+    enum class Type { EXPLICIT, IMPLICIT, PERIODIC, GENERIC };
+
+    /// Returns the type of the concrete implementation currently in use.
+    inline Type getType() const {
+      if(abstractTriangulation_ == &implicitTriangulation_)
+        return Type::IMPLICIT;
+      if(abstractTriangulation_ == &periodicImplicitTriangulation_)
+        return Type::PERIODIC;
+      return Type::EXPLICIT;
+    }
+
+    /// Returns the type of the templated kernels to dispatch on (see
+    /// ttkTemplateMacro): the type of the concrete implementation in use,
+    /// or GENERIC in lazy mode (see setLazyPreprocessing()), where the
+    /// queries have to go through the current object to trigger the
+    /// pre-processings.
+    inline Type getDispatchType() const {
+      return lazyPreprocessing_ ? Type::GENERIC : getType();
+    }
+
+    /// Returns the concrete implementation currently in use, to be
+    /// traversed without virtual calls (see ttkTemplateMacro), or NULL in
+    /// lazy mode (see getDispatchType()). getData<Triangulation>() returns
+    /// the current object.
+    ///
+    /// \warning The concrete implementation performs none of the checks of
+    /// the current object and does not re-map the queries on lower
+    /// dimensional triangulations (for instance, edges of a 1D
+    /// triangulation). The adequate pre-processing functions should be
+    /// called on the current object first.
+    /// \sa getType()
+    template <class triangulationType>
+    inline const triangulationType *getData() const {
+      if(lazyPreprocessing_)
+        return nullptr;
+      return static_cast<const triangulationType *>(abstractTriangulation_);
+    }
+
     /// Set the input 3D points of the triangulation.
     /// \param pointNumber Number of input vertices.
     /// \param pointSet Pointer to the 3D points. This pointer should point to
@@ -3258,10 +3483,47 @@ namespace ttk {
 
       abstractTriangulation_ = &explicitTriangulation_;
       gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      lazyRelations_ = 0;
       return explicitTriangulation_.setInputPoints(
         pointNumber, pointSet, doublePrecision);
     }
 
+    /// Use the implementation of \p triangulation (an explicit triangulation),
+    /// along with its pre-processed relations, instead of an implementation
+    /// of the current object.
+    ///
+    /// The current object keeps its own execution context (wrapper, debug
+    /// level, number of threads), which is used for the pre-processings it
+    /// triggers. The pre-processings of all the objects sharing an
+    /// implementation are serialized.
+    /// \param triangulation Input triangulation, which must outlive the
+    /// current object.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setInputTriangulation(const Triangulation &triangulation);
+
+    /// Enable or disable the lazy pre-processing mode (disabled by default).
+    ///
+    /// In lazy mode, the first query to a relation which has not been
+    /// pre-processed builds it (by calling the corresponding
+    /// pre-processing function), instead of returning an error. The build
+    /// happens only once, under a lock, and the queries can thus be issued
+    /// concurrently (e.g. from within an OpenMP parallel region, in which
+    /// case the build itself is sequential). Once a relation has been
+    /// built, the overhead of the mode is one atomic load per query.
+    ///
+    /// Explicit pre-processing remains recommended for performance
+    /// measurements, to exclude the construction time of the relations.
+    /// \param lazyPreprocessing Enable (true) or disable (false) the mode.
+    /// \sa footprint()
+    inline void setLazyPreprocessing(const bool &lazyPreprocessing) {
+      lazyPreprocessing_ = lazyPreprocessing;
+    }
+
+    /// Returns true if the lazy pre-processing mode is enabled.
+    inline bool isLazyPreprocessing() const {
+      return lazyPreprocessing_;
+    }
+
     /// Tune the number of active threads (default: number of logical cores)
     inline int setThreadNumber(const ThreadId &threadNumber) {
       explicitTriangulation_.setThreadNumber(threadNumber);
@@ -3274,6 +3536,7 @@ namespace ttk {
     /// Internal usage. Pass the execution context (debug level, number of
     /// threads, etc.) to the implementing classes.
     inline int setWrapper(const Wrapper *wrapper) override {
+      AbstractTriangulation::setWrapper(wrapper);
       explicitTriangulation_.setWrapper(wrapper);
       implicitTriangulation_.setWrapper(wrapper);
       periodicImplicitTriangulation_.setWrapper(wrapper);
@@ -3281,6 +3544,52 @@ namespace ttk {
     }
 
   protected:
+    /// Relations which can be pre-processed (lazily or not).
+    enum class Relation {
+      BoundaryEdges,
+      BoundaryTriangles,
+      BoundaryVertices,
+      CellEdges,
+      CellNeighbors,
+      CellTriangles,
+      Edges,
+      EdgeLinks,
+      EdgeStars,
+      EdgeTriangles,
+      Triangles,
+      TriangleEdges,
+      TriangleLinks,
+      TriangleStars,
+      VertexEdges,
+      VertexLinks,
+      VertexNeighbors,
+      VertexStars,
+      VertexTriangles,
+      NumberOfRelations
+    };
+
+    static const char *getRelationName(const Relation &relation);
+
+    bool hasPreprocessedRelation(const Relation &relation) const;
+
+    /// In lazy mode, make sure that \p relation has been built before
+    /// querying it.
+    inline void lazyPreprocess(const Relation &relation) const {
+      if((lazyPreprocessing_)
+         && (!(lazyRelations_.load(std::memory_order_acquire)
+               & (1 << static_cast<int>(relation))))) {
+        lazyPreprocessRelation(relation);
+      }
+    }
+
+    int lazyPreprocessRelation(const Relation &relation) const;
+
+    /// Lock the implementation in use for a pre-processing and pass it the
+    /// execution context (debug level, number of threads) of the current
+    /// object, which may differ from that of the other objects sharing it
+    /// (see setInputTriangulation()).
+    std::unique_lock<std::recursive_mutex> lockPreprocessing() const;
+
     inline bool isEmptyCheck() const {
       if(!abstractTriangulation_) {
         std::stringstream msg;
@@ -3299,9 +3608,54 @@ namespace ttk {
     ImplicitTriangulation implicitTriangulation_;
     PeriodicImplicitTriangulation periodicImplicitTriangulation_;
     bool usePeriodicBoundaries_;
+
+    bool lazyPreprocessing_;
+    // bit-mask of the relations available to the lazy mode
+    mutable std::atomic<int> lazyRelations_;
+    // bit-mask of the relations built upon a query (for reporting purposes)
+    mutable int lazilyBuiltRelations_;
+    // serializes the pre-processings, shared with the objects using the same
+    // implementation (see setInputTriangulation())
+    std::shared_ptr<std::recursive_mutex> preprocessMutex_;
   };
+
+  template <>
+  inline const Triangulation *Triangulation::getData<Triangulation>() const {
+    return this;
+  }
 } // namespace ttk
 
+/// \brief Compile-time dispatch on the concrete implementation of a
+/// ttk::Triangulation.
+///
+/// Executes \p call once, with TTK_TT defined as the concrete class
+/// matching \p triangulationType (ttk::Triangulation::Type). Templated
+/// kernels are thus instantiated once per concrete class and their
+/// traversal queries can be inlined. In lazy mode, TTK_TT is
+/// ttk::Triangulation itself, whose queries build the missing relations.
+/// For instance:
+/// \code
+/// ttkTemplateMacro(triangulation_->getDispatchType(),
+///                  (ret = execute(triangulation_->getData<TTK_TT>())));
+/// \endcode
+#define ttkTemplateMacroCase(triangulationType, triangulationClass, call) \
+  case triangulationType: {                                               \
+    typedef triangulationClass TTK_TT;                                    \
+    call;                                                                 \
+  }; break
+
+#define ttkTemplateMacro(triangulationType, call)                   \
+  switch(triangulationType) {                                       \
+    ttkTemplateMacroCase(ttk::Triangulation::Type::EXPLICIT,        \
+                         ttk::ExplicitTriangulation, call);         \
+    ttkTemplateMacroCase(ttk::Triangulation::Type::IMPLICIT,        \
+                         ttk::ImplicitTriangulation, call);         \
+    ttkTemplateMacroCase(ttk::Triangulation::Type::PERIODIC,        \
+                         ttk::PeriodicImplicitTriangulation, call); \
+    ttkTemplateMacroCase(ttk::Triangulation::Type::GENERIC,         \
+                         ttk::Triangulation, call);                 \
+  }
+
 // if the package is not a template, comment the following line
 // #include                  <Triangulation.cpp>
 
@@ -1389,7 +1389,7 @@ void ttkContourForests::getSegmentation(vtkDataSet *input) {
   toComputeSegmentation_ = false;
 }
 
-void ttkContourForests::getTree() {
+void ttkContourForests::getTree(vtkDataSet *input) {
   setDebugLevel(debugLevel_);
   // sequential params
   contourTree_.setDebugLevel(debugLevel_);
@@ -1398,6 +1398,18 @@ void ttkContourForests::getTree() {
   if(!vertexSoSoffsets_.empty()) {
     contourTree_.setVertexSoSoffsets(vertexSoSoffsets_);
   }
+  // skip the sort of the vertices if an order field is available
+  vtkDataArray *offsets = nullptr;
+  if(useInputOffsetScalarField_ and inputOffsetScalarFieldName_.length())
+    offsets
+      = input->GetPointData()->GetArray(inputOffsetScalarFieldName_.data());
+  else
+    offsets = input->GetPointData()->GetArray(ttk::OffsetScalarFieldName);
+  ttkSimplexIdTypeArray *orderField
+    = ttkVertexOrder::getOrderField(input, vtkInputScalars_, offsets);
+  contourTree_.setVertexOrder(
+    orderField ? static_cast<SimplexId *>(orderField->GetVoidPointer(0))
+               : nullptr);
   contourTree_.setTreeType(treeType_);
   // parallel params
   contourTree_.setLessPartition(lessPartition_);
@@ -1503,7 +1515,7 @@ int ttkContourForests::doIt(vector<vtkDataSet *> &inputs,
   // ContourForestsTree //
   if(varyingMesh_ || varyingDataValues_ || toComputeContourTree_) {
     clearTree();
-    getTree();
+    getTree(input);
   }
 
   // update the trees
@@ -60,6 +60,7 @@
 #include <vtkTable.h>
 
 // vtk wrapper includes
+#include <ttkVertexOrder.h>
 #include <ttkWrapper.h>
 
 // base code includes
@@ -137,7 +138,7 @@ protected:
   bool isCoincident(double p1[], double p2[]);
 
   // ContourForestsTree //
-  void getTree();
+  void getTree(vtkDataSet *input);
   void updateTree();
   ttk::CriticalType getNodeType(ttk::SimplexId id);
   ttk::CriticalType getNodeType(ttk::SimplexId id,
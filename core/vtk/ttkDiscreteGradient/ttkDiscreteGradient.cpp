@@ -10,7 +10,8 @@ vtkStandardNewMacro(ttkDiscreteGradient)
   : UseAllCores{true}, ScalarField{}, InputOffsetScalarFieldName{},
     ForceInputOffsetScalarField{false}, ReverseSaddleMaximumConnection{true},
     ReverseSaddleSaddleConnection{true}, AllowSecondPass{true},
-    AllowThirdPass{true}, ComputeGradientGlyphs{true}, IterationThreshold{-1},
+    AllowThirdPass{true}, ComputeGradientGlyphs{true}, LowerStarGradient{false},
+    IterationThreshold{-1},
     ScalarFieldId{}, OffsetFieldId{-1},
 
     triangulation_{}, inputScalars_{}, offsets_{}, inputOffsets_{},
@@ -431,6 +432,7 @@ int ttkDiscreteGradient::doIt(vector<vtkDataSet *> &inputs,
   // baseCode processing
   discreteGradient_.setWrapper(this);
   discreteGradient_.setIterationThreshold(IterationThreshold);
+  discreteGradient_.setLowerStarGradient(LowerStarGradient);
   discreteGradient_.setReverseSaddleMaximumConnection(
     ReverseSaddleMaximumConnection);
   discreteGradient_.setReverseSaddleSaddleConnection(
@@ -92,6 +92,9 @@ public:
   vtkSetMacro(ComputeGradientGlyphs, int);
   vtkGetMacro(ComputeGradientGlyphs, int);
 
+  vtkSetMacro(LowerStarGradient, int);
+  vtkGetMacro(LowerStarGradient, int);
+
   vtkSetMacro(IterationThreshold, int);
   vtkGetMacro(IterationThreshold, int);
 
@@ -134,6 +137,7 @@ private:
   bool AllowSecondPass;
   bool AllowThirdPass;
   bool ComputeGradientGlyphs;
+  bool LowerStarGradient;
   int IterationThreshold;
   int ScalarFieldId;
   int OffsetFieldId;
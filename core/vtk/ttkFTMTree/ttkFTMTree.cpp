@@ -371,6 +371,16 @@ int ttkFTMTree::doIt(vector<vtkDataSet *> &inputs,
   for(int cc = 0; cc < nbCC_; cc++) {
     ftmTree_[cc].tree.setVertexScalars(inputScalars_[cc]->GetVoidPointer(0));
     ftmTree_[cc].tree.setVertexSoSoffsets(offsets_[cc].data());
+    // skip the sort of the vertices if an order field is available
+    ttkSimplexIdTypeArray *orderField = nullptr;
+    if(!ForceInputOffsetScalarField)
+      orderField = ttkVertexOrder::getOrderField(
+        connected_components_[cc], inputScalars_[cc],
+        connected_components_[cc]->GetPointData()->GetArray(
+          ttk::OffsetScalarFieldName));
+    ftmTree_[cc].tree.setVertexOrder(
+      orderField ? static_cast<SimplexId *>(orderField->GetVoidPointer(0))
+                 : nullptr);
     ftmTree_[cc].tree.setTreeType(GetTreeType());
     ftmTree_[cc].tree.setSegmentation(GetWithSegmentation());
     ftmTree_[cc].tree.setNormalizeIds(GetWithNormalize());
@@ -538,6 +548,22 @@ int ttkFTMTree::getSegmentation(vtkDataSet *outputSegmentation) {
   vtkPointData *pointData = outputSegmentation->GetPointData();
   vertData.addArray(pointData, params_);
 
+  // share the order of the vertices with the subsequent filters
+  vtkDataArray *offsets = pointData->GetArray(ttk::OffsetScalarFieldName);
+  if(nbCC_ == 1 and !ForceInputOffsetScalarField
+     and !ttkVertexOrder::getOrderField(
+       outputSegmentation, inputScalars_[0], offsets)) {
+    const std::vector<SimplexId> *mirrorVertices
+      = ftmTree_[0].tree.getTree(GetTreeType())->getMirrorVertices();
+    if(mirrorVertices) {
+      vtkSmartPointer<ttkSimplexIdTypeArray> orderField;
+      orderField.TakeReference(ttkVertexOrder::newOrderField(
+        inputScalars_[0], offsets, *mirrorVertices));
+      if(orderField)
+        pointData->AddArray(orderField);
+    }
+  }
+
   return 0;
 }
 
@@ -27,6 +27,7 @@
 // ttk code includes
 #include <FTMTree.h>
 #include <ttkFTMStructures.h>
+#include <ttkVertexOrder.h>
 #include <ttkWrapper.h>
 
 #ifndef TTK_PLUGIN
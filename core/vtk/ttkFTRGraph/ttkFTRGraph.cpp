@@ -262,6 +262,16 @@ int ttkFTRGraph::dispatch(Graph &graph) {
   // reeb graph parameters
   ftrGraph_.setScalars(inputScalars_->GetVoidPointer(0));
   ftrGraph_.setVertexSoSoffsets(&offsets_);
+  // skip the sort of the vertices if an order field is available
+  vtkDataArray *inputOffsets = nullptr;
+  if(UseInputOffsetScalarField and InputOffsetScalarFieldName.length())
+    inputOffsets
+      = mesh_->GetPointData()->GetArray(InputOffsetScalarFieldName.data());
+  ttkSimplexIdTypeArray *orderField
+    = ttkVertexOrder::getOrderField(mesh_, inputScalars_, inputOffsets);
+  ftrGraph_.setVertexOrder(
+    orderField ? static_cast<ttk::SimplexId *>(orderField->GetVoidPointer(0))
+               : nullptr);
   // build
   {
     std::stringstream msg;
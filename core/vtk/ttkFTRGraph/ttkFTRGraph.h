@@ -6,6 +6,7 @@
 #include "FTRGraph.h"
 #include "Graph.h"
 #include "ttkFTRGraphStructures.h"
+#include "ttkVertexOrder.h"
 #include "ttkWrapper.h"
 
 // VTK includes
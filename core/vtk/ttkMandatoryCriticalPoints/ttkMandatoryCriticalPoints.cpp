@@ -745,6 +745,20 @@ int ttkMandatoryCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
     inputLowerBoundField->GetVoidPointer(0));
   mandatoryCriticalPoints_.setUpperBoundFieldPointer(
     inputUpperBoundField->GetVoidPointer(0));
+  // compare the vertices by their ranks if order fields are available (the
+  // offsets are the vertex identifiers)
+  ttkSimplexIdTypeArray *lowerBoundOrder
+    = ttkVertexOrder::getOrderField(input, inputLowerBoundField, nullptr);
+  ttkSimplexIdTypeArray *upperBoundOrder
+    = ttkVertexOrder::getOrderField(input, inputUpperBoundField, nullptr);
+  mandatoryCriticalPoints_.setLowerBoundOrderPointer(
+    lowerBoundOrder
+      ? static_cast<SimplexId *>(lowerBoundOrder->GetVoidPointer(0))
+      : nullptr);
+  mandatoryCriticalPoints_.setUpperBoundOrderPointer(
+    upperBoundOrder
+      ? static_cast<SimplexId *>(upperBoundOrder->GetVoidPointer(0))
+      : nullptr);
   // Set the output data pointers
   mandatoryCriticalPoints_.setOutputMinimumDataPointer(
     outputMandatoryMinimum_->GetVoidPointer(0));
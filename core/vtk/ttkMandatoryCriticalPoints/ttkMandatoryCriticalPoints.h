@@ -66,6 +66,7 @@
 
 // ttk code includes
 #include <MandatoryCriticalPoints.h>
+#include <ttkVertexOrder.h>
 #include <ttkWrapper.h>
 
 #include <queue>
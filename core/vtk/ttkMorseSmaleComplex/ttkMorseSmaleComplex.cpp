@@ -1,9 +1,153 @@
 #include <ttkMorseSmaleComplex.h>
 
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+
 using namespace std;
 using namespace ttk;
 using namespace dcg;
 
+namespace {
+
+  /**
+   * Writes the batches of 2-separatrices streamed by ttk::MorseSmaleComplex
+   * to a legacy VTK (ASCII) polygonal data file, without keeping them in
+   * memory: the points, polygons and cell arrays are appended to temporary
+   * files (one per section) which are concatenated by finalize().
+   */
+  class Separatrices2Writer {
+
+  public:
+    Separatrices2Writer(const string &fileName)
+      : fileName_{fileName}, sections_(sectionNames_.size()) {
+    }
+
+    ~Separatrices2Writer() {
+      for(size_t i = 0; i < sections_.size(); ++i) {
+        if(sections_[i].is_open())
+          sections_[i].close();
+        remove(getSectionFileName(i).data());
+      }
+    }
+
+    int open() {
+      for(size_t i = 0; i < sections_.size(); ++i) {
+        sections_[i].open(getSectionFileName(i).data());
+        if(!sections_[i])
+          return -1;
+      }
+      sections_[0].precision(numeric_limits<float>::max_digits10);
+      for(size_t i = 5; i < 8; ++i)
+        sections_[i].precision(numeric_limits<double>::max_digits10);
+      return 0;
+    }
+
+    int write(const Separatrices2Batch &batch) {
+      const SimplexId numberOfPoints = batch.getNumberOfPoints();
+      for(SimplexId i = 0; i < numberOfPoints; ++i)
+        sections_[0] << batch.points_[3 * i] << " "
+                     << batch.points_[3 * i + 1] << " "
+                     << batch.points_[3 * i + 2] << "\n";
+
+      const SimplexId numberOfCells = batch.getNumberOfCells();
+      size_t ptr{};
+      for(SimplexId i = 0; i < numberOfCells; ++i) {
+        const SimplexId vertexNumber = batch.cells_[ptr];
+        sections_[1] << vertexNumber;
+        for(SimplexId j = 1; j <= vertexNumber; ++j)
+          sections_[1] << " " << batch.cells_[ptr + j];
+        sections_[1] << "\n";
+        ptr += vertexNumber + 1;
+
+        sections_[2] << batch.cells_sourceIds_[i] << "\n";
+        sections_[3] << batch.cells_separatrixIds_[i] << "\n";
+        sections_[4] << (int)batch.cells_separatrixTypes_[i] << "\n";
+        sections_[5] << batch.cells_separatrixFunctionMaxima_[i] << "\n";
+        sections_[6] << batch.cells_separatrixFunctionMinima_[i] << "\n";
+        sections_[7] << batch.cells_separatrixFunctionDiffs_[i] << "\n";
+        sections_[8] << (int)batch.cells_isOnBoundary_[i] << "\n";
+      }
+
+      numberOfPoints_ += numberOfPoints;
+      numberOfCells_ += numberOfCells;
+      cellsSize_ += batch.cells_.size();
+
+      for(auto &section : sections_) {
+        if(!section)
+          return -1;
+      }
+      return 0;
+    }
+
+    int finalize() {
+      for(auto &section : sections_)
+        section.close();
+
+      ofstream file(fileName_.data());
+      if(!file)
+        return -1;
+
+      file << "# vtk DataFile Version 3.0\n"
+           << "TTK 2-separatrices\n"
+           << "ASCII\n"
+           << "DATASET POLYDATA\n"
+           << "POINTS " << numberOfPoints_ << " float\n";
+      if(appendSection(file, 0))
+        return -1;
+
+      file << "POLYGONS " << numberOfCells_ << " " << cellsSize_ << "\n";
+      if(appendSection(file, 1))
+        return -1;
+
+      const string idType = sizeof(SimplexId) == 4 ? "int" : "vtkIdType";
+      const vector<string> types{
+        idType, idType, "char", "double", "double", "double", "char"};
+
+      file << "CELL_DATA " << numberOfCells_ << "\n";
+      for(size_t i = 2; i < sections_.size(); ++i) {
+        file << "SCALARS " << sectionNames_[i] << " " << types[i - 2]
+             << " 1\nLOOKUP_TABLE default\n";
+        if(appendSection(file, i))
+          return -1;
+      }
+
+      return file ? 0 : -1;
+    }
+
+  protected:
+    string getSectionFileName(const size_t i) const {
+      return fileName_ + "." + sectionNames_[i] + ".tmp";
+    }
+
+    int appendSection(ofstream &file, const size_t i) const {
+      ifstream section(getSectionFileName(i).data());
+      if(!section)
+        return -1;
+      // rdbuf() of an empty file sets the failbit of the output stream
+      if(section.peek() != ifstream::traits_type::eof())
+        file << section.rdbuf();
+      return file ? 0 : -1;
+    }
+
+    const vector<string> sectionNames_{"Points",
+                                       "Polygons",
+                                       "SourceId",
+                                       "SeparatrixId",
+                                       "SeparatrixType",
+                                       "SeparatrixFunctionMaximum",
+                                       "SeparatrixFunctionMinimum",
+                                       "SeparatrixFunctionDifference",
+                                       "NumberOfCriticalPointsOnBoundary"};
+
+    string fileName_;
+    vector<ofstream> sections_;
+    SimplexId numberOfPoints_{}, numberOfCells_{};
+    size_t cellsSize_{};
+  };
+} // namespace
+
 vtkStandardNewMacro(ttkMorseSmaleComplex)
 
   ttkMorseSmaleComplex::ttkMorseSmaleComplex()
@@ -17,6 +161,7 @@ vtkStandardNewMacro(ttkMorseSmaleComplex)
     ComputeDescendingSegmentation{true}, ComputeFinalSegmentation{true},
     ScalarFieldId{}, OffsetFieldId{-1}, ReturnSaddleConnectors{false},
     SaddleConnectorsPersistenceThreshold{0}, PrioritizeSpeedOverMemory{false},
+    LowerStarGradient{false}, CompactGradient{false}, Separatrices2FileName{},
 
     triangulation_{}, defaultOffsets_{}, hasUpdatedMesh_{} {
   UseAllCores = true;
@@ -964,6 +1109,33 @@ int ttkMorseSmaleComplex::doIt(vector<vtkDataSet *> &inputs,
     SaddleConnectorsPersistenceThreshold);
 
   morseSmaleComplex_.setPrioritizeSpeedOverMemory(PrioritizeSpeedOverMemory);
+  morseSmaleComplex_.setLowerStarGradient(LowerStarGradient);
+  morseSmaleComplex_.setCompactGradient(CompactGradient);
+
+  // stream the 2-separatrices to disk instead of the third output (3D only)
+  unique_ptr<Separatrices2Writer> separatrices2Writer;
+  const bool hasSeparatrices2
+    = (ComputeAscendingSeparatrices2 or ComputeDescendingSeparatrices2)
+      and triangulation_->getCellVertexNumber(0) == 4;
+  if(!Separatrices2FileName.empty() and !hasSeparatrices2) {
+    vtkWarningMacro("[ttkMorseSmaleComplex] Warning: no 2-separatrices to "
+                    "compute (2D data-set or disabled), `"
+                    << Separatrices2FileName << "' is not written.");
+  }
+  if(!Separatrices2FileName.empty() and hasSeparatrices2) {
+    separatrices2Writer.reset(new Separatrices2Writer(Separatrices2FileName));
+    if(separatrices2Writer->open()) {
+      cerr << "[ttkMorseSmaleComplex] Error : cannot write `"
+           << Separatrices2FileName << "'." << endl;
+      return -1;
+    }
+    morseSmaleComplex_.setSeparatrices2Sink(
+      [&separatrices2Writer](const Separatrices2Batch &batch) {
+        return separatrices2Writer->write(batch);
+      });
+  } else {
+    morseSmaleComplex_.setSeparatrices2Sink({});
+  }
 
   morseSmaleComplex_.setInputScalarField(inputScalars->GetVoidPointer(0));
   morseSmaleComplex_.setInputOffsets(inputOffsets->GetVoidPointer(0));
@@ -1002,6 +1174,15 @@ int ttkMorseSmaleComplex::doIt(vector<vtkDataSet *> &inputs,
         separatrices2_cells_separatrixTypes, separatrices2_cells_isOnBoundary));
   }
 
+  if(separatrices2Writer) {
+    morseSmaleComplex_.setSeparatrices2Sink({});
+    if(!ret and separatrices2Writer->finalize()) {
+      cerr << "[ttkMorseSmaleComplex] Error : cannot write `"
+           << Separatrices2FileName << "'." << endl;
+      ret = -1;
+    }
+  }
+
 #ifndef TTK_ENABLE_KAMIKAZE
   if(ret != 0) {
     return -1;
@@ -145,6 +145,15 @@ public:
   vtkSetMacro(PrioritizeSpeedOverMemory, int);
   vtkGetMacro(PrioritizeSpeedOverMemory, int);
 
+  vtkSetMacro(LowerStarGradient, int);
+  vtkGetMacro(LowerStarGradient, int);
+
+  vtkSetMacro(CompactGradient, int);
+  vtkGetMacro(CompactGradient, int);
+
+  vtkSetMacro(Separatrices2FileName, std::string);
+  vtkGetMacro(Separatrices2FileName, std::string);
+
   int setupTriangulation(vtkDataSet *input);
   vtkDataArray *getScalars(vtkDataSet *input);
   vtkDataArray *getOffsets(vtkDataSet *input);
@@ -216,6 +225,9 @@ private:
   int ReturnSaddleConnectors;
   double SaddleConnectorsPersistenceThreshold;
   bool PrioritizeSpeedOverMemory;
+  bool LowerStarGradient;
+  bool CompactGradient;
+  std::string Separatrices2FileName;
 
   ttk::MorseSmaleComplex morseSmaleComplex_;
   ttk::Triangulation *triangulation_;
@@ -9,7 +9,7 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   ttkPersistenceDiagram::ttkPersistenceDiagram()
   : UseAllCores{}, inputScalars_{},
     CTPersistenceDiagram_{vtkUnstructuredGrid::New()}, offsets_{},
-    inputOffsets_{}, varyingMesh_{} {
+    inputOffsets_{}, varyingMesh_{}, progressiveErrorBound_{} {
   SetNumberOfInputPorts(1);
   SetNumberOfOutputPorts(1);
 
@@ -19,6 +19,10 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   InputOffsetScalarFieldName = ttk::OffsetScalarFieldName;
   ForceInputOffsetScalarField = false;
   ComputeSaddleConnectors = false;
+  Backend = 0;
+  Progressive = false;
+  StartingResolutionLevel = -1;
+  StoppingResolutionLevel = 0;
   UseAllCores = true;
   ShowInsideDomain = false;
   computeDiagram_ = true;
@@ -298,11 +302,47 @@ int ttkPersistenceDiagram::doIt(vector<vtkDataSet *> &inputs,
   persistenceDiagram_.setDMTPairs(&dmt_pairs);
   persistenceDiagram_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceDiagram_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
+  // skip the sort of the vertices if an order field is available
+  ttkSimplexIdTypeArray *orderField = nullptr;
+  if(!ForceInputOffsetScalarField)
+    orderField = ttkVertexOrder::getOrderField(
+      input, inputScalars_,
+      inputOffsets_ == offsets_ ? nullptr : inputOffsets_);
+  persistenceDiagram_.setInputOrder(
+    orderField ? orderField->GetVoidPointer(0) : nullptr);
   persistenceDiagram_.setComputeSaddleConnectors(ComputeSaddleConnectors);
+  persistenceDiagram_.setBackend(
+    static_cast<ttk::PersistenceDiagram::BACKEND>(Backend));
+  persistenceDiagram_.setProgressive(Progressive);
+  persistenceDiagram_.setStartingResolutionLevel(StartingResolutionLevel);
+  persistenceDiagram_.setStoppingResolutionLevel(StoppingResolutionLevel);
+  if(Progressive) {
+    if(static_cast<ttk::PersistenceDiagram::BACKEND>(Backend)
+         != ttk::PersistenceDiagram::BACKEND::FTM
+       or ComputeSaddleConnectors)
+      vtkWarningMacro("[ttkPersistenceDiagram] Warning: the progressive mode "
+                      "ignores the backend and the saddle connectors.");
+    // keep the error bound of the last (stopping) level
+    persistenceDiagram_.setProgressiveSink(
+      [this](const int, const double errorBound) {
+        progressiveErrorBound_ = errorBound;
+        return 0;
+      });
+  } else {
+    persistenceDiagram_.setProgressiveSink({});
+  }
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
   }
 
+  if(Progressive) {
+    vtkSmartPointer<vtkDoubleArray> errorBound
+      = vtkSmartPointer<vtkDoubleArray>::New();
+    errorBound->SetName("BottleneckErrorBound");
+    errorBound->InsertNextValue(progressiveErrorBound_);
+    CTPersistenceDiagram_->GetFieldData()->AddArray(errorBound);
+  }
+
   outputCTPersistenceDiagram->ShallowCopy(CTPersistenceDiagram_);
   computeDiagram_ = false;
 
@@ -26,6 +26,10 @@
 /// triangulation (vtkDataSet)
 /// \param Output Output persistence diagram (vtkUnstructuredGrid)
 ///
+/// In progressive mode, the upper bound on the bottleneck distance between
+/// the output diagram and the exact one is stored in the field data array
+/// "BottleneckErrorBound" of the output.
+///
 /// This filter can be used as any other VTK filter (for instance, by using the
 /// sequence of calls SetInputData(), Update(), GetOutput()).
 ///
@@ -51,6 +55,7 @@
 #include <vtkDataSet.h>
 #include <vtkDataSetAlgorithm.h>
 #include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
 #include <vtkFiltersCoreModule.h>
 #include <vtkFloatArray.h>
 #include <vtkInformation.h>
@@ -62,6 +67,7 @@
 
 // ttk code includes
 #include <PersistenceDiagram.h>
+#include <ttkVertexOrder.h>
 #include <ttkWrapper.h>
 
 #ifndef TTK_PLUGIN
@@ -128,6 +134,34 @@ public:
   }
   vtkGetMacro(ComputeSaddleConnectors, int);
 
+  void SetBackend(int data) {
+    Backend = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(Backend, int);
+
+  void SetProgressive(int data) {
+    Progressive = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(Progressive, int);
+
+  void SetStartingResolutionLevel(int data) {
+    StartingResolutionLevel = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(StartingResolutionLevel, int);
+
+  void SetStoppingResolutionLevel(int data) {
+    StoppingResolutionLevel = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(StoppingResolutionLevel, int);
+
   void SetInputOffsetScalarFieldName(std::string data) {
     InputOffsetScalarFieldName = data;
     Modified();
@@ -222,6 +256,10 @@ private:
   std::string InputOffsetScalarFieldName;
   bool ForceInputOffsetScalarField;
   bool ComputeSaddleConnectors;
+  int Backend;
+  bool Progressive;
+  int StartingResolutionLevel;
+  int StoppingResolutionLevel;
   int ShowInsideDomain;
   bool PeriodicBoundaryConditions;
 
@@ -235,6 +273,7 @@ private:
   int ScalarFieldId, OffsetFieldId;
   void *CTDiagram_;
   bool computeDiagram_;
+  double progressiveErrorBound_;
 };
 
 template <typename scalarType>
@@ -12,6 +12,7 @@ vtkStandardNewMacro(ttkScalarFieldSmoother)
   ScalarFieldIdentifier = 0;
   MaskIdentifier = 0;
   ForceInputMaskScalarField = false;
+  LazyPreprocessing = false;
   InputMask = ttk::MaskScalarFieldName;
   outputScalarField_ = NULL;
 
@@ -73,6 +74,7 @@ int ttkScalarFieldSmoother::doIt(vector<vtkDataSet *> &inputs,
 #endif
 
   triangulation->setWrapper(this);
+  triangulation->setLazyPreprocessing(LazyPreprocessing);
   smoother_.setupTriangulation(triangulation);
   smoother_.setWrapper(this);
 
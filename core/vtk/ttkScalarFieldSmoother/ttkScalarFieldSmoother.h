@@ -88,6 +88,9 @@ public:
   vtkSetMacro(InputMask, std::string);
   vtkGetMacro(InputMask, std::string);
 
+  vtkSetMacro(LazyPreprocessing, bool);
+  vtkGetMacro(LazyPreprocessing, bool);
+
 protected:
   ttkScalarFieldSmoother();
 
@@ -100,6 +103,7 @@ private:
   int ScalarFieldIdentifier;
   int MaskIdentifier;
   bool ForceInputMaskScalarField;
+  bool LazyPreprocessing;
   std::string ScalarField;
   std::string InputMask;
   vtkDataArray *outputScalarField_;
@@ -180,14 +180,54 @@ int ttkTopologicalSimplification::getOffsets(vtkDataSet *input) {
   return 0;
 }
 
+int ttkTopologicalSimplification::getConstraintPersistence(
+  vtkPointSet *input) {
+  vtkDataArray *persistence = input->GetCellData()->GetArray("Persistence");
+  vtkDataArray *pairIdentifiers
+    = input->GetCellData()->GetArray("PairIdentifier");
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!persistence) {
+    cerr << "[ttkTopologicalSimplification] Error : constraints have no "
+            "persistence (cell data `Persistence')."
+         << endl;
+    return -1;
+  }
+#endif
+
+  // persistence of a critical point: maximum over its pairs
+  constraintPersistence_.assign(input->GetNumberOfPoints(), 0);
+  vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
+  for(vtkIdType i = 0; i < input->GetNumberOfCells(); ++i) {
+    // skip the diagonal of the persistence diagram
+    if(pairIdentifiers and pairIdentifiers->GetTuple1(i) == -1)
+      continue;
+
+    const double pairPersistence = persistence->GetTuple1(i);
+    input->GetCellPoints(i, pointIds);
+    for(vtkIdType j = 0; j < pointIds->GetNumberOfIds(); ++j) {
+      double &p = constraintPersistence_[pointIds->GetId(j)];
+      p = std::max(p, pairPersistence);
+    }
+  }
+
+  return 0;
+}
+
 template <typename VTK_TT>
 int ttkTopologicalSimplification::dispatch() {
   int ret = 0;
   if(inputOffsets_->GetDataType() == VTK_INT) {
-    ret = topologicalSimplification_.execute<VTK_TT, int>();
+    if(PersistenceThresholds.empty())
+      ret = topologicalSimplification_.execute<VTK_TT, int>();
+    else
+      ret = topologicalSimplification_.executeMultiLevel<VTK_TT, int>();
   }
   if(inputOffsets_->GetDataType() == VTK_ID_TYPE) {
-    ret = topologicalSimplification_.execute<VTK_TT, vtkIdType>();
+    if(PersistenceThresholds.empty())
+      ret = topologicalSimplification_.execute<VTK_TT, vtkIdType>();
+    else
+      ret = topologicalSimplification_.executeMultiLevel<VTK_TT, vtkIdType>();
   }
   return ret;
 }
@@ -349,12 +389,78 @@ int ttkTopologicalSimplification::doIt(vector<vtkDataSet *> &inputs,
   topologicalSimplification_.setInputOffsetScalarFieldPointer(
     inputOffsets_->GetVoidPointer(0));
 
+  // share the sort of the input scalar field if its order field is available
+  // (the generated offsets are the vertex identifiers)
+  ttkSimplexIdTypeArray *inputOrder = ttkVertexOrder::getOrderField(
+    domain, inputScalars_, inputOffsets_ == offsets_ ? nullptr : inputOffsets_);
+  topologicalSimplification_.setInputOrderScalarFieldPointer(
+    inputOrder ? inputOrder->GetVoidPointer(0) : nullptr);
+
   topologicalSimplification_.setOutputScalarFieldPointer(
     outputScalars->GetVoidPointer(0));
 
   topologicalSimplification_.setOutputOffsetScalarFieldPointer(
     outputOffsets->GetVoidPointer(0));
 
+  // multi-level simplification: one output scalar field (and offset field)
+  // per persistence threshold, by increasing threshold
+  std::vector<double> thresholds(PersistenceThresholds);
+  std::sort(thresholds.begin(), thresholds.end());
+  std::vector<vtkSmartPointer<vtkDataArray>> levelScalars;
+  std::vector<vtkSmartPointer<ttkSimplexIdTypeArray>> levelOffsets;
+  if(!thresholds.empty()) {
+    ret = getConstraintPersistence(constraints);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(ret) {
+      cerr << "[ttkTopologicalSimplification] Error : wrong constraint "
+              "persistence."
+           << endl;
+      return -13;
+    }
+#endif
+
+    std::vector<void *> scalarPointers, offsetPointers;
+    for(size_t i = 0; i < thresholds.size(); ++i) {
+      const std::string suffix = "_" + std::to_string(i);
+
+      levelScalars.push_back(
+        vtkSmartPointer<vtkDataArray>::Take(outputScalars->NewInstance()));
+      levelScalars.back()->SetNumberOfTuples(numberOfVertices);
+      levelScalars.back()->SetName(
+        (std::string(inputScalars_->GetName()) + suffix).data());
+      scalarPointers.push_back(levelScalars.back()->GetVoidPointer(0));
+
+      levelOffsets.push_back(vtkSmartPointer<ttkSimplexIdTypeArray>::New());
+      levelOffsets.back()->SetNumberOfComponents(1);
+      levelOffsets.back()->SetNumberOfTuples(numberOfVertices);
+      levelOffsets.back()->SetName(
+        (OutputOffsetScalarFieldName + suffix).data());
+      offsetPointers.push_back(levelOffsets.back()->GetVoidPointer(0));
+    }
+
+    topologicalSimplification_.setConstraintPersistencePointer(
+      constraintPersistence_.data());
+    topologicalSimplification_.setPersistenceThresholds(thresholds);
+    topologicalSimplification_.setOutputScalarFieldPointers(scalarPointers);
+    topologicalSimplification_.setOutputOffsetScalarFieldPointers(
+      offsetPointers);
+  }
+
+  // order field of the simplified scalar field, shared with the subsequent
+  // filters (only valid with the default offset field)
+  vtkSmartPointer<ttkSimplexIdTypeArray> outputOrder;
+  if(thresholds.empty()
+     and OutputOffsetScalarFieldName == ttk::OffsetScalarFieldName) {
+    outputOrder = vtkSmartPointer<ttkSimplexIdTypeArray>::New();
+    outputOrder->SetNumberOfComponents(1);
+    outputOrder->SetNumberOfTuples(numberOfVertices);
+    outputOrder->SetName(ttk::OrderScalarFieldName);
+    outputOrder->SetComponentName(0, inputScalars_->GetName());
+    ttkVertexOrder::setOffsetField(outputOrder, outputOffsets);
+  }
+  topologicalSimplification_.setOutputOrderScalarFieldPointer(
+    outputOrder ? outputOrder->GetVoidPointer(0) : nullptr);
+
 #ifndef TTK_ENABLE_KAMIKAZE
   if(identifiers_->GetDataType() != inputOffsets_->GetDataType()) {
     cerr << "[ttkTopologicalSimplification] Error : type of identifiers and "
@@ -378,9 +484,20 @@ int ttkTopologicalSimplification::doIt(vector<vtkDataSet *> &inputs,
 #endif
 
   output->ShallowCopy(domain);
-  output->GetPointData()->AddArray(outputOffsets);
-  output->GetPointData()->AddArray(outputScalars);
+  if(thresholds.empty()) {
+    output->GetPointData()->AddArray(outputOffsets);
+    output->GetPointData()->AddArray(outputScalars);
+  }
+  for(size_t i = 0; i < levelScalars.size(); ++i) {
+    output->GetPointData()->AddArray(levelOffsets[i]);
+    output->GetPointData()->AddArray(levelScalars[i]);
+  }
   outputScalars->Delete();
+  if(outputOrder) {
+    // more recent than the output scalar field (see ttkVertexOrder)
+    outputOrder->Modified();
+    output->GetPointData()->AddArray(outputOrder);
+  }
 
   {
     stringstream msg;
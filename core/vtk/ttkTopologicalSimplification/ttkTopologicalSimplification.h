@@ -24,6 +24,11 @@
 ///
 /// Also, this filter can be given a specific input vertex offset.
 ///
+/// Several simplified scalar fields can also be computed in a single run, one
+/// per persistence threshold (see AddPersistenceThreshold()). The constraints
+/// are then the critical points of a persistence diagram (see
+/// ttkPersistenceDiagram), whose persistence is read from its cells.
+///
 /// \param Input0 Input scalar field, either 2D or 3D, either regular grid or
 /// triangulation (vtkDataSet)
 /// \param Input1 List of critical point constraints (vtkPointSet)
@@ -50,6 +55,7 @@
 #define _TTK_TOPOLOGICALSIMPLIFICATION_H
 
 // VTK includes -- to adapt
+#include <vtkCellData.h>
 #include <vtkCharArray.h>
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
@@ -57,6 +63,7 @@
 #include <vtkDoubleArray.h>
 #include <vtkFiltersCoreModule.h>
 #include <vtkFloatArray.h>
+#include <vtkIdList.h>
 #include <vtkInformation.h>
 #include <vtkIntArray.h>
 #include <vtkObjectFactory.h>
@@ -71,6 +78,7 @@
 #include <ttkWrapper.h>
 
 #include <ttkTriangulation.h>
+#include <ttkVertexOrder.h>
 
 #ifndef TTK_PLUGIN
 class VTKFILTERSCORE_EXPORT ttkTopologicalSimplification
@@ -123,10 +131,26 @@ public:
   vtkSetMacro(PeriodicBoundaryConditions, int);
   vtkGetMacro(PeriodicBoundaryConditions, int);
 
+  /// Add a persistence threshold: if any, one simplified scalar field (and
+  /// offset field) is computed per threshold, maintaining the constraints of
+  /// greater or equal persistence. The output fields are named after the
+  /// input ones, with the suffix "_<i>" for the i-th threshold in increasing
+  /// order.
+  void AddPersistenceThreshold(double threshold) {
+    PersistenceThresholds.push_back(threshold);
+    Modified();
+  }
+
+  void ClearPersistenceThresholds() {
+    PersistenceThresholds.clear();
+    Modified();
+  }
+
   int getTriangulation(vtkDataSet *input);
   int getScalars(vtkDataSet *input);
   int getIdentifiers(vtkPointSet *input);
   int getOffsets(vtkDataSet *input);
+  int getConstraintPersistence(vtkPointSet *input);
 
   template <typename VTK_TT>
   int dispatch();
@@ -152,6 +176,7 @@ private:
   bool PeriodicBoundaryConditions;
   bool ConsiderIdentifierAsBlackList;
   bool AddPerturbation;
+  std::vector<double> PersistenceThresholds;
   bool hasUpdatedMesh_;
 
   ttk::TopologicalSimplification topologicalSimplification_;
@@ -160,6 +185,7 @@ private:
   vtkDataArray *inputScalars_;
   vtkDataArray *offsets_;
   vtkDataArray *inputOffsets_;
+  std::vector<double> constraintPersistence_;
 };
 
 #endif // _TTK_TOPOLOGICALSIMPLIFICATION_H
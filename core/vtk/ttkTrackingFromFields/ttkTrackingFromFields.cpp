@@ -107,6 +107,8 @@ int ttkTrackingFromFields::doIt(std::vector<vtkDataSet *> &inputs,
       case str2int("geometric"):
       case str2int("3"):
       case str2int("parallel"):
+      case str2int("5"):
+      case str2int("auction"):
         useTTKMethod = true;
         break;
       case str2int("4"):
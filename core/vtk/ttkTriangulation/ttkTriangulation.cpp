@@ -4,6 +4,10 @@
 using namespace std;
 using namespace ttk;
 
+map<ttkTriangulation::CacheKey, weak_ptr<Triangulation>>
+  ttkTriangulation::cache_;
+mutex ttkTriangulation::cacheMutex_;
+
 ttkTriangulation::ttkTriangulation() {
 
   inputDataSet_ = NULL;
@@ -32,6 +36,7 @@ int ttkTriangulation::deepCopy(vtkDataObject *other) {
   if((triangulation_) && (hasAllocated_)) {
     delete triangulation_;
   }
+  cachedTriangulation_.reset();
 
   allocate();
 
@@ -42,6 +47,7 @@ int ttkTriangulation::deepCopy(vtkDataObject *other) {
     // the other object has already been enhanced
     // copy the triangulation object from the other
     (*triangulation_) = *(otherTriangulation->triangulation_);
+    cachedTriangulation_ = otherTriangulation->cachedTriangulation_;
   } else {
     triangulation_ = nullptr;
   }
@@ -55,6 +61,51 @@ int ttkTriangulation::deepCopy(vtkDataObject *other) {
   return 0;
 }
 
+int ttkTriangulation::getCacheKey(vtkDataSet *dataSet, CacheKey &key) {
+
+  vtkPoints *points = NULL;
+  vtkCellArray *cells = NULL;
+
+  if(dataSet->GetDataObjectType() == VTK_UNSTRUCTURED_GRID) {
+    points = ((vtkUnstructuredGrid *)dataSet)->GetPoints();
+    cells = ((vtkUnstructuredGrid *)dataSet)->GetCells();
+  } else if(dataSet->GetDataObjectType() == VTK_POLY_DATA) {
+    points = ((vtkPolyData *)dataSet)->GetPoints();
+    cells = ((vtkPolyData *)dataSet)->GetPolys();
+    if((!cells) || (!cells->GetNumberOfCells()))
+      cells = ((vtkPolyData *)dataSet)->GetLines();
+  } else {
+    // implicit triangulations are cheap to build and are not cached
+    return -1;
+  }
+
+  if((!points) || (!points->GetData()) || (!cells)
+     || (!cells->GetNumberOfCells()))
+    return -2;
+
+  // only the geometry and the connectivity are keyed (not the data-set nor
+  // its point data), so that the filters down the pipeline, which
+  // shallow-copy their input, share the same triangulation. The time-stamps
+  // are globally unique and increasing, which protects the cache against
+  // modified arrays and against memory re-use.
+  vtkDataArray *pointArray = points->GetData();
+#if VTK_MAJOR_VERSION >= 9
+  vtkDataArray *connectivityArray = cells->GetConnectivityArray();
+  vtkDataArray *offsetArray = cells->GetOffsetsArray();
+#else
+  // legacy layout: the offsets are stored in the connectivity array
+  vtkDataArray *connectivityArray = cells->GetData();
+  vtkDataArray *offsetArray = NULL;
+#endif
+
+  key[0] = make_pair((void *)pointArray, pointArray->GetMTime());
+  key[1] = make_pair((void *)connectivityArray, connectivityArray->GetMTime());
+  key[2] = make_pair((void *)offsetArray,
+                     offsetArray ? offsetArray->GetMTime() : 0);
+
+  return 0;
+}
+
 Triangulation *ttkTriangulation::getTriangulation(vtkDataSet *other) {
 
   if(!other)
@@ -182,6 +233,25 @@ bool ttkTriangulation::hasChangedConnectivity(Triangulation *triangulation,
   return true;
 }
 
+int ttkTriangulation::setInputCells(const SimplexId &cellNumber,
+                                    vtkCellArray *cells) {
+
+#if VTK_MAJOR_VERSION >= 9
+  // offsets + connectivity layout, passed without conversion nor copy
+  if(cells->IsStorage64Bit()) {
+    return triangulation_->setInputCells(
+      cellNumber, cells->GetConnectivityArray64()->GetPointer(0),
+      cells->GetOffsetsArray64()->GetPointer(0));
+  }
+  return triangulation_->setInputCells(
+    cellNumber, cells->GetConnectivityArray32()->GetPointer(0),
+    cells->GetOffsetsArray32()->GetPointer(0));
+#else
+  // legacy layout (32-bit or 64-bit identifiers), no copy
+  return triangulation_->setInputCells(cellNumber, cells->GetPointer());
+#endif
+}
+
 int ttkTriangulation::setInputData(vtkDataSet *dataSet) {
 
   if(!triangulation_) {
@@ -210,15 +280,8 @@ int ttkTriangulation::setInputData(vtkDataSet *dataSet) {
       }
     }
     if(((vtkUnstructuredGrid *)dataSet)->GetCells()) {
-#if !defined(_WIN32) || defined(_WIN32) && defined(VTK_USE_64BIT_IDS)
-      triangulation_->setInputCells(
-        dataSet->GetNumberOfCells(),
-        ((vtkUnstructuredGrid *)dataSet)->GetCells()->GetPointer());
-#else
-      int *pt = ((vtkUnstructuredGrid *)dataSet)->GetCells()->GetPointer();
-      long long extra_pt = *pt;
-      triangulation_->setInputCells(dataSet->GetNumberOfCells(), &extra_pt);
-#endif
+      setInputCells(dataSet->GetNumberOfCells(),
+                    ((vtkUnstructuredGrid *)dataSet)->GetCells());
     }
     inputDataSet_ = dataSet;
   } else if((dataSet->GetDataObjectType() == VTK_POLY_DATA)) {
@@ -245,27 +308,15 @@ int ttkTriangulation::setInputData(vtkDataSet *dataSet) {
     }
 
     if(((vtkPolyData *)dataSet)->GetPolys()) {
-#if !defined(_WIN32) || defined(_WIN32) && defined(VTK_USE_64BIT_IDS)
-      if(((vtkPolyData *)dataSet)->GetPolys()->GetPointer()) {
+      if(((vtkPolyData *)dataSet)->GetPolys()->GetNumberOfCells()) {
         // 2D
-        triangulation_->setInputCells(
-          dataSet->GetNumberOfCells(),
-          ((vtkPolyData *)dataSet)->GetPolys()->GetPointer());
-      } else if(((vtkPolyData *)dataSet)->GetLines()->GetPointer()) {
-        // 1D
-        triangulation_->setInputCells(
-          dataSet->GetNumberOfCells(),
-          ((vtkPolyData *)dataSet)->GetLines()->GetPointer());
-      }
-#else
-      int *pt = ((vtkPolyData *)dataSet)->GetPolys()->GetPointer();
-      if(!pt) {
+        setInputCells(dataSet->GetNumberOfCells(),
+                      ((vtkPolyData *)dataSet)->GetPolys());
+      } else if(((vtkPolyData *)dataSet)->GetLines()->GetNumberOfCells()) {
         // 1D
-        pt = ((vtkPolyData *)dataSet)->GetLines()->GetPointer();
+        setInputCells(dataSet->GetNumberOfCells(),
+                      ((vtkPolyData *)dataSet)->GetLines());
       }
-      long long extra_pt = *pt;
-      triangulation_->setInputCells(dataSet->GetNumberOfCells(), &extra_pt);
-#endif
     }
     inputDataSet_ = dataSet;
   } else if((dataSet->GetDataObjectType() == VTK_IMAGE_DATA)) {
@@ -311,6 +362,7 @@ int ttkTriangulation::shallowCopy(vtkDataObject *other) {
     delete triangulation_;
   }
   triangulation_ = NULL;
+  cachedTriangulation_.reset();
 
   if((other) && (((vtkDataSet *)other)->GetNumberOfPoints())) {
 
@@ -319,8 +371,9 @@ int ttkTriangulation::shallowCopy(vtkDataObject *other) {
 
     if(otherTriangulation) {
       triangulation_ = otherTriangulation->triangulation_;
+      cachedTriangulation_ = otherTriangulation->cachedTriangulation_;
       hasAllocated_ = false;
-    } else {
+    } else if(useCachedTriangulation((vtkDataSet *)other)) {
       // let's create the object
       allocate();
     }
@@ -334,6 +387,58 @@ int ttkTriangulation::shallowCopy(vtkDataObject *other) {
   return 0;
 }
 
+int ttkTriangulation::useCachedTriangulation(vtkDataSet *dataSet) {
+
+  CacheKey key;
+  if(getCacheKey(dataSet, key))
+    return -1;
+
+  shared_ptr<Triangulation> triangulation;
+
+  {
+    lock_guard<mutex> lock(cacheMutex_);
+
+    auto it = cache_.find(key);
+    if(it != cache_.end())
+      triangulation = it->second.lock();
+
+    if(triangulation) {
+      stringstream msg;
+      msg << "[ttkTriangulation] Re-using cached triangulation (" << dataSet
+          << ")." << endl;
+      dMsg(cout, msg.str(), detailedInfoMsg);
+    } else {
+      // purge the entries of the triangulations which are not used anymore
+      for(auto jt = cache_.begin(); jt != cache_.end();) {
+        if(jt->second.expired())
+          jt = cache_.erase(jt);
+        else
+          jt++;
+      }
+
+      // build the shared triangulation (its execution context is never used,
+      // see ttk::Triangulation::setInputTriangulation())
+      triangulation = make_shared<Triangulation>();
+      triangulation_ = triangulation.get();
+      hasAllocated_ = false;
+      setInputData(dataSet);
+      triangulation_ = NULL;
+      if(triangulation->isEmpty())
+        return -2;
+      cache_[key] = triangulation;
+    }
+  }
+
+  // the current object gets its own ttk::Triangulation (with its own
+  // wrapper, number of threads and debug level) on top of the shared one
+  allocate();
+  triangulation_->setInputTriangulation(*triangulation);
+  cachedTriangulation_ = triangulation;
+  inputDataSet_ = dataSet;
+
+  return 0;
+}
+
 vtkStandardNewMacro(ttkUnstructuredGrid)
 
   ttkUnstructuredGrid::ttkUnstructuredGrid() {
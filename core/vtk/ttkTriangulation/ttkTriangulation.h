@@ -36,6 +36,17 @@
 /// must persist as long as their corresponding ttk::Triangulation object
 /// (unspecified behavior otherwise).
 ///
+/// Explicit triangulations are shared across the pipeline: the
+/// ttk::Triangulation built for a vtkUnstructuredGrid or a vtkPolyData is
+/// cached (keyed on the arrays of its points and cells and on their
+/// modification times) and re-used, along with all its pre-processed
+/// information, by any other TTK filter taking as input a data-set which
+/// shares these arrays (for instance the output of a filter which only adds
+/// point data to its input). Each filter keeps its own execution
+/// context (wrapper, number of threads, debug level) and the
+/// pre-processings of the shared triangulation are serialized (see
+/// ttk::Triangulation::setInputTriangulation()).
+///
 /// \note
 /// Only pre-process the information you need! See the
 /// ttk::Triangulation class documentation.
@@ -46,6 +57,11 @@
 
 // c++ includes
 #include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
 
 // base code includes
 #include <Triangulation.h>
@@ -148,8 +164,19 @@ public:
 protected:
   int deepCopy(vtkDataObject *other);
 
+  /// Pass the cells of \p cells to the internal ttk::Triangulation, in
+  /// their native VTK layout (no conversion, no copy).
+  int setInputCells(const ttk::SimplexId &cellNumber, vtkCellArray *cells);
+
   int shallowCopy(vtkDataObject *other);
 
+  /// Point the current object to the cached triangulation of \p dataSet,
+  /// building and caching it first if needed.
+  /// \param dataSet Input VTK data-set (vtkUnstructuredGrid or vtkPolyData).
+  /// \return Returns 0 upon success, negative values if \p dataSet cannot be
+  /// cached (in which case the current object is left untouched).
+  int useCachedTriangulation(vtkDataSet *dataSet);
+
   bool hasAllocated_;
 
   vtkDataSet *inputDataSet_;
@@ -157,8 +184,18 @@ protected:
   vtkSmartPointer<vtkUnstructuredGrid> vtkUnstructuredGrid_;
 
   ttk::Triangulation *triangulation_;
+  // keeps the cached triangulation (if any) alive
+  std::shared_ptr<ttk::Triangulation> cachedTriangulation_;
 
 private:
+  // (array, time-stamp) of the points, of the cell connectivity and of the
+  // cell offsets (if stored separately)
+  typedef std::array<std::pair<void *, vtkMTimeType>, 3> CacheKey;
+
+  static int getCacheKey(vtkDataSet *dataSet, CacheKey &key);
+
+  static std::map<CacheKey, std::weak_ptr<ttk::Triangulation>> cache_;
+  static std::mutex cacheMutex_;
 };
 
 // Internal things to allow the ttkTriangulation to travel through a VTK
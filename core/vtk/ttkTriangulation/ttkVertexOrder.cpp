@@ -0,0 +1,149 @@
+#include <ttkVertexOrder.h>
+
+#include <VertexOrder.h>
+
+#include <vtkInformation.h>
+#include <vtkPointData.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace ttk;
+
+vtkInformationKeyMacro(ttkVertexOrder, OFFSET_FIELD_NAME, String);
+
+ttkSimplexIdTypeArray *ttkVertexOrder::getOrderField(vtkDataSet *dataSet,
+                                                     vtkDataArray *scalars,
+                                                     vtkDataArray *offsets) {
+
+  if((!dataSet) || (!scalars) || (!scalars->GetName())
+     || (!dataSet->GetPointData()))
+    return nullptr;
+
+  ttkSimplexIdTypeArray *order = ttkSimplexIdTypeArray::SafeDownCast(
+    dataSet->GetPointData()->GetArray(OrderScalarFieldName));
+
+  if((!order) || (order->GetNumberOfComponents() != 1)
+     || (order->GetNumberOfTuples() != scalars->GetNumberOfTuples()))
+    return nullptr;
+
+  // computed from another scalar field
+  const char *scalarFieldName = order->GetComponentName(0);
+  if((!scalarFieldName) || strcmp(scalarFieldName, scalars->GetName()))
+    return nullptr;
+
+  // computed with another offset field (or with an unknown one)
+  vtkInformation *information = order->GetInformation();
+  if((!information) || (!information->Has(OFFSET_FIELD_NAME())))
+    return nullptr;
+  const char *offsetFieldName = information->Get(OFFSET_FIELD_NAME());
+  if(offsets) {
+    if((!offsets->GetName()) || (!offsetFieldName)
+       || strcmp(offsetFieldName, offsets->GetName())
+       || (dataSet->GetPointData()->GetArray(offsets->GetName()) != offsets))
+      return nullptr;
+  } else if((offsetFieldName) && (strlen(offsetFieldName)))
+    return nullptr;
+
+  // the scalar or the offset field has been modified since
+  if(order->GetMTime() < scalars->GetMTime())
+    return nullptr;
+  if((offsets) && (order->GetMTime() < offsets->GetMTime()))
+    return nullptr;
+
+  return order;
+}
+
+int ttkVertexOrder::setOffsetField(ttkSimplexIdTypeArray *order,
+                                   vtkDataArray *offsets) {
+
+  if((!order) || ((offsets) && (!offsets->GetName())))
+    return -1;
+
+  order->GetInformation()->Set(
+    OFFSET_FIELD_NAME(), offsets ? offsets->GetName() : "");
+
+  return 0;
+}
+
+ttkSimplexIdTypeArray *ttkVertexOrder::newOrderField(vtkDataArray *scalars,
+                                                     vtkDataArray *offsets,
+                                                     const int &threadNumber) {
+
+  if((!scalars) || (scalars->GetNumberOfComponents() != 1))
+    return nullptr;
+
+  const SimplexId vertexNumber = scalars->GetNumberOfTuples();
+
+  if((offsets)
+     && ((offsets->GetNumberOfComponents() != 1)
+         || (offsets->GetNumberOfTuples() != vertexNumber)))
+    return nullptr;
+
+  // offsets of the vertices, converted if needed
+  vector<SimplexId> offsetBuffer;
+  const SimplexId *vertexOffsets = nullptr;
+  if(ttkSimplexIdTypeArray::SafeDownCast(offsets)) {
+    vertexOffsets = static_cast<SimplexId *>(offsets->GetVoidPointer(0));
+  } else if(offsets) {
+    offsetBuffer.resize(vertexNumber);
+    for(SimplexId i = 0; i < vertexNumber; ++i)
+      offsetBuffer[i] = offsets->GetTuple1(i);
+    vertexOffsets = offsetBuffer.data();
+  }
+
+  ttkSimplexIdTypeArray *order = ttkSimplexIdTypeArray::New();
+  order->SetNumberOfComponents(1);
+  order->SetNumberOfTuples(vertexNumber);
+  order->SetName(OrderScalarFieldName);
+  if(scalars->GetName())
+    order->SetComponentName(0, scalars->GetName());
+
+  int ret = -1;
+  switch(scalars->GetDataType()) {
+    vtkTemplateMacro(
+      ret = VertexOrder::computeOrder(
+        vertexNumber, static_cast<VTK_TT *>(scalars->GetVoidPointer(0)),
+        vertexOffsets, static_cast<SimplexId *>(order->GetVoidPointer(0)),
+        threadNumber));
+  }
+
+  if(!ret)
+    ret = setOffsetField(order, offsets);
+  if(ret) {
+    order->Delete();
+    return nullptr;
+  }
+
+  order->Modified();
+
+  return order;
+}
+
+ttkSimplexIdTypeArray *
+  ttkVertexOrder::newOrderField(vtkDataArray *scalars,
+                                vtkDataArray *offsets,
+                                const vector<SimplexId> &order) {
+
+  if((!scalars)
+     || ((SimplexId)order.size() != (SimplexId)scalars->GetNumberOfTuples()))
+    return nullptr;
+
+  ttkSimplexIdTypeArray *orderField = ttkSimplexIdTypeArray::New();
+  orderField->SetNumberOfComponents(1);
+  orderField->SetNumberOfTuples(order.size());
+  orderField->SetName(OrderScalarFieldName);
+  if(scalars->GetName())
+    orderField->SetComponentName(0, scalars->GetName());
+
+  std::copy(order.begin(), order.end(),
+            static_cast<SimplexId *>(orderField->GetVoidPointer(0)));
+  if(setOffsetField(orderField, offsets)) {
+    orderField->Delete();
+    return nullptr;
+  }
+  orderField->Modified();
+
+  return orderField;
+}
@@ -0,0 +1,83 @@
+/// \ingroup vtk
+/// \class ttkVertexOrder
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Order fields (see ttk::VertexOrder) attached to VTK data-sets.
+///
+/// The order field of a scalar field stores, for each vertex, its rank in the
+/// order of the scalar values (ties being broken by the offsets). It is
+/// attached to the point data under the name ttk::OrderScalarFieldName, the
+/// name of the scalar field it has been computed from being stored as the
+/// name of its (only) component. The name of the offset field used to break
+/// the ties (empty for the vertex identifiers) is stored in the information
+/// of the order field (OFFSET_FIELD_NAME()).
+///
+/// Filters which have sorted the vertices of a scalar field attach its order
+/// field to their output (newOrderField()). Subsequent filters first look for
+/// an up-to-date order field on their input (getOrderField()), in which case
+/// the sort of the vertices is replaced by a linear-time inversion of the
+/// order field, and vertex comparisons by integer comparisons.
+///
+/// \sa ttk::VertexOrder
+
+#pragma once
+
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkInformationStringKey.h>
+
+#include <ttkWrapper.h>
+
+#include <vector>
+
+class ttkVertexOrder {
+
+public:
+  /// Information key of an order field storing the name of its offset
+  /// field (empty for the vertex identifiers).
+  static vtkInformationStringKey *OFFSET_FIELD_NAME();
+
+  /// Get the order field of a scalar field attached to a data-set.
+  /// \param dataSet Input data-set.
+  /// \param scalars Scalar field (point data of \p dataSet).
+  /// \param offsets Offset field (point data of \p dataSet) used by the
+  /// caller to break ties (NULL: vertex identifiers).
+  /// \return Returns the order field of \p scalars, NULL if \p dataSet has no
+  /// order field for \p scalars and \p offsets or if it is out-dated (the
+  /// scalar or the offset field has been modified since).
+  static ttkSimplexIdTypeArray *getOrderField(vtkDataSet *dataSet,
+                                              vtkDataArray *scalars,
+                                              vtkDataArray *offsets);
+
+  /// Record the offset field an order field has been computed with.
+  /// \param order Order field.
+  /// \param offsets Offset field (NULL: vertex identifiers).
+  /// \return Returns 0 upon success, negative values otherwise.
+  static int setOffsetField(ttkSimplexIdTypeArray *order,
+                            vtkDataArray *offsets);
+
+  /// Create the order field of a scalar field by sorting its vertices.
+  /// \param scalars Scalar field.
+  /// \param offsets Offset field, used to break ties (NULL: vertex
+  /// identifiers).
+  /// \param threadNumber Number of threads.
+  /// \return Returns a new order field (to be deleted by the caller), NULL
+  /// upon failure.
+  static ttkSimplexIdTypeArray *newOrderField(vtkDataArray *scalars,
+                                              vtkDataArray *offsets,
+                                              const int &threadNumber);
+
+  /// Create the order field of a scalar field from the ranks of its
+  /// vertices (for instance computed by ttk::VertexOrder::sortVertices()).
+  /// \param scalars Scalar field.
+  /// \param offsets Offset field the ranks have been computed with (NULL:
+  /// vertex identifiers).
+  /// \param order Rank of each vertex.
+  /// \return Returns a new order field (to be deleted by the caller), NULL
+  /// upon failure.
+  static ttkSimplexIdTypeArray *
+    newOrderField(vtkDataArray *scalars,
+                  vtkDataArray *offsets,
+                  const std::vector<ttk::SimplexId> &order);
+};
@@ -0,0 +1,186 @@
+/// \ingroup examples
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Micro-benchmark of the dense assignment solvers used for the
+/// Wasserstein matching of persistence diagrams.
+///
+/// A sequence of random persistence diagrams (each one being a perturbation
+/// of the previous one, as in the tracking of features over consecutive
+/// time-steps) is matched pair by pair with:
+///  -# ttk::Munkres on a vector of vectors, a new solver being created for
+///  each matching (as formerly done by ttk::BottleneckDistance);
+///  -# ttk::DenseAssignment by shortest augmenting paths on its rectangular
+///  problem, a single solver being reused as a workspace;
+///  -# ttk::DenseAssignment by LAPJV on its square problem.
+
+// include the local headers
+#include <BottleneckDistance.h>
+#include <CommandLineParser.h>
+#include <DenseAssignment.h>
+#include <Munkres.h>
+
+#include <array>
+#include <random>
+
+using Diagram = std::vector<std::array<double, 2>>;
+
+double getDistance(const std::array<double, 2> &p1,
+                   const std::array<double, 2> &p2) {
+  return std::sqrt((p1[0] - p2[0]) * (p1[0] - p2[0])
+                   + (p1[1] - p2[1]) * (p1[1] - p2[1]));
+}
+
+double getDiagonalDistance(const std::array<double, 2> &p) {
+  return std::abs(p[1] - p[0]);
+}
+
+double matchMunkres(const Diagram &diagram1, const Diagram &diagram2) {
+
+  // Munkres expects at most as many rows as columns
+  const bool transpose = diagram1.size() > diagram2.size();
+  const Diagram &rows = transpose ? diagram2 : diagram1;
+  const Diagram &columns = transpose ? diagram1 : diagram2;
+  const int n = rows.size();
+  const int m = columns.size();
+  const double infinity = std::numeric_limits<double>::max();
+
+  std::vector<std::vector<double>> costs(n + 1, std::vector<double>(m + 1));
+  for(int i = 0; i < n; ++i) {
+    for(int j = 0; j < m; ++j) {
+      const double distance = getDistance(rows[i], columns[j]);
+      costs[i][j] = distance > getDiagonalDistance(rows[i])
+                                 + getDiagonalDistance(columns[j])
+                      ? infinity
+                      : distance;
+    }
+    costs[i][m] = getDiagonalDistance(rows[i]);
+  }
+  for(int j = 0; j < m; ++j)
+    costs[n][j] = getDiagonalDistance(columns[j]);
+  costs[n][m] = infinity;
+
+  ttk::Munkres solver;
+  std::vector<std::tuple<int, int, double>> matchings;
+  solver.setInput(n + 1, m + 1, (void *)&costs);
+  solver.run<double>(matchings);
+
+  double cost = 0;
+  for(const auto &matching : matchings)
+    cost += std::get<2>(matching);
+  return cost;
+}
+
+double matchDense(const Diagram &diagram1,
+                  const Diagram &diagram2,
+                  ttk::DenseAssignment &solver) {
+
+  const int n = diagram1.size();
+  const int m = diagram2.size();
+
+  solver.setSize(n, m);
+  for(int i = 0; i < n; ++i) {
+    double *costs = solver.getCostRow(i);
+    for(int j = 0; j < m; ++j) {
+      const double distance = getDistance(diagram1[i], diagram2[j]);
+      costs[j] = distance > getDiagonalDistance(diagram1[i])
+                              + getDiagonalDistance(diagram2[j])
+                   ? std::numeric_limits<double>::infinity()
+                   : distance;
+    }
+    solver.setRowDiagonal(i, getDiagonalDistance(diagram1[i]));
+  }
+  for(int j = 0; j < m; ++j)
+    solver.setColumnDiagonal(j, getDiagonalDistance(diagram2[j]));
+
+  std::vector<std::tuple<int, int, double>> matchings;
+  solver.run(matchings);
+
+  double cost = 0;
+  for(const auto &matching : matchings)
+    cost += std::get<2>(matching);
+  return cost;
+}
+
+int main(int argc, char **argv) {
+
+  int pairNumber = 200, timeStepNumber = 50, lapjvThreshold = 512;
+
+  ttk::CommandLineParser parser;
+
+  // register the arguments to the command line parser
+  parser.setArgument(
+    "n", &pairNumber, "Average number of pairs per diagram", true);
+  parser.setArgument("t", &timeStepNumber, "Number of time-steps", true);
+  parser.setArgument("l", &lapjvThreshold,
+                     "Size (rows + columns) up to which LAPJV is used", true);
+  parser.parse(argc, argv);
+
+  ttk::Debug d;
+
+  // random walk of the pairs, some of them appearing or vanishing at each
+  // time-step
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::normal_distribution<double> perturbation(0, 0.01);
+  std::vector<Diagram> diagrams(timeStepNumber);
+  for(int k = 0; k < timeStepNumber; ++k) {
+    Diagram &diagram = diagrams[k];
+    if(k > 0) {
+      for(const auto &p : diagrams[k - 1]) {
+        if(uniform(generator) < 0.05)
+          continue;
+        const double birth = p[0] + perturbation(generator);
+        const double death = p[1] + perturbation(generator);
+        diagram.push_back({birth, std::max(birth, death)});
+      }
+    }
+    while((int)diagram.size() < pairNumber || uniform(generator) < 0.5) {
+      const double birth = uniform(generator);
+      diagram.push_back({birth, birth + 0.3 * uniform(generator)});
+    }
+  }
+
+  ttk::Timer t;
+  std::vector<double> munkresCosts(timeStepNumber - 1);
+  for(int k = 0; k < timeStepNumber - 1; ++k)
+    munkresCosts[k] = matchMunkres(diagrams[k], diagrams[k + 1]);
+  const double munkresTime = t.getElapsedTime();
+
+  std::array<double, 2> denseTimes;
+  const std::array<std::string, 2> denseNames{
+    "augmenting paths", "LAPJV (all sizes)"};
+  for(int s = 0; s < 2; ++s) {
+    ttk::DenseAssignment solver;
+    solver.setLapjvThreshold(s == 0 ? lapjvThreshold
+                                    : std::numeric_limits<int>::max());
+
+    t.reStart();
+    std::vector<double> denseCosts(timeStepNumber - 1);
+    for(int k = 0; k < timeStepNumber - 1; ++k)
+      denseCosts[k] = matchDense(diagrams[k], diagrams[k + 1], solver);
+    denseTimes[s] = t.getElapsedTime();
+
+    for(int k = 0; k < timeStepNumber - 1; ++k) {
+      if(std::abs(denseCosts[k] - munkresCosts[k])
+         > 1e-9 * std::max(1.0, munkresCosts[k])) {
+        std::stringstream msg;
+        msg << "[main] " << denseNames[s] << ": costs differ at time-step "
+            << k << " (" << denseCosts[k] << " instead of " << munkresCosts[k]
+            << ")!" << std::endl;
+        d.dMsg(std::cerr, msg.str(), d.fatalMsg);
+        return -1;
+      }
+    }
+  }
+
+  std::stringstream msg;
+  msg << "[main] " << timeStepNumber - 1 << " matchings of ~" << pairNumber
+      << " pairs: Munkres " << munkresTime << " s., dense assignment "
+      << denseTimes[0] << " s. (speedup x" << munkresTime / denseTimes[0]
+      << "), LAPJV " << denseTimes[1] << " s. (speedup x"
+      << munkresTime / denseTimes[1] << ")" << std::endl;
+  d.dMsg(std::cout, msg.str(), d.timeMsg);
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/// \ingroup examples
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Benchmark of the (optionally distributed) clustering of
+/// persistence diagrams.
+///
+/// Random persistence diagrams are generated around a few template diagrams
+/// (the same diagrams on every process) and clustered with
+/// ttk::PersistenceDiagramClustering. With a TTK build with TTK_ENABLE_MPI,
+/// the clustering is distributed over the processes of the run, for
+/// instance:
+///
+/// $ mpirun -np 4 ttkDiagramClustering -n 64 -k 4
+///
+/// The process 0 reports the clustering and a checksum of the centroids,
+/// which match those of a single process run.
+
+// include the local headers
+#include <CommandLineParser.h>
+#include <PersistenceDiagramClustering.h>
+
+#include <iomanip>
+#include <random>
+
+template <typename dataType>
+int clusterDiagrams(const int &diagramNumber,
+                    const int &pairNumber,
+                    const int &clusterNumber,
+                    const bool &useAccelerated,
+                    const int &threadNumber,
+                    const int &rank) {
+
+  ttk::Debug d;
+
+  // Each diagram is a perturbation of the template diagram of its group
+  // (local maximum - saddle pairs), generated in the same order on every
+  // process.
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::normal_distribution<double> perturbation(0, 0.02);
+  std::vector<std::vector<std::pair<double, double>>> templates(clusterNumber);
+  for(auto &pairs : templates) {
+    for(int j = 0; j < pairNumber; j++) {
+      const double birth = uniform(generator);
+      pairs.emplace_back(birth, birth + 0.5 * uniform(generator));
+    }
+  }
+
+  std::vector<std::vector<diagramTuple>> diagrams(diagramNumber);
+  for(int i = 0; i < diagramNumber; i++) {
+    for(const auto &pair : templates[i % clusterNumber]) {
+      if(uniform(generator) < 0.1)
+        continue;
+      const dataType birth = pair.first + perturbation(generator);
+      const dataType death
+        = std::max(pair.second + perturbation(generator), birth + 1e-3);
+      diagrams[i].push_back(
+        std::make_tuple(0, ttk::CriticalType::Saddle1, 0,
+                        ttk::CriticalType::Local_maximum, death - birth, 1,
+                        birth, 0.f, 0.f, 0.f, death, 0.f, 0.f, 0.f));
+    }
+  }
+
+  ttk::Timer t;
+
+  ttk::PersistenceDiagramClustering<dataType> clustering;
+  clustering.setWasserstein("2");
+  clustering.setDeterministic(true);
+  clustering.setForceUseOfAlgorithm(false);
+  clustering.setPairTypeClustering(-1);
+  clustering.setNumberOfInputs(diagramNumber);
+  clustering.setDebugLevel(ttk::globalDebugLevel_);
+  clustering.setTimeLimit(std::numeric_limits<double>::max());
+  clustering.setUseProgressive(true);
+  clustering.setThreadNumber(threadNumber);
+  clustering.setAlpha(1);
+  clustering.setDeltaLim(0.01);
+  clustering.setUseDeltaLim(false);
+  clustering.setLambda(1);
+  clustering.setNumberOfClusters(clusterNumber);
+  clustering.setUseAccelerated(useAccelerated);
+  clustering.setUseKmeansppInit(false);
+  clustering.setDistanceWritingOptions(0);
+  clustering.setUseMPI(true);
+  clustering.setDiagrams((void *)&diagrams);
+
+  std::vector<std::vector<diagramTuple>> centroids;
+  std::vector<std::vector<std::vector<matchingTuple>>> matchings;
+  std::vector<int> clusters = clustering.execute(&centroids, &matchings);
+
+  if(rank == 0) {
+    double checksum = 0;
+    for(const auto &centroid : centroids) {
+      for(const auto &pair : centroid) {
+        checksum += std::get<6>(pair) + 2 * std::get<10>(pair);
+      }
+    }
+
+    std::stringstream msg;
+    msg << "[main] Clusters:";
+    for(const auto &c : clusters)
+      msg << " " << c;
+    msg << std::endl
+        << "[main] Centroid checksum: " << std::setprecision(17) << checksum
+        << std::endl;
+    msg << "[main] " << diagramNumber << " diagrams of ~" << pairNumber
+        << " pairs clustered in " << t.getElapsedTime() << " s."
+        << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  return 0;
+}
+
+int main(int argc, char **argv) {
+
+#ifdef TTK_ENABLE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  int diagramNumber = 64, pairNumber = 50, clusterNumber = 4;
+  bool useAccelerated = false;
+
+  ttk::CommandLineParser parser;
+
+  // register the arguments to the command line parser
+  parser.setArgument("n", &diagramNumber, "Number of diagrams", true);
+  parser.setArgument("p", &pairNumber, "Average number of pairs", true);
+  parser.setArgument("k", &clusterNumber, "Number of clusters", true);
+  parser.setOption("a", &useAccelerated, "Accelerated k-means");
+  parser.parse(argc, argv);
+
+  int rank, size;
+  ttk::MPIUtils::getPartition(rank, size);
+
+  const int ret = clusterDiagrams<double>(diagramNumber, pairNumber,
+                                          clusterNumber, useAccelerated,
+                                          ttk::globalThreadNumber_, rank);
+
+#ifdef TTK_ENABLE_MPI
+  MPI_Finalize();
+#endif
+
+  return ret;
+}
@@ -0,0 +1,154 @@
+/// \ingroup examples
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Comparison of the backends of ttk::PersistenceDiagram.
+///
+/// The persistence diagram of a sum of random Gaussian bumps on a regular
+/// grid is computed with the FTM backend and with the discrete gradient
+/// backend. Both timings are reported and the extremum-saddle pairs of both
+/// diagrams are compared:
+///  - the minimum-saddle pairs and the global pair must be identical;
+///  - the saddle-maximum pairs may only differ if the superlevel set of their
+///  saddle reaches the boundary of the grid (see
+///  PersistenceDiagram::computeDiscreteGradientPairs()), hence only the
+///  pairs whose saddle is higher than the boundary are compared.
+///
+/// The program returns a non-zero value if the diagrams differ.
+
+// include the local headers
+#include <CommandLineParser.h>
+#include <PersistenceDiagram.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+
+using Diagram = std::vector<std::tuple<ttk::SimplexId,
+                                       ttk::CriticalType,
+                                       ttk::SimplexId,
+                                       ttk::CriticalType,
+                                       float,
+                                       ttk::SimplexId>>;
+
+int computeDiagram(ttk::Triangulation &grid,
+                   std::vector<float> &scalars,
+                   std::vector<ttk::SimplexId> &offsets,
+                   const ttk::PersistenceDiagram::BACKEND &backend,
+                   Diagram &diagram) {
+
+  ttk::PersistenceDiagram persistenceDiagram;
+  persistenceDiagram.setDebugLevel(ttk::globalDebugLevel_);
+  persistenceDiagram.setThreadNumber(ttk::globalThreadNumber_);
+  persistenceDiagram.setupTriangulation(&grid);
+  persistenceDiagram.setInputScalars(scalars.data());
+  persistenceDiagram.setInputOffsets(offsets.data());
+  persistenceDiagram.setComputeSaddleConnectors(false);
+  persistenceDiagram.setBackend(backend);
+  persistenceDiagram.setOutputCTDiagram(&diagram);
+
+  return persistenceDiagram.execute<float, ttk::SimplexId>();
+}
+
+int main(int argc, char **argv) {
+
+  int gridSize = 64, dimension = 3, bumpNumber = 200;
+
+  ttk::CommandLineParser parser;
+
+  // register the arguments to the command line parser
+  parser.setArgument("n", &gridSize, "Grid size (per dimension)", true);
+  parser.setArgument("D", &dimension, "Grid dimension (2 or 3)", true);
+  parser.setArgument("b", &bumpNumber, "Number of Gaussian bumps", true);
+  parser.parse(argc, argv);
+
+  ttk::Debug d;
+
+  const ttk::SimplexId n = gridSize;
+  const ttk::SimplexId nz = (dimension == 3 ? n : 1);
+  ttk::Triangulation grid;
+  grid.setInputGrid(0, 0, 0, 1, 1, 1, n, n, nz);
+  const ttk::SimplexId vertexNumber = grid.getNumberOfVertices();
+
+  // Gaussian bumps away from the boundary, on a field decreasing towards the
+  // boundary
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> position(0.2 * n, 0.8 * n);
+  std::uniform_real_distribution<float> height(0.5, 1);
+  std::vector<std::array<float, 4>> bumps(bumpNumber);
+  for(auto &b : bumps)
+    b = {position(generator), position(generator),
+         dimension == 3 ? position(generator) : 0, height(generator)};
+  const float sigma2 = 0.0025 * n * n;
+
+  std::vector<float> scalars(vertexNumber);
+  std::vector<ttk::SimplexId> offsets(vertexNumber);
+  float boundaryMaximum = -std::numeric_limits<float>::max();
+  for(ttk::SimplexId v = 0; v < vertexNumber; v++) {
+    const ttk::SimplexId p[3] = {v % n, (v / n) % n, v / (n * n)};
+    float s = 0;
+    for(int k = 0; k < dimension; k++)
+      s -= (p[k] - 0.5f * n) * (p[k] - 0.5f * n) / (n * n);
+    for(const auto &b : bumps) {
+      float d2 = 0;
+      for(int k = 0; k < dimension; k++)
+        d2 += (p[k] - b[k]) * (p[k] - b[k]);
+      s += b[3] * std::exp(-d2 / sigma2);
+    }
+    scalars[v] = s;
+    offsets[v] = v;
+
+    bool isOnBoundary = false;
+    for(int k = 0; k < dimension; k++)
+      isOnBoundary = isOnBoundary or p[k] == 0 or p[k] == n - 1;
+    if(isOnBoundary)
+      boundaryMaximum = std::max(boundaryMaximum, s);
+  }
+
+  Diagram diagrams[2];
+  const ttk::PersistenceDiagram::BACKEND backends[2]
+    = {ttk::PersistenceDiagram::BACKEND::FTM,
+       ttk::PersistenceDiagram::BACKEND::DISCRETE_GRADIENT};
+  const char *backendNames[2] = {"FTM", "discrete gradient"};
+
+  // compared pairs: (birth, death, pair type)
+  std::multiset<std::tuple<ttk::SimplexId, ttk::SimplexId, ttk::SimplexId>>
+    pairs[2];
+
+  for(int b = 0; b < 2; b++) {
+    ttk::Timer t;
+    if(computeDiagram(grid, scalars, offsets, backends[b], diagrams[b]))
+      return -1;
+
+    std::stringstream msg;
+    msg << "[main] " << backendNames[b] << " backend: "
+        << diagrams[b].size() << " pairs in " << t.getElapsedTime() << " s."
+        << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+
+    for(const auto &p : diagrams[b]) {
+      ttk::SimplexId pairType = std::get<5>(p);
+      // the type of the global pair depends on the backend
+      if(std::get<1>(p) == ttk::CriticalType::Local_minimum
+         and std::get<3>(p) == ttk::CriticalType::Local_maximum)
+        pairType = -1;
+      if(pairType == 2 and scalars[std::get<0>(p)] <= boundaryMaximum)
+        continue;
+      if(pairType != 1)
+        pairs[b].emplace(std::get<0>(p), std::get<2>(p), pairType);
+    }
+  }
+
+  const bool isSame = (pairs[0] == pairs[1]);
+  {
+    std::stringstream msg;
+    msg << "[main] " << pairs[0].size() << " / " << pairs[1].size()
+        << " extremum-saddle pairs compared: "
+        << (isSame ? "identical." : "DIFFERENT.") << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  return isSame ? 0 : -2;
+}
@@ -0,0 +1,330 @@
+/// \ingroup examples
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Micro-benchmark of the priority queues driving the sweeps of the
+/// topological simplification algorithms.
+///
+/// The std::set based queues formerly used by ttk::TopologicalSimplification
+/// and ttk::DiscreteGradient are compared to ttk::IndexedHeap on:
+///  -# a synthetic persistence-ordered queue of v-paths, where each pop is
+///  followed by updates of the keys of some queued v-paths (as in
+///  DiscreteGradient::processSaddleMaximumConnections());
+///  -# the sweep of ttk::TopologicalSimplification, grown from the local
+///  minima of a random field on a regular grid and, optionally, of the
+///  height field of a terrain read from an OFF file (for instance
+///  examples/data/inputData.off).
+
+// include the local headers
+#include <CommandLineParser.h>
+#include <DiscreteGradient.h>
+#include <IndexedHeap.h>
+#include <TopologicalSimplification.h>
+
+#include <fstream>
+#include <random>
+#include <set>
+
+using VPathKey = std::pair<float, ttk::SimplexId>;
+using VPathComparator = ttk::dcg::SaddleMaximumVPathComparator<float>;
+using SweepKey = std::tuple<float, ttk::SimplexId, ttk::SimplexId>;
+
+struct VPathUpdate {
+  ttk::SimplexId vpathId;
+  float persistence;
+};
+
+long long processVPathsSet(std::vector<float> persistence,
+                           const std::vector<VPathUpdate> &updates,
+                           const int &updatesPerPop) {
+  std::set<VPathKey, VPathComparator> S;
+  const ttk::SimplexId vpathNumber = persistence.size();
+  for(ttk::SimplexId i = 0; i < vpathNumber; ++i)
+    S.insert(std::make_pair(persistence[i], i));
+
+  long long checkSum = 0;
+  size_t u = 0;
+  for(ttk::SimplexId rank = 0; !S.empty(); ++rank) {
+    auto ptr = S.begin();
+    checkSum += rank * ptr->second;
+    S.erase(ptr);
+    for(int i = 0; i < updatesPerPop and u < updates.size(); ++i, ++u) {
+      const ttk::SimplexId vpathId = updates[u].vpathId;
+      if(S.erase(std::make_pair(persistence[vpathId], vpathId))) {
+        persistence[vpathId] = updates[u].persistence;
+        S.insert(std::make_pair(persistence[vpathId], vpathId));
+      }
+    }
+  }
+
+  return checkSum;
+}
+
+long long processVPathsHeap(std::vector<float> persistence,
+                            const std::vector<VPathUpdate> &updates,
+                            const int &updatesPerPop) {
+  ttk::IndexedHeap<VPathKey, VPathComparator> S;
+  const ttk::SimplexId vpathNumber = persistence.size();
+  S.reserve(vpathNumber, vpathNumber);
+  for(ttk::SimplexId i = 0; i < vpathNumber; ++i)
+    S.push(i, std::make_pair(persistence[i], i));
+
+  long long checkSum = 0;
+  size_t u = 0;
+  for(ttk::SimplexId rank = 0; !S.empty(); ++rank) {
+    checkSum += rank * S.pop();
+    for(int i = 0; i < updatesPerPop and u < updates.size(); ++i, ++u) {
+      const ttk::SimplexId vpathId = updates[u].vpathId;
+      if(S.contains(vpathId)) {
+        persistence[vpathId] = updates[u].persistence;
+        S.update(vpathId, std::make_pair(persistence[vpathId], vpathId));
+      }
+    }
+  }
+
+  return checkSum;
+}
+
+int benchmarkVPaths(const ttk::SimplexId &vpathNumber,
+                    const int &updatesPerPop) {
+
+  ttk::Debug d;
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  std::uniform_int_distribution<ttk::SimplexId> vpathDistribution(
+    0, vpathNumber - 1);
+
+  std::vector<float> persistence(vpathNumber);
+  for(auto &p : persistence)
+    p = distribution(generator);
+  std::vector<VPathUpdate> updates(vpathNumber * updatesPerPop);
+  for(auto &update : updates) {
+    update.vpathId = vpathDistribution(generator);
+    update.persistence = distribution(generator);
+  }
+
+  ttk::Timer t;
+  const long long setSum
+    = processVPathsSet(persistence, updates, updatesPerPop);
+  const double setTime = t.getElapsedTime();
+
+  t.reStart();
+  const long long heapSum
+    = processVPathsHeap(persistence, updates, updatesPerPop);
+  const double heapTime = t.getElapsedTime();
+
+  if(setSum != heapSum) {
+    std::stringstream msg;
+    msg << "[main::benchmarkVPaths] Orders differ!" << std::endl;
+    d.dMsg(std::cerr, msg.str(), d.fatalMsg);
+    return -1;
+  }
+
+  std::stringstream msg;
+  msg << "[main::benchmarkVPaths] " << vpathNumber << " v-paths, "
+      << updatesPerPop << " update(s) per pop: std::set " << setTime
+      << " s., indexed heap " << heapTime << " s., speedup x"
+      << setTime / heapTime << std::endl;
+  d.dMsg(std::cout, msg.str(), d.timeMsg);
+
+  return 0;
+}
+
+template <class frontType>
+long long sweep(ttk::Triangulation &triangulation,
+                const std::vector<float> &scalars,
+                const std::vector<ttk::SimplexId> &offsets,
+                const std::vector<ttk::SimplexId> &seeds,
+                frontType &front) {
+
+  const ttk::SimplexId vertexNumber = triangulation.getNumberOfVertices();
+  std::vector<bool> visitedVertices(vertexNumber, false);
+
+  for(const auto &k : seeds) {
+    front.push(k, std::make_tuple(scalars[k], offsets[k], k));
+    visitedVertices[k] = true;
+  }
+
+  long long checkSum = 0;
+  for(ttk::SimplexId rank = 0; !front.empty(); ++rank) {
+    const ttk::SimplexId vertexId = front.pop();
+    checkSum += rank * vertexId;
+
+    const ttk::SimplexId neighborNumber
+      = triangulation.getVertexNeighborNumber(vertexId);
+    for(ttk::SimplexId j = 0; j < neighborNumber; ++j) {
+      ttk::SimplexId neighbor;
+      triangulation.getVertexNeighbor(vertexId, j, neighbor);
+      if(!visitedVertices[neighbor]) {
+        front.push(neighbor, std::make_tuple(
+                               scalars[neighbor], offsets[neighbor], neighbor));
+        visitedVertices[neighbor] = true;
+      }
+    }
+  }
+
+  return checkSum;
+}
+
+// std::set based sweep front (previous implementation)
+class SetFront {
+public:
+  inline void push(const ttk::SimplexId &, const SweepKey &key) {
+    front_.insert(key);
+  }
+
+  inline ttk::SimplexId pop() {
+    auto front = front_.begin();
+    const ttk::SimplexId vertexId = std::get<2>(*front);
+    front_.erase(front);
+    return vertexId;
+  }
+
+  inline bool empty() const {
+    return front_.empty();
+  }
+
+protected:
+  std::set<SweepKey, ttk::SweepCmp> front_{ttk::SweepCmp(true)};
+};
+
+int benchmarkSweep(const std::string &name,
+                   ttk::Triangulation &triangulation,
+                   const std::vector<float> &scalars) {
+
+  ttk::Debug d;
+
+  const ttk::SimplexId vertexNumber = triangulation.getNumberOfVertices();
+  triangulation.preprocessVertexNeighbors();
+
+  std::vector<ttk::SimplexId> offsets(vertexNumber);
+  for(ttk::SimplexId i = 0; i < vertexNumber; ++i)
+    offsets[i] = i;
+
+  // the sweeps are seeded by the local minima of the field
+  std::vector<ttk::SimplexId> seeds;
+  for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+    bool isMinimum = true;
+    const ttk::SimplexId neighborNumber
+      = triangulation.getVertexNeighborNumber(i);
+    for(ttk::SimplexId j = 0; j < neighborNumber and isMinimum; ++j) {
+      ttk::SimplexId neighbor;
+      triangulation.getVertexNeighbor(i, j, neighbor);
+      if(scalars[neighbor] < scalars[i]
+         or (scalars[neighbor] == scalars[i] and neighbor < i))
+        isMinimum = false;
+    }
+    if(isMinimum)
+      seeds.push_back(i);
+  }
+
+  ttk::Timer t;
+  SetFront setFront;
+  const long long setSum
+    = sweep(triangulation, scalars, offsets, seeds, setFront);
+  const double setTime = t.getElapsedTime();
+
+  t.reStart();
+  ttk::IndexedHeap<SweepKey, ttk::SweepCmp> heapFront(ttk::SweepCmp(true));
+  heapFront.reserve(vertexNumber, 0);
+  const long long heapSum
+    = sweep(triangulation, scalars, offsets, seeds, heapFront);
+  const double heapTime = t.getElapsedTime();
+
+  if(setSum != heapSum) {
+    std::stringstream msg;
+    msg << "[main::benchmarkSweep] " << name << ": sweeps differ!"
+        << std::endl;
+    d.dMsg(std::cerr, msg.str(), d.fatalMsg);
+    return -1;
+  }
+
+  std::stringstream msg;
+  msg << "[main::benchmarkSweep] " << name << " (" << vertexNumber
+      << " vertices, " << seeds.size() << " seeds): std::set " << setTime
+      << " s., indexed heap " << heapTime << " s., speedup x"
+      << setTime / heapTime << std::endl;
+  d.dMsg(std::cout, msg.str(), d.timeMsg);
+
+  return 0;
+}
+
+int loadTerrain(const std::string &inputPath,
+                std::vector<float> &pointSet,
+                std::vector<long long int> &triangleSet) {
+
+  ttk::Debug d;
+
+  std::ifstream f(inputPath.data(), std::ios::in);
+  std::string keyword;
+  if(f)
+    f >> keyword;
+  if(!f or keyword != "OFF") {
+    std::stringstream msg;
+    msg << "[main::loadTerrain] Cannot read OFF file `" << inputPath << "'!"
+        << std::endl;
+    d.dMsg(std::cerr, msg.str(), d.fatalMsg);
+    return -1;
+  }
+
+  int vertexNumber = 0, triangleNumber = 0;
+  f >> vertexNumber >> triangleNumber >> keyword;
+
+  pointSet.resize(3 * vertexNumber);
+  triangleSet.resize(4 * triangleNumber);
+  for(auto &p : pointSet)
+    f >> p;
+  for(auto &t : triangleSet)
+    f >> t;
+
+  return 0;
+}
+
+int main(int argc, char **argv) {
+
+  int gridSize = 64, vpathNumber = 1000000, updatesPerPop = 2;
+  std::string inputPath;
+
+  ttk::CommandLineParser parser;
+
+  // register the arguments to the command line parser
+  parser.setArgument("n", &gridSize, "Grid size (per dimension)", true);
+  parser.setArgument("v", &vpathNumber, "Number of synthetic v-paths", true);
+  parser.setArgument(
+    "u", &updatesPerPop, "Number of key updates per v-path pop", true);
+  parser.setArgument("i", &inputPath, "Path to an input OFF terrain", true);
+  parser.parse(argc, argv);
+
+  benchmarkVPaths(vpathNumber, updatesPerPop);
+
+  // random field on a regular grid (many critical points)
+  const ttk::SimplexId n = gridSize;
+  ttk::Triangulation grid;
+  grid.setInputGrid(0, 0, 0, 1, 1, 1, n, n, n);
+  std::vector<float> randomField(n * n * n);
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  for(auto &s : randomField)
+    s = distribution(generator);
+  benchmarkSweep("random grid", grid, randomField);
+
+  // terrain height field
+  if(!inputPath.empty()) {
+    std::vector<float> pointSet;
+    std::vector<long long int> triangleSet;
+    if(loadTerrain(inputPath, pointSet, triangleSet))
+      return -1;
+
+    ttk::Triangulation terrain;
+    terrain.setInputPoints(pointSet.size() / 3, pointSet.data());
+    terrain.setInputCells(triangleSet.size() / 4, triangleSet.data());
+
+    std::vector<float> height(pointSet.size() / 3);
+    for(size_t i = 0; i < height.size(); ++i)
+      height[i] = pointSet[3 * i + 2];
+    benchmarkSweep("terrain", terrain, height);
+  }
+
+  return 0;
+}
@@ -0,0 +1,238 @@
+/// \ingroup examples
+/// \author agent <agent@local>
+/// \date October 2026.
+///
+/// \brief Micro-benchmark of the vertex neighbor traversal of a regular grid.
+///
+/// The same traversal kernel is run:
+///  -# through the ttk::Triangulation wrapper (one virtual call, plus the
+///  run-time checks if TTK is not built with TTK_ENABLE_KAMIKAZE, per query);
+///  -# on the concrete triangulation type, selected once with
+///  ttkTemplateMacro (inlinable queries).
+///
+/// for the implicit, periodic implicit and explicit representations of a
+/// regular grid. With the option -l, the triangulations are used in lazy
+/// mode (see ttk::Triangulation::setLazyPreprocessing()): the vertex
+/// neighbors are built upon their first query and the dispatched traversal
+/// goes through the ttk::Triangulation wrapper.
+///
+/// The row-major traversal of the implicit grid is also compared to its
+/// cache-blocked traversal (Morton-ordered vertex bricks, with neighbor
+/// stencil look-ups for the interior bricks).
+
+// include the local headers
+#include <CommandLineParser.h>
+#include <Triangulation.h>
+
+template <class triangulationType>
+long long traverse(const triangulationType *triangulation,
+                   const int &repetitions) {
+
+  long long checkSum = 0;
+  const ttk::SimplexId vertexNumber = triangulation->getNumberOfVertices();
+
+  for(int i = 0; i < repetitions; i++) {
+    for(ttk::SimplexId v = 0; v < vertexNumber; v++) {
+      const ttk::SimplexId neighborNumber
+        = triangulation->getVertexNeighborNumber(v);
+      for(ttk::SimplexId j = 0; j < neighborNumber; j++) {
+        ttk::SimplexId neighborId;
+        triangulation->getVertexNeighbor(v, j, neighborId);
+        checkSum += neighborId;
+      }
+    }
+  }
+
+  return checkSum;
+}
+
+long long traverseBricks(const ttk::ImplicitTriangulation *triangulation,
+                         const ttk::SimplexId dimensions[3],
+                         const int &repetitions) {
+
+  long long checkSum = 0;
+  const ttk::SimplexId brickNumber = triangulation->getVertexBrickNumber();
+  const ttk::SimplexId stencilSize
+    = triangulation->getInteriorVertexNeighborNumber();
+
+  for(int i = 0; i < repetitions; i++) {
+    for(ttk::SimplexId b = 0; b < brickNumber; b++) {
+      ttk::SimplexId lower[3], upper[3];
+      bool isInterior;
+      triangulation->getVertexBrick(b, lower, upper, isInterior);
+      for(ttk::SimplexId z = lower[2]; z < upper[2]; z++) {
+        for(ttk::SimplexId y = lower[1]; y < upper[1]; y++) {
+          for(ttk::SimplexId x = lower[0]; x < upper[0]; x++) {
+            const ttk::SimplexId v
+              = x + dimensions[0] * (y + dimensions[1] * z);
+            if(isInterior) {
+              for(ttk::SimplexId j = 0; j < stencilSize; j++)
+                checkSum += triangulation->getInteriorVertexNeighbor(v, j);
+            } else {
+              const ttk::SimplexId neighborNumber
+                = triangulation->getVertexNeighborNumber(v);
+              for(ttk::SimplexId j = 0; j < neighborNumber; j++) {
+                ttk::SimplexId neighborId;
+                triangulation->getVertexNeighbor(v, j, neighborId);
+                checkSum += neighborId;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return checkSum;
+}
+
+int benchmarkBricks(const ttk::SimplexId &n, const int &repetitions) {
+
+  ttk::Debug d;
+
+  ttk::ImplicitTriangulation grid;
+  grid.setInputGrid(0, 0, 0, 1, 1, 1, n, n, n);
+  grid.preprocessVertexBricks();
+
+  const ttk::SimplexId dimensions[3] = {n, n, n};
+
+  ttk::Timer t;
+  const long long rowMajorSum = traverse(&grid, repetitions);
+  const double rowMajorTime = t.getElapsedTime();
+
+  t.reStart();
+  const long long brickedSum = traverseBricks(&grid, dimensions, repetitions);
+  const double brickedTime = t.getElapsedTime();
+
+  if(rowMajorSum != brickedSum) {
+    std::stringstream msg;
+    msg << "[main::benchmarkBricks] Traversals differ!" << std::endl;
+    d.dMsg(std::cerr, msg.str(), d.fatalMsg);
+    return -1;
+  }
+
+  std::stringstream msg;
+  msg << "[main::benchmarkBricks] implicit: row-major " << rowMajorTime
+      << " s., bricked " << brickedTime << " s., speedup x"
+      << rowMajorTime / brickedTime << std::endl;
+  d.dMsg(std::cout, msg.str(), d.timeMsg);
+
+  return 0;
+}
+
+int benchmark(const std::string &name,
+              ttk::Triangulation &triangulation,
+              const int &repetitions,
+              const bool &lazyPreprocessing) {
+
+  ttk::Debug d;
+
+  // in lazy mode, the first query builds the vertex neighbors
+  triangulation.setLazyPreprocessing(lazyPreprocessing);
+  if(!lazyPreprocessing)
+    triangulation.preprocessVertexNeighbors();
+
+  ttk::SimplexId queryNumber = 0;
+  for(ttk::SimplexId v = 0; v < triangulation.getNumberOfVertices(); v++)
+    queryNumber += triangulation.getVertexNeighborNumber(v);
+
+  ttk::Timer t;
+  const long long wrapperSum = traverse(&triangulation, repetitions);
+  const double wrapperTime = t.getElapsedTime();
+
+  t.reStart();
+  long long dispatchedSum = 0;
+  ttkTemplateMacro(
+    triangulation.getDispatchType(),
+    dispatchedSum
+    = traverse(triangulation.getData<TTK_TT>(), repetitions));
+  const double dispatchedTime = t.getElapsedTime();
+
+  if(wrapperSum != dispatchedSum) {
+    std::stringstream msg;
+    msg << "[main::benchmark] " << name << ": traversals differ!" << std::endl;
+    d.dMsg(std::cerr, msg.str(), d.fatalMsg);
+    return -1;
+  }
+
+  const double queries = (double)queryNumber * repetitions / 1e6;
+
+  std::stringstream msg;
+  msg << "[main::benchmark] " << name << ": wrapper " << wrapperTime << " s. ("
+      << queries / wrapperTime << " M queries/s), dispatched "
+      << dispatchedTime << " s. (" << queries / dispatchedTime
+      << " M queries/s), speedup x" << wrapperTime / dispatchedTime
+      << std::endl;
+  d.dMsg(std::cout, msg.str(), d.timeMsg);
+
+  return 0;
+}
+
+int main(int argc, char **argv) {
+
+  int gridSize = 128, repetitions = 10;
+  bool lazyPreprocessing = false;
+
+  ttk::CommandLineParser parser;
+
+  // register the arguments to the command line parser
+  parser.setArgument("n", &gridSize, "Grid size (per dimension)", true);
+  parser.setArgument(
+    "r", &repetitions, "Number of repetitions of the traversal", true);
+  parser.setOption("l", &lazyPreprocessing, "Lazy pre-processing");
+  parser.parse(argc, argv);
+
+  const ttk::SimplexId n = gridSize;
+
+  // implicit and periodic implicit grids
+  ttk::Triangulation implicitGrid;
+  implicitGrid.setInputGrid(0, 0, 0, 1, 1, 1, n, n, n);
+  benchmark("implicit", implicitGrid, repetitions, lazyPreprocessing);
+  benchmarkBricks(n, repetitions);
+
+  ttk::Triangulation periodicGrid;
+  periodicGrid.setInputGrid(0, 0, 0, 1, 1, 1, n, n, n);
+  periodicGrid.setPeriodicBoundaryConditions(true);
+  benchmark("periodic", periodicGrid, repetitions, lazyPreprocessing);
+
+  // explicit grid (6 tetrahedra per voxel)
+  std::vector<float> pointSet(3 * n * n * n);
+  for(ttk::SimplexId k = 0; k < n; k++) {
+    for(ttk::SimplexId j = 0; j < n; j++) {
+      for(ttk::SimplexId i = 0; i < n; i++) {
+        float *p = &pointSet[3 * (i + n * (j + n * k))];
+        p[0] = i;
+        p[1] = j;
+        p[2] = k;
+      }
+    }
+  }
+
+  const int tetrahedra[6][4] = {{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7},
+                                {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}};
+  std::vector<ttk::LongSimplexId> cellSet;
+  cellSet.reserve(30 * (n - 1) * (n - 1) * (n - 1));
+  for(ttk::SimplexId k = 0; k < n - 1; k++) {
+    for(ttk::SimplexId j = 0; j < n - 1; j++) {
+      for(ttk::SimplexId i = 0; i < n - 1; i++) {
+        ttk::LongSimplexId voxel[8];
+        for(int c = 0; c < 8; c++) {
+          voxel[c] = (i + (c & 1))
+                     + n * ((j + ((c >> 1) & 1)) + n * (k + ((c >> 2) & 1)));
+        }
+        for(const auto &tetrahedron : tetrahedra) {
+          cellSet.push_back(4);
+          for(int c = 0; c < 4; c++)
+            cellSet.push_back(voxel[tetrahedron[c]]);
+        }
+      }
+    }
+  }
+
+  ttk::Triangulation explicitGrid;
+  explicitGrid.setInputPoints(n * n * n, pointSet.data());
+  explicitGrid.setInputCells(cellSet.size() / 5, cellSet.data());
+  benchmark("explicit", explicitGrid, repetitions, lazyPreprocessing);
+
+  return 0;
+}